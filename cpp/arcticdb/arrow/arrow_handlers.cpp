@@ -12,8 +12,44 @@
 #include <arcticdb/pipeline/column_mapping.hpp>
 #include <arcticdb/util/sparse_utils.hpp>
 
+#include <algorithm>
+
 namespace arcticdb {
 
+namespace {
+// Writes the Arrow string and offset buffers for a dictionary given as string pool offsets in dictionary order
+template<typename OffsetType>
+void write_arrow_dictionary(
+    Column& dest_column,
+    size_t offset_bytes,
+    const std::vector<OffsetType>& dictionary,
+    const StringPool& string_pool) {
+    int64_t bytes = 0;
+    for(auto string_pool_offset : dictionary)
+        bytes += string_pool.get_const_view(string_pool_offset).size();
+
+    auto& string_buffer = dest_column.create_extra_buffer(offset_bytes, ExtraBufferType::STRING, bytes, AllocationType::DETACHABLE);
+    auto& offsets_buffer = dest_column.create_extra_buffer(offset_bytes, ExtraBufferType::OFFSET, (dictionary.size() + 1) * sizeof(int64_t), AllocationType::DETACHABLE);
+
+    auto offsets_ptr = reinterpret_cast<int64_t*>(offsets_buffer.data());
+    auto string_ptr = reinterpret_cast<char*>(string_buffer.data());
+    auto string_begin_ptr = string_ptr;
+    for(auto i = 0u; i < dictionary.size(); ++i) {
+        offsets_ptr[i] = string_ptr - string_begin_ptr;
+        const auto strv = string_pool.get_const_view(dictionary[i]);
+        memcpy(string_ptr, strv.data(), strv.size());
+        string_ptr += strv.size();
+    }
+    util::check(string_ptr - string_begin_ptr == bytes, "Mismatch in string buffer size");
+    offsets_ptr[dictionary.size()] = bytes;
+}
+
+template<typename CodeType>
+void write_arrow_keys(const CodeType* codes, size_t row_count, int32_t* dest_ptr) {
+    std::transform(codes, codes + row_count, dest_ptr, [](CodeType code) { return static_cast<int32_t>(code); });
+}
+}
+
 void ArrowStringHandler::handle_type(
     const uint8_t *&data,
     Column& dest_column,
@@ -24,10 +60,34 @@ void ArrowStringHandler::handle_type(
     EncodingVersion encoding_version,
     const std::shared_ptr<StringPool>& string_pool) {
     ARCTICDB_SAMPLE(ArrowHandleString, 0)
-    util::check(field.has_ndarray(), "String handler expected array");
+    util::check(field.has_ndarray() || field.has_dictionary(), "String handler expected array or dictionary");
     ARCTICDB_DEBUG(log::version(), "String handler got encoded field: {}", field.DebugString());
-    const auto &ndarray = field.ndarray();
-    const auto bytes = encoding_sizes::data_uncompressed_size(ndarray);
+    if(field.has_dictionary() && field.sparse_map_bytes() == 0) {
+        // The stored dictionary and codes map directly onto an Arrow dictionary array, so there is no need to expand
+        // the codes into string pool offsets and hash them all again
+        if(encoding_version == EncodingVersion::V2)
+            util::check_magic<ColumnMagic>(data);
+
+        const auto dictionary = decode_dictionary_blocks(field, data);
+        auto dest_ptr = reinterpret_cast<int32_t*>(dest_column.bytes_at(m.offset_bytes_, dictionary.row_count_ * sizeof(int32_t)));
+        switch(dictionary.code_width_) {
+        case sizeof(uint8_t):
+            write_arrow_keys(dictionary.codes_.data(), dictionary.row_count_, dest_ptr);
+            break;
+        case sizeof(uint16_t):
+            write_arrow_keys(dictionary.codes_.ptr_cast<uint16_t>(0, dictionary.codes_.bytes()), dictionary.row_count_, dest_ptr);
+            break;
+        case sizeof(uint32_t):
+            write_arrow_keys(dictionary.codes_.ptr_cast<uint32_t>(0, dictionary.codes_.bytes()), dictionary.row_count_, dest_ptr);
+            break;
+        default:
+            util::raise_rte("Unexpected dictionary code width {}", dictionary.code_width_);
+        }
+        write_arrow_dictionary(dest_column, m.offset_bytes_, dictionary.dictionary_, *string_pool);
+        return;
+    }
+
+    const auto bytes = encoding_sizes::decoded_data_size(field);
 
     Column decoded_data{m.source_type_desc_, bytes / get_type_size(m.source_type_desc_.data_type()),
                                        AllocationType::DYNAMIC, Sparsity::PERMITTED};
@@ -56,44 +116,22 @@ void ArrowStringHandler::convert_type(
     auto pos = input_data.cbegin<ArcticStringColumnTag>();
     const auto end = input_data.cend<ArcticStringColumnTag>();
 
-    struct DictEntry {
-        int32_t offset_buffer_pos_;
-        int64_t string_buffer_pos_;
-    };
     std::vector<StringPool::offset_t> unique_offsets_in_order;
-    ankerl::unordered_dense::map<StringPool::offset_t, DictEntry> unique_offsets;
-    int64_t bytes = 0;
+    ankerl::unordered_dense::map<StringPool::offset_t, int32_t> unique_offsets;
     auto dest_ptr = reinterpret_cast<int32_t*>(dest_column.bytes_at(mapping.offset_bytes_, source_column.row_count() * sizeof(int32_t)));
 
-    // First go through the source column once to compute the size of offset and string buffers.
+    // First go through the source column once to assign each distinct string a position in the dictionary.
     while(pos != end) {
-        auto [entry, is_emplaced] = unique_offsets.try_emplace(*pos, DictEntry{static_cast<int32_t>(unique_offsets_in_order.size()), bytes});
-        if(is_emplaced) {
-            bytes += string_pool->get_const_view(*pos).size();
+        auto [entry, is_emplaced] = unique_offsets.try_emplace(*pos, static_cast<int32_t>(unique_offsets_in_order.size()));
+        if(is_emplaced)
             unique_offsets_in_order.push_back(*pos);
-        }
+
         ++pos;
-        *dest_ptr = entry->second.offset_buffer_pos_;
+        *dest_ptr = entry->second;
         ++dest_ptr;
     }
-    auto& string_buffer = dest_column.create_extra_buffer(mapping.offset_bytes_, ExtraBufferType::STRING, bytes, AllocationType::DETACHABLE);
-    auto& offsets_buffer = dest_column.create_extra_buffer(mapping.offset_bytes_, ExtraBufferType::OFFSET, (unique_offsets_in_order.size() + 1) * sizeof(int64_t), AllocationType::DETACHABLE);
-
-    // Then go through unique_offsets to fill up the offset and string buffers.
-    auto offsets_ptr = reinterpret_cast<int64_t*>(offsets_buffer.data());
-    auto string_ptr = reinterpret_cast<char*>(string_buffer.data());
-    auto string_begin_ptr = string_ptr;
-    for(auto i=0u; i<unique_offsets_in_order.size(); ++i) {
-        auto string_pool_offset = unique_offsets_in_order[i];
-        auto& entry = unique_offsets[string_pool_offset];
-        util::check(static_cast<int32_t>(i) == entry.offset_buffer_pos_, "Mismatch in offset buffer pos");
-        util::check(string_ptr - string_begin_ptr == entry.string_buffer_pos_, "Mismatch in string buffer pos");
-        offsets_ptr[i] = entry.string_buffer_pos_;
-        const auto strv = string_pool->get_const_view(string_pool_offset);
-        memcpy(string_ptr, strv.data(), strv.size());
-        string_ptr += strv.size();
-    }
-    offsets_ptr[unique_offsets_in_order.size()] = bytes;
+    // Then fill up the offset and string buffers from the distinct strings.
+    write_arrow_dictionary(dest_column, mapping.offset_bytes_, unique_offsets_in_order, *string_pool);
 }
 
 TypeDescriptor ArrowStringHandler::output_type(const TypeDescriptor&) const {
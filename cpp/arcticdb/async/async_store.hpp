@@ -16,6 +16,10 @@
 #include <arcticdb/async/tasks.hpp>
 #include <arcticdb/processing/clause.hpp>
 #include <arcticdb/storage/key_segment_pair.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/codec/zstd_dictionary.hpp>
+
+#include <tuple>
 
 namespace arcticdb::toolbox::apy{
     class LibraryTool;
@@ -31,9 +35,15 @@ DeDupLookupResult lookup_match_in_dedup_map(
     const std::shared_ptr<DeDupMap> &de_dup_map,
     storage::KeySegmentPair& key_seg);
 
+// Ref keys, version keys and indexes gate everything else an operation does, so are read ahead of bulk data
+inline TaskPriority read_priority(const VariantKey& key) {
+    const auto key_type = variant_key_type(key);
+    return key_type == KeyType::TABLE_DATA || key_type == KeyType::APPEND_DATA ? TaskPriority::LOW : TaskPriority::HIGH;
+}
+
 template <typename Callable>
 auto read_and_continue(const VariantKey& key, std::shared_ptr<storage::Library> library, const storage::ReadKeyOpts& opts, Callable&& c) {
-    return async::submit_io_task(ReadCompressedTask{key, library, opts, std::forward<decltype(c)>(c)})
+    return async::submit_io_task(ReadCompressedTask{key, library, opts, std::forward<decltype(c)>(c)}, read_priority(key))
         .thenValueInline([](auto &&result) mutable {
             auto&& [key_seg_fut, continuation] = std::forward<decltype(result)>(result);
             return std::move(key_seg_fut).thenValueInline([continuation=std::move(continuation)] (storage::KeySegmentPair&& key_seg) mutable { return continuation(std::move(key_seg)); });
@@ -41,6 +51,33 @@ auto read_and_continue(const VariantKey& key, std::shared_ptr<storage::Library>
     );
 }
 
+// As read_and_continue, but holding bytes against the in-flight bytes budget from submission until the continuation
+// has consumed the segment, and queueing the read while the budget is exhausted
+template <typename Callable>
+folly::Future<folly::lift_unit_t<std::invoke_result_t<std::decay_t<Callable>, storage::KeySegmentPair&&>>> read_and_continue_within_budget(
+    const VariantKey& key,
+    std::shared_ptr<storage::Library> library,
+    const storage::ReadKeyOpts& opts,
+    Callable&& c) {
+    using ResultType = folly::lift_unit_t<std::invoke_result_t<std::decay_t<Callable>, storage::KeySegmentPair&&>>;
+    auto& budget = async::in_flight_bytes_budget();
+    if(!budget.enabled())
+        return read_and_continue(key, std::move(library), opts, std::forward<Callable>(c));
+
+    folly::Promise<ResultType> promise;
+    auto future = promise.getFuture();
+    budget.submit([key, library=std::move(library), opts, c=std::forward<Callable>(c), promise=std::move(promise)] (InFlightBytesReservation&& reservation) mutable {
+        std::ignore = read_and_continue(key, library, opts, [c=std::move(c), reservation=std::move(reservation)] (storage::KeySegmentPair&& key_seg) mutable {
+            auto consumed = std::move(reservation);
+            consumed.resize(key_seg.segment().buffer_bytes());
+            return c(std::move(key_seg));
+        }).thenTryInline([promise=std::move(promise)] (folly::Try<ResultType>&& result) mutable {
+            promise.setTry(std::move(result));
+        });
+    });
+    return future;
+}
+
 /*
  * AsyncStore is a wrapper around a Store that provides async methods for writing and reading data.
  * It is used by the VersionStore to write data to the Store asynchronously.
@@ -71,9 +108,10 @@ public:
 
         util::check(segment.descriptor().id() == stream_id, "Descriptor id mismatch in atom key {} != {}", stream_id, segment.descriptor().id());
 
+        auto codec = codec_for(key_type, segment);
         return async::submit_cpu_task(EncodeAtomTask{
             key_type, version_id, stream_id, start_index, end_index, current_timestamp(),
-            std::move(segment), codec_, encoding_version_
+            std::move(segment), std::move(codec), encoding_version_
         }).via(&async::io_executor())
         .thenValue(WriteSegmentTask{library_});
     }
@@ -89,9 +127,10 @@ folly::Future<entity::VariantKey> write(
 
     util::check(segment.descriptor().id() == stream_id, "Descriptor id mismatch in atom key {} != {}", stream_id, segment.descriptor().id());
 
+    auto codec = codec_for(key_type, segment);
     return async::submit_cpu_task(EncodeAtomTask{
         key_type, version_id, stream_id, start_index, end_index, creation_ts,
-        std::move(segment), codec_, encoding_version_
+        std::move(segment), std::move(codec), encoding_version_
     })
         .via(&async::io_executor())
         .thenValue(WriteSegmentTask{library_});
@@ -106,8 +145,9 @@ folly::Future<entity::VariantKey> write(
     const StreamId &stream_id,
     SegmentInMemory &&segment) override {
     util::check(is_ref_key_class(key_type), "Expected ref key type got  {}", key_type);
+    auto codec = codec_for(key_type, segment);
     return async::submit_cpu_task(EncodeRefTask{
-        key_type, stream_id, std::move(segment), codec_, encoding_version_
+        key_type, stream_id, std::move(segment), std::move(codec), encoding_version_
     })
         .via(&async::io_executor())
         .thenValue(WriteSegmentTask{library_});
@@ -138,9 +178,10 @@ entity::VariantKey write_sync(
                 stream_id,
                 segment.descriptor().id());
 
+    auto codec = codec_for(key_type, segment);
     auto encoded = EncodeAtomTask{
         key_type, version_id, stream_id, start_index, end_index, current_timestamp(),
-        std::move(segment), codec_, encoding_version_
+        std::move(segment), std::move(codec), encoding_version_
     }();
     return WriteSegmentTask{library_}(std::move(encoded));
 }
@@ -154,7 +195,8 @@ entity::VariantKey write_sync(
     const StreamId &stream_id,
     SegmentInMemory &&segment) override {
     util::check(is_ref_key_class(key_type), "Expected ref key type got  {}", key_type);
-    auto encoded = EncodeRefTask{key_type, stream_id, std::move(segment), codec_, encoding_version_}();
+    auto codec = codec_for(key_type, segment);
+    auto encoded = EncodeRefTask{key_type, stream_id, std::move(segment), std::move(codec), encoding_version_}();
     return WriteSegmentTask{library_}(std::move(encoded));
 }
 
@@ -163,7 +205,8 @@ entity::VariantKey write_if_none_sync(
         const StreamId &stream_id,
         SegmentInMemory &&segment) override {
     util::check(is_ref_key_class(key_type), "Expected ref key type got  {}", key_type);
-    auto encoded = EncodeRefTask{key_type, stream_id, std::move(segment), codec_, encoding_version_}();
+    auto codec = codec_for(key_type, segment);
+    auto encoded = EncodeRefTask{key_type, stream_id, std::move(segment), std::move(codec), encoding_version_}();
     return WriteIfNoneTask{library_}(std::move(encoded));
 }
 
@@ -188,8 +231,9 @@ folly::Future<entity::VariantKey> update(const entity::VariantKey &key,
                 stream_id,
                 segment.descriptor().id());
 
+    auto codec = codec_for(variant_key_type(key), segment);
     return async::submit_cpu_task(EncodeSegmentTask{
-        key, std::move(segment), codec_, encoding_version_
+        key, std::move(segment), std::move(codec), encoding_version_
     })
         .via(&async::io_executor())
         .thenValue(UpdateSegmentTask{library_, opts});
@@ -386,9 +430,22 @@ std::vector<folly::Future<VariantKey>> batch_read_compressed(
         std::vector<std::pair<entity::VariantKey, ReadContinuation>> &&keys_and_continuations,
         const BatchReadArgs &args) override {
     util::check(!keys_and_continuations.empty(), "Unexpected empty keys/continuation vector in batch_read_compressed");
+    if (library_->supports_batch_operations()) {
+        std::vector<entity::VariantKey> keys;
+        keys.reserve(keys_and_continuations.size());
+        for (const auto& key_and_continuation : keys_and_continuations)
+            keys.emplace_back(key_and_continuation.first);
+
+        // Keeps to around args.batch_size_ reads in flight, as the window below does for individual reads
+        const auto max_batches_in_flight = std::max(size_t{1}, args.batch_size_ / read_batch_size());
+        auto continuations = std::make_shared<std::vector<std::pair<entity::VariantKey, ReadContinuation>>>(std::move(keys_and_continuations));
+        return read_batched(std::move(keys), max_batches_in_flight, [continuations] (folly::Future<storage::KeySegmentPair>&& read, size_t idx) {
+            return std::move(read).thenValueInline(std::move((*continuations)[idx].second));
+        });
+    }
     return folly::window(std::move(keys_and_continuations), [this] (auto&& key_and_continuation) {
         auto [key, continuation] = std::forward<decltype(key_and_continuation)>(key_and_continuation);
-        return read_and_continue(key, library_, storage::ReadKeyOpts{}, std::move(continuation));
+        return read_and_continue_within_budget(key, library_, storage::ReadKeyOpts{}, std::move(continuation));
     }, args.batch_size_);
 }
 
@@ -397,9 +454,24 @@ std::vector<folly::Future<pipelines::SegmentAndSlice>> batch_read_uncompressed(
         std::shared_ptr<std::unordered_set<std::string>> columns_to_decode) override {
     ARCTICDB_RUNTIME_DEBUG(log::version(), "Reading {} keys", ranges_and_keys.size());
     std::vector<folly::Future<pipelines::SegmentAndSlice>> output;
+    if (library_->supports_batch_operations()) {
+        std::vector<entity::VariantKey> keys;
+        keys.reserve(ranges_and_keys.size());
+        for (const auto& ranges_and_key : ranges_and_keys)
+            keys.emplace_back(ranges_and_key.key_);
+
+        // As with individual reads, only the in-flight bytes budget limits the reads issued
+        const auto num_batches = (keys.size() + read_batch_size() - 1) / read_batch_size();
+        auto shared_ranges_and_keys = std::make_shared<std::vector<pipelines::RangesAndKey>>(std::move(ranges_and_keys));
+        return read_batched(std::move(keys), std::max(size_t{1}, num_batches), [shared_ranges_and_keys, columns_to_decode] (folly::Future<storage::KeySegmentPair>&& read, size_t idx) {
+            return std::move(read)
+                .via(async::cpu_executor_with_priority(TaskPriority::HIGH))
+                .thenValue(DecodeSliceTask{std::move((*shared_ranges_and_keys)[idx]), columns_to_decode});
+        });
+    }
     for(auto&& ranges_and_key : ranges_and_keys) {
         const auto key = ranges_and_key.key_;
-        output.emplace_back(read_and_continue(
+        output.emplace_back(read_and_continue_within_budget(
             key,
             library_,
             storage::ReadKeyOpts{},
@@ -423,11 +495,12 @@ folly::Future<SliceAndKey> async_write(
             const std::shared_ptr<DeDupMap> &de_dup_map) override {
         return std::move(input_fut).thenValue([this] (auto&& input) {
             auto [key, seg, slice] = std::forward<decltype(input)>(input);
+            auto codec = codec_for(key.key_type, seg);
             auto key_seg = EncodeAtomTask{
                 std::move(key),
                 ClockType::nanos_since_epoch(),
                 std::move(seg),
-                codec_,
+                std::move(codec),
                 encoding_version_}();
             return std::pair<storage::KeySegmentPair, FrameSlice>(std::move(key_seg), std::move(slice));
         })
@@ -452,14 +525,88 @@ folly::Future<SliceAndKey> async_write(
         library_->set_failure_sim(cfg);
     }
 
+    void set_zstd_dictionary(std::shared_ptr<const ZstdDictionary> dictionary) override {
+        ZstdDictionaries::instance()->add(dictionary);
+        auto codec = std::make_shared<arcticdb::proto::encoding::VariantCodec>(zstd_dictionary_codec(*dictionary));
+        std::lock_guard lock(dictionary_codec_mutex_);
+        dictionary_codec_ = std::move(codec);
+    }
+
     std::string name() const override {
         return library_->name();
     }
 
 private:
+    std::shared_ptr<arcticdb::proto::encoding::VariantCodec> codec_for(KeyType key_type, const SegmentInMemory& segment) const {
+        std::lock_guard lock(dictionary_codec_mutex_);
+        return dictionary_codec_ && uses_zstd_dictionary(key_type, segment) ? dictionary_codec_ : codec_;
+    }
+
+    static size_t read_batch_size() {
+        return static_cast<size_t>(std::max(int64_t{1}, ConfigsMap::instance()->get_int("Storage.ReadBatchSize", 64)));
+    }
+
+    /*
+     * Reads the keys in batches of Storage.ReadBatchSize, each batch with a single read_batch call on an IO thread.
+     * continue_read is applied to the read of each key along with its position in keys. As with
+     * read_and_continue_within_budget, a batch is only issued once the in-flight bytes budget admits all of its reads,
+     * and each read holds its bytes until the future returned by continue_read completes. At most
+     * max_batches_in_flight batches are read and continued at a time.
+     */
+    template <typename ContinueRead>
+    auto read_batched(std::vector<entity::VariantKey>&& keys, size_t max_batches_in_flight, ContinueRead&& continue_read) {
+        using ResultType = typename std::invoke_result_t<std::decay_t<ContinueRead>&, folly::Future<storage::KeySegmentPair>&&, size_t>::value_type;
+        const auto batch_size = read_batch_size();
+        auto promises = std::make_shared<std::vector<folly::Promise<ResultType>>>(keys.size());
+        std::vector<folly::Future<ResultType>> output;
+        output.reserve(keys.size());
+        for (auto& promise : *promises)
+            output.emplace_back(promise.getFuture());
+
+        std::vector<size_t> batch_starts;
+        for (size_t start = 0; start < keys.size(); start += batch_size)
+            batch_starts.emplace_back(start);
+
+        // Results are delivered through the promises, the futures returned by window only pace the batches
+        auto shared_keys = std::make_shared<std::vector<entity::VariantKey>>(std::move(keys));
+        auto shared_continue_read = std::make_shared<std::decay_t<ContinueRead>>(std::forward<ContinueRead>(continue_read));
+        std::ignore = folly::window(std::move(batch_starts), [this, shared_keys, promises, batch_size, shared_continue_read] (size_t start) {
+            const auto end = std::min(shared_keys->size(), start + batch_size);
+            folly::Promise<folly::Unit> batch_done;
+            auto batch_done_future = batch_done.getFuture();
+            async::in_flight_bytes_budget().submit_batch(end - start, [this, shared_keys, promises, start, end, shared_continue_read, batch_done=std::move(batch_done)] (std::vector<InFlightBytesReservation>&& reservations) mutable {
+                std::vector<folly::Promise<storage::KeySegmentPair>> read_promises(end - start);
+                std::vector<folly::Future<folly::Unit>> continued;
+                continued.reserve(end - start);
+                for (size_t idx = start; idx < end; ++idx) {
+                    auto reservation = std::make_shared<InFlightBytesReservation>(std::move(reservations[idx - start]));
+                    auto read = read_promises[idx - start].getFuture().thenValueInline([reservation] (storage::KeySegmentPair&& key_seg) {
+                        reservation->resize(key_seg.segment().buffer_bytes());
+                        return std::move(key_seg);
+                    });
+                    continued.emplace_back((*shared_continue_read)(std::move(read), idx).thenTryInline([reservation, promise=std::move((*promises)[idx])] (folly::Try<ResultType>&& result) mutable {
+                        reservation.reset();
+                        promise.setTry(std::move(result));
+                    }));
+                }
+                std::vector<entity::VariantKey> batch_keys{shared_keys->begin() + start, shared_keys->begin() + end};
+                const auto priority = read_priority(batch_keys.front());
+                std::ignore = async::submit_io_task(ReadCompressedBatchTask{std::move(batch_keys), std::move(read_promises), library_, storage::ReadKeyOpts{}}, priority);
+                std::ignore = folly::collectAll(std::move(continued)).thenValueInline([batch_done=std::move(batch_done)] (auto&&) mutable {
+                    batch_done.setValue();
+                });
+            });
+            return batch_done_future;
+        }, max_batches_in_flight);
+        return output;
+    }
+
     friend class arcticdb::toolbox::apy::LibraryTool;
     std::shared_ptr<storage::Library> library_;
     std::shared_ptr<arcticdb::proto::encoding::VariantCodec> codec_;
+    // The codec for the segments that use the library's ZSTD dictionary, if it has one
+    std::shared_ptr<arcticdb::proto::encoding::VariantCodec> dictionary_codec_;
+    mutable std::mutex dictionary_codec_mutex_;
     const EncodingVersion encoding_version_;
 };
 
@@ -6,6 +6,10 @@
  */
 
 #include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <atomic>
+#include <latch>
 
 namespace arcticdb::async {
 
@@ -57,6 +61,190 @@ TaskSchedulerPtrWrapper::~TaskSchedulerPtrWrapper() {
     delete ptr_;
 }
 
+InFlightBytesReservation::~InFlightBytesReservation() {
+    if(budget_ != nullptr)
+        budget_->release(bytes_);
+}
+
+void InFlightBytesReservation::resize(size_t bytes) {
+    if(budget_ != nullptr)
+        budget_->resize(bytes_, bytes);
+
+    bytes_ = bytes;
+}
+
+void InFlightBytesBudget::submit(Submission&& submission) {
+    submit_batch(1, [submission=std::move(submission)] (std::vector<InFlightBytesReservation>&& reservations) mutable {
+        submission(std::move(reservations.front()));
+    });
+}
+
+void InFlightBytesBudget::submit_batch(size_t reads, BatchSubmission&& submission) {
+    util::check(reads > 0, "Cannot submit an empty batch of reads to the in-flight bytes budget");
+    if(!enabled()) {
+        std::vector<InFlightBytesReservation> reservations;
+        reservations.reserve(reads);
+        for(size_t i = 0; i < reads; ++i)
+            reservations.emplace_back(nullptr, 0);
+
+        submission(std::move(reservations));
+        return;
+    }
+
+    std::unique_lock lock{mutex_};
+    queued_.emplace_back(std::move(submission), reads);
+    run_admitted(lock);
+}
+
+size_t InFlightBytesBudget::in_flight_bytes() const {
+    std::lock_guard lock{mutex_};
+    return in_flight_bytes_;
+}
+
+size_t InFlightBytesBudget::queued_submissions() const {
+    std::lock_guard lock{mutex_};
+    return queued_.size();
+}
+
+void InFlightBytesBudget::resize(size_t from, size_t to) {
+    std::unique_lock lock{mutex_};
+    in_flight_bytes_ = in_flight_bytes_ - from + to;
+    ++reads_sized_;
+    bytes_sized_ += to;
+    run_admitted(lock);
+}
+
+void InFlightBytesBudget::release(size_t bytes) {
+    std::unique_lock lock{mutex_};
+    debug::check<ErrorCode::E_ASSERTION_FAILURE>(bytes <= in_flight_bytes_,
+        "Releasing {} bytes from in-flight budget holding only {}", bytes, in_flight_bytes_);
+    in_flight_bytes_ -= std::min(bytes, in_flight_bytes_);
+    try {
+        run_admitted(lock);
+    } catch (const std::exception& e) {
+        // Called from reservation destructors, the submissions are responsible for reporting their own failures
+        log::schedule().error("Failed to run submission admitted to in-flight bytes budget: {}", e.what());
+    }
+}
+
+size_t InFlightBytesBudget::read_estimate_bytes() const {
+    return reads_sized_ == 0 ? initial_read_estimate_bytes : bytes_sized_ / reads_sized_;
+}
+
+bool InFlightBytesBudget::can_admit(size_t bytes) const {
+    return in_flight_bytes_ == 0 || in_flight_bytes_ + bytes <= limit_bytes_;
+}
+
+void InFlightBytesBudget::run_admitted(std::unique_lock<std::mutex>& lock) {
+    std::vector<std::tuple<BatchSubmission, size_t, size_t>> admitted;
+    while(!queued_.empty()) {
+        const auto estimate = read_estimate_bytes();
+        const auto reads = queued_.front().second;
+        if(!can_admit(estimate * reads))
+            break;
+
+        in_flight_bytes_ += estimate * reads;
+        admitted.emplace_back(std::move(queued_.front().first), reads, estimate);
+        queued_.pop_front();
+    }
+    ARCTICDB_DEBUG(log::schedule(), "Admitting {} reads to in-flight bytes budget, {} of {} bytes in flight with {} queued",
+                   admitted.size(), in_flight_bytes_, limit_bytes_, queued_.size());
+
+    // Submissions release their reservations themselves, so must run without the lock held. A submission that throws
+    // releases its reservation when the exception unwinds, and must not stop the other admitted submissions running
+    lock.unlock();
+    std::exception_ptr first_error;
+    for(auto& [submission, reads, estimate] : admitted) {
+        try {
+            std::vector<InFlightBytesReservation> reservations;
+            reservations.reserve(reads);
+            for(size_t i = 0; i < reads; ++i)
+                reservations.emplace_back(this, estimate);
+
+            submission(std::move(reservations));
+        } catch (...) {
+            if(!first_error)
+                first_error = std::current_exception();
+        }
+    }
+    if(first_error)
+        std::rethrow_exception(first_error);
+}
+
+namespace {
+
+class CpuPoolGroups {
+public:
+    CpuPoolGroups(size_t num_groups, std::function<void(size_t)>&& run_group) :
+        num_groups_(num_groups),
+        run_group_(std::move(run_group)),
+        remaining_(static_cast<std::ptrdiff_t>(num_groups)) {
+    }
+
+    ARCTICDB_NO_MOVE_OR_COPY(CpuPoolGroups)
+
+    void run_remaining_groups() {
+        for (auto group = next_group_++; group < num_groups_; group = next_group_++) {
+            try {
+                run_group_(group);
+            } catch (...) {
+                std::lock_guard lock{mutex_};
+                if (!exception_)
+                    exception_ = std::current_exception();
+            }
+            remaining_.count_down();
+        }
+    }
+
+    // Runs any unclaimed groups on this thread, then waits for the groups claimed by other threads
+    void run_and_wait() {
+        run_remaining_groups();
+        remaining_.wait();
+        if (exception_)
+            std::rethrow_exception(exception_);
+    }
+
+private:
+    const size_t num_groups_;
+    const std::function<void(size_t)> run_group_;
+    std::atomic<size_t> next_group_ = 0;
+    std::latch remaining_;
+    std::mutex mutex_;
+    std::exception_ptr exception_;
+};
+
+struct RunCpuPoolGroupsTask : BaseTask {
+    std::shared_ptr<CpuPoolGroups> groups_;
+
+    explicit RunCpuPoolGroupsTask(std::shared_ptr<CpuPoolGroups> groups) :
+        groups_(std::move(groups)) {
+    }
+
+    ARCTICDB_MOVE_ONLY_DEFAULT(RunCpuPoolGroupsTask)
+
+    folly::Unit operator()() {
+        groups_->run_remaining_groups();
+        return folly::Unit{};
+    }
+};
+
+} // namespace
+
+void run_groups_on_cpu_pool(size_t num_groups, std::function<void(size_t)>&& run_group, TaskPriority priority) {
+    if (num_groups <= 1) {
+        if (num_groups == 1)
+            run_group(0);
+
+        return;
+    }
+
+    auto groups = std::make_shared<CpuPoolGroups>(num_groups, std::move(run_group));
+    for (size_t group = 1; group < num_groups; ++group)
+        (void)submit_cpu_task(RunCpuPoolGroupsTask{groups}, priority);
+
+    groups->run_and_wait();
+}
+
 void print_scheduler_stats() {
     auto cpu_stats = TaskScheduler::instance()->cpu_exec().getPoolStats();
     log::schedule().info("CPU: Threads: {}\tIdle: {}\tActive: {}\tPending: {}\tTotal: {}\tMaxIdleTime: {}",
@@ -20,15 +20,20 @@
 
 #include <folly/executors/FutureExecutor.h>
 #include <folly/executors/CPUThreadPoolExecutor.h>
-#include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/executors/ExecutorWithPriority.h>
+#include <folly/executors/task_queue/PriorityUnboundedBlockingQueue.h>
+#include <folly/Function.h>
 
 #include <thread>
 #include <algorithm>
+#include <deque>
 #include <filesystem>
+#include <functional>
 #include <string>
 #include <fstream>
 #include <fmt/format.h>
 #include <type_traits>
+#include <vector>
 
 namespace arcticdb::async {
 class TaskScheduler;
@@ -165,46 +170,154 @@ inline auto get_default_num_cpus([[maybe_unused]] const std::string& cgroup_fold
     #endif
 }
 
+/*
+ * Tasks in each pool are taken from a priority queue, so that the work gating everything else is done first:
+ * reads of ref keys, version keys and indexes ahead of bulk reads of data keys, and decoding of segments that have
+ * already been fetched ahead of anything else waiting for a CPU thread. Continuations scheduled with via() run at
+ * NORMAL priority.
+ */
+enum class TaskPriority : int8_t {
+    LOW = folly::Executor::LO_PRI,
+    NORMAL = folly::Executor::MID_PRI,
+    HIGH = folly::Executor::HI_PRI
+};
+
+constexpr uint8_t num_task_priorities = 3;
+
+class InFlightBytesBudget;
+
+// Bytes held against an InFlightBytesBudget by a single read, released on destruction
+class InFlightBytesReservation {
+public:
+    InFlightBytesReservation(InFlightBytesBudget* budget, size_t bytes) :
+        budget_(budget),
+        bytes_(bytes) {
+    }
+
+    InFlightBytesReservation(InFlightBytesReservation&& other) noexcept :
+        budget_(std::exchange(other.budget_, nullptr)),
+        bytes_(other.bytes_) {
+    }
+
+    InFlightBytesReservation(const InFlightBytesReservation&) = delete;
+    InFlightBytesReservation& operator=(const InFlightBytesReservation&) = delete;
+    InFlightBytesReservation& operator=(InFlightBytesReservation&&) = delete;
+
+    ~InFlightBytesReservation();
+
+    // Replaces the estimate reserved on admission with the actual size of the read, once known
+    void resize(size_t bytes);
+
+    [[nodiscard]] size_t bytes() const {
+        return bytes_;
+    }
+
+private:
+    InFlightBytesBudget* budget_;
+    size_t bytes_;
+};
+
+/*
+ * Global limit on the bytes of storage reads that have been issued but not yet consumed, applying memory backpressure
+ * to large batch reads which would otherwise issue all of their IO up front. Submissions are run immediately while
+ * the bytes in flight are within the limit, otherwise they are queued and run in order as earlier reads release
+ * their reservations. The size of a read is only known once it completes, so each read reserves the mean size of
+ * the reads seen so far, which it corrects with InFlightBytesReservation::resize. A single submission is always
+ * admitted when nothing is in flight, so that reads larger than the limit still make progress.
+ *
+ * A limit of zero disables the budget.
+ */
+class InFlightBytesBudget {
+public:
+    using Submission = folly::Function<void(InFlightBytesReservation&&)>;
+    using BatchSubmission = folly::Function<void(std::vector<InFlightBytesReservation>&&)>;
+
+    static constexpr size_t initial_read_estimate_bytes = 16 * 1024 * 1024;
+
+    explicit InFlightBytesBudget(size_t limit_bytes) :
+        limit_bytes_(limit_bytes) {
+    }
+
+    void submit(Submission&& submission);
+
+    // Admits reads that are issued together, such as a single read_batch call, once the estimated bytes of all of
+    // them fit within the limit. Each read gets its own reservation, to be resized and released independently.
+    void submit_batch(size_t reads, BatchSubmission&& submission);
+
+    [[nodiscard]] bool enabled() const {
+        return limit_bytes_ > 0;
+    }
+
+    [[nodiscard]] size_t limit_bytes() const {
+        return limit_bytes_;
+    }
+
+    [[nodiscard]] size_t in_flight_bytes() const;
+
+    [[nodiscard]] size_t queued_submissions() const;
+
+private:
+    friend class InFlightBytesReservation;
+
+    void resize(size_t from, size_t to);
+    void release(size_t bytes);
+    [[nodiscard]] size_t read_estimate_bytes() const;
+    [[nodiscard]] bool can_admit(size_t bytes) const;
+    void run_admitted(std::unique_lock<std::mutex>& lock);
+
+    const size_t limit_bytes_;
+    mutable std::mutex mutex_;
+    size_t in_flight_bytes_ = 0;
+    size_t reads_sized_ = 0;
+    size_t bytes_sized_ = 0;
+    std::deque<std::pair<BatchSubmission, size_t>> queued_;
+};
+
 /*
  * Possible areas of inprovement in the future:
  * 1/ Task/op decoupling: push task and then use strategy to implement smart batching to
  * amortize costs wherever possible
  * 2/ Worker thread Affinity - would better locality improve throughput by keeping hot structure in
  * hot cachelines and not jumping from one thread to the next (assuming thread/core affinity in hw too) ?
- * 3/ Priority: How to assign priorities to task in order to treat the most pressing first.
- * 4/ Throttling: (similar to priority) how to absorb work spikes and apply memory backpressure
+ * 3/ Priority: tasks are submitted with a TaskPriority, but priorities are fixed per task type rather than, for
+ * example, favouring the query that is closest to completion.
+ * 4/ Throttling: the InFlightBytesBudget bounds the storage reads waiting to be decoded, but not the decoded segments
+ * waiting for clause processing.
  */
 class TaskScheduler {
   public:
+    // Both pools are CPUThreadPoolExecutors so that their tasks share a single priority queue, the IO pool's threads
+    // only block on storage and so do not need the per-thread event bases of an IOThreadPoolExecutor
     using CPUSchedulerType = folly::FutureExecutor<folly::CPUThreadPoolExecutor>;
-    using IOSchedulerType = folly::FutureExecutor<folly::IOThreadPoolExecutor>;
+    using IOSchedulerType = folly::FutureExecutor<folly::CPUThreadPoolExecutor>;
 
      explicit TaskScheduler(const std::optional<size_t>& cpu_thread_count = std::nullopt, const std::optional<size_t>& io_thread_count = std::nullopt) :
         cgroup_folder_("/sys/fs/cgroup"),
         cpu_thread_count_(cpu_thread_count ? *cpu_thread_count : ConfigsMap::instance()->get_int("VersionStore.NumCPUThreads", get_default_num_cpus(cgroup_folder_))),
         io_thread_count_(io_thread_count ? *io_thread_count : ConfigsMap::instance()->get_int("VersionStore.NumIOThreads", (int) (cpu_thread_count_ * 1.5))),
-        cpu_exec_(cpu_thread_count_, std::make_shared<InstrumentedNamedFactory>("CPUPool")) ,
-        io_exec_(io_thread_count_,  std::make_shared<InstrumentedNamedFactory>("IOPool")){
+        cpu_exec_(cpu_thread_count_, make_priority_queue(), std::make_shared<InstrumentedNamedFactory>("CPUPool")) ,
+        io_exec_(io_thread_count_, make_priority_queue(), std::make_shared<InstrumentedNamedFactory>("IOPool")),
+        in_flight_bytes_budget_(static_cast<size_t>(std::max(int64_t{0}, ConfigsMap::instance()->get_int("VersionStore.MaxInFlightBytes", 0)))) {
         util::check(cpu_thread_count_ > 0 && io_thread_count_ > 0, "Zero IO or CPU threads: {} {}", io_thread_count_, cpu_thread_count_);
         ARCTICDB_RUNTIME_DEBUG(log::schedule(), "Task scheduler created with {:d} {:d}", cpu_thread_count_, io_thread_count_);
     }
 
     template<class Task>
-    auto submit_cpu_task(Task &&t) {
+    auto submit_cpu_task(Task &&t, TaskPriority priority = TaskPriority::NORMAL) {
         auto task = std::forward<decltype(t)>(t);
         static_assert(std::is_base_of_v<BaseTask, std::decay_t<Task>>, "Only supports Task derived from BaseTask");
-        ARCTICDB_DEBUG(log::schedule(), "{} Submitting CPU task {}: {} of {}", uintptr_t(this), typeid(task).name(), cpu_exec_.getTaskQueueSize(), cpu_exec_.kDefaultMaxQueueSize);
+        ARCTICDB_DEBUG(log::schedule(), "{} Submitting CPU task {} with priority {}: {}", uintptr_t(this), typeid(task).name(), static_cast<int>(priority), cpu_exec_.getTaskQueueSize());
         std::lock_guard lock{cpu_mutex_};
-        return cpu_exec_.addFuture(std::move(task));
+        return add_future(cpu_exec_, std::move(task), priority);
     }
 
     template<class Task>
-    auto submit_io_task(Task &&t) {
+    auto submit_io_task(Task &&t, TaskPriority priority = TaskPriority::NORMAL) {
         auto task = std::forward<decltype(t)>(t);
         static_assert(std::is_base_of_v<BaseTask, std::decay_t<Task>>, "Only support Tasks derived from BaseTask");
-        ARCTICDB_DEBUG(log::schedule(), "{} Submitting IO task {}: {}", uintptr_t(this), typeid(task).name(), io_exec_.getPendingTaskCount());
+        ARCTICDB_DEBUG(log::schedule(), "{} Submitting IO task {} with priority {}: {}", uintptr_t(this), typeid(task).name(), static_cast<int>(priority), io_exec_.getPendingTaskCount());
         std::lock_guard lock{io_mutex_};
-        return io_exec_.addFuture(std::move(task));
+        return add_future(io_exec_, std::move(task), priority);
     }
 
     static std::shared_ptr<TaskSchedulerPtrWrapper> instance_;
@@ -275,7 +388,27 @@ class TaskScheduler {
         return io_thread_count_;
     }
 
+    InFlightBytesBudget& in_flight_bytes_budget() {
+        return in_flight_bytes_budget_;
+    }
+
 private:
+    static std::unique_ptr<folly::PriorityUnboundedBlockingQueue<folly::CPUThreadPoolExecutor::CPUTask>> make_priority_queue() {
+        return std::make_unique<folly::PriorityUnboundedBlockingQueue<folly::CPUThreadPoolExecutor::CPUTask>>(num_task_priorities);
+    }
+
+    // As FutureExecutor::addFuture, but queueing the task at the given priority
+    template<class Executor, class Task>
+    static auto add_future(Executor& exec, Task&& task, TaskPriority priority) {
+        using ResultType = folly::lift_unit_t<std::invoke_result_t<Task>>;
+        folly::Promise<ResultType> promise;
+        auto future = promise.getFuture();
+        exec.addWithPriority([promise = std::move(promise), task = std::forward<Task>(task)]() mutable {
+            promise.setWith(std::move(task));
+        }, static_cast<int8_t>(priority));
+        return future;
+    }
+
     std::string cgroup_folder_;
     size_t cpu_thread_count_;
     size_t io_thread_count_;
@@ -283,6 +416,7 @@ private:
     SchedulerWrapper<IOSchedulerType> io_exec_;
     std::mutex cpu_mutex_;
     std::mutex io_mutex_;
+    InFlightBytesBudget in_flight_bytes_budget_;
 };
 
 
@@ -294,17 +428,34 @@ inline auto& io_executor() {
     return TaskScheduler::instance()->io_exec();
 }
 
+// For continuations that should run ahead of the other work on the CPU pool, e.g. decoding fetched segments
+inline folly::Executor::KeepAlive<> cpu_executor_with_priority(TaskPriority priority) {
+    return folly::ExecutorWithPriority::create(folly::getKeepAliveToken(cpu_executor()), static_cast<int8_t>(priority));
+}
+
+inline InFlightBytesBudget& in_flight_bytes_budget() {
+    return TaskScheduler::instance()->in_flight_bytes_budget();
+}
+
 template <typename Task>
-auto submit_cpu_task(Task&& task) {
-    return TaskScheduler::instance()->submit_cpu_task(std::forward<decltype(task)>(task));
+auto submit_cpu_task(Task&& task, TaskPriority priority = TaskPriority::NORMAL) {
+    return TaskScheduler::instance()->submit_cpu_task(std::forward<decltype(task)>(task), priority);
 }
 
 
 template <typename Task>
-auto submit_io_task(Task&& task) {
-    return TaskScheduler::instance()->submit_io_task(std::forward<decltype(task)>(task));
+auto submit_io_task(Task&& task, TaskPriority priority = TaskPriority::NORMAL) {
+    return TaskScheduler::instance()->submit_io_task(std::forward<decltype(task)>(task), priority);
 }
 
+/*
+ * Runs run_group(0) to run_group(num_groups - 1) from a task on the CPU pool, using whichever other CPU threads are
+ * free. Groups are claimed in turn by the calling thread and by helper tasks submitted to the CPU pool, so the caller
+ * never waits on a group that has not been started, and helpers that only start once every group has been claimed
+ * return without doing anything. The first exception thrown by a group is rethrown once every group has finished.
+ */
+void run_groups_on_cpu_pool(size_t num_groups, std::function<void(size_t)>&& run_group, TaskPriority priority = TaskPriority::HIGH);
+
 void print_scheduler_stats();
 
 }
@@ -37,6 +37,9 @@ namespace arcticdb::async {
 
     pipelines::SegmentAndSlice DecodeSliceTask::decode_into_slice(storage::KeySegmentPair&& key_segment_pair) {
         auto key = key_segment_pair.atom_key();
+        auto query_stat_operation_time = query_stats::QueryStats::instance()->is_enabled() ?
+                query_stats::add_task_count_and_time(query_stats::ProcessingType::DecodeSlice, query_stats::get_key_type_str(key.type())) :
+                std::nullopt;
         auto& seg = *key_segment_pair.segment_ptr();
         ARCTICDB_DEBUG(log::storage(), "ReadAndDecodeAtomTask decoding segment of size {} with key {}",
                        seg.size(),
@@ -26,7 +26,9 @@
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/processing/processing_unit.hpp>
 #include <arcticdb/util/constructors.hpp>
+#include <arcticdb/util/arena.hpp>
 #include <arcticdb/codec/codec.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 #include <arcticdb/util/test/random_throw.hpp>
 
 #include <type_traits>
@@ -270,6 +272,47 @@ struct ReadCompressedTask : BaseTask {
     }
 };
 
+// Reads several keys with a single call to the storage, for storages that support batch operations, fulfilling one
+// promise per key so that the keys can be processed independently once read
+struct ReadCompressedBatchTask : BaseTask {
+    std::vector<entity::VariantKey> keys_;
+    std::vector<folly::Promise<storage::KeySegmentPair>> promises_;
+    std::shared_ptr<storage::Library> lib_;
+    storage::ReadKeyOpts opts_;
+
+    ReadCompressedBatchTask(
+        std::vector<entity::VariantKey>&& keys,
+        std::vector<folly::Promise<storage::KeySegmentPair>>&& promises,
+        std::shared_ptr<storage::Library> lib,
+        storage::ReadKeyOpts opts) :
+        keys_(std::move(keys)),
+        promises_(std::move(promises)),
+        lib_(std::move(lib)),
+        opts_(opts) {
+        util::check(keys_.size() == promises_.size(), "Mismatched keys and promises in ReadCompressedBatchTask: {} != {}", keys_.size(), promises_.size());
+        ARCTICDB_DEBUG(log::storage(), "Creating read compressed batch task for {} keys", keys_.size());
+    }
+
+    ARCTICDB_MOVE_ONLY_DEFAULT(ReadCompressedBatchTask)
+
+    folly::Unit operator()() {
+        ARCTICDB_SAMPLE(ReadCompressedBatch, 0)
+        try {
+            auto results = lib_->read_batch(std::span(keys_), opts_);
+            util::check(results.size() == promises_.size(), "Expected {} results from read_batch, got {}", promises_.size(), results.size());
+            for (size_t idx = 0; idx < promises_.size(); ++idx)
+                promises_[idx].setTry(std::move(results[idx]));
+        } catch (...) {
+            const auto error = folly::exception_wrapper{std::current_exception()};
+            for (auto& promise : promises_) {
+                if (!promise.isFulfilled())
+                    promise.setException(error);
+            }
+        }
+        return folly::Unit{};
+    }
+};
+
 struct PassThroughTask : BaseTask {
     PassThroughTask() = default;
 
@@ -478,13 +521,16 @@ struct SegmentFunctionTask : BaseTask {
 struct MemSegmentProcessingTask : BaseTask {
     std::vector<std::shared_ptr<Clause>> clauses_;
     std::vector<EntityId> entity_ids_;
+    std::shared_ptr<Arena> arena_;
     timestamp creation_time_;
 
     explicit MemSegmentProcessingTask(
            std::vector<std::shared_ptr<Clause>> clauses,
-           std::vector<EntityId>&& entity_ids) :
+           std::vector<EntityId>&& entity_ids,
+           std::shared_ptr<Arena> arena = nullptr) :
         clauses_(std::move(clauses)),
         entity_ids_(std::move(entity_ids)),
+        arena_(std::move(arena)),
         creation_time_(util::SysClock::coarse_nanos_since_epoch()){
     }
 
@@ -495,8 +541,15 @@ struct MemSegmentProcessingTask : BaseTask {
         const auto nanos_start = util::SysClock::coarse_nanos_since_epoch();
         const auto time_in_queue = double(nanos_start - creation_time_) / BILLION;
         ARCTICDB_RUNTIME_DEBUG(log::inmem(), "Segment processing task running after {}s queue time", time_in_queue);
+        const bool query_stats_enabled = query_stats::QueryStats::instance()->is_enabled();
+        ArenaScope arena_scope{arena_};
         for (auto it = clauses_.cbegin(); it != clauses_.cend(); ++it) {
-            entity_ids_ = (*it)->process(std::move(entity_ids_));
+            {
+                auto query_stat_operation_time = query_stats_enabled ?
+                        query_stats::add_task_count_and_time(query_stats::ProcessingType::ClauseProcess, clause_name(**it)) :
+                        std::nullopt;
+                entity_ids_ = (*it)->process(std::move(entity_ids_));
+            }
 
             auto next_it = std::next(it);
             if(next_it != clauses_.cend() && (*it)->clause_info().output_structure_ != (*next_it)->clause_info().input_structure_)
@@ -610,9 +663,7 @@ struct WriteCompressedBatchTask : BaseTask {
     ARCTICDB_MOVE_ONLY_DEFAULT(WriteCompressedBatchTask)
 
     folly::Future<folly::Unit> write() {
-        for(auto&& kv : kvs_)
-            lib_->write(kv);
-
+        lib_->write_batch(std::span(kvs_));
         return folly::makeFuture();
     }
 
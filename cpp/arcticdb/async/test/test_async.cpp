@@ -18,6 +18,9 @@
 
 #include <string>
 #include <vector>
+#include <list>
+
+#include <folly/synchronization/Baton.h>
 
 #include <arcticdb/storage/s3/s3_storage.hpp>
 #include <arcticdb/storage/mock/s3_mock_client.hpp>
@@ -139,6 +142,145 @@ TEST(Async, CollectWithThrow) {
    ARCTICDB_DEBUG(log::version(), "Collect returned");
 }
 
+struct BlockingTask : arcticdb::async::BaseTask {
+    std::shared_ptr<folly::Baton<>> started_;
+    std::shared_ptr<folly::Baton<>> release_;
+
+    BlockingTask(std::shared_ptr<folly::Baton<>> started, std::shared_ptr<folly::Baton<>> release) :
+        started_(std::move(started)),
+        release_(std::move(release)) {
+    }
+
+    folly::Unit operator()() const {
+        started_->post();
+        release_->wait();
+        return folly::Unit{};
+    }
+};
+
+struct RecordOrderTask : arcticdb::async::BaseTask {
+    std::shared_ptr<std::vector<int>> order_;
+    int id_;
+
+    RecordOrderTask(std::shared_ptr<std::vector<int>> order, int id) :
+        order_(std::move(order)),
+        id_(id) {
+    }
+
+    folly::Unit operator()() const {
+        order_->push_back(id_);
+        return folly::Unit{};
+    }
+};
+
+TEST(Async, TaskPriority) {
+    aa::TaskScheduler sched{1, 1};
+    auto order = std::make_shared<std::vector<int>>();
+    for (auto io : {false, true}) {
+        order->clear();
+        auto started = std::make_shared<folly::Baton<>>();
+        auto release = std::make_shared<folly::Baton<>>();
+        auto submit = [&sched, io](auto&& task, aa::TaskPriority priority) {
+            return io ? sched.submit_io_task(std::move(task), priority) : sched.submit_cpu_task(std::move(task), priority);
+        };
+        // Occupy the only thread so that the other tasks queue up behind it
+        auto blocker = submit(BlockingTask{started, release}, aa::TaskPriority::NORMAL);
+        started->wait();
+        std::vector<folly::Future<folly::Unit>> futures;
+        futures.emplace_back(submit(RecordOrderTask{order, 0}, aa::TaskPriority::LOW));
+        futures.emplace_back(submit(RecordOrderTask{order, 1}, aa::TaskPriority::NORMAL));
+        futures.emplace_back(submit(RecordOrderTask{order, 2}, aa::TaskPriority::HIGH));
+        futures.emplace_back(submit(RecordOrderTask{order, 3}, aa::TaskPriority::LOW));
+        release->post();
+        std::move(blocker).get();
+        folly::collect(futures).get();
+        ASSERT_EQ(*order, std::vector<int>({2, 1, 0, 3}));
+    }
+}
+
+TEST(Async, InFlightBytesBudget) {
+    aa::InFlightBytesBudget budget{100};
+    std::list<aa::InFlightBytesReservation> reservations;
+    auto submit = [&budget, &reservations]() {
+        budget.submit([&reservations](aa::InFlightBytesReservation&& reservation) {
+            reservations.emplace_back(std::move(reservation));
+        });
+    };
+    auto release_first = [&reservations]() {
+        auto released = std::move(reservations.front());
+        reservations.pop_front();
+    };
+
+    // Nothing is in flight, so the first read is admitted even though its estimated size exceeds the limit
+    submit();
+    ASSERT_EQ(reservations.size(), 1);
+    ASSERT_EQ(budget.in_flight_bytes(), aa::InFlightBytesBudget::initial_read_estimate_bytes);
+    submit();
+    ASSERT_EQ(reservations.size(), 1);
+    ASSERT_EQ(budget.queued_submissions(), 1);
+
+    // Once the first read is sized, later reads are estimated from it
+    reservations.front().resize(40);
+    ASSERT_EQ(reservations.size(), 2);
+    ASSERT_EQ(budget.in_flight_bytes(), 80);
+    submit();
+    ASSERT_EQ(reservations.size(), 2);
+    ASSERT_EQ(budget.queued_submissions(), 1);
+
+    release_first();
+    ASSERT_EQ(reservations.size(), 2);
+    ASSERT_EQ(budget.queued_submissions(), 0);
+    ASSERT_EQ(budget.in_flight_bytes(), 80);
+
+    reservations.clear();
+    ASSERT_EQ(budget.in_flight_bytes(), 0);
+
+    aa::InFlightBytesBudget disabled{0};
+    ASSERT_FALSE(disabled.enabled());
+    auto ran = false;
+    disabled.submit([&ran](aa::InFlightBytesReservation&& reservation) {
+        ran = true;
+        ASSERT_EQ(reservation.bytes(), 0);
+    });
+    ASSERT_TRUE(ran);
+    ASSERT_EQ(disabled.in_flight_bytes(), 0);
+}
+
+TEST(Async, InFlightBytesBudgetBatch) {
+    aa::InFlightBytesBudget budget{100};
+    std::list<aa::InFlightBytesReservation> reservations;
+    auto submit_batch = [&budget, &reservations](size_t reads) {
+        budget.submit_batch(reads, [&reservations](std::vector<aa::InFlightBytesReservation>&& batch) {
+            for (auto& reservation : batch)
+                reservations.emplace_back(std::move(reservation));
+        });
+    };
+
+    submit_batch(1);
+    reservations.front().resize(20);
+    ASSERT_EQ(budget.in_flight_bytes(), 20);
+
+    // A batch is only admitted once all of its reads fit
+    submit_batch(5);
+    ASSERT_EQ(reservations.size(), 1);
+    ASSERT_EQ(budget.queued_submissions(), 1);
+    {
+        // Released outside the list, as the release admits the batch, which adds to it
+        auto released = std::move(reservations.front());
+        reservations.pop_front();
+    }
+    ASSERT_EQ(reservations.size(), 5);
+    ASSERT_EQ(budget.in_flight_bytes(), 100);
+
+    // Each read of the batch is sized and released independently
+    reservations.front().resize(10);
+    ASSERT_EQ(budget.in_flight_bytes(), 90);
+    reservations.pop_front();
+    ASSERT_EQ(budget.in_flight_bytes(), 80);
+    reservations.clear();
+    ASSERT_EQ(budget.in_flight_bytes(), 0);
+}
+
 TEST(Async, QueryStatsDemo) {
     using namespace arcticdb::query_stats;
     class EnableQueryStatsRAII {
@@ -192,6 +334,33 @@ TEST(Async, QueryStatsDemo) {
     ASSERT_EQ(result["count"], 30);
 }
 
+TEST(Async, QueryStatsProcessingOperations) {
+    using namespace arcticdb::query_stats;
+    QueryStats::instance()->enable();
+    async::TaskScheduler sched{4, 4};
+    std::vector<folly::Future<folly::Unit>> futures;
+    for (auto i = 0; i < 8; ++i) {
+        futures.push_back(sched.submit_cpu_task(MaybeThrowTask(false)).thenValue([](auto) {
+            auto query_stat_operation_time = add_task_count_and_time(ProcessingType::ClauseProcess, "FilterClause");
+            add(ProcessingType::DecodeBlock, "LZ4", StatType::COUNT, 1);
+            add(ProcessingType::DecodeBlock, "LZ4", StatType::SIZE_BYTES, 100);
+            return folly::Unit{};
+        }));
+    }
+    folly::collectAll(futures).get();
+    QueryStats::instance()->disable();
+    add(ProcessingType::DecodeBlock, "ZSTD", StatType::COUNT, 1);
+
+    auto stats = QueryStats::instance()->get_stats();
+    QueryStats::instance()->reset_stats();
+    auto& processing = stats["processing_operations"];
+    ASSERT_EQ(processing["ClauseProcess"]["FilterClause"]["count"], 8);
+    ASSERT_EQ(processing["DecodeBlock"]["LZ4"]["count"], 8);
+    ASSERT_EQ(processing["DecodeBlock"]["LZ4"]["size_bytes"], 800);
+    ASSERT_FALSE(processing["DecodeBlock"].contains("ZSTD"));
+    ASSERT_TRUE(QueryStats::instance()->get_stats().empty());
+}
+
 using IndexSegmentReader = int;
 
 int get_index_segment_reader_impl(arcticdb::StreamId id) {
@@ -13,11 +13,14 @@
 #include <arcticdb/codec/passthrough.hpp>
 #include <arcticdb/codec/zstd.hpp>
 #include <arcticdb/codec/lz4.hpp>
+#include <arcticdb/codec/pfor.hpp>
 #include <arcticdb/codec/encoded_field.hpp>
 #include <arcticdb/codec/magic_words.hpp>
+#include <arcticdb/codec/dictionary_encoding.hpp>
 #include <arcticdb/util/bitset.hpp>
 #include <arcticdb/util/buffer.hpp>
 #include <arcticdb/util/sparse_utils.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 
 #include <type_traits>
 
@@ -28,6 +31,9 @@ void decode_block(const BlockType &block, const std::uint8_t *input, T *output)
     ARCTICDB_SUBSAMPLE_AGG(DecodeBlock)
     std::size_t size_to_decode = block.out_bytes();
     std::size_t decoded_size = block.in_bytes();
+    const auto codec_name = block.has_codec() ? codec_type_to_string(block.codec().codec_type()) : codec_type_to_string(Codec::PASS);
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::ProcessingType::DecodeBlock, codec_name);
+    query_stats::add(query_stats::ProcessingType::DecodeBlock, codec_name, query_stats::StatType::SIZE_BYTES, decoded_size);
 
     if (!block.has_codec()) {
         arcticdb::detail::PassthroughDecoder::decode_block<T>(input, size_to_decode, output, decoded_size);
@@ -48,6 +54,14 @@ void decode_block(const BlockType &block, const std::uint8_t *input, T *output)
                 output,
                 decoded_size);
             break;
+        case arcticdb::Codec::PFOR:
+            arcticdb::detail::PforDecoder::decode_block<T>(encoder_version,
+                block.codec().pfor().sub_codec_,
+                input,
+                size_to_decode,
+                output,
+                decoded_size);
+            break;
         default:
             util::raise_rte("Unsupported block codec {}", codec_type_to_string(block.codec().codec_type()));
         }
@@ -69,6 +83,20 @@ inline void read_shapes(
     data_sink.advance_shapes(shape.in_bytes());
 }
 
+template<class DataSink, typename NDArrayEncodedFieldType>
+void decode_sparse_map(
+    const NDArrayEncodedFieldType& field,
+    const std::uint8_t*& data_in,
+    DataSink& data_sink,
+    std::optional<util::BitMagic>& bv
+) {
+    util::check_magic<util::BitMagicStart>(data_in);
+    const auto bitmap_size = field.sparse_map_bytes() - util::combined_bit_magic_delimiters_size();
+    bv = util::deserialize_bytes_to_bitmap(data_in, bitmap_size);
+    util::check_magic<util::BitMagicEnd>(data_in);
+    data_sink.set_allow_sparse(Sparsity::PERMITTED);
+}
+
 template<class DataSink, typename NDArrayEncodedFieldType>
 std::size_t decode_ndarray(
     const TypeDescriptor& td,
@@ -136,11 +164,7 @@ std::size_t decode_ndarray(
 
         if(field.sparse_map_bytes()) {
             util::check(!is_empty_type(type_desc_tag.data_type()), "Empty typed columns should not have sparse map");
-            util::check_magic<util::BitMagicStart>(data_in);
-            const auto bitmap_size = field.sparse_map_bytes() - util::combined_bit_magic_delimiters_size();
-            bv = util::deserialize_bytes_to_bitmap(data_in, bitmap_size);
-            util::check_magic<util::BitMagicEnd>(data_in);
-            data_sink.set_allow_sparse(Sparsity::PERMITTED);
+            decode_sparse_map(field, data_in, data_sink, bv);
         }
 
         read_bytes = encoding_sizes::ndarray_field_compressed_size(field);
@@ -155,6 +179,71 @@ std::size_t decode_ndarray(
     return read_bytes;
 }
 
+/// @brief Decompresses the dictionary and codes blocks of a dictionary encoded field, advancing the input past them.
+/// Any sparse map following the codes is left for the caller.
+inline DictionaryEncodedColumn decode_dictionary_blocks(
+    const EncodedFieldImpl& field,
+    const std::uint8_t*& data_in
+) {
+    util::check(field.has_dictionary(), "Expected dictionary encoded field, got {}", field.DebugString());
+    util::check(field.values_size() == static_cast<int>(DictionaryEncodedColumn::num_blocks),
+        "Expected {} blocks in dictionary encoded field, got {}", DictionaryEncodedColumn::num_blocks, field.values_size());
+
+    DictionaryEncodedColumn result;
+    const auto& dictionary_block = field.values(DictionaryEncodedColumn::dictionary_block);
+    result.dictionary_.resize(dictionary_block.in_bytes() / sizeof(uint64_t));
+    decode_block<uint64_t>(dictionary_block, data_in, result.dictionary_.data());
+    data_in += dictionary_block.out_bytes();
+
+    result.row_count_ = field.items_count();
+    const auto& codes_block = field.values(DictionaryEncodedColumn::codes_block);
+    util::check(result.row_count_ > 0 && codes_block.in_bytes() % result.row_count_ == 0,
+        "Dictionary codes size {} is not a multiple of the item count {}", codes_block.in_bytes(), result.row_count_);
+    result.code_width_ = codes_block.in_bytes() / result.row_count_;
+    result.codes_ = Buffer{codes_block.in_bytes()};
+    decode_block<uint8_t>(codes_block, data_in, result.codes_.data());
+    data_in += codes_block.out_bytes();
+    return result;
+}
+
+/// @brief Decodes a dictionary encoded field (see DictionaryEncodedColumn) by expanding the codes back into string
+/// pool offsets, so that the data sink receives exactly what it would have for the equivalent ndarray field.
+template<class DataSink>
+std::size_t decode_dictionary(
+    const TypeDescriptor& td,
+    const EncodedFieldImpl& field,
+    const std::uint8_t* input,
+    DataSink& data_sink,
+    std::optional<util::BitMagic>& bv
+) {
+    ARCTICDB_SUBSAMPLE_AGG(DecodeDictionary)
+    util::check(is_dynamic_string_type(td.data_type()) && get_type_size(td.data_type()) == sizeof(uint64_t),
+        "Dictionary encoding is only supported for dynamic string columns, got {}", td);
+
+    auto data_in = input;
+    const auto dictionary = decode_dictionary_blocks(field, data_in);
+    const auto data_size = dictionary.row_count_ * sizeof(uint64_t);
+    auto* data_out = data_sink.allocate_data(data_size);
+    util::check(data_out != nullptr, "Failed to allocate data of size {}", data_size);
+    expand_dictionary_codes(
+        dictionary.dictionary_.data(),
+        dictionary.dictionary_.size(),
+        dictionary.codes_.data(),
+        dictionary.code_width_,
+        dictionary.row_count_,
+        reinterpret_cast<uint64_t*>(data_out));
+    data_sink.advance_data(data_size);
+
+    if(field.sparse_map_bytes())
+        decode_sparse_map(field.dictionary(), data_in, data_sink, bv);
+
+    const auto read_bytes = encoding_sizes::field_compressed_size(field);
+    util::check(data_in - input == intptr_t(read_bytes),
+        "Decoding compressed size mismatch, expected decode size {} to equal total size {}", data_in - input,
+        read_bytes);
+    return read_bytes;
+}
+
 template<class DataSink>
 std::size_t decode_field(
     const TypeDescriptor &td,
@@ -172,6 +261,8 @@ std::size_t decode_field(
     switch (field.encoding_case()) {
         case EncodedFieldType::NDARRAY:
             return decode_ndarray(td, field.ndarray(), input, data_sink, bv, encoding_version) + magic_size;
+        case EncodedFieldType::DICTIONARY:
+            return decode_dictionary(td, field, input, data_sink, bv) + magic_size;
         default:
             util::raise_rte("Unsupported encoding {}", field);
     }
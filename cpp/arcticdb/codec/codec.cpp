@@ -32,10 +32,18 @@ SizeResult max_compressed_size_dispatch(
     const SegmentInMemory& in_mem_seg,
     const arcticdb::proto::encoding::VariantCodec &codec_opts,
     EncodingVersion encoding_version) {
+    return max_compressed_size_dispatch(in_mem_seg, codec_opts, encoding_version, column_codecs(in_mem_seg, codec_opts, encoding_version));
+}
+
+SizeResult max_compressed_size_dispatch(
+    const SegmentInMemory& in_mem_seg,
+    const arcticdb::proto::encoding::VariantCodec &codec_opts,
+    EncodingVersion encoding_version,
+    const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs) {
     if(encoding_version == EncodingVersion::V2) {
-        return max_compressed_size_v2(in_mem_seg, codec_opts);
+        return max_compressed_size_v2(in_mem_seg, codec_opts, codecs);
     } else {
-        return max_compressed_size_v1(in_mem_seg, codec_opts);
+        return max_compressed_size_v1(in_mem_seg, codec_opts, codecs);
     }
 }
 
@@ -50,6 +58,18 @@ Segment encode_dispatch(
     }
 }
 
+Segment encode_dispatch(
+    SegmentInMemory&& in_mem_seg,
+    const arcticdb::proto::encoding::VariantCodec &codec_opts,
+    EncodingVersion encoding_version,
+    const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs) {
+    if(encoding_version == EncodingVersion::V2) {
+        return encode_v2(std::move(in_mem_seg), codec_opts, codecs);
+    } else {
+        return encode_v1(std::move(in_mem_seg), codec_opts, codecs);
+    }
+}
+
 namespace {
 class MetaBuffer {
   public:
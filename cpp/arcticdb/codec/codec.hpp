@@ -26,16 +26,35 @@ Segment encode_dispatch(
     const arcticdb::proto::encoding::VariantCodec &codec_opts,
     EncodingVersion encoding_version);
 
+/// As above with the codec of each column already chosen, see column_codecs
+Segment encode_dispatch(
+    SegmentInMemory&& in_mem_seg,
+    const arcticdb::proto::encoding::VariantCodec &codec_opts,
+    EncodingVersion encoding_version,
+    const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs);
+
 Segment encode_v2(
     SegmentInMemory&& in_mem_seg,
     const arcticdb::proto::encoding::VariantCodec& codec_opts
 );
 
+Segment encode_v2(
+    SegmentInMemory&& in_mem_seg,
+    const arcticdb::proto::encoding::VariantCodec& codec_opts,
+    const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs
+);
+
 Segment encode_v1(
     SegmentInMemory&& in_mem_seg,
     const arcticdb::proto::encoding::VariantCodec& codec_opts
 );
 
+Segment encode_v1(
+    SegmentInMemory&& in_mem_seg,
+    const arcticdb::proto::encoding::VariantCodec& codec_opts,
+    const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs
+);
+
 void decode_v1(const Segment& segment,
                const SegmentHeader& hdr,
                SegmentInMemory& res,
@@ -52,6 +71,13 @@ SizeResult max_compressed_size_dispatch(
     const arcticdb::proto::encoding::VariantCodec &codec_opts,
     EncodingVersion encoding_version);
 
+/// As above with the codec of each column already chosen, so that encoding with the same codecs fits the result
+SizeResult max_compressed_size_dispatch(
+    const SegmentInMemory& in_mem_seg,
+    const arcticdb::proto::encoding::VariantCodec &codec_opts,
+    EncodingVersion encoding_version,
+    const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs);
+
 EncodedFieldCollection decode_encoded_fields(
     const SegmentHeader& hdr,
     const uint8_t* data,
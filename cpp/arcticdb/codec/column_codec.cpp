@@ -0,0 +1,223 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/codec/column_codec.hpp>
+#include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/codec/dictionary_encoding.hpp>
+#include <arcticdb/codec/lightweight_encoding.hpp>
+#include <arcticdb/codec/lz4.hpp>
+#include <arcticdb/codec/pfor.hpp>
+#include <arcticdb/codec/zstd.hpp>
+#include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/pb_util.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace arcticdb {
+
+namespace {
+
+// The sample is made of this many runs of consecutive values spread evenly over the column, so that both the local
+// patterns the codecs exploit and any drift along the column are represented
+constexpr size_t sample_runs = 4;
+constexpr size_t sample_run_bytes = 4096;
+// Below this sampling would cost about as much as encoding the column, which is then encoded with codec_opts
+constexpr size_t min_sampled_column_bytes = 4096;
+constexpr std::array<int, 4> zstd_levels{1, 3, 9, 19};
+
+// Typical single core decode throughputs, in bytes of decoded data per nanosecond
+constexpr double passthrough_decode_bytes_per_ns = 10.0;
+constexpr double lz4_decode_bytes_per_ns = 3.0;
+constexpr double zstd_decode_bytes_per_ns = 1.0;
+constexpr double integer_lightweight_decode_bytes_per_ns = 2.0;
+constexpr double float_lightweight_decode_bytes_per_ns = 1.0;
+
+void copy_column_bytes(const ChunkedBuffer& buffer, size_t offset, size_t bytes, std::vector<uint8_t>& out) {
+    size_t block_start = 0;
+    for (const auto* block : buffer.blocks()) {
+        if (bytes == 0)
+            break;
+
+        if (!block)
+            continue;
+
+        const auto block_end = block_start + block->bytes();
+        if (offset < block_end) {
+            const auto block_offset = offset - block_start;
+            const auto count = std::min(bytes, block->bytes() - block_offset);
+            out.insert(out.end(), block->data() + block_offset, block->data() + block_offset + count);
+            offset += count;
+            bytes -= count;
+        }
+        block_start = block_end;
+    }
+}
+
+std::vector<uint8_t> sample_column(const ChunkedBuffer& buffer, size_t value_size) {
+    std::vector<uint8_t> sample;
+    const auto total_bytes = buffer.bytes();
+    if (total_bytes <= sample_runs * sample_run_bytes) {
+        copy_column_bytes(buffer, 0, total_bytes, sample);
+        return sample;
+    }
+
+    const auto run_bytes = sample_run_bytes - sample_run_bytes % value_size;
+    sample.reserve(sample_runs * run_bytes);
+    for (size_t run = 0; run < sample_runs; ++run) {
+        auto offset = run * (total_bytes - run_bytes) / (sample_runs - 1);
+        offset -= offset % value_size;
+        copy_column_bytes(buffer, offset, run_bytes, sample);
+    }
+    return sample;
+}
+
+template<class Encoder, typename T>
+size_t encoded_size(const typename Encoder::Opts& opts, const T* values, size_t bytes, std::vector<uint8_t>& scratch) {
+    detail::BlockDataHelper block_utils{bytes / sizeof(T), bytes};
+    HashAccum hasher;
+    std::ptrdiff_t pos = 0;
+    BlockCodecImpl block_codec;
+    scratch.resize(Encoder::max_compressed_size(bytes));
+    return Encoder::encode_block(opts, values, block_utils, hasher, reinterpret_cast<T*>(scratch.data()), scratch.size(), pos, block_codec);
+}
+
+template<typename T>
+size_t encoded_size(const arcticdb::proto::encoding::VariantCodec& codec, const T* values, size_t bytes, std::vector<uint8_t>& scratch) {
+    switch (codec.codec_case()) {
+    case arcticdb::proto::encoding::VariantCodec::kLz4:
+        return encoded_size<detail::Lz4BlockEncoder>(codec.lz4(), values, bytes, scratch);
+    case arcticdb::proto::encoding::VariantCodec::kZstd:
+        return encoded_size<detail::ZstdBlockEncoder>(codec.zstd(), values, bytes, scratch);
+    case arcticdb::proto::encoding::VariantCodec::kTp4:
+        return encoded_size<detail::PforBlockEncoder>(codec.tp4(), values, bytes, scratch);
+    default:
+        return bytes;
+    }
+}
+
+double decode_bytes_per_ns(const arcticdb::proto::encoding::VariantCodec& codec) {
+    switch (codec.codec_case()) {
+    case arcticdb::proto::encoding::VariantCodec::kLz4:
+        return lz4_decode_bytes_per_ns;
+    case arcticdb::proto::encoding::VariantCodec::kZstd:
+        return zstd_decode_bytes_per_ns;
+    case arcticdb::proto::encoding::VariantCodec::kTp4:
+        return codec.tp4().sub_codec() == arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_XOR ?
+            float_lightweight_decode_bytes_per_ns : integer_lightweight_decode_bytes_per_ns;
+    default:
+        return passthrough_decode_bytes_per_ns;
+    }
+}
+
+} // namespace
+
+bool adaptive_column_codecs_enabled() {
+    return ConfigsMap::instance()->get_int("Codec.AdaptiveColumnCodecs", 0) == 1;
+}
+
+CodecCostModel CodecCostModel::from_config() {
+    const auto megabytes_per_second = ConfigsMap::instance()->get_int("Codec.AdaptiveStorageMBPerSecond", 100);
+    util::check(megabytes_per_second > 0, "Codec.AdaptiveStorageMBPerSecond must be positive, got {}", megabytes_per_second);
+    // 1MB/s is 1e-3 bytes per nanosecond
+    return CodecCostModel{static_cast<double>(megabytes_per_second) / 1000.0};
+}
+
+double CodecCostModel::cost(const arcticdb::proto::encoding::VariantCodec& codec, size_t encoded_bytes, size_t decoded_bytes) const {
+    return static_cast<double>(encoded_bytes) / storage_bytes_per_ns_ +
+        static_cast<double>(decoded_bytes) / decode_bytes_per_ns(codec);
+}
+
+std::vector<arcticdb::proto::encoding::VariantCodec> candidate_codecs(
+        const TypeDescriptor& type,
+        const arcticdb::proto::encoding::VariantCodec& codec_opts) {
+    std::vector<arcticdb::proto::encoding::VariantCodec> res{codec_opts};
+    auto add_candidate = [&res](arcticdb::proto::encoding::VariantCodec&& codec) {
+        if (std::none_of(res.begin(), res.end(), [&codec](const auto& existing) { return util::pb_equals(existing, codec); }))
+            res.emplace_back(std::move(codec));
+    };
+    add_candidate(codec::default_passthrough_codec());
+    add_candidate(codec::default_lz4_codec());
+    const auto max_zstd_level = ConfigsMap::instance()->get_int("Codec.AdaptiveMaxZstdLevel", 3);
+    for (auto level : zstd_levels) {
+        if (level > max_zstd_level)
+            break;
+
+        arcticdb::proto::encoding::VariantCodec zstd;
+        zstd.mutable_zstd()->set_level(level);
+        add_candidate(std::move(zstd));
+    }
+    if (lightweight_encodings_enabled()) {
+        if (auto lightweight = lightweight_codec(type); lightweight)
+            add_candidate(std::move(*lightweight));
+    }
+    return res;
+}
+
+arcticdb::proto::encoding::VariantCodec choose_column_codec(
+        ColumnData& column_data,
+        const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        const CodecCostModel& cost_model) {
+    const auto type = column_data.type();
+    if (type.dimension() != Dimension::Dim0 || column_data.buffer().bytes() < min_sampled_column_bytes)
+        return codec_opts;
+
+    const auto sample = sample_column(column_data.buffer(), get_type_size(type.data_type()));
+    const auto candidates = candidate_codecs(type, codec_opts);
+    size_t best = 0;
+    auto best_cost = std::numeric_limits<double>::max();
+    type.visit_tag([&](auto type_desc_tag) {
+        using T = typename decltype(type_desc_tag)::DataTypeTag::raw_type;
+        const auto* values = reinterpret_cast<const T*>(sample.data());
+        std::vector<uint8_t> scratch;
+        for (size_t idx = 0; idx < candidates.size(); ++idx) {
+            const auto encoded_bytes = encoded_size(candidates[idx], values, sample.size(), scratch);
+            const auto cost = cost_model.cost(candidates[idx], encoded_bytes, sample.size());
+            ARCTICDB_TRACE(log::codec(), "Candidate codec {} encodes {} sampled bytes to {} at cost {}",
+                           candidates[idx].ShortDebugString(), sample.size(), encoded_bytes, cost);
+            if (cost < best_cost) {
+                best = idx;
+                best_cost = cost;
+            }
+        }
+    });
+    return candidates[best];
+}
+
+arcticdb::proto::encoding::VariantCodec column_codec(
+        ColumnData& column_data,
+        const arcticdb::proto::encoding::VariantCodec& codec_opts) {
+    if (adaptive_column_codecs_enabled())
+        return choose_column_codec(column_data, codec_opts, CodecCostModel::from_config());
+
+    if (lightweight_encodings_enabled()) {
+        if (auto codec = lightweight_codec(column_data.type()); codec)
+            return *codec;
+    }
+    return codec_opts;
+}
+
+std::vector<arcticdb::proto::encoding::VariantCodec> column_codecs(
+        const SegmentInMemory& segment,
+        const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        EncodingVersion encoding_version) {
+    std::vector<arcticdb::proto::encoding::VariantCodec> res;
+    res.reserve(segment.num_columns());
+    for (size_t col = 0; col < segment.num_columns(); ++col) {
+        if (encoding_version == EncodingVersion::V2 && may_dictionary_encode(segment.column(col).type())) {
+            res.emplace_back(codec_opts);
+            continue;
+        }
+        auto column_data = segment.column_data(col);
+        res.emplace_back(column_codec(column_data, codec_opts));
+    }
+    return res;
+}
+
+} // namespace arcticdb
@@ -0,0 +1,65 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/column_store/column_data.hpp>
+#include <arcticdb/entity/protobufs.hpp>
+#include <arcticdb/storage/memory_layout.hpp>
+
+#include <vector>
+
+namespace arcticdb {
+
+class SegmentInMemory;
+
+/// Controlled by Codec.AdaptiveColumnCodecs, off by default
+bool adaptive_column_codecs_enabled();
+
+/// @brief Estimates how long reading and decoding data encoded with a codec takes.
+/// The estimate is the time to fetch the encoded bytes from storage at storage_bytes_per_ns_, plus the time to decode
+/// them at the typical single core decode throughput of the codec. A slower storage favours smaller encodings, a
+/// faster one favours the codecs that are quicker to decode.
+struct CodecCostModel {
+    double storage_bytes_per_ns_;
+
+    /// Reads Codec.AdaptiveStorageMBPerSecond, 100 by default
+    static CodecCostModel from_config();
+
+    [[nodiscard]] double cost(const arcticdb::proto::encoding::VariantCodec& codec, size_t encoded_bytes, size_t decoded_bytes) const;
+};
+
+/// @brief The codecs considered for a column of the given type by the adaptive selection.
+/// These are codec_opts, passthrough, LZ4, ZSTD at levels up to Codec.AdaptiveMaxZstdLevel (3 by default) and the
+/// lightweight encoding of the type when lightweight encodings are enabled.
+std::vector<arcticdb::proto::encoding::VariantCodec> candidate_codecs(
+    const TypeDescriptor& type,
+    const arcticdb::proto::encoding::VariantCodec& codec_opts);
+
+/// @brief Encodes a sample of evenly spaced runs of the column's values with each candidate codec and returns the one
+/// the cost model rates cheapest. Earlier candidates win ties. Multidimensional columns and columns too small for the
+/// sample to be worth taking keep codec_opts.
+arcticdb::proto::encoding::VariantCodec choose_column_codec(
+    ColumnData& column_data,
+    const arcticdb::proto::encoding::VariantCodec& codec_opts,
+    const CodecCostModel& cost_model);
+
+/// @brief The codec to encode the values of a column with: the adaptively chosen one if adaptive selection is
+/// enabled, otherwise the lightweight encoding of its type if those are enabled, otherwise codec_opts.
+arcticdb::proto::encoding::VariantCodec column_codec(
+    ColumnData& column_data,
+    const arcticdb::proto::encoding::VariantCodec& codec_opts);
+
+/// column_codec of each column of the segment, computed once so that sizing and encoding the segment agree. Columns
+/// that V2 may dictionary encode keep codec_opts without being sampled, as the dictionary is encoded with codec_opts
+/// and the codec is only used if the column turns out not to be worth dictionary encoding.
+std::vector<arcticdb::proto::encoding::VariantCodec> column_codecs(
+    const SegmentInMemory& segment,
+    const arcticdb::proto::encoding::VariantCodec& codec_opts,
+    EncodingVersion encoding_version);
+
+} // namespace arcticdb
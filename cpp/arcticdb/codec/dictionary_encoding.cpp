@@ -0,0 +1,108 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/codec/dictionary_encoding.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <ankerl/unordered_dense.h>
+
+#include <limits>
+
+namespace arcticdb {
+
+namespace {
+// Below this many values the fixed per-block overhead of writing two blocks outweighs any saving
+constexpr size_t min_dictionary_encoded_values = 128;
+
+template <typename CodeType>
+void write_codes(const std::vector<uint32_t>& codes, Buffer& out) {
+    auto* ptr = out.ptr_cast<CodeType>(0, codes.size() * sizeof(CodeType));
+    std::transform(codes.begin(), codes.end(), ptr, [](uint32_t code) { return static_cast<CodeType>(code); });
+}
+}
+
+bool dictionary_encoding_enabled() {
+    return ConfigsMap::instance()->get_int("Codec.DictionaryEncodeStrings", 0) == 1;
+}
+
+bool may_dictionary_encode(const TypeDescriptor& type) {
+    return type.dimension() == Dimension::Dim0 &&
+        is_dynamic_string_type(type.data_type()) &&
+        get_type_size(type.data_type()) == sizeof(uint64_t) &&
+        dictionary_encoding_enabled();
+}
+
+size_t dictionary_code_width(size_t dictionary_size) {
+    if (dictionary_size <= size_t(std::numeric_limits<uint8_t>::max()) + 1)
+        return sizeof(uint8_t);
+    else if (dictionary_size <= size_t(std::numeric_limits<uint16_t>::max()) + 1)
+        return sizeof(uint16_t);
+    else
+        return sizeof(uint32_t);
+}
+
+std::optional<DictionaryEncodedColumn> dictionary_encode(ColumnData& column_data) {
+    if (!may_dictionary_encode(column_data.type()))
+        return std::nullopt;
+
+    using OffsetTDT = ScalarTagType<DataTypeTag<DataType::UINT64>>;
+    size_t value_count = 0;
+    column_data.reset();
+    while (auto block = column_data.next<OffsetTDT>())
+        value_count += block->row_count();
+
+    column_data.reset();
+    if (value_count < min_dictionary_encoded_values)
+        return std::nullopt;
+
+    // Give up as soon as the dictionary alone would use more than half the space of the plain offsets
+    const size_t max_dictionary_size = value_count / 2;
+    DictionaryEncodedColumn result;
+    ankerl::unordered_dense::map<uint64_t, uint32_t> codes_by_offset;
+    std::vector<uint32_t> codes;
+    codes.reserve(value_count);
+    while (auto block = column_data.next<OffsetTDT>()) {
+        for (auto offset : *block) {
+            auto [it, inserted] = codes_by_offset.try_emplace(offset, static_cast<uint32_t>(result.dictionary_.size()));
+            if (inserted) {
+                if (result.dictionary_.size() == max_dictionary_size) {
+                    column_data.reset();
+                    return std::nullopt;
+                }
+                result.dictionary_.push_back(offset);
+            }
+            codes.push_back(it->second);
+        }
+    }
+    column_data.reset();
+
+    const auto code_width = dictionary_code_width(result.dictionary_.size());
+    const auto encoded_bytes = result.dictionary_.size() * sizeof(uint64_t) + value_count * code_width;
+    if (encoded_bytes * 2 > value_count * sizeof(uint64_t))
+        return std::nullopt;
+
+    ARCTICDB_DEBUG(log::codec(), "Dictionary encoding {} values with {} distinct offsets using {} byte codes",
+                   value_count, result.dictionary_.size(), code_width);
+    result.code_width_ = code_width;
+    result.row_count_ = value_count;
+    result.codes_ = Buffer{value_count * code_width};
+    switch (code_width) {
+    case sizeof(uint8_t):
+        write_codes<uint8_t>(codes, result.codes_);
+        break;
+    case sizeof(uint16_t):
+        write_codes<uint16_t>(codes, result.codes_);
+        break;
+    default:
+        write_codes<uint32_t>(codes, result.codes_);
+        break;
+    }
+    return result;
+}
+
+} // namespace arcticdb
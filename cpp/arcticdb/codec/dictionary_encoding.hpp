@@ -0,0 +1,94 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/column_store/column_data.hpp>
+#include <arcticdb/util/buffer.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace arcticdb {
+
+/// @brief Dictionary encoded representation of a dynamic string column.
+/// Dynamic string columns hold offsets into the segment's string pool, which already stores each distinct string
+/// exactly once. For low-cardinality columns the offsets themselves are very repetitive, so instead we store the
+/// distinct offsets once (the dictionary), followed by one narrow code per value indexing into the dictionary.
+/// On disk this is an EncodedFieldType::DICTIONARY field with exactly two value blocks: the dictionary, then the codes.
+/// The width of the codes is implied by the size of the codes block divided by the field's items count.
+struct DictionaryEncodedColumn {
+    static constexpr size_t num_blocks = 2;
+    static constexpr size_t dictionary_block = 0;
+    static constexpr size_t codes_block = 1;
+
+    /// Distinct string pool offsets, in order of first appearance in the column
+    std::vector<uint64_t> dictionary_;
+    /// row_count_ codes, each code_width_ bytes wide
+    Buffer codes_;
+    size_t code_width_ = 0;
+    size_t row_count_ = 0;
+};
+
+/// Controlled by Codec.DictionaryEncodeStrings, off by default as older clients cannot read dictionary encoded fields
+bool dictionary_encoding_enabled();
+
+/// Whether the size of the block reservation for this column should allow for a dictionary encoded field
+bool may_dictionary_encode(const TypeDescriptor& type);
+
+/// Narrowest of 1, 2 or 4 bytes that can index a dictionary of the given size
+size_t dictionary_code_width(size_t dictionary_size);
+
+/// @brief Builds the dictionary encoding of a dynamic string column if doing so is worthwhile.
+/// Returns std::nullopt if the column is not a dynamic string column, is too short for the encoding to pay off, or
+/// the dictionary and codes would take more than half the space of the plain offsets. The column data is reset on
+/// return so that it can be used by the regular encoder.
+std::optional<DictionaryEncodedColumn> dictionary_encode(ColumnData& column_data);
+
+/// @brief Expands codes of the given width back into the dictionary values they index.
+template <typename CodeType>
+void expand_dictionary_codes(
+        const uint64_t* dictionary,
+        size_t dictionary_size,
+        const CodeType* codes,
+        size_t row_count,
+        uint64_t* out) {
+    if (row_count == 0)
+        return;
+
+    const auto max_code = *std::max_element(codes, codes + row_count);
+    util::check(static_cast<size_t>(max_code) < dictionary_size,
+                "Dictionary code {} out of range for dictionary of size {}", max_code, dictionary_size);
+    for (size_t i = 0; i < row_count; ++i)
+        out[i] = dictionary[codes[i]];
+}
+
+inline void expand_dictionary_codes(
+        const uint64_t* dictionary,
+        size_t dictionary_size,
+        const uint8_t* codes,
+        size_t code_width,
+        size_t row_count,
+        uint64_t* out) {
+    switch (code_width) {
+    case sizeof(uint8_t):
+        expand_dictionary_codes(dictionary, dictionary_size, codes, row_count, out);
+        break;
+    case sizeof(uint16_t):
+        expand_dictionary_codes(dictionary, dictionary_size, reinterpret_cast<const uint16_t*>(codes), row_count, out);
+        break;
+    case sizeof(uint32_t):
+        expand_dictionary_codes(dictionary, dictionary_size, reinterpret_cast<const uint32_t*>(codes), row_count, out);
+        break;
+    default:
+        util::raise_rte("Unexpected dictionary code width {}", code_width);
+    }
+}
+
+} // namespace arcticdb
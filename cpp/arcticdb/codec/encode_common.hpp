@@ -14,8 +14,10 @@
 #include <arcticdb/entity/protobufs.hpp>
 #include <arcticdb/column_store/memory_segment.hpp>
 #include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/codec/column_codec.hpp>
 
 #include <cstddef>
+#include <span>
 
 namespace arcticdb {
 
@@ -132,13 +134,12 @@ void calc_metadata_size(
 template<typename EncodingPolicyType>
 void calc_columns_size(
     const SegmentInMemory &in_mem_seg,
-    const arcticdb::proto::encoding::VariantCodec &codec_opts,
+    std::span<const arcticdb::proto::encoding::VariantCodec> codecs,
     SizeResult &result
 ) {
     for (std::size_t c = 0; c < in_mem_seg.num_columns(); ++c) {
         auto column_data = in_mem_seg.column_data(c);
-        const auto [uncompressed, required] = EncodingPolicyType::ColumnEncoder::max_compressed_size(codec_opts,
-                                                                                                     column_data);
+        const auto [uncompressed, required] = EncodingPolicyType::ColumnEncoder::max_compressed_size(codecs[c], column_data);
         result.uncompressed_bytes_ += uncompressed;
         result.max_compressed_bytes_ += required;
         ARCTICDB_TRACE(log::codec(),
@@ -220,12 +221,16 @@ void encode_string_pool(
     }
 }
 
+/// @param codecs The codec for each column of the segment, see column_codecs
 [[nodiscard]] SizeResult max_compressed_size_v1(
     const SegmentInMemory &in_mem_seg,
-    const arcticdb::proto::encoding::VariantCodec &codec_opts);
+    const arcticdb::proto::encoding::VariantCodec &codec_opts,
+    std::span<const arcticdb::proto::encoding::VariantCodec> codecs);
 
+/// @param codecs The codec for each column of the segment, see column_codecs
 [[nodiscard]] SizeResult max_compressed_size_v2(
     const SegmentInMemory &in_mem_seg,
-    const arcticdb::proto::encoding::VariantCodec &codec_opts);
+    const arcticdb::proto::encoding::VariantCodec &codec_opts,
+    std::span<const arcticdb::proto::encoding::VariantCodec> codecs);
 
 } //namespace arcticdb
\ No newline at end of file
@@ -87,13 +87,14 @@ namespace arcticdb {
 
     [[nodiscard]] SizeResult max_compressed_size_v1(
             const SegmentInMemory& in_mem_seg,
-            const arcticdb::proto::encoding::VariantCodec& codec_opts) {
+            const arcticdb::proto::encoding::VariantCodec& codec_opts,
+            std::span<const arcticdb::proto::encoding::VariantCodec> codecs) {
         ARCTICDB_SAMPLE(GetSegmentCompressedSize, 0)
         SizeResult result{};
         calc_metadata_size<EncodingPolicyV1>(in_mem_seg, codec_opts, result);
 
         if(in_mem_seg.row_count() > 0) {
-            calc_columns_size<EncodingPolicyV1>(in_mem_seg, codec_opts, result);
+            calc_columns_size<EncodingPolicyV1>(in_mem_seg, codecs, result);
             calc_string_pool_size<EncodingPolicyV1>(in_mem_seg, codec_opts, result);
         }
         ARCTICDB_TRACE(log::codec(), "Max compressed size {}", result.max_compressed_bytes_);
@@ -105,6 +106,14 @@ namespace arcticdb {
      * and based on the type of the column, calls the typed block encoder for that column.
      */
     [[nodiscard]] Segment encode_v1(SegmentInMemory&& s, const arcticdb::proto::encoding::VariantCodec &codec_opts) {
+        const auto codecs = column_codecs(s, codec_opts, EncodingVersion::V1);
+        return encode_v1(std::move(s), codec_opts, codecs);
+    }
+
+    [[nodiscard]] Segment encode_v1(
+            SegmentInMemory&& s,
+            const arcticdb::proto::encoding::VariantCodec &codec_opts,
+            const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs) {
         ARCTICDB_SAMPLE(EncodeSegment, 0)
         auto in_mem_seg = std::move(s);
         SegmentHeader segment_header{EncodingVersion::V1};
@@ -122,7 +131,7 @@ namespace arcticdb {
         std::ptrdiff_t pos = 0;
         static auto block_to_header_ratio = ConfigsMap::instance()->get_int("Codec.EstimatedHeaderRatio", 75);
         const auto preamble = in_mem_seg.num_blocks() * block_to_header_ratio;
-        auto [max_compressed_size, uncompressed_size, encoded_buffer_size] = max_compressed_size_v1(in_mem_seg, codec_opts);
+        auto [max_compressed_size, uncompressed_size, encoded_buffer_size] = max_compressed_size_v1(in_mem_seg, codec_opts, codecs);
         ARCTICDB_TRACE(log::codec(), "Estimated max buffer requirement: {}", max_compressed_size);
         auto out_buffer = std::make_shared<Buffer>(max_compressed_size, preamble);
         ColumnEncoderV1 encoder;
@@ -143,7 +152,7 @@ namespace arcticdb {
                 auto column_data = column.data();
                 auto* column_field = encoded_fields.add_field(column_data.num_blocks());
                 if(column_data.num_blocks() > 0) {
-                    encoder.encode(codec_opts, column_data, *column_field, *out_buffer, pos);
+                    encoder.encode(codecs[column_index], column_data, *column_field, *out_buffer, pos);
                     ARCTICDB_TRACE(log::codec(), "Encoded column {}: ({}) to position {}", column_index, in_mem_seg.descriptor().fields(column_index).name(),pos);
                 } else {
                     util::check(!must_contain_data(column_data.type()), "Column {} of type {} contains no blocks", column_index, column_data.type());
@@ -11,6 +11,7 @@
 #include <arcticdb/codec/magic_words.hpp>
 #include <arcticdb/column_store/memory_segment.hpp>
 #include <arcticdb/codec/segment_identifier.hpp>
+#include <arcticdb/codec/dictionary_encoding.hpp>
 
 namespace arcticdb {
 void add_bitmagic_compressed_size(
@@ -169,6 +170,51 @@ std::pair<size_t, size_t> ColumnEncoderV2::max_compressed_size(
 
 using EncodingPolicyV2 = EncodingPolicyType<EncodingVersion::V2, ColumnEncoderV2>;
 
+template<DataType data_type>
+static void encode_dictionary_block(
+        const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        const uint8_t* data,
+        size_t row_count,
+        EncodedFieldImpl& field,
+        Buffer& out,
+        std::ptrdiff_t& pos) {
+    using TDT = ScalarTagType<DataTypeTag<data_type>>;
+    using RawType = typename TDT::DataTypeTag::raw_type;
+    using Encoder = TypedBlockEncoderImpl<TypedBlockData, TDT, EncodingVersion::V2>;
+    const TypedBlockData<TDT> block{reinterpret_cast<const RawType*>(data), nullptr, row_count * sizeof(RawType), row_count, nullptr};
+    Encoder::encode_values(codec_opts, block, field, out, pos);
+}
+
+/// @brief Writes a dictionary encoded column as the dictionary block followed by the codes block, see
+/// DictionaryEncodedColumn. The sparse map, if any, is written after the codes exactly as for an ndarray field.
+static void encode_dictionary(
+        const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        const DictionaryEncodedColumn& dictionary,
+        ColumnData& column_data,
+        EncodedFieldImpl& field,
+        Buffer& out,
+        std::ptrdiff_t& pos) {
+    const auto* dictionary_data = reinterpret_cast<const uint8_t*>(dictionary.dictionary_.data());
+    encode_dictionary_block<DataType::UINT64>(codec_opts, dictionary_data, dictionary.dictionary_.size(), field, out, pos);
+    const auto* codes_data = dictionary.codes_.data();
+    switch (dictionary.code_width_) {
+    case sizeof(uint8_t):
+        encode_dictionary_block<DataType::UINT8>(codec_opts, codes_data, dictionary.row_count_, field, out, pos);
+        break;
+    case sizeof(uint16_t):
+        encode_dictionary_block<DataType::UINT16>(codec_opts, codes_data, dictionary.row_count_, field, out, pos);
+        break;
+    case sizeof(uint32_t):
+        encode_dictionary_block<DataType::UINT32>(codec_opts, codes_data, dictionary.row_count_, field, out, pos);
+        break;
+    default:
+        util::raise_rte("Unexpected dictionary code width {}", dictionary.code_width_);
+    }
+    encode_sparse_map(column_data, field, out, pos);
+    field.mutable_dictionary()->set_items_count(static_cast<uint32_t>(dictionary.row_count_));
+}
+
+
 static void encode_field_descriptors(
         const SegmentInMemory& in_mem_seg,
         SegmentHeader& segment_header,
@@ -214,12 +260,14 @@ static void encode_index_descriptors(
     if(col.type().dimension() != entity::Dimension::Dim0)
         bytes += sizeof(EncodedBlock);
 
-    bytes += sizeof(EncodedBlock) * col.num_blocks();
+    // Dictionary encoded columns always have exactly two value blocks, whatever the number of blocks in the column
+    const auto num_blocks = may_dictionary_encode(col.type()) ? std::max(col.num_blocks(), DictionaryEncodedColumn::num_blocks) : col.num_blocks();
+    bytes += sizeof(EncodedBlock) * num_blocks;
     ARCTICDB_TRACE(log::version(), "Encoded block size: {} + shapes({}) + {} * {} = {}",
         EncodedFieldImpl::Size,
         col.type().dimension() != entity::Dimension::Dim0 ? sizeof(EncodedBlock) : 0u,
         sizeof(EncodedBlock),
-        col.num_blocks(),
+        num_blocks,
         bytes);
 
     return bytes;
@@ -274,7 +322,8 @@ static void calc_stream_descriptor_fields_size(
 
 [[nodiscard]] SizeResult max_compressed_size_v2(
         const SegmentInMemory& in_mem_seg,
-        const arcticdb::proto::encoding::VariantCodec& codec_opts) {
+        const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        std::span<const arcticdb::proto::encoding::VariantCodec> codecs) {
     ARCTICDB_SAMPLE(GetSegmentCompressedSize, 0)
     SizeResult result{};
     result.max_compressed_bytes_ += sizeof(MetadataMagic);
@@ -288,7 +337,7 @@ static void calc_stream_descriptor_fields_size(
     // Calculate fields collection size
     if(in_mem_seg.row_count() > 0) {
         result.max_compressed_bytes_ += sizeof(ColumnMagic) * in_mem_seg.descriptor().field_count();
-        calc_columns_size<EncodingPolicyV2>(in_mem_seg, codec_opts, result);
+        calc_columns_size<EncodingPolicyV2>(in_mem_seg, codecs, result);
         result.max_compressed_bytes_ += sizeof(StringPoolMagic);
         calc_string_pool_size<EncodingPolicyV2>(in_mem_seg, codec_opts, result);
     }
@@ -316,6 +365,14 @@ static void encode_encoded_fields(
 [[nodiscard]] Segment encode_v2(
         SegmentInMemory&& s,
         const arcticdb::proto::encoding::VariantCodec &codec_opts) {
+    const auto codecs = column_codecs(s, codec_opts, EncodingVersion::V2);
+    return encode_v2(std::move(s), codec_opts, codecs);
+}
+
+[[nodiscard]] Segment encode_v2(
+        SegmentInMemory&& s,
+        const arcticdb::proto::encoding::VariantCodec &codec_opts,
+        const std::vector<arcticdb::proto::encoding::VariantCodec>& codecs) {
     ARCTICDB_SAMPLE(EncodeSegment, 0)
     auto in_mem_seg = std::move(s);
 
@@ -329,7 +386,7 @@ static void encode_encoded_fields(
     segment_header.set_compacted(in_mem_seg.compacted());
 
     std::ptrdiff_t pos = 0;
-    auto [max_compressed_size, uncompressed_size, encoded_buffer_size] = max_compressed_size_v2(in_mem_seg, codec_opts);
+    auto [max_compressed_size, uncompressed_size, encoded_buffer_size] = max_compressed_size_v2(in_mem_seg, codec_opts, codecs);
     ARCTICDB_TRACE(log::codec(), "Estimated max buffer requirement: {}", max_compressed_size);
     const auto preamble = SegmentHeader::required_bytes(in_mem_seg);
     auto out_buffer = std::make_shared<Buffer>(max_compressed_size + encoded_buffer_size, preamble);
@@ -360,14 +417,18 @@ static void encode_encoded_fields(
             util::check(!is_arrow_output_only_type(column.type()),
                 "Attempts to encode an output only type {}", column.type());
             auto column_data = column.data();
-            auto* column_field = encoded_fields.add_field(column_data.num_blocks());
+            auto dictionary = dictionary_encode(column_data);
+            auto* column_field = encoded_fields.add_field(dictionary ? DictionaryEncodedColumn::num_blocks : column_data.num_blocks());
             if(column.has_statistics())
                 column_field->set_statistics(column.get_statistics());
 
             ARCTICDB_TRACE(log::codec(),"Beginning encoding of column {}: ({}) to position {}", column_index, in_mem_seg.descriptor().field(column_index).name(), pos);
 
-            if(column_data.num_blocks() > 0) {
-                encoder.encode(codec_opts, column_data, *column_field, *out_buffer, pos);
+            if(dictionary) {
+                encode_dictionary(codec_opts, *dictionary, column_data, *column_field, *out_buffer, pos);
+                ARCTICDB_TRACE(log::codec(), "Dictionary encoded column {}: ({}) to position {}", column_index, in_mem_seg.descriptor().field(column_index).name(), pos);
+            } else if(column_data.num_blocks() > 0) {
+                encoder.encode(codecs[column_index], column_data, *column_field, *out_buffer, pos);
                 ARCTICDB_TRACE(log::codec(), "Encoded column {}: ({}) to position {}", column_index, in_mem_seg.descriptor().field(column_index).name(), pos);
             } else {
                 util::check(!must_contain_data(column_data.type()), "Column {} of type {} contains no blocks", column_index, column_data.type());
@@ -401,6 +401,20 @@ struct EncodedFieldImpl : public EncodedField {
         return type_ == EncodedFieldType::NDARRAY;
     }
 
+    // Dictionary fields share the block layout of ndarray fields, see DictionaryEncodedColumn
+    EncodedFieldImpl *mutable_dictionary() {
+        type_ = EncodedFieldType::DICTIONARY;
+        return this;
+    }
+
+    [[nodiscard]] const EncodedFieldImpl &dictionary() const {
+        return *this;
+    }
+
+    [[nodiscard]] bool has_dictionary() const {
+        return type_ == EncodedFieldType::DICTIONARY;
+    }
+
     [[nodiscard]] std::string DebugString() const {
         return fmt::format("{}: {} shapes {} values", has_ndarray() ? "NDARRAY" : "DICT", shapes_size(), values_size());
     }
@@ -68,15 +68,32 @@ inline std::size_t field_compressed_size(const EncodedFieldImpl &field) {
 switch (field.encoding_case()) {
     case EncodedFieldType::NDARRAY:
         return ndarray_field_compressed_size(field.ndarray());
+    case EncodedFieldType::DICTIONARY:
+        return ndarray_field_compressed_size(field.dictionary());
     default:
         util::raise_rte("Unsupported encoding {}", field.DebugString());
 }
 }
 
+/// Size of the values once decoded. For dictionary encoded fields this is the size of the string pool offsets the
+/// codes expand to, rather than the size of the dictionary and codes blocks.
+inline std::size_t decoded_data_size(const EncodedFieldImpl &field) {
+    switch (field.encoding_case()) {
+    case EncodedFieldType::NDARRAY:
+        return data_uncompressed_size(field.ndarray());
+    case EncodedFieldType::DICTIONARY:
+        return field.dictionary().items_count() * sizeof(uint64_t);
+    default:
+        util::raise_rte("Unsupported encoding {}", field.DebugString());
+    }
+}
+
 inline std::size_t field_uncompressed_size(const EncodedFieldImpl &field) {
     switch (field.encoding_case()) {
     case EncodedFieldType::NDARRAY:
         return uncompressed_size(field.ndarray());
+    case EncodedFieldType::DICTIONARY:
+        return decoded_data_size(field) + bitmap_serialized_size(field.dictionary());
     default:
         util::raise_rte("Unsupported encoding {}", field.DebugString());
     }
@@ -0,0 +1,39 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/codec/lightweight_encoding.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+namespace arcticdb {
+
+bool lightweight_encodings_enabled() {
+    return ConfigsMap::instance()->get_int("Codec.LightweightEncodings", 0) == 1;
+}
+
+std::optional<arcticdb::proto::encoding::VariantCodec> lightweight_codec(const TypeDescriptor& type) {
+    using TurboPfor = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+    if (type.dimension() != Dimension::Dim0)
+        return std::nullopt;
+
+    const auto data_type = type.data_type();
+    std::optional<TurboPfor::SubCodecs> sub_codec;
+    if (is_time_type(data_type))
+        sub_codec = TurboPfor::P4_DELTA;
+    else if (is_integer_type(data_type) || is_bool_type(data_type))
+        sub_codec = TurboPfor::P4;
+    else if (is_floating_point_type(data_type))
+        sub_codec = TurboPfor::FP_XOR;
+
+    if (!sub_codec)
+        return std::nullopt;
+
+    arcticdb::proto::encoding::VariantCodec codec;
+    codec.mutable_tp4()->set_sub_codec(*sub_codec);
+    return codec;
+}
+
+} // namespace arcticdb
@@ -0,0 +1,25 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/entity/protobufs.hpp>
+#include <arcticdb/entity/types.hpp>
+
+#include <optional>
+
+namespace arcticdb {
+
+/// Controlled by Codec.LightweightEncodings, off by default as older clients cannot read lightweight encoded blocks
+bool lightweight_encodings_enabled();
+
+/// @brief The lightweight encoding suited to values of the given type, see arcticdb::detail::PforBlockEncoder.
+/// Timestamps are delta encoded, other integers and bools are frame-of-reference encoded and floating point values
+/// are XOR encoded. Returns std::nullopt for strings and multidimensional columns.
+std::optional<arcticdb::proto::encoding::VariantCodec> lightweight_codec(const TypeDescriptor& type);
+
+} // namespace arcticdb
@@ -0,0 +1,364 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/codec/core.hpp>
+#include <arcticdb/codec/protobuf_mappings.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+namespace arcticdb::detail {
+
+/// Lightweight, type-aware encodings stored in the PFOR (protobuf tp4) codec slot. Unlike LZ4 and ZSTD these know
+/// the type of the values they encode:
+///  - P4: frame-of-reference. Values are split into frames of up to 128, and each frame is stored as its minimum
+///    followed by the differences from that minimum, bit-packed to the width of the largest difference.
+///  - P4_DELTA: the first value, then the differences between consecutive values encoded as P4. Monotonic
+///    timestamps sampled at a regular interval pack to a few bits per frame.
+///  - FP_XOR: each floating point value is XORed with the previous one, and only the bytes between the leading and
+///    trailing zero bytes of the result are stored, after a one byte header holding their count and position.
+///    Series whose consecutive values are close share their sign, exponent and high mantissa bits.
+/// Bools are encoded as single byte integers. All formats are little-endian, as are the other codecs.
+namespace pfor {
+
+constexpr size_t values_per_frame = 128;
+
+template<typename T>
+using StorageType = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+
+template<typename T>
+constexpr bool is_integer_encodable = std::is_integral_v<T>;
+
+template<typename T>
+constexpr bool is_float_encodable = std::is_floating_point_v<T>;
+
+[[nodiscard]] constexpr uint64_t low_bits_mask(size_t width) {
+    return width >= 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+}
+
+[[nodiscard]] constexpr size_t packed_bytes(size_t count, size_t width) {
+    return (count * width + 7) / 8;
+}
+
+/// Appends values of a fixed bit width, least significant bit first. Values must fit in the width.
+class BitWriter {
+public:
+    explicit BitWriter(uint8_t* out) : out_(out) {}
+
+    void write(uint64_t value, size_t width) {
+        if (width == 0)
+            return;
+
+        acc_ |= value << bits_;
+        if (bits_ + width >= 64) {
+            std::memcpy(out_, &acc_, sizeof(acc_));
+            out_ += sizeof(acc_);
+            acc_ = bits_ == 0 ? 0 : value >> (64 - bits_);
+            bits_ = bits_ + width - 64;
+        } else {
+            bits_ += width;
+        }
+    }
+
+    /// Writes out the last partial word, returning the position after it
+    uint8_t* flush() {
+        const auto bytes = (bits_ + 7) / 8;
+        std::memcpy(out_, &acc_, bytes);
+        out_ += bytes;
+        acc_ = 0;
+        bits_ = 0;
+        return out_;
+    }
+
+private:
+    uint8_t* out_;
+    uint64_t acc_ = 0;
+    size_t bits_ = 0;
+};
+
+/// Reads back values written by BitWriter, never reading past end
+class BitReader {
+public:
+    BitReader(const uint8_t* in, const uint8_t* end) : in_(in), end_(end) {}
+
+    uint64_t read(size_t width) {
+        if (width == 0)
+            return 0;
+
+        uint64_t res;
+        if (bits_ >= width) {
+            res = acc_;
+            acc_ = width == 64 ? 0 : acc_ >> width;
+            bits_ -= width;
+        } else {
+            const auto bytes = std::min(sizeof(uint64_t), static_cast<size_t>(end_ - in_));
+            uint64_t next = 0;
+            std::memcpy(&next, in_, bytes);
+            in_ += bytes;
+            const auto needed = width - bits_;
+            util::check(needed <= bytes * 8, "Lightweight encoded block is truncated");
+            res = acc_ | (next << bits_);
+            acc_ = needed == 64 ? 0 : next >> needed;
+            bits_ = bytes * 8 - needed;
+        }
+        return res & low_bits_mask(width);
+    }
+
+private:
+    const uint8_t* in_;
+    const uint8_t* end_;
+    uint64_t acc_ = 0;
+    size_t bits_ = 0;
+};
+
+template<typename T>
+uint8_t* encode_frame(const T* in, size_t count, uint8_t* out) {
+    using U = std::make_unsigned_t<T>;
+    const auto [min_it, max_it] = std::minmax_element(in, in + count);
+    const auto min = *min_it;
+    const auto width = static_cast<uint8_t>(std::bit_width(static_cast<U>(static_cast<U>(*max_it) - static_cast<U>(min))));
+    std::memcpy(out, &min, sizeof(T));
+    out += sizeof(T);
+    *out++ = width;
+    BitWriter writer(out);
+    for (size_t i = 0; i < count; ++i)
+        writer.write(static_cast<U>(static_cast<U>(in[i]) - static_cast<U>(min)), width);
+
+    return writer.flush();
+}
+
+template<typename T>
+const uint8_t* decode_frame(const uint8_t* in, const uint8_t* end, size_t count, T* out) {
+    using U = std::make_unsigned_t<T>;
+    util::check(static_cast<size_t>(end - in) >= sizeof(T) + 1, "Lightweight encoded block is truncated");
+    T min;
+    std::memcpy(&min, in, sizeof(T));
+    in += sizeof(T);
+    const size_t width = *in++;
+    util::check(width <= sizeof(T) * 8, "Unexpected bit width {} for values of {} bytes", width, sizeof(T));
+    const auto frame_bytes = packed_bytes(count, width);
+    util::check(static_cast<size_t>(end - in) >= frame_bytes, "Lightweight encoded block is truncated");
+    BitReader reader(in, in + frame_bytes);
+    for (size_t i = 0; i < count; ++i)
+        out[i] = static_cast<T>(static_cast<U>(static_cast<U>(min) + static_cast<U>(reader.read(width))));
+
+    return in + frame_bytes;
+}
+
+template<typename T>
+uint8_t* encode_for(const T* in, size_t count, uint8_t* out) {
+    for (size_t start = 0; start < count; start += values_per_frame)
+        out = encode_frame(in + start, std::min(values_per_frame, count - start), out);
+
+    return out;
+}
+
+template<typename T>
+void decode_for(const uint8_t* in, const uint8_t* end, size_t count, T* out) {
+    for (size_t start = 0; start < count; start += values_per_frame)
+        in = decode_frame(in, end, std::min(values_per_frame, count - start), out + start);
+}
+
+// Differences are taken modulo the width of the type and stored as signed, so that a decreasing step packs as
+// narrowly as an increasing one
+template<typename T>
+uint8_t* encode_delta(const T* in, size_t count, uint8_t* out) {
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<T>;
+    if (count == 0)
+        return out;
+
+    std::memcpy(out, in, sizeof(T));
+    out += sizeof(T);
+    std::array<S, values_per_frame> deltas;
+    auto previous = static_cast<U>(in[0]);
+    for (size_t start = 0; start < count; start += values_per_frame) {
+        const auto frame_count = std::min(values_per_frame, count - start);
+        for (size_t i = 0; i < frame_count; ++i) {
+            const auto value = static_cast<U>(in[start + i]);
+            deltas[i] = static_cast<S>(static_cast<U>(value - previous));
+            previous = value;
+        }
+        out = encode_frame(deltas.data(), frame_count, out);
+    }
+    return out;
+}
+
+template<typename T>
+void decode_delta(const uint8_t* in, const uint8_t* end, size_t count, T* out) {
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<T>;
+    if (count == 0)
+        return;
+
+    util::check(static_cast<size_t>(end - in) >= sizeof(T), "Lightweight encoded block is truncated");
+    U previous;
+    std::memcpy(&previous, in, sizeof(T));
+    in += sizeof(T);
+    std::array<S, values_per_frame> deltas;
+    for (size_t start = 0; start < count; start += values_per_frame) {
+        const auto frame_count = std::min(values_per_frame, count - start);
+        in = decode_frame(in, end, frame_count, deltas.data());
+        for (size_t i = 0; i < frame_count; ++i) {
+            previous = static_cast<U>(previous + static_cast<U>(deltas[i]));
+            out[start + i] = static_cast<T>(previous);
+        }
+    }
+}
+
+template<typename T>
+using FloatBits = std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t, uint32_t>;
+
+template<typename T>
+uint8_t* encode_xor(const T* in, size_t count, uint8_t* out) {
+    using U = FloatBits<T>;
+    U previous = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const auto bits = std::bit_cast<U>(in[i]);
+        const U x = bits ^ previous;
+        previous = bits;
+        if (x == 0) {
+            *out++ = 0;
+            continue;
+        }
+        const auto leading = static_cast<size_t>(std::countl_zero(x)) / 8;
+        const auto trailing = static_cast<size_t>(std::countr_zero(x)) / 8;
+        const auto meaningful = sizeof(U) - leading - trailing;
+        *out++ = static_cast<uint8_t>(trailing << 4 | meaningful);
+        const U shifted = x >> (8 * trailing);
+        std::memcpy(out, &shifted, meaningful);
+        out += meaningful;
+    }
+    return out;
+}
+
+template<typename T>
+void decode_xor(const uint8_t* in, const uint8_t* end, size_t count, T* out) {
+    using U = FloatBits<T>;
+    U previous = 0;
+    for (size_t i = 0; i < count; ++i) {
+        util::check(in < end, "Lightweight encoded block is truncated");
+        const auto header = *in++;
+        const size_t trailing = header >> 4;
+        const size_t meaningful = header & 0xF;
+        util::check(trailing + meaningful <= sizeof(U) && static_cast<size_t>(end - in) >= meaningful,
+                    "Invalid XOR encoded value header {}", header);
+        if (meaningful != 0) {
+            U x = 0;
+            std::memcpy(&x, in, meaningful);
+            in += meaningful;
+            previous ^= x << (8 * trailing);
+        }
+        out[i] = std::bit_cast<T>(previous);
+    }
+}
+
+} // namespace pfor
+
+struct PforBlockEncoder {
+
+    using Opts = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+    static constexpr std::uint32_t VERSION = 1;
+
+    // The worst cases are values that do not compress at all plus the frame headers, or a one byte header per
+    // four byte float for FP_XOR
+    static std::size_t max_compressed_size(std::size_t size) {
+        return size + size / 4 + 64;
+    }
+
+    static void set_shape_defaults(Opts &opts) {
+        opts.set_sub_codec(Opts::P4);
+    }
+
+    template<class T, class CodecType>
+    static std::size_t encode_block(
+            const Opts& opts,
+            const T *in,
+            BlockDataHelper &block_utils,
+            HashAccum &hasher,
+            T *out,
+            std::size_t out_capacity,
+            std::ptrdiff_t &pos,
+            CodecType& out_codec) {
+        using S = pfor::StorageType<T>;
+        const auto* values = reinterpret_cast<const S*>(in);
+        const auto count = block_utils.bytes_ / sizeof(T);
+        auto* begin = reinterpret_cast<uint8_t*>(out);
+        uint8_t* end = nullptr;
+        if constexpr (pfor::is_integer_encodable<S>) {
+            switch (opts.sub_codec()) {
+            case Opts::P4:
+                end = pfor::encode_for(values, count, begin);
+                break;
+            case Opts::P4_DELTA:
+                end = pfor::encode_delta(values, count, begin);
+                break;
+            default:
+                util::raise_rte("Unsupported lightweight encoding {} for integer values", Opts::SubCodecs_Name(opts.sub_codec()));
+            }
+        } else if constexpr (pfor::is_float_encodable<S>) {
+            util::check(opts.sub_codec() == Opts::FP_XOR,
+                        "Unsupported lightweight encoding {} for floating point values", Opts::SubCodecs_Name(opts.sub_codec()));
+            end = pfor::encode_xor(values, count, begin);
+        } else {
+            util::raise_rte("Lightweight encodings do not support values of {} bytes", sizeof(T));
+        }
+        const auto compressed_bytes = static_cast<std::size_t>(end - begin);
+        util::check(compressed_bytes <= out_capacity,
+                    "Lightweight encoding wrote {} bytes into a buffer of {}", compressed_bytes, out_capacity);
+        ARCTICDB_TRACE(log::storage(), "Block of size {} encoded to {} bytes: {}", block_utils.bytes_, compressed_bytes, dump_bytes(out, compressed_bytes, 10U));
+        hasher(in, block_utils.count_);
+        pos += ssize_t(compressed_bytes);
+        copy_codec(*out_codec.mutable_pfor(), opts);
+        return compressed_bytes;
+    }
+};
+
+struct PforDecoder {
+    template<typename T>
+    static void decode_block(
+            [[maybe_unused]] std::uint32_t encoder_version,
+            std::uint32_t sub_codec,
+            const std::uint8_t* in,
+            std::size_t in_bytes,
+            T* t_out,
+            std::size_t out_bytes) {
+        using Opts = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+        using S = pfor::StorageType<T>;
+        ARCTICDB_TRACE(log::codec(), "Lightweight decoder reading block: {} {}", in_bytes, out_bytes);
+        util::check(out_bytes % sizeof(T) == 0, "Decoded size {} is not a multiple of the value size {}", out_bytes, sizeof(T));
+        auto* values = reinterpret_cast<S*>(t_out);
+        const auto count = out_bytes / sizeof(T);
+        const auto* end = in + in_bytes;
+        if constexpr (pfor::is_integer_encodable<S>) {
+            switch (sub_codec) {
+            case Opts::P4:
+                pfor::decode_for(in, end, count, values);
+                break;
+            case Opts::P4_DELTA:
+                pfor::decode_delta(in, end, count, values);
+                break;
+            default:
+                util::raise_rte("Unsupported lightweight encoding {} for integer values", sub_codec);
+            }
+        } else if constexpr (pfor::is_float_encodable<S>) {
+            util::check(sub_codec == Opts::FP_XOR, "Unsupported lightweight encoding {} for floating point values", sub_codec);
+            pfor::decode_xor(in, end, count, values);
+        } else {
+            util::raise_rte("Lightweight encodings do not support values of {} bytes", sizeof(T));
+        }
+    }
+};
+
+} // namespace arcticdb::detail
@@ -28,6 +28,10 @@ inline void copy_codec(Lz4Codec& codec, const arcticdb::proto::encoding::Variant
     codec.acceleration_ = lz4.acceleration();
 }
 
+inline void copy_codec(PforCodec& codec, const arcticdb::proto::encoding::VariantCodec::TurboPfor& tp4) {
+    codec.sub_codec_ = static_cast<uint32_t>(tp4.sub_codec());
+}
+
 inline void copy_codec(PassthroughCodec&, const arcticdb::proto::encoding::VariantCodec::Passthrough&) {
     // No data in passthrough
 }
@@ -58,6 +62,10 @@ inline void set_zstd(const ZstdCodec& zstd_in, arcticdb::proto::encoding::Varian
     zstd_out.set_level(zstd_in.level_);
 }
 
+inline void set_pfor(const PforCodec& pfor_in, arcticdb::proto::encoding::VariantCodec::TurboPfor& pfor_out) {
+    pfor_out.set_sub_codec(static_cast<arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs>(pfor_in.sub_codec_));
+}
+
 inline void set_passthrough(const PassthroughCodec& passthrough_in, arcticdb::proto::encoding::VariantCodec::Passthrough& passthrough_out) {
     passthrough_out.set_mark(passthrough_in.unused_);
 }
@@ -0,0 +1,170 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <arcticdb/codec/lz4.hpp>
+#include <arcticdb/codec/pfor.hpp>
+
+using namespace arcticdb;
+
+// Compares the lightweight encodings with LZ4 on synthetic tick data. The ratio counter is the uncompressed size
+// divided by the encoded size, and bytes_per_second is measured against the uncompressed size.
+// run like: --benchmark_time_unit=us --benchmark_filter=BM_lightweight.* --benchmark_min_time=5x
+
+namespace {
+
+constexpr size_t num_ticks = 100'000;
+
+enum class TickColumn : int64_t {
+    TIMESTAMP,
+    PRICE,
+    SIZE
+};
+
+enum class BenchmarkCodec : int64_t {
+    LZ4,
+    LIGHTWEIGHT
+};
+
+// Ticks arrive a few hundred microseconds apart, with jitter
+std::vector<timestamp> tick_timestamps() {
+    std::mt19937_64 gen(42);
+    std::exponential_distribution<double> gaps(1.0 / 300'000.0);
+    std::vector<timestamp> res(num_ticks);
+    timestamp time = 1'700'000'000'000'000'000;
+    for (auto& value : res) {
+        time += 1 + static_cast<timestamp>(gaps(gen));
+        value = time;
+    }
+    return res;
+}
+
+// A random walk on a one cent tick size, often unchanged between ticks
+std::vector<double> tick_prices() {
+    std::mt19937_64 gen(43);
+    std::discrete_distribution<int> moves({5, 90, 5});
+    std::vector<double> res(num_ticks);
+    int64_t cents = 10'000;
+    for (auto& value : res) {
+        cents += moves(gen) - 1;
+        value = static_cast<double>(cents) / 100.0;
+    }
+    return res;
+}
+
+// Mostly round lots
+std::vector<int64_t> tick_sizes() {
+    std::mt19937_64 gen(44);
+    std::uniform_int_distribution<int64_t> lots(1, 10);
+    std::uniform_int_distribution<int64_t> odd_lots(1, 99);
+    std::bernoulli_distribution is_odd_lot(0.2);
+    std::vector<int64_t> res(num_ticks);
+    for (auto& value : res)
+        value = is_odd_lot(gen) ? odd_lots(gen) : 100 * lots(gen);
+
+    return res;
+}
+
+arcticdb::proto::encoding::VariantCodec::TurboPfor lightweight_opts(TickColumn column) {
+    arcticdb::proto::encoding::VariantCodec::TurboPfor opts;
+    switch (column) {
+    case TickColumn::TIMESTAMP:
+        opts.set_sub_codec(opts.P4_DELTA);
+        break;
+    case TickColumn::PRICE:
+        opts.set_sub_codec(opts.FP_XOR);
+        break;
+    case TickColumn::SIZE:
+        opts.set_sub_codec(opts.P4);
+        break;
+    }
+    return opts;
+}
+
+template<typename T>
+size_t encode(BenchmarkCodec codec, TickColumn column, const std::vector<T>& values, std::vector<uint8_t>& out, BlockCodecImpl& block_codec) {
+    const auto bytes = values.size() * sizeof(T);
+    detail::BlockDataHelper helper{values.size(), bytes};
+    HashAccum hasher;
+    std::ptrdiff_t pos = 0;
+    if (codec == BenchmarkCodec::LZ4) {
+        out.resize(detail::Lz4BlockEncoder::max_compressed_size(bytes));
+        arcticdb::proto::encoding::VariantCodec::Lz4 opts;
+        opts.set_acceleration(1);
+        return detail::Lz4BlockEncoder::encode_block(opts, values.data(), helper, hasher, reinterpret_cast<T*>(out.data()), out.size(), pos, block_codec);
+    } else {
+        out.resize(detail::PforBlockEncoder::max_compressed_size(bytes));
+        return detail::PforBlockEncoder::encode_block(lightweight_opts(column), values.data(), helper, hasher, reinterpret_cast<T*>(out.data()), out.size(), pos, block_codec);
+    }
+}
+
+template<typename T>
+void decode(const BlockCodecImpl& block_codec, const std::vector<uint8_t>& in, size_t in_bytes, std::vector<T>& out) {
+    if (block_codec.codec_type() == Codec::LZ4)
+        detail::Lz4Decoder::decode_block(detail::Lz4BlockEncoder::VERSION, in.data(), in_bytes, out.data(), out.size() * sizeof(T));
+    else
+        detail::PforDecoder::decode_block(detail::PforBlockEncoder::VERSION, block_codec.pfor().sub_codec_, in.data(), in_bytes, out.data(), out.size() * sizeof(T));
+}
+
+template<typename Func>
+void visit_tick_column(TickColumn column, Func&& func) {
+    switch (column) {
+    case TickColumn::TIMESTAMP:
+        func(tick_timestamps());
+        break;
+    case TickColumn::PRICE:
+        func(tick_prices());
+        break;
+    case TickColumn::SIZE:
+        func(tick_sizes());
+        break;
+    }
+}
+
+} // namespace
+
+static void BM_lightweight_encode(benchmark::State& state) {
+    const auto column = static_cast<TickColumn>(state.range(0));
+    const auto codec = static_cast<BenchmarkCodec>(state.range(1));
+    visit_tick_column(column, [&](const auto& values) {
+        const auto bytes = values.size() * sizeof(values[0]);
+        std::vector<uint8_t> out;
+        size_t encoded_bytes = 0;
+        for (auto _ : state) {
+            BlockCodecImpl block_codec;
+            encoded_bytes = encode(codec, column, values, out, block_codec);
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+        state.counters["ratio"] = static_cast<double>(bytes) / static_cast<double>(encoded_bytes);
+    });
+}
+
+static void BM_lightweight_decode(benchmark::State& state) {
+    const auto column = static_cast<TickColumn>(state.range(0));
+    const auto codec = static_cast<BenchmarkCodec>(state.range(1));
+    visit_tick_column(column, [&](const auto& values) {
+        const auto bytes = values.size() * sizeof(values[0]);
+        std::vector<uint8_t> encoded;
+        BlockCodecImpl block_codec;
+        const auto encoded_bytes = encode(codec, column, values, encoded, block_codec);
+        auto out = values;
+        for (auto _ : state) {
+            decode(block_codec, encoded, encoded_bytes, out);
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+        state.counters["ratio"] = static_cast<double>(bytes) / static_cast<double>(encoded_bytes);
+    });
+}
+
+// Args are the tick column (timestamp, price, size) and the codec (LZ4, lightweight)
+BENCHMARK(BM_lightweight_encode)->ArgsProduct({{0, 1, 2}, {0, 1}});
+BENCHMARK(BM_lightweight_decode)->ArgsProduct({{0, 1, 2}, {0, 1}});
@@ -14,9 +14,15 @@
 #include <arcticdb/stream/row_builder.hpp>
 #include <arcticdb/stream/aggregator.hpp>
 #include <arcticdb/codec/typed_block_encoder_impl.hpp>
+#include <arcticdb/codec/column_codec.hpp>
+#include <arcticdb/codec/lightweight_encoding.hpp>
+#include <arcticdb/codec/zstd_dictionary.hpp>
 
 #include <gtest/gtest.h>
 
+#include <bit>
+#include <random>
+
 namespace arcticdb {
     struct ColumnEncoderV1 {
         static std::pair<size_t, size_t> max_compressed_size(
@@ -592,6 +598,75 @@ TEST(Segment, RoundtripStatisticsV2) {
     ASSERT_EQ(col2_stats.get_unique_count(), 10);
 }
 
+TEST(Segment, RoundtripDictionaryEncodedStringsV2) {
+    ScopedConfig dictionary_encode("Codec.DictionaryEncodeStrings", 1);
+    const auto stream_desc = stream_descriptor(StreamId{"thing"}, RowCountIndex{}, {
+        scalar_field(DataType::UTF_DYNAMIC64, "low_cardinality"),
+        scalar_field(DataType::UTF_DYNAMIC64, "high_cardinality")
+    });
+
+    SegmentInMemory in_mem_seg{stream_desc.clone()};
+    const std::array<std::string, 3> sides{"buy", "sell", "cross"};
+    constexpr size_t num_rows = 1000;
+    for(auto i = 0UL; i < num_rows; ++i) {
+        in_mem_seg.set_string(0, sides[i % sides.size()]);
+        in_mem_seg.set_string(1, fmt::format("order_{}", i));
+        in_mem_seg.end_row();
+    }
+    auto copy = in_mem_seg.clone();
+    auto seg = encode_v2(std::move(in_mem_seg), codec::default_lz4_codec());
+    std::vector<uint8_t> vec;
+    const auto bytes = seg.calculate_size();
+    vec.resize(bytes);
+    seg.write_to(vec.data());
+    auto unserialized = Segment::from_bytes(vec.data(), bytes);
+    const auto& body_fields = unserialized.header().body_fields();
+    ASSERT_TRUE(body_fields.at(0).has_dictionary());
+    ASSERT_EQ(body_fields.at(0).items_count(), num_rows);
+    ASSERT_TRUE(body_fields.at(1).has_ndarray());
+
+    SegmentInMemory decoded{stream_desc.clone()};
+    decode_v2(unserialized, unserialized.header(), decoded, unserialized.descriptor());
+    ASSERT_EQ(decoded.row_count(), num_rows);
+    for(auto i = 0UL; i < num_rows; ++i) {
+        ASSERT_EQ(decoded.string_at(i, 0), copy.string_at(i, 0));
+        ASSERT_EQ(decoded.string_at(i, 1), copy.string_at(i, 1));
+    }
+}
+
+TEST(Segment, DictionaryEncodingDisabledByDefaultV2) {
+    const auto stream_desc = stream_descriptor(StreamId{"thing"}, RowCountIndex{}, {
+        scalar_field(DataType::UTF_DYNAMIC64, "low_cardinality")
+    });
+
+    SegmentInMemory in_mem_seg{stream_desc.clone()};
+    for(auto i = 0UL; i < 1000; ++i) {
+        in_mem_seg.set_string(0, i % 2 == 0 ? "buy" : "sell");
+        in_mem_seg.end_row();
+    }
+    auto seg = encode_v2(std::move(in_mem_seg), codec::default_lz4_codec());
+    std::vector<uint8_t> vec;
+    const auto bytes = seg.calculate_size();
+    vec.resize(bytes);
+    seg.write_to(vec.data());
+    auto unserialized = Segment::from_bytes(vec.data(), bytes);
+    ASSERT_TRUE(unserialized.header().body_fields().at(0).has_ndarray());
+}
+
+TEST(DictionaryEncoding, ExpandCodes) {
+    const std::vector<uint64_t> dictionary{10, 20, 30};
+    const std::vector<uint16_t> codes{2, 0, 1, 1, 2};
+    std::vector<uint64_t> out(codes.size());
+    expand_dictionary_codes(dictionary.data(), dictionary.size(), reinterpret_cast<const uint8_t*>(codes.data()), sizeof(uint16_t), codes.size(), out.data());
+    ASSERT_EQ(out, std::vector<uint64_t>({30, 10, 20, 20, 30}));
+
+    const std::vector<uint8_t> bad_codes{0, 3};
+    ASSERT_THROW(expand_dictionary_codes(dictionary.data(), dictionary.size(), bad_codes.data(), sizeof(uint8_t), bad_codes.size(), out.data()), ArcticCategorizedException<ErrorCategory::INTERNAL>);
+    ASSERT_EQ(dictionary_code_width(256), sizeof(uint8_t));
+    ASSERT_EQ(dictionary_code_width(257), sizeof(uint16_t));
+    ASSERT_EQ(dictionary_code_width(65537), sizeof(uint32_t));
+}
+
 TEST(Segment, ColumnNamesProduceDifferentHashes) {
     const auto stream_desc_1 = stream_descriptor(StreamId{"thing"}, RowCountIndex{}, {
         scalar_field(DataType::UINT8, "ints1"),
@@ -812,3 +887,318 @@ TEST(Segment, TestIdenticalProduceSameHashesV2) {
 
     ASSERT_EQ(hash_1, hash_2);
 }
+
+template<typename EncodingVersionConstant>
+class LightweightEncodingTest : public testing::Test {};
+
+TYPED_TEST_SUITE(LightweightEncodingTest, EncodingVersions);
+
+TYPED_TEST(LightweightEncodingTest, RoundtripTicks) {
+    ScopedConfig lightweight_encodings("Codec.LightweightEncodings", 1);
+    const auto stream_desc = stream_descriptor(StreamId{"ticks"}, TimeseriesIndex::default_index(), {
+        scalar_field(DataType::INT64, "size"),
+        scalar_field(DataType::FLOAT64, "price"),
+        scalar_field(DataType::BOOL8, "is_buy"),
+        scalar_field(DataType::UTF_DYNAMIC64, "venue")
+    });
+
+    SegmentInMemory in_mem_seg{stream_desc.clone()};
+    constexpr size_t num_rows = 1000;
+    for(auto i = 0UL; i < num_rows; ++i) {
+        in_mem_seg.set_scalar<timestamp>(0, 1'700'000'000'000'000'000 + static_cast<timestamp>(i * 1000 + i % 7));
+        in_mem_seg.set_scalar<int64_t>(1, i % 5 == 0 ? -static_cast<int64_t>(i) : 100 * static_cast<int64_t>(i % 10));
+        in_mem_seg.set_scalar<double>(2, 100.0 + static_cast<double>(i % 13) / 100.0);
+        in_mem_seg.set_scalar<bool>(3, i % 3 == 0);
+        in_mem_seg.set_string(4, i % 2 == 0 ? "XLON" : "XPAR");
+        in_mem_seg.end_row();
+    }
+    auto copy = in_mem_seg.clone();
+    constexpr EncodingVersion encoding_version = TypeParam::value;
+    auto seg = encode_dispatch(std::move(in_mem_seg), codec::default_lz4_codec(), encoding_version);
+    std::vector<uint8_t> vec;
+    const auto bytes = seg.calculate_size();
+    vec.resize(bytes);
+    seg.write_to(vec.data());
+    auto unserialized = Segment::from_bytes(vec.data(), bytes);
+
+    using TurboPfor = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+    const auto& body_fields = unserialized.header().body_fields();
+    const std::array<uint32_t, 4> expected_sub_codecs{TurboPfor::P4_DELTA, TurboPfor::P4, TurboPfor::FP_XOR, TurboPfor::P4};
+    for(auto col = 0UL; col < expected_sub_codecs.size(); ++col) {
+        const auto codec = body_fields.at(col).values(0).codec();
+        ASSERT_EQ(codec.codec_type(), Codec::PFOR);
+        ASSERT_EQ(codec.pfor().sub_codec_, expected_sub_codecs[col]);
+    }
+    ASSERT_EQ(body_fields.at(4).values(0).codec().codec_type(), Codec::LZ4);
+
+    auto decoded = decode_segment(unserialized);
+    ASSERT_EQ(decoded.row_count(), num_rows);
+    for(auto i = 0UL; i < num_rows; ++i) {
+        ASSERT_EQ(decoded.scalar_at<timestamp>(i, 0), copy.scalar_at<timestamp>(i, 0));
+        ASSERT_EQ(decoded.scalar_at<int64_t>(i, 1), copy.scalar_at<int64_t>(i, 1));
+        ASSERT_EQ(decoded.scalar_at<double>(i, 2), copy.scalar_at<double>(i, 2));
+        ASSERT_EQ(decoded.scalar_at<bool>(i, 3), copy.scalar_at<bool>(i, 3));
+        ASSERT_EQ(decoded.string_at(i, 4), copy.string_at(i, 4));
+    }
+}
+
+template<typename T>
+std::vector<T> lightweight_roundtrip(const std::vector<T>& values, arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs sub_codec) {
+    arcticdb::proto::encoding::VariantCodec::TurboPfor opts;
+    opts.set_sub_codec(sub_codec);
+    const auto bytes = values.size() * sizeof(T);
+    detail::BlockDataHelper helper{values.size(), bytes};
+    HashAccum hasher;
+    std::ptrdiff_t pos = 0;
+    BlockCodecImpl block_codec;
+    std::vector<uint8_t> encoded(detail::PforBlockEncoder::max_compressed_size(bytes));
+    const auto encoded_bytes = detail::PforBlockEncoder::encode_block(opts, values.data(), helper, hasher, reinterpret_cast<T*>(encoded.data()), encoded.size(), pos, block_codec);
+    EXPECT_EQ(pos, static_cast<std::ptrdiff_t>(encoded_bytes));
+    EXPECT_EQ(block_codec.pfor().sub_codec_, static_cast<uint32_t>(sub_codec));
+    std::vector<T> decoded(values.size());
+    detail::PforDecoder::decode_block(detail::PforBlockEncoder::VERSION, block_codec.pfor().sub_codec_, encoded.data(), encoded_bytes, decoded.data(), bytes);
+    return decoded;
+}
+
+TEST(LightweightEncoding, BlockRoundtrip) {
+    using TurboPfor = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+    std::mt19937_64 gen(42);
+    for(auto num_values : {1UL, 127UL, 128UL, 129UL, 1000UL}) {
+        std::vector<int64_t> ints(num_values);
+        for(auto& value : ints)
+            value = static_cast<int64_t>(gen());
+        ints[0] = std::numeric_limits<int64_t>::min();
+        ints[num_values - 1] = std::numeric_limits<int64_t>::max();
+        ASSERT_EQ(lightweight_roundtrip(ints, TurboPfor::P4), ints);
+        ASSERT_EQ(lightweight_roundtrip(ints, TurboPfor::P4_DELTA), ints);
+
+        std::vector<uint8_t> bytes(num_values);
+        for(auto& value : bytes)
+            value = static_cast<uint8_t>(gen());
+        ASSERT_EQ(lightweight_roundtrip(bytes, TurboPfor::P4), bytes);
+        ASSERT_EQ(lightweight_roundtrip(bytes, TurboPfor::P4_DELTA), bytes);
+
+        std::vector<double> doubles(num_values);
+        for(auto& value : doubles)
+            value = std::bit_cast<double>(gen());
+        doubles[0] = 0.0;
+        const auto decoded = lightweight_roundtrip(doubles, TurboPfor::FP_XOR);
+        ASSERT_EQ(std::memcmp(decoded.data(), doubles.data(), num_values * sizeof(double)), 0);
+    }
+    ASSERT_THROW(lightweight_roundtrip(std::vector<double>{1.0}, TurboPfor::P4), ArcticCategorizedException<ErrorCategory::INTERNAL>);
+}
+
+TEST(LightweightEncoding, CodecForType) {
+    ASSERT_EQ(lightweight_codec(make_scalar_type(DataType::NANOSECONDS_UTC64))->tp4().sub_codec(), arcticdb::proto::encoding::VariantCodec::TurboPfor::P4_DELTA);
+    ASSERT_EQ(lightweight_codec(make_scalar_type(DataType::UINT32))->tp4().sub_codec(), arcticdb::proto::encoding::VariantCodec::TurboPfor::P4);
+    ASSERT_EQ(lightweight_codec(make_scalar_type(DataType::FLOAT32))->tp4().sub_codec(), arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_XOR);
+    ASSERT_FALSE(lightweight_codec(make_scalar_type(DataType::UTF_DYNAMIC64)).has_value());
+    ASSERT_FALSE(lightweight_codec(TypeDescriptor{DataType::FLOAT64, Dimension::Dim1}).has_value());
+}
+
+TEST(LightweightEncoding, OnlyUsedWhenEnabled) {
+    Column column(make_scalar_type(DataType::INT64), Sparsity::NOT_PERMITTED);
+    for(int64_t i = 0; i < 10; ++i)
+        column.push_back<int64_t>(i);
+    auto column_data = column.data();
+    const auto default_codec = codec::default_lz4_codec();
+    ASSERT_TRUE(column_codec(column_data, default_codec).has_lz4());
+    ScopedConfig lightweight_encodings("Codec.LightweightEncodings", 1);
+    ASSERT_TRUE(column_codec(column_data, default_codec).has_tp4());
+}
+
+namespace {
+
+template<typename T>
+Column column_of(const std::vector<T>& values) {
+    Column column(make_scalar_type(data_type_from_raw_type<T>()), Sparsity::NOT_PERMITTED);
+    for(auto value : values)
+        column.push_back<T>(value);
+    return column;
+}
+
+arcticdb::proto::encoding::VariantCodec adaptive_choice(Column& column, size_t storage_mb_per_second) {
+    auto column_data = column.data();
+    return choose_column_codec(column_data, codec::default_lz4_codec(), CodecCostModel{static_cast<double>(storage_mb_per_second) / 1000.0});
+}
+
+} // namespace
+
+TEST(AdaptiveColumnCodecs, CandidateCodecs) {
+    const auto default_codec = codec::default_lz4_codec();
+    auto candidates = candidate_codecs(make_scalar_type(DataType::FLOAT64), default_codec);
+    // The library codec, passthrough, and ZSTD levels 1 and 3, with the default LZ4 the same as the library codec
+    ASSERT_EQ(candidates.size(), 4);
+    ASSERT_TRUE(candidates[0].has_lz4());
+    ASSERT_TRUE(candidates[1].has_passthrough());
+    ASSERT_EQ(candidates[2].zstd().level(), 1);
+    ASSERT_EQ(candidates[3].zstd().level(), 3);
+
+    ScopedConfig max_zstd_level("Codec.AdaptiveMaxZstdLevel", 9);
+    ScopedConfig lightweight_encodings("Codec.LightweightEncodings", 1);
+    candidates = candidate_codecs(make_scalar_type(DataType::FLOAT64), default_codec);
+    ASSERT_EQ(candidates.size(), 6);
+    ASSERT_EQ(candidates[4].zstd().level(), 9);
+    ASSERT_EQ(candidates[5].tp4().sub_codec(), arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_XOR);
+}
+
+TEST(AdaptiveColumnCodecs, ChoosesByCost) {
+    std::mt19937_64 gen(42);
+    std::vector<double> noise(100'000);
+    for(auto& value : noise)
+        value = std::bit_cast<double>(gen() >> 2);
+    auto noise_column = column_of(noise);
+    // Compressing high-entropy values does not pay for the time taken to decompress them
+    ASSERT_TRUE(adaptive_choice(noise_column, 100).has_passthrough());
+
+    std::vector<uint64_t> offsets(100'000);
+    for(size_t i = 0; i < offsets.size(); ++i)
+        offsets[i] = (i * 7919) % 50 * 16;
+    auto offsets_column = column_of(offsets);
+    // Repetitive values are worth compressing, and the slower the storage the more worthwhile ZSTD is
+    ASSERT_FALSE(adaptive_choice(offsets_column, 100).has_passthrough());
+    ASSERT_TRUE(adaptive_choice(offsets_column, 1).has_zstd());
+
+    auto small_column = column_of(std::vector<double>(10, 1.0));
+    ASSERT_TRUE(adaptive_choice(small_column, 100).has_lz4());
+}
+
+TEST(AdaptiveColumnCodecs, DictionaryEncodedColumnsNotSampled) {
+    ScopedConfig adaptive("Codec.AdaptiveColumnCodecs", 1);
+    ScopedConfig slow_storage("Codec.AdaptiveStorageMBPerSecond", 1);
+    ScopedConfig dictionary_encode("Codec.DictionaryEncodeStrings", 1);
+    std::vector<uint64_t> offsets(100'000);
+    for(size_t i = 0; i < offsets.size(); ++i)
+        offsets[i] = (i * 7919) % 50 * 16;
+
+    SegmentInMemory segment;
+    for(auto [data_type, name] : {std::pair{DataType::UINT64, "offsets"}, std::pair{DataType::UTF_DYNAMIC64, "strings"}}) {
+        auto column = std::make_shared<Column>(column_of(offsets));
+        column->set_type(make_scalar_type(data_type));
+        segment.add_column(scalar_field(data_type, name), column);
+    }
+    const auto default_codec = codec::default_lz4_codec();
+    const auto v1_codecs = column_codecs(segment, default_codec, EncodingVersion::V1);
+    ASSERT_TRUE(v1_codecs[0].has_zstd());
+    ASSERT_TRUE(v1_codecs[1].has_zstd());
+    // V2 encodes the string column with a dictionary, which the sampled codec would not be used for
+    const auto v2_codecs = column_codecs(segment, default_codec, EncodingVersion::V2);
+    ASSERT_TRUE(v2_codecs[0].has_zstd());
+    ASSERT_TRUE(v2_codecs[1].has_lz4());
+}
+
+class AdaptiveColumnCodecsTest : public testing::Test {};
+
+TYPED_TEST_SUITE(AdaptiveColumnCodecsTest, EncodingVersions);
+
+TYPED_TEST(AdaptiveColumnCodecsTest, RoundtripRecordsChoicePerBlock) {
+    ScopedConfig adaptive("Codec.AdaptiveColumnCodecs", 1);
+    const auto stream_desc = stream_descriptor(StreamId{"adaptive"}, RowCountIndex{}, {
+        scalar_field(DataType::FLOAT64, "noise"),
+        scalar_field(DataType::INT64, "constant")
+    });
+
+    SegmentInMemory in_mem_seg{stream_desc.clone()};
+    std::mt19937_64 gen(42);
+    constexpr size_t num_rows = 10'000;
+    for(auto i = 0UL; i < num_rows; ++i) {
+        in_mem_seg.set_scalar<double>(0, std::bit_cast<double>(gen() >> 2));
+        in_mem_seg.set_scalar<int64_t>(1, 5);
+        in_mem_seg.end_row();
+    }
+    auto copy = in_mem_seg.clone();
+    constexpr EncodingVersion encoding_version = TypeParam::value;
+    auto seg = encode_dispatch(std::move(in_mem_seg), codec::default_lz4_codec(), encoding_version);
+    std::vector<uint8_t> vec;
+    const auto bytes = seg.calculate_size();
+    vec.resize(bytes);
+    seg.write_to(vec.data());
+    auto unserialized = Segment::from_bytes(vec.data(), bytes);
+
+    const auto& body_fields = unserialized.header().body_fields();
+    ASSERT_EQ(body_fields.at(0).values(0).codec().codec_type(), Codec::PASS);
+    ASSERT_EQ(body_fields.at(1).values(0).codec().codec_type(), Codec::LZ4);
+
+    auto decoded = decode_segment(unserialized);
+    ASSERT_EQ(decoded.row_count(), num_rows);
+    for(auto i = 0UL; i < num_rows; ++i) {
+        ASSERT_EQ(decoded.scalar_at<double>(i, 0), copy.scalar_at<double>(i, 0));
+        ASSERT_EQ(decoded.scalar_at<int64_t>(i, 1), copy.scalar_at<int64_t>(i, 1));
+    }
+}
+
+namespace {
+
+// Resembles the small segments of a symbol list, a few symbols of similar names with their versions
+SegmentInMemory small_symbols_segment(std::mt19937_64& gen) {
+    const auto stream_desc = stream_descriptor(StreamId{"symbols"}, RowCountIndex{}, {
+        scalar_field(DataType::UTF_DYNAMIC64, "symbol"),
+        scalar_field(DataType::UINT64, "version")
+    });
+    SegmentInMemory segment{stream_desc.clone()};
+    std::uniform_int_distribution<uint64_t> symbol_ids(0, 100'000);
+    std::uniform_int_distribution<uint64_t> versions(0, 50);
+    for(auto i = 0; i < 5; ++i) {
+        segment.set_string(0, fmt::format("equities_daily_close_prices_{}", symbol_ids(gen)));
+        segment.set_scalar<uint64_t>(1, versions(gen));
+        segment.end_row();
+    }
+    return segment;
+}
+
+} // namespace
+
+class ZstdDictionaryTest : public testing::Test {};
+
+TYPED_TEST_SUITE(ZstdDictionaryTest, EncodingVersions);
+
+TYPED_TEST(ZstdDictionaryTest, TrainAndRoundtrip) {
+    std::mt19937_64 gen(42);
+    std::vector<std::string> samples;
+    for(auto i = 0; i < 2000; ++i)
+        append_zstd_dictionary_samples(small_symbols_segment(gen), samples);
+
+    std::shared_ptr<const ZstdDictionary> dictionary = train_zstd_dictionary(samples, 4096);
+    ASSERT_NE(dictionary->id(), 0);
+    ASSERT_LE(dictionary->content().size(), 4096);
+    ASSERT_EQ(zstd_dictionary_from_segment(zstd_dictionary_to_segment(*dictionary))->content(), dictionary->content());
+    ZstdDictionaries::instance()->add(dictionary);
+
+    constexpr EncodingVersion encoding_version = TypeParam::value;
+    auto segment = small_symbols_segment(gen);
+    auto copy = segment.clone();
+    const auto dictionary_codec = zstd_dictionary_codec(*dictionary);
+    auto zstd_codec = dictionary_codec;
+    zstd_codec.mutable_zstd()->clear_dictionary_id();
+    auto without_dictionary = encode_dispatch(segment.clone(), zstd_codec, encoding_version);
+    auto with_dictionary = encode_dispatch(std::move(segment), dictionary_codec, encoding_version);
+    ASSERT_LT(with_dictionary.calculate_size(), without_dictionary.calculate_size());
+
+    std::vector<uint8_t> vec(with_dictionary.calculate_size());
+    with_dictionary.write_to(vec.data());
+    auto decoded = decode_segment(Segment::from_bytes(vec.data(), vec.size()));
+    ASSERT_EQ(decoded.row_count(), copy.row_count());
+    for(auto i = 0UL; i < copy.row_count(); ++i) {
+        ASSERT_EQ(decoded.string_at(i, 0), copy.string_at(i, 0));
+        ASSERT_EQ(decoded.scalar_at<uint64_t>(i, 1), copy.scalar_at<uint64_t>(i, 1));
+    }
+}
+
+TEST(ZstdDictionary, UsedForSmallSegmentsOfSomeKeyTypes) {
+    std::mt19937_64 gen(42);
+    const auto segment = small_symbols_segment(gen);
+    ASSERT_TRUE(uses_zstd_dictionary(KeyType::VERSION, segment));
+    ASSERT_TRUE(uses_zstd_dictionary(KeyType::SYMBOL_LIST, segment));
+    ASSERT_TRUE(uses_zstd_dictionary(KeyType::TABLE_DATA, segment));
+    ASSERT_FALSE(uses_zstd_dictionary(KeyType::TABLE_INDEX, segment));
+    ASSERT_FALSE(uses_zstd_dictionary(KeyType::ZSTD_DICTIONARY, segment));
+
+    SegmentInMemory large{segment.descriptor().clone()};
+    for(auto i = 0UL; i < 10'000; ++i) {
+        large.set_string(0, fmt::format("symbol_{}", i));
+        large.set_scalar<uint64_t>(1, i);
+        large.end_row();
+    }
+    ASSERT_TRUE(uses_zstd_dictionary(KeyType::VERSION, large));
+    ASSERT_FALSE(uses_zstd_dictionary(KeyType::TABLE_DATA, large));
+}
@@ -2,6 +2,7 @@
 #include <arcticdb/codec/passthrough.hpp>
 #include <arcticdb/codec/zstd.hpp>
 #include <arcticdb/codec/lz4.hpp>
+#include <arcticdb/codec/pfor.hpp>
 #include <arcticdb/codec/encoded_field.hpp>
 #include <arcticdb/util/buffer.hpp>
 
@@ -130,6 +131,7 @@ namespace arcticdb {
 
         using ZstdEncoder = BlockEncoder<arcticdb::detail::ZstdBlockEncoder>;
         using Lz4Encoder = BlockEncoder<arcticdb::detail::Lz4BlockEncoder>;
+        using PforEncoder = BlockEncoder<arcticdb::detail::PforBlockEncoder>;
 
         using PassthroughEncoder = std::conditional_t<encoder_version == EncodingVersion::V1,
             arcticdb::detail::PassthroughEncoderV1<TypedBlock, TD>,
@@ -147,6 +149,8 @@ namespace arcticdb {
                     return f(EncoderTag<ZstdEncoder>());
                 case arcticdb::proto::encoding::VariantCodec::kLz4:
                     return f(EncoderTag<Lz4Encoder>());
+                case arcticdb::proto::encoding::VariantCodec::kTp4:
+                    return f(EncoderTag<PforEncoder>());
                 case arcticdb::proto::encoding::VariantCodec::kPassthrough :
                     return f(EncoderTag<PassthroughEncoder>());
                 default:
@@ -162,6 +166,10 @@ namespace arcticdb {
             return codec_opts.zstd();
         }
 
+        static auto get_opts(const arcticdb::proto::encoding::VariantCodec& codec_opts, EncoderTag<PforEncoder>) {
+            return codec_opts.tp4();
+        }
+
         static auto get_opts(const arcticdb::proto::encoding::VariantCodec& codec_opts, EncoderTag<PassthroughEncoder>) {
             return codec_opts.passthrough();
         }
@@ -11,14 +11,29 @@
 #include <arcticdb/entity/performance_tracing.hpp>
 #include <arcticdb/stream/protobuf_mappings.hpp>
 #include <arcticdb/codec/protobuf_mappings.hpp>
+#include <arcticdb/codec/zstd_dictionary.hpp>
 #include <arcticdb/storage/common.hpp>
 #include <arcticdb/util/pb_util.hpp>
 #include <arcticdb/util/dump_bytes.hpp>
 
 #include <zstd.h>
 
+#include <memory>
+
 namespace arcticdb::detail {
 
+// Creating a ZSTD context allocates and initialises several hundred KB of tables, which for small blocks costs more
+// than compressing them, so each thread keeps one of each for its lifetime
+inline ZSTD_CCtx* zstd_compression_context() {
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    return context.get();
+}
+
+inline ZSTD_DCtx* zstd_decompression_context() {
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    return context.get();
+}
+
 struct ZstdBlockEncoder {
 
     using Opts = arcticdb::proto::encoding::VariantCodec::Zstd;
@@ -42,7 +57,18 @@ struct ZstdBlockEncoder {
             std::size_t out_capacity,
             std::ptrdiff_t &pos,
             CodecType& out_codec) {
-        std::size_t compressed_bytes = ZSTD_compress(out, out_capacity, in, block_utils.bytes_, opts.level());
+        std::size_t compressed_bytes;
+        if (opts.dictionary_id() != 0) {
+            const auto dictionary = ZstdDictionaries::instance()->get(opts.dictionary_id());
+            compressed_bytes = ZSTD_compress_usingCDict(zstd_compression_context(), out, out_capacity, in, block_utils.bytes_,
+                                                        dictionary->compression_dictionary(opts.level()));
+        } else {
+            compressed_bytes = ZSTD_compressCCtx(zstd_compression_context(), out, out_capacity, in, block_utils.bytes_, opts.level());
+        }
+        codec::check<ErrorCode::E_ZSDT_ENCODING>(
+            !ZSTD_isError(compressed_bytes),
+            "ZSTD compression failed: {}",
+            ZSTD_getErrorName(compressed_bytes));
         hasher(in, block_utils.count_);
         pos += compressed_bytes;
         copy_codec(*out_codec.mutable_zstd(), opts);
@@ -54,6 +80,7 @@ struct ZstdBlockEncoder {
 struct ZstdDecoder {
 
     /// @param[in] encoder_version Used to support multiple versions but won't be used before we have them
+    /// Blocks compressed with a dictionary record its id in the frame, and are decompressed with that dictionary
     template <typename T>
     static void decode_block(
         [[maybe_unused]] std::uint32_t encoder_version,
@@ -70,7 +97,14 @@ struct ZstdDecoder {
             out_bytes,
             decomp_size
         );
-        std::size_t real_decomp = ZSTD_decompress(t_out, out_bytes, in, in_bytes);
+        std::size_t real_decomp;
+        if (const auto dictionary_id = ZSTD_getDictID_fromFrame(in, in_bytes); dictionary_id != 0) {
+            const auto dictionary = ZstdDictionaries::instance()->get(dictionary_id);
+            real_decomp = ZSTD_decompress_usingDDict(zstd_decompression_context(), t_out, out_bytes, in, in_bytes,
+                                                     dictionary->decompression_dictionary());
+        } else {
+            real_decomp = ZSTD_decompressDCtx(zstd_decompression_context(), t_out, out_bytes, in, in_bytes);
+        }
         codec::check<ErrorCode::E_DECODE_ERROR>(
             real_decomp == out_bytes,
             "expected out_bytes == zstd decompressed bytes, actual {} != {}",
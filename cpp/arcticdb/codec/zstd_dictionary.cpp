@@ -0,0 +1,219 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/codec/zstd_dictionary.hpp>
+#include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <zdict.h>
+
+#include <cstring>
+
+namespace arcticdb {
+
+namespace {
+
+void append_buffer_samples(const ChunkedBuffer& buffer, std::vector<std::string>& samples) {
+    for (const auto* block : buffer.blocks()) {
+        if (block && block->bytes() > 0)
+            samples.emplace_back(reinterpret_cast<const char*>(block->data()), block->bytes());
+    }
+}
+
+} // namespace
+
+ZstdDictionary::ZstdDictionary(std::string content) :
+    content_(std::move(content)),
+    id_(ZSTD_getDictID_fromDict(content_.data(), content_.size())),
+    ddict_(nullptr) {
+    // Raw content dictionaries have no id, so frames compressed with them could not be matched to them on decode
+    codec::check<ErrorCode::E_ZSDT_ENCODING>(id_ != 0, "Expected a trained ZSTD dictionary with an id");
+    ddict_ = ZSTD_createDDict(content_.data(), content_.size());
+    codec::check<ErrorCode::E_ZSDT_ENCODING>(ddict_ != nullptr, "Failed to load ZSTD dictionary {}", id_);
+}
+
+ZstdDictionary::~ZstdDictionary() {
+    for (auto& [level, cdict] : cdicts_)
+        ZSTD_freeCDict(cdict);
+
+    ZSTD_freeDDict(ddict_);
+}
+
+const ZSTD_CDict* ZstdDictionary::compression_dictionary(int level) const {
+    std::lock_guard lock(cdicts_mutex_);
+    auto it = cdicts_.find(level);
+    if (it == cdicts_.end()) {
+        auto* cdict = ZSTD_createCDict(content_.data(), content_.size(), level);
+        codec::check<ErrorCode::E_ZSDT_ENCODING>(cdict != nullptr, "Failed to load ZSTD dictionary {} at level {}", id_, level);
+        it = cdicts_.try_emplace(level, cdict).first;
+    }
+    return it->second;
+}
+
+std::shared_ptr<ZstdDictionaries> ZstdDictionaries::instance() {
+    std::call_once(ZstdDictionaries::init_flag_, &ZstdDictionaries::init);
+    return ZstdDictionaries::instance_;
+}
+
+void ZstdDictionaries::init() {
+    instance_ = std::make_shared<ZstdDictionaries>();
+}
+
+void ZstdDictionaries::add(std::shared_ptr<const ZstdDictionary> dictionary) {
+    std::lock_guard lock(mutex_);
+    const auto [it, inserted] = dictionaries_.try_emplace(dictionary->id(), dictionary);
+    codec::check<ErrorCode::E_ZSDT_ENCODING>(
+        inserted || it->second->content() == dictionary->content(),
+        "Cannot register ZSTD dictionary {} as a different dictionary with the same id is registered",
+        dictionary->id());
+}
+
+void ZstdDictionaries::add_loader(const std::shared_ptr<const ZstdDictionaryLoader>& loader) {
+    std::lock_guard lock(mutex_);
+    std::erase_if(loaders_, [](const auto& existing) { return existing.expired(); });
+    loaders_.emplace_back(loader);
+}
+
+std::shared_ptr<const ZstdDictionary> ZstdDictionaries::get(uint32_t id) {
+    std::vector<std::shared_ptr<const ZstdDictionaryLoader>> loaders;
+    {
+        std::lock_guard lock(mutex_);
+        if (const auto it = dictionaries_.find(id); it != dictionaries_.end())
+            return it->second;
+
+        for (const auto& loader : loaders_) {
+            if (auto locked = loader.lock(); locked)
+                loaders.emplace_back(std::move(locked));
+        }
+    }
+    // Loading reads from storage, so is done without holding the lock. Should several threads load the same
+    // dictionary at once, add accepts it from each of them as the contents match.
+    for (const auto& loader : loaders) {
+        if (auto dictionary = (*loader)(id); dictionary) {
+            codec::check<ErrorCode::E_DECODE_ERROR>(
+                dictionary->id() == id,
+                "Loaded ZSTD dictionary {} when asked for {}", dictionary->id(), id);
+            add(dictionary);
+            return dictionary;
+        }
+    }
+    codec::raise<ErrorCode::E_DECODE_ERROR>(
+        "ZSTD dictionary {} is not loaded, and none of the libraries open with the zstd_dictionary option have it",
+        id);
+}
+
+void ZstdDictionaries::_test_remove(uint32_t id) {
+    std::lock_guard lock(mutex_);
+    dictionaries_.erase(id);
+}
+
+std::shared_ptr<ZstdDictionaries> ZstdDictionaries::instance_;
+std::once_flag ZstdDictionaries::init_flag_;
+
+bool uses_zstd_dictionary(entity::KeyType key_type, const SegmentInMemory& segment) {
+    switch (key_type) {
+    case entity::KeyType::VERSION:
+    case entity::KeyType::SYMBOL_LIST:
+        return true;
+    case entity::KeyType::TABLE_DATA:
+    case entity::KeyType::APPEND_DATA: {
+        const auto max_segment_bytes = ConfigsMap::instance()->get_int("Codec.ZstdDictionaryMaxSegmentBytes", 64 * 1024);
+        return static_cast<int64_t>(segment.num_bytes()) <= max_segment_bytes;
+    }
+    default:
+        return false;
+    }
+}
+
+arcticdb::proto::encoding::VariantCodec zstd_dictionary_codec(const ZstdDictionary& dictionary) {
+    arcticdb::proto::encoding::VariantCodec codec;
+    auto* zstd = codec.mutable_zstd();
+    zstd->set_level(ZSTD_CLEVEL_DEFAULT);
+    zstd->set_dictionary_id(dictionary.id());
+    return codec;
+}
+
+std::shared_ptr<ZstdDictionary> train_zstd_dictionary(std::span<const std::string> samples, size_t max_dictionary_bytes) {
+    std::string buffer;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto& sample : samples) {
+        buffer.append(sample);
+        sample_sizes.push_back(sample.size());
+    }
+    std::string content(max_dictionary_bytes, '\0');
+    const auto dictionary_bytes = ZDICT_trainFromBuffer(
+        content.data(),
+        content.size(),
+        buffer.data(),
+        sample_sizes.data(),
+        static_cast<unsigned>(sample_sizes.size()));
+    codec::check<ErrorCode::E_ZSDT_ENCODING>(
+        !ZDICT_isError(dictionary_bytes),
+        "Failed to train a ZSTD dictionary from {} samples of {} bytes: {}",
+        samples.size(), buffer.size(), ZDICT_getErrorName(dictionary_bytes));
+    content.resize(dictionary_bytes);
+    return std::make_shared<ZstdDictionary>(std::move(content));
+}
+
+void append_zstd_dictionary_samples(const SegmentInMemory& segment, std::vector<std::string>& samples) {
+    for (size_t col = 0; col < segment.num_columns(); ++col)
+        append_buffer_samples(segment.column(col).data().buffer(), samples);
+
+    if (segment.has_string_pool())
+        append_buffer_samples(segment.const_string_pool().data(), samples);
+
+    if (const auto* metadata = segment.metadata(); metadata)
+        samples.emplace_back(metadata->SerializeAsString());
+}
+
+std::string zstd_dictionary_stream_id(uint32_t id) {
+    return fmt::format("{}{}", ZstdDictionaryId, id);
+}
+
+SegmentInMemory zstd_dictionary_to_segment(const ZstdDictionary& dictionary) {
+    const auto& content = dictionary.content();
+    auto column = std::make_shared<Column>(make_scalar_type(DataType::UINT8), content.size(), AllocationType::PRESIZED, Sparsity::NOT_PERMITTED);
+    std::memcpy(column->ptr(), content.data(), content.size());
+    column->set_row_data(content.size() - 1);
+    SegmentInMemory segment;
+    segment.add_column(scalar_field(DataType::UINT8, "dictionary"), column);
+    segment.set_row_id(static_cast<ssize_t>(content.size()) - 1);
+    return segment;
+}
+
+std::shared_ptr<ZstdDictionary> zstd_dictionary_from_segment(const SegmentInMemory& segment) {
+    codec::check<ErrorCode::E_DECODE_ERROR>(
+        segment.num_columns() == 1 && segment.column(0).type() == make_scalar_type(DataType::UINT8),
+        "Expected a ZSTD dictionary segment to have a single UINT8 column");
+    std::string content;
+    content.reserve(segment.row_count());
+    for (const auto* block : segment.column(0).data().buffer().blocks()) {
+        if (block)
+            content.append(reinterpret_cast<const char*>(block->data()), block->bytes());
+    }
+    return std::make_shared<ZstdDictionary>(std::move(content));
+}
+
+SegmentInMemory current_zstd_dictionary_to_segment(uint32_t id) {
+    auto column = std::make_shared<Column>(make_scalar_type(DataType::UINT32), Sparsity::NOT_PERMITTED);
+    column->push_back<uint32_t>(id);
+    SegmentInMemory segment;
+    segment.add_column(scalar_field(DataType::UINT32, "dictionary_id"), column);
+    segment.set_row_id(0);
+    return segment;
+}
+
+uint32_t current_zstd_dictionary_from_segment(const SegmentInMemory& segment) {
+    codec::check<ErrorCode::E_DECODE_ERROR>(
+        segment.num_columns() == 1 && segment.column(0).type() == make_scalar_type(DataType::UINT32) && segment.row_count() == 1,
+        "Expected the current ZSTD dictionary segment to have a single UINT32 value");
+    return segment.scalar_at<uint32_t>(0, 0).value();
+}
+
+} // namespace arcticdb
@@ -0,0 +1,129 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/entity/key.hpp>
+#include <arcticdb/entity/protobufs.hpp>
+
+#include <zstd.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace arcticdb {
+
+class SegmentInMemory;
+
+// The id of the library's ZSTD_DICTIONARY key holding the id of the dictionary new segments are compressed with. Each
+// dictionary is stored under a ZSTD_DICTIONARY key of its own, see zstd_dictionary_stream_id, which is never
+// overwritten or deleted as the segments compressed with it may be read at any time.
+constexpr std::string_view ZstdDictionaryId = "__zstd_dictionary__";
+
+/// @brief A ZSTD dictionary trained on the small segments of a library, see train_zstd_dictionary.
+/// Small segments compress poorly on their own as there is little history within one segment for ZSTD to match
+/// against. Compressing them with a dictionary of the content they typically share makes that history available.
+/// The id of the dictionary is recorded in each frame compressed with it, which is how the decoder finds it again.
+class ZstdDictionary {
+public:
+    explicit ZstdDictionary(std::string content);
+    ~ZstdDictionary();
+
+    ZstdDictionary(const ZstdDictionary&) = delete;
+    ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+    [[nodiscard]] uint32_t id() const {
+        return id_;
+    }
+
+    [[nodiscard]] const std::string& content() const {
+        return content_;
+    }
+
+    /// The dictionary digested for compression at the given level, created the first time each level is requested
+    [[nodiscard]] const ZSTD_CDict* compression_dictionary(int level) const;
+
+    [[nodiscard]] const ZSTD_DDict* decompression_dictionary() const {
+        return ddict_;
+    }
+
+private:
+    std::string content_;
+    uint32_t id_;
+    ZSTD_DDict* ddict_;
+    mutable std::mutex cdicts_mutex_;
+    mutable std::map<int, ZSTD_CDict*> cdicts_;
+};
+
+/// Reads the dictionary with the given id from a library, returning nullptr if the library does not have it
+using ZstdDictionaryLoader = std::function<std::shared_ptr<ZstdDictionary>(uint32_t id)>;
+
+/// @brief The ZSTD dictionaries known to this process, by id.
+/// Decoding happens without reference to the library a segment was read from, so dictionaries are registered here
+/// and looked up by the id found in each compressed frame. Libraries with dictionaries register a loader when
+/// opened, which is asked for the dictionaries not registered yet: those trained since, or since replaced by a newer
+/// dictionary but still used by the segments compressed with them.
+class ZstdDictionaries {
+    static std::shared_ptr<ZstdDictionaries> instance_;
+    static std::once_flag init_flag_;
+
+    static void init();
+
+    mutable std::mutex mutex_;
+    std::unordered_map<uint32_t, std::shared_ptr<const ZstdDictionary>> dictionaries_;
+    // Owned by the libraries, so that closing a library stops it being asked
+    mutable std::vector<std::weak_ptr<const ZstdDictionaryLoader>> loaders_;
+public:
+    static std::shared_ptr<ZstdDictionaries> instance();
+
+    /// Registering a dictionary with the same id as one already registered is only allowed if their contents match
+    void add(std::shared_ptr<const ZstdDictionary> dictionary);
+
+    void add_loader(const std::shared_ptr<const ZstdDictionaryLoader>& loader);
+
+    /// Loads the dictionary from the open libraries if it is not registered yet, and raises if none of them have it
+    [[nodiscard]] std::shared_ptr<const ZstdDictionary> get(uint32_t id);
+
+    /// Forgets a dictionary, so that tests can act as a client that has not loaded it
+    void _test_remove(uint32_t id);
+};
+
+/// The key types of the segments compressed with a library's dictionary, when it has one. TABLE_DATA and APPEND_DATA
+/// segments only use it when they are smaller than Codec.ZstdDictionaryMaxSegmentBytes, 64KB by default.
+bool uses_zstd_dictionary(entity::KeyType key_type, const SegmentInMemory& segment);
+
+/// The codec for the segments that use the dictionary, ZSTD at its default level
+arcticdb::proto::encoding::VariantCodec zstd_dictionary_codec(const ZstdDictionary& dictionary);
+
+/// @brief Trains a dictionary of up to max_dictionary_bytes from samples of the data it will be used to compress.
+/// ZSTD needs a reasonable number of samples, in total around a hundred times the size of the dictionary, and
+/// raises if they are not enough to train from.
+std::shared_ptr<ZstdDictionary> train_zstd_dictionary(std::span<const std::string> samples, size_t max_dictionary_bytes);
+
+/// The buffers of a segment that are compressed individually when it is encoded, as samples to train a dictionary
+void append_zstd_dictionary_samples(const SegmentInMemory& segment, std::vector<std::string>& samples);
+
+/// The id of the ZSTD_DICTIONARY key the dictionary with this id is stored under
+std::string zstd_dictionary_stream_id(uint32_t id);
+
+/// The segment a dictionary is stored in under its ZSTD_DICTIONARY key, and the dictionary read back from it
+SegmentInMemory zstd_dictionary_to_segment(const ZstdDictionary& dictionary);
+std::shared_ptr<ZstdDictionary> zstd_dictionary_from_segment(const SegmentInMemory& segment);
+
+/// The segment stored under the ZstdDictionaryId key, recording which dictionary new segments are compressed with
+SegmentInMemory current_zstd_dictionary_to_segment(uint32_t id);
+uint32_t current_zstd_dictionary_from_segment(const SegmentInMemory& segment);
+
+} // namespace arcticdb
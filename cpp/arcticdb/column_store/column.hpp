@@ -15,9 +15,11 @@
 #include <arcticdb/entity/performance_tracing.hpp>
 #include <arcticdb/entity/types.hpp>
 #include <arcticdb/util/bitset.hpp>
+#include <arcticdb/util/bitset_packing.hpp>
 #include <arcticdb/util/cursored_buffer.hpp>
 #include <arcticdb/util/flatten_utils.hpp>
 #include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/simd_dispatch.hpp>
 #include <arcticdb/util/sparse_utils.hpp>
 
 #include <folly/container/Enumerate.h>
@@ -29,6 +31,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
+#include <algorithm>
 #include <concepts>
 #include <numeric>
 #include <optional>
@@ -795,6 +798,57 @@ public:
         size_t end_row
     );
 
+    // Calls f(data, count) for each non-empty block of a dense column, in order
+    template <
+            typename input_tdt,
+            typename functor>
+    static void for_each_dense_block(const Column& input_column, functor&& f) {
+        auto input_data = input_column.data();
+        while (auto block = input_data.next<input_tdt>()) {
+            if (block->row_count() > 0) {
+                f(block->data(), block->row_count());
+            }
+        }
+    }
+
+    // Calls f(left_data, right_data, count) over the first rows of two dense columns, splitting at the block boundaries
+    // of both columns so that each call covers contiguous data on both sides
+    template <
+            typename left_input_tdt,
+            typename right_input_tdt,
+            typename functor>
+    static void for_each_dense_block(const Column& left_input_column, const Column& right_input_column, size_t rows, functor&& f) {
+        auto left_input_data = left_input_column.data();
+        auto right_input_data = right_input_column.data();
+        const typename left_input_tdt::DataTypeTag::raw_type* left_ptr = nullptr;
+        const typename right_input_tdt::DataTypeTag::raw_type* right_ptr = nullptr;
+        size_t left_remaining = 0;
+        size_t right_remaining = 0;
+        while (rows > 0) {
+            if (left_remaining == 0) {
+                auto block = left_input_data.next<left_input_tdt>();
+                util::check(block.has_value(), "Left column ran out of blocks with {} rows remaining", rows);
+                left_ptr = block->data();
+                left_remaining = block->row_count();
+                continue;
+            }
+            if (right_remaining == 0) {
+                auto block = right_input_data.next<right_input_tdt>();
+                util::check(block.has_value(), "Right column ran out of blocks with {} rows remaining", rows);
+                right_ptr = block->data();
+                right_remaining = block->row_count();
+                continue;
+            }
+            const auto count = std::min({left_remaining, right_remaining, rows});
+            f(left_ptr, right_ptr, count);
+            left_ptr += count;
+            right_ptr += count;
+            left_remaining -= count;
+            right_remaining -= count;
+            rows -= count;
+        }
+    }
+
     template <
             typename input_tdt,
             typename functor>
@@ -827,6 +881,19 @@ public:
     static void transform(const Column& input_column, Column& output_column, functor&& f) {
         auto input_data = input_column.data();
         initialise_output_column(input_column, output_column);
+        if (!input_column.is_sparse() && &input_column != &output_column && output_column.num_blocks() == 1) {
+            // Contiguous output, so use plain pointer loops over each input block, vectorised for the running CPU
+            auto* output_ptr = reinterpret_cast<typename output_tdt::DataTypeTag::raw_type*>(output_column.ptr());
+            for_each_dense_block<input_tdt>(input_column, [&output_ptr, &f](const auto* input_ptr, size_t count) {
+                util::dispatch_simd([output_ptr, input_ptr, count, &f]() {
+                    for (size_t idx = 0; idx < count; ++idx) {
+                        output_ptr[idx] = f(input_ptr[idx]);
+                    }
+                });
+                output_ptr += count;
+            });
+            return;
+        }
         auto output_data = output_column.data();
         std::transform(
             input_data.cbegin<input_tdt>(),
@@ -857,8 +924,24 @@ public:
         auto output_it = output_data.begin<output_tdt>();
 
         if (!left_input_column.is_sparse() && !right_input_column.is_sparse()) {
-            // Both dense, use std::transform over the shorter column to avoid going out-of-bounds
-            if (left_input_column.row_count() <= right_input_column.row_count()) {
+            if (output_column.num_blocks() == 1 && &left_input_column != &output_column && &right_input_column != &output_column) {
+                // Contiguous output, so use plain pointer loops over the shorter column, vectorised for the running CPU
+                auto* output_ptr = reinterpret_cast<typename output_tdt::DataTypeTag::raw_type*>(output_column.ptr());
+                const auto rows = std::min(left_input_column.row_count(), right_input_column.row_count());
+                for_each_dense_block<left_input_tdt, right_input_tdt>(
+                        left_input_column,
+                        right_input_column,
+                        rows,
+                        [&output_ptr, &f](const auto* left_ptr, const auto* right_ptr, size_t count) {
+                    util::dispatch_simd([output_ptr, left_ptr, right_ptr, count, &f]() {
+                        for (size_t idx = 0; idx < count; ++idx) {
+                            output_ptr[idx] = f(left_ptr[idx], right_ptr[idx]);
+                        }
+                    });
+                    output_ptr += count;
+                });
+            } else if (left_input_column.row_count() <= right_input_column.row_count()) {
+                // Both dense, use std::transform over the shorter column to avoid going out-of-bounds
                 std::transform(left_input_data.cbegin<left_input_tdt>(),
                                left_input_data.cend<left_input_tdt>(),
                                right_input_data.cbegin<right_input_tdt>(),
@@ -908,6 +991,30 @@ public:
         }
     }
 
+    // Evaluates the predicate over a dense column into 0/1 mask bytes with a loop vectorised for the running CPU, and packs
+    // them into output_bitset, see util::ByteMaskBitSetBuilder
+    template <
+            typename input_tdt,
+            std::predicate<typename input_tdt::DataTypeTag::raw_type> functor>
+    static void dense_predicate_to_bitset(const Column& input_column, util::BitSet& output_bitset, functor&& f) {
+        util::ByteMaskBitSetBuilder builder(output_bitset);
+        for_each_dense_block<input_tdt>(input_column, [&builder, &f](const auto* input_ptr, size_t count) {
+            while (count > 0) {
+                auto mask = builder.next_chunk(count);
+                auto* mask_ptr = mask.data();
+                const auto chunk_rows = mask.size();
+                util::dispatch_simd([mask_ptr, input_ptr, chunk_rows, &f]() {
+                    for (size_t idx = 0; idx < chunk_rows; ++idx) {
+                        mask_ptr[idx] = static_cast<uint8_t>(f(input_ptr[idx]));
+                    }
+                });
+                input_ptr += chunk_rows;
+                count -= chunk_rows;
+            }
+        });
+        builder.flush();
+    }
+
     template <
             typename input_tdt,
             std::predicate<typename input_tdt::DataTypeTag::raw_type> functor>
@@ -915,12 +1022,13 @@ public:
                           util::BitSet& output_bitset,
                           bool sparse_missing_value_output,
                           functor&& f) {
-        if (input_column.is_sparse()) {
-            initialise_output_bitset(input_column, sparse_missing_value_output, output_bitset);
-        } else {
+        if (!input_column.is_sparse()) {
             // This allows for empty/full result optimisations, technically bitsets are always dynamically sized
             output_bitset.resize(input_column.row_count());
+            dense_predicate_to_bitset<input_tdt>(input_column, output_bitset, std::forward<functor>(f));
+            return;
         }
+        initialise_output_bitset(input_column, sparse_missing_value_output, output_bitset);
         util::BitSet::bulk_insert_iterator inserter(output_bitset);
         Column::for_each_enumerated<input_tdt>(input_column, [&inserter, f = std::forward<functor>(f)](auto enumerated_it) {
             if (f(enumerated_it.value())) {
@@ -953,30 +1061,29 @@ public:
                 // Dense columns of different lengths, and missing values should be on in the output bitset
                 output_bitset.set_range(std::min(left_input_column.last_row(), right_input_column.last_row()) + 1, rows - 1);
             }
-            auto pos = 0u;
-            if (left_input_column.row_count() <= right_input_column.row_count()) {
-                auto right_it = right_input_data.cbegin<right_input_tdt>();
-                std::for_each(
-                        left_input_data.cbegin<left_input_tdt>(),
-                        left_input_data.cend<left_input_tdt>(),
-                        [&right_it, &inserter, &pos, f = std::forward<functor>(f)](auto left_value) {
-                            if (f(left_value, *right_it++)) {
-                                inserter = pos;
-                            }
-                            ++pos;
-                        });
-            } else {
-                auto left_it = left_input_data.cbegin<left_input_tdt>();
-                std::for_each(
-                        right_input_data.cbegin<right_input_tdt>(),
-                        right_input_data.cend<right_input_tdt>(),
-                        [&left_it, &inserter, &pos, f = std::forward<functor>(f)](auto right_value) {
-                            if (f(*left_it++, right_value)) {
-                                inserter = pos;
-                            }
-                            ++pos;
-                        });
-            }
+            // Evaluate the relation over the shorter column to avoid going out-of-bounds
+            const auto dense_rows = std::min(left_input_column.row_count(), right_input_column.row_count());
+            util::ByteMaskBitSetBuilder builder(output_bitset);
+            for_each_dense_block<left_input_tdt, right_input_tdt>(
+                    left_input_column,
+                    right_input_column,
+                    dense_rows,
+                    [&builder, &f](const auto* left_ptr, const auto* right_ptr, size_t count) {
+                while (count > 0) {
+                    auto mask = builder.next_chunk(count);
+                    auto* mask_ptr = mask.data();
+                    const auto chunk_rows = mask.size();
+                    util::dispatch_simd([mask_ptr, left_ptr, right_ptr, chunk_rows, &f]() {
+                        for (size_t idx = 0; idx < chunk_rows; ++idx) {
+                            mask_ptr[idx] = static_cast<uint8_t>(f(left_ptr[idx], right_ptr[idx]));
+                        }
+                    });
+                    left_ptr += chunk_rows;
+                    right_ptr += chunk_rows;
+                    count -= chunk_rows;
+                }
+            });
+            builder.flush();
         } else if (left_input_column.is_sparse() && right_input_column.is_sparse()) {
             // Both sparse, only check the intersection of on-bits from both sparse maps
             auto bits_to_check = left_input_column.sparse_map() & right_input_column.sparse_map();
@@ -444,7 +444,7 @@ public:
         impl_->check_magic();
     }
 
-    // Not currently used but might be useful in the future
+    // Leaves every column in a single contiguous block
     void compact_blocks() {
         impl_->compact_blocks();
     }
@@ -7,6 +7,11 @@
 
 #include <span>
 #include <algorithm>
+#include <cmath>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <vector>
 
 namespace arcticdb {
 
@@ -160,13 +165,23 @@ FieldStatsImpl generate_numeric_statistics(std::span<const T> data) {
     if(data.empty())
         return FieldStatsImpl{};
 
-    auto [col_min, col_max] = std::minmax_element(std::begin(data), std::end(data));
     ankerl::unordered_dense::set<T> unique;
     for(auto val : data) {
         unique.emplace(val);
     }
-    FieldStatsImpl field_stats(*col_min, *col_max, unique.size(), UniqueCountType::PRECISE);
-    return field_stats;
+    if constexpr (std::is_floating_point_v<T>) {
+        // NaNs compare false with everything, so would otherwise give a min and max that depend on where they occur.
+        // No comparison can match a NaN, so they are left out of the min and max altogether
+        auto values = data | std::views::filter([](T val) { return !std::isnan(val); });
+        if (std::ranges::empty(values))
+            return FieldStatsImpl(unique.size(), UniqueCountType::PRECISE);
+
+        auto [col_min, col_max] = std::ranges::minmax(values);
+        return FieldStatsImpl(col_min, col_max, unique.size(), UniqueCountType::PRECISE);
+    } else {
+        auto [col_min, col_max] = std::minmax_element(std::begin(data), std::end(data));
+        return FieldStatsImpl(*col_min, *col_max, unique.size(), UniqueCountType::PRECISE);
+    }
 }
 
 inline FieldStatsImpl generate_string_statistics(std::span<const uint64_t> data) {
@@ -210,4 +225,18 @@ FieldStatsImpl generate_column_statistics(ColumnData column_data) {
         return stats;
     }
 }
+
+// The statistics of one column of a data segment, kept alongside the slice the segment was written from so that they
+// can be copied into the index
+struct ColumnFieldStats {
+    std::string name_;
+    DataType data_type_;
+    FieldStatsImpl stats_;
+    // The number of NaN, NaT and None values plus the number of rows missing from a sparse column, for types that have
+    // a null value
+    std::optional<uint64_t> null_count_;
+};
+
+using SegmentFieldStats = std::vector<ColumnFieldStats>;
+
 } // namespace arcticdb
\ No newline at end of file
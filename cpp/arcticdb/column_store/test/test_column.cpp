@@ -417,3 +417,46 @@ TEST(ColumnStats, MultipleBlocks) {
     EXPECT_EQ(stats.unique_count_, 1'000'000);
     EXPECT_EQ(stats.unique_count_precision_, UniqueCountType::PRECISE);
 }
+
+TEST(ColumnTransform, DenseMultipleBlocks) {
+    using namespace arcticdb;
+    using Int64TDT = ScalarTagType<DataTypeTag<DataType::INT64>>;
+    using UInt8TDT = ScalarTagType<DataTypeTag<DataType::UINT8>>;
+    // Different type widths so that the block boundaries of the two columns do not line up
+    constexpr auto num_rows = 10'000;
+    Column left(make_scalar_type(DataType::INT64));
+    Column right(make_scalar_type(DataType::UINT8));
+    for (auto i = 0; i < num_rows; ++i) {
+        left.set_scalar<int64_t>(i, (i * 7) % 256);
+        right.set_scalar<uint8_t>(i, static_cast<uint8_t>((i * 13) % 256));
+    }
+    ASSERT_GT(left.num_blocks(), 1);
+    ASSERT_GT(right.num_blocks(), 1);
+
+    // Each level that the running CPU supports
+    for (auto level : {util::SimdLevel::BASELINE, util::SimdLevel::AVX2, util::SimdLevel::AVX512}) {
+        util::_test_set_max_simd_level(level);
+        util::BitSet predicate_bitset;
+        Column::transform<Int64TDT>(left, predicate_bitset, false, [](int64_t value) { return value % 3 == 0; });
+        util::BitSet relation_bitset;
+        Column::transform<Int64TDT, UInt8TDT>(left, right, relation_bitset, false, [](int64_t l, uint8_t r) { return l < r; });
+        Column doubled(make_scalar_type(DataType::INT64), Sparsity::PERMITTED);
+        Column::transform<Int64TDT, Int64TDT>(left, doubled, [](int64_t value) { return value * 2; });
+        Column difference(make_scalar_type(DataType::INT64), Sparsity::PERMITTED);
+        Column::transform<Int64TDT, UInt8TDT, Int64TDT>(left, right, difference, [](int64_t l, uint8_t r) { return l - r; });
+
+        ASSERT_EQ(predicate_bitset.size(), num_rows);
+        ASSERT_EQ(relation_bitset.size(), num_rows);
+        ASSERT_EQ(doubled.row_count(), num_rows);
+        ASSERT_EQ(difference.row_count(), num_rows);
+        for (auto i = 0; i < num_rows; ++i) {
+            const auto l = *left.scalar_at<int64_t>(i);
+            const auto r = *right.scalar_at<uint8_t>(i);
+            ASSERT_EQ(predicate_bitset.test(i), l % 3 == 0);
+            ASSERT_EQ(relation_bitset.test(i), l < r);
+            ASSERT_EQ(doubled.scalar_at<int64_t>(i), l * 2);
+            ASSERT_EQ(difference.scalar_at<int64_t>(i), l - r);
+        }
+    }
+    util::_test_set_max_simd_level(std::nullopt);
+}
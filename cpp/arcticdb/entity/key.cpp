@@ -64,6 +64,8 @@ KeyData get_key_data(KeyType key_type) {
     STRING_REF(KeyType::SNAPSHOT_TOMBSTONE, ttomb, 'X')
     STRING_KEY(KeyType::APPEND_DATA, app, 'b')
     STRING_REF(KeyType::BLOCK_VERSION_REF, bvref, 'R')
+    STRING_REF(KeyType::ZSTD_DICTIONARY, zdict, 'z')
+    STRING_REF(KeyType::SNAPSHOT_GENERATION, sgen, 'N')
     // Unused
     STRING_KEY(KeyType::PARTITION, pref, 'p')
     STRING_KEY(KeyType::REPLICATION_FAIL_INFO, rfail, 'F')
@@ -192,6 +192,15 @@ enum class KeyType : int {
      * Used for a list based reliable storage lock
      */
     ATOMIC_LOCK = 28,
+    /*
+     * Contains the ZSTD dictionary trained on the small segments of the library, when it has one
+     */
+    ZSTD_DICTIONARY = 29,
+    /*
+     * Rewritten with a new generation whenever a snapshot is written, so that clients caching snapshots can tell when
+     * one was rewritten under the same SNAPSHOT_REF key
+     */
+    SNAPSHOT_GENERATION = 30,
     UNDEFINED
 };
 
@@ -200,6 +209,7 @@ consteval auto key_types_write_precedence() {
     // they just exist inside version keys
     return std::array {
         KeyType::LIBRARY_CONFIG,
+        KeyType::ZSTD_DICTIONARY,
         KeyType::TABLE_DATA,
         KeyType::TABLE_INDEX,
         KeyType::MULTI_KEY,
@@ -210,6 +220,7 @@ consteval auto key_types_write_precedence() {
         KeyType::SNAPSHOT,
         KeyType::SNAPSHOT_REF,
         KeyType::SNAPSHOT_TOMBSTONE,
+        KeyType::SNAPSHOT_GENERATION,
         KeyType::APPEND_REF,
         KeyType::APPEND_DATA,
         KeyType::PARTITION,
@@ -2,12 +2,18 @@
 
 #include <arcticdb/processing/aggregation_interface.hpp>
 #include <arcticdb/processing/unsorted_aggregation.hpp>
+#include <arcticdb/processing/operation_types.hpp>
+#include <arcticdb/entity/type_conversion.hpp>
 #include <arcticdb/entity/type_utils.hpp>
+#include <arcticdb/pipeline/string_pool_utils.hpp>
 #include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/variant.hpp>
 
 #include <third_party/semimap/semimap.h>
 
+#include <cctype>
 #include <charconv>
+#include <functional>
 
 namespace arcticdb {
 
@@ -42,7 +48,14 @@ SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>&
         merged.add_column(FieldRef{*type_descriptor, field_names.at(type_descriptor.index)}, 0, AllocationType::DYNAMIC);
     }
     for (auto &segment : segments) {
-        merged.append(segment);
+        if (segment.has_string_pool()) {
+            // Appending copies the string pool offsets, so they must be made to refer to the merged string pool first
+            auto remapped = segment.clone();
+            remap_strings(remapped, merged.string_pool());
+            merged.append(remapped);
+        } else {
+            merged.append(segment);
+        }
     }
     merged.set_compacted(true);
     merged.sort(start_index_column_name);
@@ -52,7 +65,8 @@ SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>&
 // Needed as MINMAX maps to 2 columns in the column stats object
 enum class ColumnStatTypeInternal {
     MIN,
-    MAX
+    MAX,
+    HLL
 };
 
 std::string type_to_operator_string(ColumnStatTypeInternal type) {
@@ -60,6 +74,7 @@ std::string type_to_operator_string(ColumnStatTypeInternal type) {
     using TypeToOperatorStringMap = semi::static_map<ColumnStatTypeInternal, std::string, Tag>;
     TypeToOperatorStringMap::get(ColumnStatTypeInternal::MIN) = "MIN";
     TypeToOperatorStringMap::get(ColumnStatTypeInternal::MAX) = "MAX";
+    TypeToOperatorStringMap::get(ColumnStatTypeInternal::HLL) = "HLL";
     internal::check<ErrorCode::E_ASSERTION_FAILURE>(TypeToOperatorStringMap::contains(type), "Unknown column stat type requested");
     return TypeToOperatorStringMap::get(type);
 }
@@ -100,7 +115,8 @@ std::pair<std::string, ColumnStatType> from_segment_column_name_v1(std::string_v
     const semi::map<std::string, ColumnStatType> name_to_type_map;
     const ankerl::unordered_dense::map<std::string, ColumnStatTypeInternal> operator_string_to_type {
         {"MIN", ColumnStatTypeInternal::MIN},
-        {"MAX", ColumnStatTypeInternal::MAX}
+        {"MAX", ColumnStatTypeInternal::MAX},
+        {"HLL", ColumnStatTypeInternal::HLL}
     };
     std::optional<ColumnStatTypeInternal> type;
     for (const auto& [name, type_candidate]: operator_string_to_type) {
@@ -118,6 +134,7 @@ std::pair<std::string, ColumnStatType> from_segment_column_name_v1(std::string_v
     using InternalToExternalColumnStatType = semi::static_map<ColumnStatTypeInternal, ColumnStatType, Tag>;
     InternalToExternalColumnStatType::get(ColumnStatTypeInternal::MIN) = ColumnStatType::MINMAX;
     InternalToExternalColumnStatType::get(ColumnStatTypeInternal::MAX) = ColumnStatType::MINMAX;
+    InternalToExternalColumnStatType::get(ColumnStatTypeInternal::HLL) = ColumnStatType::HYPERLOGLOG;
     return std::make_pair(std::string(pattern.substr(1, pattern.size() - 2)), InternalToExternalColumnStatType::get(*type));
 }
 
@@ -125,6 +142,7 @@ std::string type_to_name(ColumnStatType type) {
     struct Tag{};
     using TypeToNameMap = semi::static_map<ColumnStatType, std::string, Tag>;
     TypeToNameMap::get(ColumnStatType::MINMAX) = "MINMAX";
+    TypeToNameMap::get(ColumnStatType::HYPERLOGLOG) = "HYPERLOGLOG";
     internal::check<ErrorCode::E_ASSERTION_FAILURE>(TypeToNameMap::contains(type), "Unknown column stat type requested");
     return TypeToNameMap::get(type);
 }
@@ -133,6 +151,7 @@ std::optional<ColumnStatType> name_to_type(const std::string& name) {
     // Cannot use static_map here as keys come from user input
     semi::map<std::string, ColumnStatType> name_to_type_map;
     name_to_type_map.get("MINMAX") = ColumnStatType::MINMAX;
+    name_to_type_map.get("HYPERLOGLOG") = ColumnStatType::HYPERLOGLOG;
     return name_to_type_map.contains(name) ? std::make_optional<ColumnStatType>(name_to_type_map.get(name)) : std::nullopt;
 }
 
@@ -152,9 +171,15 @@ ColumnStats::ColumnStats(const std::unordered_map<std::string, std::unordered_se
     }
 }
 
+// Column stats column names are of the form "vX.Y_<version specific pattern>". Any other columns, such as the start
+// and end index columns, or the fields of an index segment that stats have been copied into, are not column stats
+bool is_column_stats_column_name(std::string_view name) {
+    return name.size() > 1 && name[0] == 'v' && std::isdigit(static_cast<unsigned char>(name[1]));
+}
+
 ColumnStats::ColumnStats(const FieldCollection& column_stats_fields) {
     for (const auto& field: column_stats_fields) {
-        if (field.name() != start_index_column_name && field.name() != end_index_column_name) {
+        if (is_column_stats_column_name(field.name())) {
             auto [column_name, index_type] = from_segment_column_name(field.name());
             if (auto it = column_stats_.find(column_name); it == column_stats_.end()) {
                 column_stats_[column_name] = {index_type};
@@ -198,6 +223,7 @@ ankerl::unordered_dense::set<std::string> ColumnStats::segment_column_names() co
     struct Tag{};
     using ExternalToInternalColumnStatType = semi::static_map<ColumnStatType, std::unordered_set<ColumnStatTypeInternal>, Tag>;
     ExternalToInternalColumnStatType::get(ColumnStatType::MINMAX) = std::unordered_set<ColumnStatTypeInternal>{ColumnStatTypeInternal::MIN, ColumnStatTypeInternal::MAX};
+    ExternalToInternalColumnStatType::get(ColumnStatType::HYPERLOGLOG) = std::unordered_set<ColumnStatTypeInternal>{ColumnStatTypeInternal::HLL};
     ankerl::unordered_dense::set<std::string> res;
     for (const auto& [column, column_stat_types]: column_stats_) {
         for (const auto& column_stat_type: column_stat_types) {
@@ -238,6 +264,12 @@ std::optional<Clause> ColumnStats::clause() const {
                                              ColumnName(to_segment_column_name(column, ColumnStatTypeInternal::MAX)))
                                              );
                     break;
+                case ColumnStatType::HYPERLOGLOG:
+                    index_generation_aggregators->emplace_back(
+                            HyperLogLogAggregator(ColumnName(column),
+                                                  ColumnName(to_segment_column_name(column, ColumnStatTypeInternal::HLL)))
+                                                  );
+                    break;
                 default:
                     internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unrecognised ColumnStatType");
             }
@@ -246,6 +278,39 @@ std::optional<Clause> ColumnStats::clause() const {
     return ColumnStatsGenerationClause(std::move(input_columns), index_generation_aggregators);
 }
 
+std::optional<std::pair<std::string, std::string>> ColumnStats::minmax_column_names(const std::string& column) const {
+    if (auto it = column_stats_.find(column); it == column_stats_.end() || !it->second.contains(ColumnStatType::MINMAX)) {
+        return std::nullopt;
+    }
+    return std::make_pair(to_segment_column_name(column, ColumnStatTypeInternal::MIN, version_),
+                          to_segment_column_name(column, ColumnStatTypeInternal::MAX, version_));
+}
+
+std::optional<std::string> ColumnStats::hyperloglog_column_name(const std::string& column) const {
+    if (auto it = column_stats_.find(column); it == column_stats_.end() || !it->second.contains(ColumnStatType::HYPERLOGLOG)) {
+        return std::nullopt;
+    }
+    return to_segment_column_name(column, ColumnStatTypeInternal::HLL, version_);
+}
+
+std::pair<std::string, std::string> minmax_segment_column_names(const std::string& column) {
+    return std::make_pair(to_segment_column_name(column, ColumnStatTypeInternal::MIN),
+                          to_segment_column_name(column, ColumnStatTypeInternal::MAX));
+}
+
+static constexpr std::string_view null_count_prefix = "NULL_COUNT(";
+
+std::string null_count_segment_column_name(std::string_view column) {
+    return fmt::format("{}{})", null_count_prefix, column);
+}
+
+std::optional<std::string> column_from_null_count_segment_column_name(std::string_view segment_column_name) {
+    if (!segment_column_name.starts_with(null_count_prefix) || !segment_column_name.ends_with(')')) {
+        return std::nullopt;
+    }
+    return std::string(segment_column_name.substr(null_count_prefix.size(), segment_column_name.size() - null_count_prefix.size() - 1));
+}
+
 bool ColumnStats::operator==(const ColumnStats& right) const {
     return column_stats_ == right.column_stats_;
 }
@@ -293,4 +358,287 @@ std::pair<std::string, ColumnStatType> ColumnStats::from_segment_column_name(
     }
 }
 
-}
\ No newline at end of file
+namespace {
+
+// Flips the comparison so that "value OP column" can be evaluated as "column OP value"
+OperationType reverse_comparison(OperationType operation_type) {
+    switch (operation_type) {
+        case OperationType::LT:
+            return OperationType::GT;
+        case OperationType::LE:
+            return OperationType::GE;
+        case OperationType::GT:
+            return OperationType::LT;
+        case OperationType::GE:
+            return OperationType::LE;
+        default:
+            return operation_type;
+    }
+}
+
+// Returns true only if no value in [min, max] can satisfy "value OP comparand". All of the checks are phrased such
+// that a NaN min, max, or comparand results in false, so that segments are never incorrectly excluded.
+template<typename T, typename U>
+bool comparison_impossible(OperationType operation_type, T min, T max, U comparand) {
+    switch (operation_type) {
+        case OperationType::EQ:
+            return LessThanOperator{}(comparand, min) || GreaterThanOperator{}(comparand, max);
+        case OperationType::LT:
+            return GreaterThanEqualsOperator{}(min, comparand);
+        case OperationType::LE:
+            return GreaterThanOperator{}(min, comparand);
+        case OperationType::GT:
+            return LessThanEqualsOperator{}(max, comparand);
+        case OperationType::GE:
+            return LessThanOperator{}(max, comparand);
+        default:
+            return false;
+    }
+}
+
+class ColumnStatsFilter {
+public:
+    ColumnStatsFilter(
+            const SegmentInMemory& column_stats_segment,
+            const ExpressionContext& expression_context,
+            std::span<const uint64_t> row_counts) :
+        segment_(column_stats_segment),
+        expression_context_(expression_context),
+        column_stats_(column_stats_segment.descriptor().fields()),
+        row_counts_(row_counts) {
+    }
+
+    util::BitSet evaluate(const VariantNode& node) const {
+        return util::variant_match(node,
+            [this](const ExpressionName& expression_name) {
+                return evaluate_expression(*expression_context_.expression_nodes_.get_value(expression_name.value));
+            },
+            [this](const auto&) {
+                return all_rows();
+            });
+    }
+
+private:
+    const SegmentInMemory& segment_;
+    const ExpressionContext& expression_context_;
+    ColumnStats column_stats_;
+    std::span<const uint64_t> row_counts_;
+
+    util::BitSet all_rows() const {
+        util::BitSet res(bv_size(segment_.row_count()));
+        if (segment_.row_count() > 0) {
+            res.set_range(0, bv_size(segment_.row_count() - 1));
+        }
+        return res;
+    }
+
+    util::BitSet evaluate_expression(const ExpressionNode& expression_node) const {
+        switch (expression_node.operation_type_) {
+            case OperationType::AND: {
+                auto res = evaluate(expression_node.left_);
+                res &= evaluate(expression_node.right_);
+                return res;
+            }
+            case OperationType::OR: {
+                auto res = evaluate(expression_node.left_);
+                res |= evaluate(expression_node.right_);
+                return res;
+            }
+            case OperationType::EQ:
+            case OperationType::LT:
+            case OperationType::LE:
+            case OperationType::GT:
+            case OperationType::GE:
+                return evaluate_comparison(expression_node);
+            case OperationType::ISIN:
+                return evaluate_membership(expression_node);
+            case OperationType::ISNULL:
+            case OperationType::NOTNULL:
+                return evaluate_null_check(expression_node);
+            default:
+                return all_rows();
+        }
+    }
+
+    std::optional<std::pair<const Column*, const Column*>> minmax_columns(const ColumnName& column_name) const {
+        auto names = column_stats_.minmax_column_names(column_name.value);
+        if (!names.has_value()) {
+            return std::nullopt;
+        }
+        auto min_index = segment_.column_index(names->first);
+        auto max_index = segment_.column_index(names->second);
+        if (!min_index.has_value() || !max_index.has_value()) {
+            return std::nullopt;
+        }
+        const auto& min_column = segment_.column(*min_index);
+        const auto& max_column = segment_.column(*max_index);
+        if (min_column.type() != max_column.type() || !is_numeric_type(min_column.type().data_type())) {
+            return std::nullopt;
+        }
+        return std::make_pair(&min_column, &max_column);
+    }
+
+    // Calls func(row, min, max) for every row of the stats segment where both a min and a max are present
+    template<typename RawType, typename Func>
+    void for_each_minmax(const Column& min_column, const Column& max_column, Func&& func) const {
+        for (position_t row = 0; row < static_cast<position_t>(segment_.row_count()); ++row) {
+            auto min = min_column.scalar_at<RawType>(row);
+            auto max = max_column.scalar_at<RawType>(row);
+            if (min.has_value() && max.has_value()) {
+                func(row, *min, *max);
+            }
+        }
+    }
+
+    util::BitSet evaluate_comparison(const ExpressionNode& expression_node) const {
+        auto operation_type = expression_node.operation_type_;
+        ColumnName column_name;
+        ValueName value_name;
+        if (std::holds_alternative<ColumnName>(expression_node.left_) && std::holds_alternative<ValueName>(expression_node.right_)) {
+            column_name = std::get<ColumnName>(expression_node.left_);
+            value_name = std::get<ValueName>(expression_node.right_);
+        } else if (std::holds_alternative<ValueName>(expression_node.left_) && std::holds_alternative<ColumnName>(expression_node.right_)) {
+            column_name = std::get<ColumnName>(expression_node.right_);
+            value_name = std::get<ValueName>(expression_node.left_);
+            operation_type = reverse_comparison(operation_type);
+        } else {
+            return all_rows();
+        }
+        auto res = all_rows();
+        auto columns = minmax_columns(column_name);
+        if (!columns.has_value()) {
+            return res;
+        }
+        const Column* min_column = columns->first;
+        const Column* max_column = columns->second;
+        const auto value = expression_context_.values_.get_value(value_name.value);
+        details::visit_type(min_column->type().data_type(), [&](auto col_tag) {
+            using col_type_info = ScalarTypeInfo<decltype(col_tag)>;
+            details::visit_type(value->data_type_, [&](auto val_tag) {
+                using val_type_info = ScalarTypeInfo<decltype(val_tag)>;
+                if constexpr (is_numeric_type(col_type_info::data_type) && is_numeric_type(val_type_info::data_type)) {
+                    using ColType = typename col_type_info::RawType;
+                    using ValType = typename val_type_info::RawType;
+                    using comp = typename arcticdb::Comparable<ColType, ValType>;
+                    const auto comparand = static_cast<typename comp::right_type>(value->get<ValType>());
+                    for_each_minmax<ColType>(*min_column, *max_column, [&](position_t row, ColType min, ColType max) {
+                        if (comparison_impossible(operation_type,
+                                                  static_cast<typename comp::left_type>(min),
+                                                  static_cast<typename comp::left_type>(max),
+                                                  comparand)) {
+                            res.set(bv_size(row), false);
+                        }
+                    });
+                }
+            });
+        });
+        return res;
+    }
+
+    util::BitSet evaluate_membership(const ExpressionNode& expression_node) const {
+        if (!std::holds_alternative<ColumnName>(expression_node.left_) || !std::holds_alternative<ValueSetName>(expression_node.right_)) {
+            return all_rows();
+        }
+        auto res = all_rows();
+        auto columns = minmax_columns(std::get<ColumnName>(expression_node.left_));
+        if (!columns.has_value()) {
+            return res;
+        }
+        const Column* min_column = columns->first;
+        const Column* max_column = columns->second;
+        const auto value_set = expression_context_.value_sets_.get_value(std::get<ValueSetName>(expression_node.right_).value);
+        if (value_set->empty()) {
+            // Nothing can be a member of the empty set
+            res.clear();
+            return res;
+        }
+        details::visit_type(min_column->type().data_type(), [&](auto col_tag) {
+            using col_type_info = ScalarTypeInfo<decltype(col_tag)>;
+            details::visit_type(value_set->base_type().data_type(), [&](auto val_set_tag) {
+                using val_set_type_info = ScalarTypeInfo<decltype(val_set_tag)>;
+                if constexpr (is_numeric_type(col_type_info::data_type) && is_numeric_type(val_set_type_info::data_type)) {
+                    using ColType = typename col_type_info::RawType;
+                    using ValSetType = typename val_set_type_info::RawType;
+                    using comp = typename arcticdb::Comparable<ColType, ValSetType>;
+                    const auto typed_value_set = value_set->get_set<ValSetType>();
+                    for_each_minmax<ColType>(*min_column, *max_column, [&](position_t row, ColType min, ColType max) {
+                        const bool impossible = std::ranges::all_of(*typed_value_set, [&](ValSetType member) {
+                            return comparison_impossible(OperationType::EQ,
+                                                         static_cast<typename comp::left_type>(min),
+                                                         static_cast<typename comp::left_type>(max),
+                                                         static_cast<typename comp::right_type>(member));
+                        });
+                        if (impossible) {
+                            res.set(bv_size(row), false);
+                        }
+                    });
+                }
+            });
+        });
+        return res;
+    }
+
+    // No row can be null if the null count is zero, and every row is null if it equals the number of rows
+    util::BitSet evaluate_null_check(const ExpressionNode& expression_node) const {
+        auto res = all_rows();
+        if (row_counts_.empty() || !std::holds_alternative<ColumnName>(expression_node.left_)) {
+            return res;
+        }
+        auto null_count_index = segment_.column_index(
+                null_count_segment_column_name(std::get<ColumnName>(expression_node.left_).value));
+        if (!null_count_index.has_value()) {
+            return res;
+        }
+        const auto& null_count_column = segment_.column(*null_count_index);
+        internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+                row_counts_.size() == segment_.row_count(),
+                "Expected a row count for each of the {} rows of the stats segment, got {}",
+                segment_.row_count(), row_counts_.size());
+        const bool is_null = expression_node.operation_type_ == OperationType::ISNULL;
+        for (position_t row = 0; row < static_cast<position_t>(segment_.row_count()); ++row) {
+            auto null_count = null_count_column.scalar_at<uint64_t>(row);
+            if (null_count.has_value() && (is_null ? *null_count == 0 : *null_count == row_counts_[row])) {
+                res.set(bv_size(row), false);
+            }
+        }
+        return res;
+    }
+};
+
+} // namespace
+
+bool filter_can_use_minmax_stats(const ExpressionContext& expression_context) {
+    std::function<bool(const VariantNode&)> can_use = [&](const VariantNode& node) {
+        if (!std::holds_alternative<ExpressionName>(node))
+            return false;
+
+        const auto& expression_node = *expression_context.expression_nodes_.get_value(std::get<ExpressionName>(node).value);
+        switch (expression_node.operation_type_) {
+            case OperationType::AND:
+                return can_use(expression_node.left_) || can_use(expression_node.right_);
+            case OperationType::OR:
+                return can_use(expression_node.left_) && can_use(expression_node.right_);
+            case OperationType::EQ:
+            case OperationType::LT:
+            case OperationType::LE:
+            case OperationType::GT:
+            case OperationType::GE:
+                return (std::holds_alternative<ColumnName>(expression_node.left_) && std::holds_alternative<ValueName>(expression_node.right_)) ||
+                    (std::holds_alternative<ValueName>(expression_node.left_) && std::holds_alternative<ColumnName>(expression_node.right_));
+            case OperationType::ISIN:
+                return std::holds_alternative<ColumnName>(expression_node.left_) && std::holds_alternative<ValueSetName>(expression_node.right_);
+            default:
+                return false;
+        }
+    };
+    return can_use(expression_context.root_node_name_);
+}
+
+util::BitSet column_stats_rows_matching_filter(
+        const SegmentInMemory& column_stats_segment,
+        const ExpressionContext& expression_context,
+        std::span<const uint64_t> row_counts) {
+    return ColumnStatsFilter(column_stats_segment, expression_context, row_counts).evaluate(expression_context.root_node_name_);
+}
+
+}
@@ -6,6 +6,7 @@
 
 #include <map>
 #include <set>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -15,7 +16,8 @@ namespace arcticdb {
 SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>& segments);
 
 enum class ColumnStatType {
-    MINMAX
+    MINMAX,
+    HYPERLOGLOG
 };
 
 static const char* const start_index_column_name = "start_index";
@@ -31,6 +33,11 @@ public:
 
     std::unordered_map<std::string, std::unordered_set<std::string>> to_map() const;
     std::optional<Clause> clause() const;
+    // The names of the MIN and MAX columns for the given input column, if this object was constructed from the fields
+    // of a column stats segment that contains MINMAX stats for that column
+    std::optional<std::pair<std::string, std::string>> minmax_column_names(const std::string& column) const;
+    // The name of the column holding the serialized HyperLogLog sketches for the given input column, likewise
+    std::optional<std::string> hyperloglog_column_name(const std::string& column) const;
 
     bool operator==(const ColumnStats& right) const;
 private:
@@ -44,4 +51,32 @@ private:
 
 };
 
+// The names of the MIN and MAX columns for the given input column, as written by the latest column stats version
+std::pair<std::string, std::string> minmax_segment_column_names(const std::string& column);
+
+// The name of the column holding the number of null values in the given input column. Only the stats copied into index
+// segments when statistics are generated on write have these columns.
+std::string null_count_segment_column_name(std::string_view column);
+
+// The input column that a null count column holds the number of nulls for, if segment_column_name is one
+std::optional<std::string> column_from_null_count_segment_column_name(std::string_view segment_column_name);
+
+/*
+ * Uses the MINMAX columns of a column stats segment to work out which of the data segments the stats were generated
+ * from could contain rows satisfying the filter in expression_context. The returned bitset has one bit per row of
+ * the column stats segment, which is cleared only if the min/max values make the filter impossible for that segment.
+ * Parts of the expression that cannot be reasoned about using min/max values never clear any bits.
+ * If row_counts holds the number of rows of the data segment described by each row, ISNULL and NOTNULL are also
+ * evaluated using any null count columns.
+ */
+util::BitSet column_stats_rows_matching_filter(
+        const SegmentInMemory& column_stats_segment,
+        const ExpressionContext& expression_context,
+        std::span<const uint64_t> row_counts = {});
+
+// Whether column_stats_rows_matching_filter could clear any bits for this filter using MINMAX stats, i.e. whether it
+// compares a column with a value or value set somewhere that is not ORed with something that cannot be reasoned about.
+// If not, there is no point fetching the column stats to filter with.
+bool filter_can_use_minmax_stats(const ExpressionContext& expression_context);
+
 }
\ No newline at end of file
@@ -118,6 +118,15 @@ struct FrameSlice {
         desc_ = desc;
     }
 
+    // The statistics of the columns of the segment written for this slice, if they were generated on write
+    [[nodiscard]] const std::shared_ptr<const SegmentFieldStats>& field_stats() const {
+        return field_stats_;
+    }
+
+    void set_field_stats(std::shared_ptr<const SegmentFieldStats> field_stats) {
+        field_stats_ = std::move(field_stats);
+    }
+
     [[nodiscard]] const ColRange& columns() const { return col_range;  }
     [[nodiscard]] const RowRange& rows() const { return row_range; }
 
@@ -168,6 +177,7 @@ private:
     std::optional<uint64_t> hash_bucket_;
     std::optional<uint64_t> num_buckets_;
     std::optional<std::vector<size_t>> indices_;
+    std::shared_ptr<const SegmentFieldStats> field_stats_;
     util::MagicNum<'F', 's', 'l', 'c'> magic_;
 };
 
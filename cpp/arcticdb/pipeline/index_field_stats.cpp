@@ -0,0 +1,270 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/pipeline/index_field_stats.hpp>
+#include <arcticdb/pipeline/column_stats.hpp>
+#include <arcticdb/pipeline/index_fields.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/constants.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <ankerl/unordered_dense.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace arcticdb::pipelines::index {
+
+namespace {
+
+// The number of null values in column, for the types that have one, including rows missing from a sparse column
+std::optional<uint64_t> count_nulls(const Column& column, size_t segment_rows) {
+    std::optional<uint64_t> null_count;
+    column.type().visit_tag([&column, &null_count, segment_rows](auto tdt) {
+        using TagType = std::decay_t<decltype(tdt)>;
+        constexpr auto data_type = TagType::DataTypeTag::data_type;
+        constexpr bool is_string = is_dynamic_string_type(data_type) && !is_arrow_output_only_type(data_type);
+        if constexpr (TagType::DimensionTag::value == Dimension::Dim0 &&
+                      (is_floating_point_type(data_type) || is_time_type(data_type) || is_string)) {
+            uint64_t nulls = segment_rows - column.row_count();
+            auto column_data = column.data();
+            while (auto block = column_data.next<TagType>()) {
+                for (auto value : std::span{block->data(), block->row_count()}) {
+                    if constexpr (is_floating_point_type(data_type)) {
+                        nulls += std::isnan(value) ? 1 : 0;
+                    } else if constexpr (is_time_type(data_type)) {
+                        nulls += value == NaT ? 1 : 0;
+                    } else {
+                        // Relies on string_nan == string_none - 1
+                        nulls += static_cast<entity::position_t>(value) >= string_nan ? 1 : 0;
+                    }
+                }
+            }
+            null_count = nulls;
+        }
+    });
+    return null_count;
+}
+
+// The columns written for the statistics of one column of the data
+struct FieldStatsColumns {
+    std::optional<DataType> minmax_type_;
+    std::shared_ptr<Column> min_;
+    std::shared_ptr<Column> max_;
+    std::shared_ptr<Column> null_count_;
+};
+
+void add_sparse_column(SegmentInMemory& index_segment, const std::string& name, const std::shared_ptr<Column>& column) {
+    if (column->row_count() == 0)
+        return;
+
+    column->set_row_data(index_segment.row_count() - 1);
+    index_segment.add_column(scalar_field(column->type().data_type(), name), column);
+}
+
+} // namespace
+
+bool generate_field_stats_on_write() {
+    return ConfigsMap::instance()->get_int("Statistics.GenerateOnWrite", 0) == 1;
+}
+
+std::shared_ptr<const SegmentFieldStats> collect_field_stats(const SegmentInMemory& segment) {
+    auto field_stats = std::make_shared<SegmentFieldStats>();
+    for (auto col = segment.descriptor().index().field_count(); col < segment.num_columns(); ++col) {
+        const auto& column = segment.column(static_cast<position_t>(col));
+        auto stats = column.get_statistics();
+        auto null_count = count_nulls(column, segment.row_count());
+        if ((stats.has_min() && stats.has_max()) || null_count.has_value()) {
+            field_stats->emplace_back(ColumnFieldStats{
+                std::string{segment.field(col).name()},
+                column.type().data_type(),
+                stats,
+                null_count});
+        }
+    }
+    if (field_stats->empty())
+        return nullptr;
+
+    return field_stats;
+}
+
+void add_field_stats_columns(
+        SegmentInMemory& index_segment,
+        std::span<const std::shared_ptr<const SegmentFieldStats>> row_field_stats) {
+    util::check(row_field_stats.size() == index_segment.row_count(),
+                "Expected field stats for each of the {} rows of the index, got {}",
+                index_segment.row_count(), row_field_stats.size());
+
+    // Kept in the order in which the columns are first seen, so that the stats columns are in a consistent order
+    std::vector<std::string> names;
+    ankerl::unordered_dense::map<std::string, FieldStatsColumns> columns;
+    for (const auto& field_stats : row_field_stats) {
+        if (!field_stats)
+            continue;
+
+        for (const auto& column_stats : *field_stats) {
+            auto [it, inserted] = columns.try_emplace(column_stats.name_);
+            auto& stats_columns = it->second;
+            if (inserted) {
+                names.emplace_back(column_stats.name_);
+                stats_columns.minmax_type_ = column_stats.data_type_;
+                stats_columns.min_ = std::make_shared<Column>(make_scalar_type(column_stats.data_type_), Sparsity::PERMITTED);
+                stats_columns.max_ = std::make_shared<Column>(make_scalar_type(column_stats.data_type_), Sparsity::PERMITTED);
+                stats_columns.null_count_ = std::make_shared<Column>(make_scalar_type(DataType::UINT64), Sparsity::PERMITTED);
+            } else if (stats_columns.minmax_type_ != column_stats.data_type_ && column_stats.stats_.has_min()) {
+                // The type of a column can change between rows with dynamic schema. Converting the min and max to a
+                // common type could round them the wrong way, so no min and max are kept for such a column
+                stats_columns.minmax_type_ = std::nullopt;
+            }
+        }
+    }
+
+    for (size_t row = 0; row < row_field_stats.size(); ++row) {
+        if (!row_field_stats[row])
+            continue;
+
+        const auto index_row = static_cast<ssize_t>(row);
+        for (const auto& column_stats : *row_field_stats[row]) {
+            auto& stats_columns = columns.at(column_stats.name_);
+            auto stats = column_stats.stats_;
+            if (stats.has_min() && stats.has_max() && stats_columns.minmax_type_ == column_stats.data_type_) {
+                details::visit_type(column_stats.data_type_, [&](auto tag) {
+                    using type_info = ScalarTypeInfo<decltype(tag)>;
+                    if constexpr (is_numeric_type(type_info::data_type)) {
+                        using RawType = typename type_info::RawType;
+                        stats_columns.min_->set_scalar(index_row, stats.get_min<RawType>());
+                        stats_columns.max_->set_scalar(index_row, stats.get_max<RawType>());
+                    }
+                });
+            }
+            if (column_stats.null_count_.has_value())
+                stats_columns.null_count_->set_scalar(index_row, *column_stats.null_count_);
+        }
+    }
+
+    for (const auto& name : names) {
+        const auto& stats_columns = columns.at(name);
+        if (stats_columns.minmax_type_.has_value()) {
+            auto [min_name, max_name] = minmax_segment_column_names(name);
+            add_sparse_column(index_segment, min_name, stats_columns.min_);
+            add_sparse_column(index_segment, max_name, stats_columns.max_);
+        }
+        add_sparse_column(index_segment, null_count_segment_column_name(name), stats_columns.null_count_);
+    }
+}
+
+bool has_field_stats(const SegmentInMemory& index_segment) {
+    const auto& fields = index_segment.descriptor().fields();
+    return !ColumnStats(fields).to_map().empty() || std::ranges::any_of(fields, [](const auto& field) {
+        return column_from_null_count_segment_column_name(field.name()).has_value();
+    });
+}
+
+std::vector<std::shared_ptr<const SegmentFieldStats>> read_field_stats(const SegmentInMemory& index_segment) {
+    std::vector<std::shared_ptr<SegmentFieldStats>> field_stats(index_segment.row_count());
+    auto column_stats_for_row = [&field_stats](size_t row, const std::string& name, DataType data_type) -> ColumnFieldStats& {
+        auto& row_stats = field_stats[row];
+        if (!row_stats)
+            row_stats = std::make_shared<SegmentFieldStats>();
+
+        if (row_stats->empty() || row_stats->back().name_ != name)
+            row_stats->emplace_back(ColumnFieldStats{name, data_type, FieldStatsImpl{}, std::nullopt});
+
+        return row_stats->back();
+    };
+
+    // Columns with only null counts have no min and max to take the type from, so it is taken from the descriptor
+    ankerl::unordered_dense::map<std::string, DataType> data_types;
+    if (index_segment.has_index_descriptor()) {
+        for (const auto& field : index_segment.index_descriptor().fields())
+            data_types.try_emplace(std::string{field.name()}, field.type().data_type());
+    }
+
+    ColumnStats column_stats(index_segment.descriptor().fields());
+    std::vector<std::string> names;
+    for (const auto& [name, stat_types] : column_stats.to_map())
+        names.emplace_back(name);
+    for (const auto& field : index_segment.descriptor().fields()) {
+        if (auto name = column_from_null_count_segment_column_name(field.name()); name.has_value() && !column_stats.minmax_column_names(*name).has_value())
+            names.emplace_back(std::move(*name));
+    }
+
+    for (const auto& name : names) {
+        const Column* min_column = nullptr;
+        const Column* max_column = nullptr;
+        if (auto minmax_names = column_stats.minmax_column_names(name); minmax_names.has_value()) {
+            auto min_index = index_segment.column_index(minmax_names->first);
+            auto max_index = index_segment.column_index(minmax_names->second);
+            if (min_index.has_value() && max_index.has_value()) {
+                min_column = &index_segment.column(static_cast<position_t>(*min_index));
+                max_column = &index_segment.column(static_cast<position_t>(*max_index));
+            }
+        }
+        const Column* null_count_column = nullptr;
+        if (auto null_count_index = index_segment.column_index(null_count_segment_column_name(name)); null_count_index.has_value())
+            null_count_column = &index_segment.column(static_cast<position_t>(*null_count_index));
+
+        DataType data_type = DataType::UINT64;
+        if (min_column != nullptr)
+            data_type = min_column->type().data_type();
+        else if (auto it = data_types.find(name); it != data_types.end())
+            data_type = it->second;
+
+        for (size_t row = 0; row < index_segment.row_count(); ++row) {
+            const auto index_row = static_cast<position_t>(row);
+            if (min_column != nullptr) {
+                details::visit_type(data_type, [&](auto tag) {
+                    using type_info = ScalarTypeInfo<decltype(tag)>;
+                    if constexpr (is_numeric_type(type_info::data_type)) {
+                        using RawType = typename type_info::RawType;
+                        auto min = min_column->scalar_at<RawType>(index_row);
+                        auto max = max_column->scalar_at<RawType>(index_row);
+                        if (min.has_value() && max.has_value()) {
+                            auto& stats = column_stats_for_row(row, name, data_type).stats_;
+                            stats.set_min(*min);
+                            stats.set_max(*max);
+                        }
+                    }
+                });
+            }
+            if (null_count_column != nullptr) {
+                if (auto null_count = null_count_column->scalar_at<uint64_t>(index_row); null_count.has_value())
+                    column_stats_for_row(row, name, data_type).null_count_ = *null_count;
+            }
+        }
+    }
+    return {field_stats.begin(), field_stats.end()};
+}
+
+util::BitSet index_rows_matching_filter(
+        const SegmentInMemory& index_segment,
+        const ExpressionContext& expression_context) {
+    const auto& start_row_column = index_segment.column(static_cast<position_t>(Fields::start_row));
+    const auto& end_row_column = index_segment.column(static_cast<position_t>(Fields::end_row));
+    std::vector<uint64_t> start_rows(index_segment.row_count());
+    std::vector<uint64_t> row_counts(index_segment.row_count());
+    for (size_t row = 0; row < index_segment.row_count(); ++row) {
+        start_rows[row] = start_row_column.scalar_at<uint64_t>(static_cast<position_t>(row)).value();
+        row_counts[row] = end_row_column.scalar_at<uint64_t>(static_cast<position_t>(row)).value() - start_rows[row];
+    }
+
+    auto res = column_stats_rows_matching_filter(index_segment, expression_context, row_counts);
+    ankerl::unordered_dense::set<uint64_t> excluded_row_slices;
+    for (size_t row = 0; row < index_segment.row_count(); ++row) {
+        if (!res[bv_size(row)])
+            excluded_row_slices.emplace(start_rows[row]);
+    }
+    if (!excluded_row_slices.empty()) {
+        for (size_t row = 0; row < index_segment.row_count(); ++row) {
+            if (excluded_row_slices.contains(start_rows[row]))
+                res.set(bv_size(row), false);
+        }
+    }
+    return res;
+}
+
+} //namespace arcticdb::pipelines::index
@@ -0,0 +1,54 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/column_store/statistics.hpp>
+#include <arcticdb/processing/expression_context.hpp>
+#include <arcticdb/util/bitset.hpp>
+
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace arcticdb::pipelines::index {
+
+/*
+ * When Statistics.GenerateOnWrite is set, the statistics calculated for each data segment are also copied into the
+ * index, so that reads can skip data segments using them without a separate create_column_stats pass. Each index row
+ * describing a data segment with statistics has values in the MIN and MAX columns named as in a column stats segment,
+ * and in NULL_COUNT columns, for the columns of that data segment. All of these columns are sparse, and rows for data
+ * segments written without statistics have no values in them.
+ */
+bool generate_field_stats_on_write();
+
+// The statistics already calculated for the non-index columns of segment, along with their null counts, or nullptr if
+// there are none
+std::shared_ptr<const SegmentFieldStats> collect_field_stats(const SegmentInMemory& segment);
+
+// Adds the statistics columns to index_segment, given the statistics of the data segment each of its rows refers to
+void add_field_stats_columns(
+    SegmentInMemory& index_segment,
+    std::span<const std::shared_ptr<const SegmentFieldStats>> row_field_stats);
+
+bool has_field_stats(const SegmentInMemory& index_segment);
+
+// The inverse of add_field_stats_columns, with a nullptr for each row without any statistics
+std::vector<std::shared_ptr<const SegmentFieldStats>> read_field_stats(const SegmentInMemory& index_segment);
+
+/*
+ * Returns a bitset with one bit per row of index_segment, which is cleared where the statistics show that no row of
+ * the row-slice it belongs to can satisfy the filter in expression_context. As the statistics of each column slice only
+ * describe its own columns, a row-slice is excluded if the statistics of any one of its column slices rule it out, and
+ * all of the index rows for that row-slice are then cleared.
+ */
+util::BitSet index_rows_matching_filter(
+    const SegmentInMemory& index_segment,
+    const ExpressionContext& expression_context);
+
+} //namespace arcticdb::pipelines::index
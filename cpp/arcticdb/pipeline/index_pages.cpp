@@ -0,0 +1,139 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/pipeline/index_pages.hpp>
+#include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/pipeline/index_fields.hpp>
+#include <arcticdb/pipeline/string_pool_utils.hpp>
+#include <arcticdb/storage/store.hpp>
+#include <arcticdb/stream/stream_utils.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <folly/futures/Future.h>
+
+namespace arcticdb::pipelines::index {
+
+namespace {
+
+struct PageBounds {
+    timestamp start_index_ = std::numeric_limits<timestamp>::max();
+    timestamp end_index_ = std::numeric_limits<timestamp>::min();
+    size_t start_col_ = std::numeric_limits<size_t>::max();
+    size_t end_col_ = 0;
+    size_t start_row_ = std::numeric_limits<size_t>::max();
+    size_t end_row_ = 0;
+};
+
+// The keys in an index segment are ordered by column slice and then by row slice, so the first and last rows of a
+// page do not necessarily hold its bounds
+PageBounds page_bounds(const SegmentInMemory& page) {
+    PageBounds bounds;
+    for (auto row = 0L; row < static_cast<ssize_t>(page.row_count()); ++row) {
+        bounds.start_index_ = std::min(bounds.start_index_, page.scalar_at<timestamp>(row, int(Fields::start_index)).value());
+        bounds.end_index_ = std::max(bounds.end_index_, page.scalar_at<timestamp>(row, int(Fields::end_index)).value());
+        bounds.start_col_ = std::min(bounds.start_col_, page.scalar_at<size_t>(row, int(Fields::start_col)).value());
+        bounds.end_col_ = std::max(bounds.end_col_, page.scalar_at<size_t>(row, int(Fields::end_col)).value());
+        bounds.start_row_ = std::min(bounds.start_row_, page.scalar_at<size_t>(row, int(Fields::start_row)).value());
+        bounds.end_row_ = std::max(bounds.end_row_, page.scalar_at<size_t>(row, int(Fields::end_row)).value());
+    }
+    return bounds;
+}
+
+} // namespace
+
+size_t index_page_rows() {
+    return static_cast<size_t>(ConfigsMap::instance()->get_int("VersionStore.IndexPageRows", 0));
+}
+
+bool is_paged_index(const SegmentInMemory& index_segment) {
+    return index_segment.row_count() > 0 &&
+        stream::key_type_from_segment<Fields>(index_segment, 0) == KeyType::TABLE_INDEX;
+}
+
+bool should_write_index_pages(const SegmentInMemory& index_segment, KeyType key_type, size_t page_rows) {
+    if (page_rows == 0 || key_type != KeyType::TABLE_INDEX || index_segment.row_count() <= page_rows)
+        return false;
+
+    const auto& tsd = index_segment.index_descriptor();
+    return tsd.index().type() == IndexDescriptor::Type::TIMESTAMP && !tsd.column_groups();
+}
+
+folly::Future<std::vector<SliceAndKey>> write_index_pages(
+        const std::shared_ptr<stream::StreamSink>& sink,
+        const IndexPartialKey& partial_key,
+        const SegmentInMemory& index_segment,
+        size_t page_rows) {
+    util::check(page_rows > 0, "Cannot write index pages of zero rows");
+    const auto row_count = index_segment.row_count();
+    std::vector<folly::Future<SliceAndKey>> page_futs;
+    page_futs.reserve((row_count + page_rows - 1) / page_rows);
+    for (size_t start_row = 0; start_row < row_count; start_row += page_rows) {
+        auto page = index_segment.truncate(start_row, std::min(start_row + page_rows, row_count), true);
+        const auto bounds = page_bounds(page);
+        FrameSlice slice{ColRange{bounds.start_col_, bounds.end_col_}, RowRange{bounds.start_row_, bounds.end_row_}};
+        page_futs.emplace_back(sink->write(
+            KeyType::TABLE_INDEX,
+            partial_key.version_id,
+            partial_key.id,
+            bounds.start_index_,
+            bounds.end_index_,
+            std::move(page)).thenValue([slice=std::move(slice)](VariantKey&& key) {
+                return SliceAndKey{slice, to_atom(std::move(key))};
+            }));
+    }
+    ARCTICDB_DEBUG(log::version(), "Writing {} index rows for {} as {} pages", row_count, partial_key.id, page_futs.size());
+    return folly::collect(page_futs).via(&async::io_executor());
+}
+
+SegmentInMemory concatenate_index_pages(const SegmentInMemory& top_level, std::vector<SegmentInMemory>&& pages) {
+    util::check(!pages.empty(), "Expected at least one index page to concatenate");
+    auto output = std::move(pages[0]);
+    for (auto page = std::next(pages.begin()); page != pages.end(); ++page) {
+        remap_strings(*page, output.string_pool());
+        output.append(*page);
+    }
+    output.set_timeseries_descriptor(top_level.index_descriptor());
+    return output;
+}
+
+folly::Future<SegmentInMemory> read_index_pages(
+        const std::shared_ptr<Store>& store,
+        SegmentInMemory&& top_level,
+        const std::optional<IndexRange>& index_range) {
+    std::vector<folly::Future<SegmentInMemory>> page_futs;
+    const auto row_count = static_cast<ssize_t>(top_level.row_count());
+    for (auto row = 0L; row < row_count; ++row) {
+        auto key = stream::read_key_row(top_level, row);
+        if (!index_range || intersects(*index_range, key.start_index(), key.end_index())) {
+            page_futs.emplace_back(store->read(key).thenValueInline([](std::pair<VariantKey, SegmentInMemory>&& key_seg) {
+                return std::move(key_seg.second);
+            }));
+        }
+    }
+    if (page_futs.empty()) {
+        page_futs.emplace_back(store->read(stream::read_key_row(top_level, 0)).thenValueInline([](std::pair<VariantKey, SegmentInMemory>&& key_seg) {
+            return std::move(key_seg.second);
+        }));
+    }
+    ARCTICDB_DEBUG(log::version(), "Reading {} of {} index pages", page_futs.size(), row_count);
+    return folly::collect(page_futs).via(&async::cpu_executor()).thenValue([top_level=std::move(top_level)](std::vector<SegmentInMemory>&& pages) {
+        return concatenate_index_pages(top_level, std::move(pages));
+    });
+}
+
+folly::Future<SegmentInMemory> maybe_read_index_pages(
+        const std::shared_ptr<Store>& store,
+        SegmentInMemory&& index_segment,
+        const std::optional<IndexRange>& index_range) {
+    if (!is_paged_index(index_segment))
+        return folly::makeFuture(std::move(index_segment));
+
+    return read_index_pages(store, std::move(index_segment), index_range);
+}
+
+} //namespace arcticdb::pipelines::index
@@ -0,0 +1,71 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/entity/index_range.hpp>
+#include <arcticdb/pipeline/frame_slice.hpp>
+#include <arcticdb/pipeline/pipeline_common.hpp>
+#include <folly/futures/Future.h>
+
+#include <optional>
+
+namespace arcticdb {
+class Store;
+}
+
+namespace arcticdb::stream {
+struct StreamSink;
+}
+
+namespace arcticdb::pipelines::index {
+
+/*
+ * Two-level index segments for symbols with very many data keys.
+ *
+ * When VersionStore.IndexPageRows is set and a timestamp indexed TABLE_INDEX segment would have more rows than that,
+ * its rows are written as a series of TABLE_INDEX pages of at most that many rows each, and the version's index key
+ * instead points at a small top-level segment with one row per page, in the same way that a MULTI_KEY points at the
+ * index keys of its children. The start and end index of each top-level row cover those of the data keys in its page,
+ * so that date range reads only need to fetch the pages that intersect the range.
+ *
+ * The top-level segment carries the timeseries descriptor of the whole version, and is recognisable because its rows
+ * refer to TABLE_INDEX keys rather than data keys.
+ */
+
+// The number of rows above which index segments are written as pages, or 0 if they are never paged
+size_t index_page_rows();
+
+bool is_paged_index(const SegmentInMemory& index_segment);
+
+bool should_write_index_pages(const SegmentInMemory& index_segment, KeyType key_type, size_t page_rows);
+
+// Writes the rows of index_segment as pages of at most page_rows rows, returning the key and the
+// combined column and row ranges of each
+folly::Future<std::vector<SliceAndKey>> write_index_pages(
+    const std::shared_ptr<stream::StreamSink>& sink,
+    const IndexPartialKey& partial_key,
+    const SegmentInMemory& index_segment,
+    size_t page_rows);
+
+// Replaces a top-level index segment with the concatenation of its pages. If index_range is specified then only the
+// pages that intersect it are read, which will always include at least one page so that the result retains the schema
+folly::Future<SegmentInMemory> read_index_pages(
+    const std::shared_ptr<Store>& store,
+    SegmentInMemory&& top_level,
+    const std::optional<IndexRange>& index_range = std::nullopt);
+
+// Returns index_segment unchanged if it is not paged
+folly::Future<SegmentInMemory> maybe_read_index_pages(
+    const std::shared_ptr<Store>& store,
+    SegmentInMemory&& index_segment,
+    const std::optional<IndexRange>& index_range = std::nullopt);
+
+SegmentInMemory concatenate_index_pages(const SegmentInMemory& top_level, std::vector<SegmentInMemory>&& pages);
+
+} //namespace arcticdb::pipelines::index
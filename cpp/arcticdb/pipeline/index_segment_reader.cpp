@@ -11,6 +11,7 @@
 #include <arcticdb/pipeline/index_segment_reader.hpp>
 #include <arcticdb/pipeline/slicing.hpp>
 #include <arcticdb/pipeline/index_fields.hpp>
+#include <arcticdb/pipeline/index_pages.hpp>
 #include <arcticdb/pipeline/query.hpp>
 
 using namespace arcticdb::entity;
@@ -21,12 +22,17 @@ namespace arcticdb::pipelines::index {
 
 IndexSegmentReader get_index_reader(const AtomKey &prev_index, const std::shared_ptr<Store> &store) {
     auto [key, seg] = store->read_sync(prev_index);
+    if (is_paged_index(seg))
+        return index::IndexSegmentReader{read_index_pages(store, std::move(seg)).get()};
+
     return index::IndexSegmentReader{std::move(seg)};
 }
 
 folly::Future<IndexSegmentReader> async_get_index_reader(const AtomKey &prev_index, const std::shared_ptr<Store> &store) {
-    return store->read(prev_index).thenValueInline([](std::pair<VariantKey, SegmentInMemory>&& key_seg) {
-        return IndexSegmentReader{std::move(key_seg.second)};
+    return store->read(prev_index).thenValue([store](std::pair<VariantKey, SegmentInMemory>&& key_seg) {
+        return maybe_read_index_pages(store, std::move(key_seg.second));
+    }).thenValueInline([](SegmentInMemory&& seg) {
+        return IndexSegmentReader{std::move(seg)};
     });
 }
 
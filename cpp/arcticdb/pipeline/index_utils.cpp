@@ -70,8 +70,7 @@ folly::Future<entity::AtomKey> write_index(
 std::pair<index::IndexSegmentReader, std::vector<SliceAndKey>> read_index_to_vector(
     const std::shared_ptr<Store> &store,
     const AtomKey &index_key) {
-    auto [_, index_seg] = store->read_sync(index_key);
-    index::IndexSegmentReader index_segment_reader(std::move(index_seg));
+    auto index_segment_reader = get_index_reader(index_key, store);
     std::vector<SliceAndKey> slice_and_keys;
     for (const auto& row : index_segment_reader)
         slice_and_keys.push_back(row);
@@ -15,6 +15,8 @@
 #include <arcticdb/pipeline/index_fields.hpp>
 #include <arcticdb/pipeline/slicing.hpp>
 #include <arcticdb/pipeline/pipeline_common.hpp>
+#include <arcticdb/pipeline/index_pages.hpp>
+#include <arcticdb/pipeline/index_field_stats.hpp>
 
 namespace arcticdb::pipelines::index {
 // TODO: change the name - something like KeysSegmentWriter or KeyAggragator or  better
@@ -29,7 +31,12 @@ class IndexWriter {
 public:
     ARCTICDB_MOVE_ONLY_DEFAULT(IndexWriter)
 
-    IndexWriter(std::shared_ptr<stream::StreamSink> sink, IndexPartialKey partial_key, const TimeseriesDescriptor &tsd, const std::optional<KeyType>& key_type = std::nullopt) :
+    IndexWriter(
+        std::shared_ptr<stream::StreamSink> sink,
+        IndexPartialKey partial_key,
+        const TimeseriesDescriptor &tsd,
+        const std::optional<KeyType>& key_type = std::nullopt,
+        bool allow_pages = true) :
             bucketize_columns_(tsd.column_groups()),
             partial_key_(std::move(partial_key)),
             slice_descriptor_(partial_key_.id, bucketize_columns_),
@@ -41,7 +48,8 @@ public:
                 slice_descriptor_),
             sink_(std::move(sink)),
             key_being_committed_(folly::Future<AtomKey>::makeEmpty()),
-            key_type_(key_type) {
+            key_type_(key_type),
+            allow_pages_(allow_pages) {
         agg_.segment().set_timeseries_descriptor(tsd);
     }
 
@@ -76,6 +84,11 @@ public:
             std::visit([&rb](auto &&val) { rb.set_scalar(int(Fields::start_index), val); }, key.start_index());
             add_to_row(rb);
         });
+
+        if (slice.field_stats() && !bucketize_columns_) {
+            row_field_stats_.resize(agg_.row_count() - 1);
+            row_field_stats_.emplace_back(slice.field_stats());
+        }
     }
 
     void add(const arcticdb::entity::AtomKey &key, const FrameSlice &slice) {
@@ -120,7 +133,22 @@ private:
 
     void on_segment(SegmentInMemory &&s) {
         auto seg = std::move(s);
+        if (!row_field_stats_.empty()) {
+            row_field_stats_.resize(seg.row_count());
+            add_field_stats_columns(seg, row_field_stats_);
+        }
         auto key_type = key_type_.value_or(get_key_type_for_index_stream(partial_key_.id));
+        if (const auto page_rows = index_page_rows(); allow_pages_ && should_write_index_pages(seg, key_type, page_rows)) {
+            key_being_committed_ = write_index_pages(sink_, partial_key_, seg, page_rows).thenValue(
+                [sink=sink_, partial_key=partial_key_, tsd=seg.index_descriptor(), key_type](std::vector<SliceAndKey>&& pages) {
+                    IndexWriter<Index> top_level(sink, partial_key, tsd, key_type, false);
+                    for (const auto& page : pages)
+                        top_level.add_unchecked(page.key(), page.slice());
+
+                    return top_level.commit();
+            });
+            return;
+        }
         key_being_committed_ = sink_->write(
             key_type, partial_key_.version_id, partial_key_.id,
                 segment_start(seg), segment_end(seg), std::move(seg)).thenValue([] (auto&& variant_key) {
@@ -137,6 +165,10 @@ private:
     std::optional<std::size_t> current_col_ = std::nullopt;
     std::optional<std::size_t> current_row_ = std::nullopt;
     std::optional<KeyType> key_type_ = std::nullopt;
+    // The statistics of the data segment referred to by each row, up to the last row whose data segment has them
+    std::vector<std::shared_ptr<const SegmentFieldStats>> row_field_stats_;
+    // Whether a segment with too many rows can be written as a top-level segment over index pages
+    bool allow_pages_ = true;
 };
 
 
@@ -41,6 +41,31 @@ bool PipelineContext::only_index_columns_selected() const {
         ((overall_column_bitset_->count() == 1 && (*overall_column_bitset_)[0]) || overall_column_bitset_->count() == 0);
 }
 
+std::shared_ptr<PipelineContext> PipelineContext::slice_range_context(size_t begin, size_t end) const {
+    util::check(begin <= end && end <= slice_and_keys_.size(), "Invalid slice range {}-{} for pipeline context with {} slices",
+                begin, end, slice_and_keys_.size());
+    util::check(!incompletes_after_.has_value(), "Cannot take a slice range of a pipeline context with incompletes");
+    auto res = std::make_shared<PipelineContext>();
+    res->desc_ = desc_;
+    res->orig_desc_ = orig_desc_;
+    res->staged_descriptor_ = staged_descriptor_;
+    res->stream_id_ = stream_id_;
+    res->version_id_ = version_id_;
+    res->rows_ = rows_;
+    res->norm_meta_ = norm_meta_;
+    if (user_meta_)
+        res->user_meta_ = std::make_unique<arcticdb::proto::descriptors::UserDefinedMetadata>(*user_meta_);
+    res->slice_and_keys_.assign(slice_and_keys_.begin() + begin, slice_and_keys_.begin() + end);
+    res->total_rows_ = res->calc_rows();
+    res->selected_columns_ = selected_columns_;
+    res->overall_column_bitset_ = overall_column_bitset_;
+    res->filter_columns_ = filter_columns_;
+    res->filter_columns_set_ = filter_columns_set_;
+    res->index_key_ = index_key_;
+    res->bucketize_dynamic_ = bucketize_dynamic_;
+    return res;
+}
+
 const std::optional<util::BitSet>& PipelineContextRow::get_selected_columns() const {
     return parent_->selected_columns_;
 }
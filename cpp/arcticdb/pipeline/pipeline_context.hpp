@@ -132,6 +132,8 @@ struct PipelineContext : public std::enable_shared_from_this<PipelineContext> {
     std::optional<std::unordered_set<std::string_view>> filter_columns_set_;
     std::vector<std::shared_ptr<StreamDescriptor>> segment_descriptors_;
     std::optional<SegmentInMemory> multi_key_;
+    // The index key the slice_and_keys_ were read from, if any. Used to locate keys derived from it such as column stats.
+    std::optional<AtomKey> index_key_;
     std::vector<unsigned char> compacted_;
     std::optional<size_t> incompletes_after_;
     bool bucketize_dynamic_ = false;
@@ -244,6 +246,10 @@ struct PipelineContext : public std::enable_shared_from_this<PipelineContext> {
     }
 
     bool only_index_columns_selected() const;
+
+    // A new context for reading only slice_and_keys_[begin, end) of this one, sharing its descriptors, column
+    // selection and metadata. The per-slice vectors are reset, to be populated by the read.
+    std::shared_ptr<PipelineContext> slice_range_context(size_t begin, size_t end) const;
 };
 
 }
\ No newline at end of file
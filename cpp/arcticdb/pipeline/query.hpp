@@ -14,9 +14,11 @@
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/util/variant.hpp>
 #include <arcticdb/pipeline/index_segment_reader.hpp>
+#include <arcticdb/pipeline/index_field_stats.hpp>
 #include <arcticdb/stream/stream_utils.hpp>
 #include <arcticdb/processing/clause.hpp>
 #include <arcticdb/util/simple_string_hash.hpp>
+#include <arcticdb/util/configs_map.hpp>
 #include <arcticdb/pipeline/pipeline_context.hpp>
 #include <arcticdb/pipeline/read_query.hpp>
 
@@ -290,17 +292,63 @@ inline void build_col_read_query_filters(
     }
 }
 
+// Excludes the row-slices that the statistics generated on write show cannot contain any rows matching the leading
+// FilterClauses of the query. Only leading FilterClauses are considered, as any other clause may change the values or
+// meaning of the columns being filtered on.
+inline FilterQuery<index::IndexSegmentReader> create_field_stats_filter(std::vector<std::shared_ptr<ExpressionContext>> filters) {
+    return [filters = std::move(filters)](const index::IndexSegmentReader& isr, std::unique_ptr<util::BitSet>&& input) mutable {
+        if (!index::has_field_stats(isr.seg())) {
+            if (input)
+                return std::move(input);
+
+            auto res = std::make_unique<util::BitSet>(static_cast<util::BitSetSizeType>(isr.size()));
+            if (isr.size() > 0)
+                res->set_range(0, static_cast<util::BitSetSizeType>(isr.size() - 1));
+            return res;
+        }
+        auto res = std::make_unique<util::BitSet>(index::index_rows_matching_filter(isr.seg(), *filters.front()));
+        for (auto filter = std::next(filters.begin()); filter != filters.end(); ++filter)
+            *res &= index::index_rows_matching_filter(isr.seg(), **filter);
+
+        if (input)
+            *res &= *input;
+
+        ARCTICDB_DEBUG(log::version(), "Field stats filter has {} bits set", res->count());
+        return res;
+    };
+}
+
+template <typename ContainerType>
+inline void build_field_stats_read_query_filters(
+    const std::vector<std::shared_ptr<Clause>>& clauses,
+    std::vector<FilterQuery<ContainerType>>& queries) {
+    if (ConfigsMap::instance()->get_int("ColumnStats.UseForFiltering", 1) == 0)
+        return;
+
+    std::vector<std::shared_ptr<ExpressionContext>> filters;
+    for (const auto& clause: clauses) {
+        if (folly::poly_type(*clause) != typeid(FilterClause))
+            break;
+
+        filters.emplace_back(folly::poly_cast<FilterClause>(*clause).expression_context_);
+    }
+    if (!filters.empty())
+        queries.emplace_back(create_field_stats_filter(std::move(filters)));
+}
+
 template<typename ContainerType>
 inline std::vector<FilterQuery<ContainerType>> build_read_query_filters(
     const std::shared_ptr<PipelineContext>& pipeline_context,
     const FilterRange &range,
     bool dynamic_schema,
-    bool column_groups) {
+    bool column_groups,
+    const std::vector<std::shared_ptr<Clause>>& clauses = {}) {
     using namespace arcticdb::pipelines;
     std::vector<FilterQuery<ContainerType>> queries;
 
     build_row_read_query_filters(range, dynamic_schema, column_groups, queries);
     build_col_read_query_filters(pipeline_context, dynamic_schema, column_groups, queries);
+    build_field_stats_read_query_filters(clauses, queries);
 
     return queries;
 }
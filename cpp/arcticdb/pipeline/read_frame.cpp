@@ -292,9 +292,8 @@ void decode_or_expand(
         ARCTICDB_TRACE(log::version(), "Decoding standard field to position {}", mapping.offset_bytes_);
         const auto dest_bytes = mapping.dest_bytes_;
         std::optional<util::BitMagic> bv;
-        if (encoded_field_info.has_ndarray() && encoded_field_info.ndarray().sparse_map_bytes() > 0) {
-            const auto &ndarray = encoded_field_info.ndarray();
-            const auto bytes = encoding_sizes::data_uncompressed_size(ndarray);
+        if ((encoded_field_info.has_ndarray() || encoded_field_info.has_dictionary()) && encoded_field_info.ndarray().sparse_map_bytes() > 0) {
+            const auto bytes = encoding_sizes::decoded_data_size(encoded_field_info);
 
             ChunkedBuffer sparse = ChunkedBuffer::presized(bytes);
             SliceDataSink sparse_sink{sparse.data(), bytes};
@@ -312,8 +311,7 @@ void decode_or_expand(
                 create_dense_bitmap(mapping.offset_bytes_, *bv, dest_column, AllocationType::DETACHABLE);
         } else {
             SliceDataSink sink(dest, dest_bytes);
-            const auto &ndarray = encoded_field_info.ndarray();
-            if (const auto bytes = encoding_sizes::data_uncompressed_size(ndarray); bytes < dest_bytes) {
+            if (const auto bytes = encoding_sizes::decoded_data_size(encoded_field_info); bytes < dest_bytes) {
                 ARCTICDB_TRACE(log::version(), "Default initializing as only have {} bytes of {}", bytes, dest_bytes);
                 source_type_desc.visit_tag([dest, bytes, dest_bytes](const auto tdt) {
                     using TagType = decltype(tdt);
@@ -530,6 +528,144 @@ void check_data_left_for_subsequent_fields(
 }
 
 
+void check_mapping_type_compatibility(const ColumnMapping& m) {
+    util::check(
+        is_valid_type_promotion_to_target(m.source_type_desc_, m.dest_type_desc_),
+        "Can't promote type {} to type {} in field {}",
+        m.source_type_desc_,
+        m.dest_type_desc_,
+        m.frame_field_descriptor_.name()
+    );
+}
+
+// If the source and destination types are different, then sizeof(destination type) >= sizeof(source type)
+// We have decoded the column of source type directly onto the output buffer above
+// We therefore need to iterate backwards through the source values, static casting them to the destination
+// type to avoid overriding values we haven't cast yet.
+template <typename SourceType, typename DestinationType>
+void promote_integral_type(
+    const ColumnMapping& m,
+    const ReadOptions& read_options,
+    Column& column) {
+    const auto src_data_type_size = data_type_size(m.source_type_desc_, read_options.output_format(), DataTypeMode::INTERNAL);
+    const auto dest_data_type_size = data_type_size(m.dest_type_desc_, read_options.output_format(), DataTypeMode::INTERNAL);
+
+    const auto src_ptr_offset = src_data_type_size * (m.num_rows_ - 1);
+    const auto dest_ptr_offset = dest_data_type_size * (m.num_rows_ - 1);
+
+    auto src_ptr = reinterpret_cast<SourceType*>(column.bytes_at(m.offset_bytes_ + src_ptr_offset, 0UL)); // No bytes required as we are at the end
+    auto dest_ptr = reinterpret_cast<DestinationType*>(column.bytes_at(m.offset_bytes_ + dest_ptr_offset, 0UL));
+    for (auto i = 0u; i < m.num_rows_; ++i) {
+        *dest_ptr-- = static_cast<DestinationType>(*src_ptr--);
+    }
+}
+
+bool source_is_empty(const ColumnMapping& m) {
+    return is_empty_type(m.source_type_desc_.data_type());
+}
+
+void handle_type_promotion(
+    const ColumnMapping& m,
+    const DecodePathData& shared_data,
+    const ReadOptions& read_options,
+    Column& column
+    ) {
+    if (!trivially_compatible_types(m.source_type_desc_, m.dest_type_desc_) && !source_is_empty(m)) {
+        m.dest_type_desc_.visit_tag([&column, &m, shared_data, &read_options] (auto dest_desc_tag) {
+            using DestinationType =  typename decltype(dest_desc_tag)::DataTypeTag::raw_type;
+            m.source_type_desc_.visit_tag([&column, &m, &read_options] (auto src_desc_tag ) {
+                using SourceType =  typename decltype(src_desc_tag)::DataTypeTag::raw_type;
+                if constexpr(std::is_arithmetic_v<SourceType> && std::is_arithmetic_v<DestinationType>) {
+                    promote_integral_type<SourceType, DestinationType>(m, read_options, column);
+                } else {
+                    util::raise_rte("Can't promote type {} to type {} in field {}", m.source_type_desc_, m.dest_type_desc_, m.frame_field_descriptor_.name());
+                }
+            });
+        });
+    }
+}
+
+// A field of a segment to be decoded into the frame, along with the position of its encoded data in the segment
+struct FieldDecodeJob {
+    const uint8_t* data_;
+    const EncodedFieldImpl& encoded_field_;
+    ColumnMapping mapping_;
+    bool promote_type_;
+};
+
+// Splits the jobs into consecutive groups each decoding at least Decode.ColumnGroupBytes bytes into the frame, with
+// no more groups than there are CPU threads. Returns the index one past the last job of each group.
+std::vector<size_t> get_field_decode_groups(const std::vector<FieldDecodeJob>& jobs) {
+    const auto configured_group_bytes = ConfigsMap::instance()->get_int("Decode.ColumnGroupBytes", 32 * 1024 * 1024);
+    if (configured_group_bytes <= 0 || jobs.size() < 2)
+        return {jobs.size()};
+
+    size_t total_bytes = 0;
+    for (const auto& job : jobs)
+        total_bytes += job.mapping_.dest_bytes_;
+
+    const auto max_groups = std::max(async::TaskScheduler::instance()->cpu_thread_count(), size_t{1});
+    const auto group_bytes = std::max({static_cast<size_t>(configured_group_bytes), total_bytes / max_groups, size_t{1}});
+    std::vector<size_t> group_ends;
+    size_t group_total = 0;
+    for (size_t job = 0; job < jobs.size(); ++job) {
+        group_total += jobs[job].mapping_.dest_bytes_;
+        if (group_total >= group_bytes) {
+            group_ends.emplace_back(job + 1);
+            group_total = 0;
+        }
+    }
+    if (group_ends.empty() || group_ends.back() != jobs.size())
+        group_ends.emplace_back(jobs.size());
+
+    return group_ends;
+}
+
+void decode_field_jobs(
+        SegmentInMemory& frame,
+        const std::vector<FieldDecodeJob>& jobs,
+        const DecodePathData& shared_data,
+        std::any& handler_data,
+        EncodingVersion encoding_version,
+        const std::shared_ptr<StringPool>& string_pool,
+        const ReadOptions& read_options) {
+    auto decode_job = [&](size_t job_index) {
+        const auto& job = jobs[job_index];
+        const uint8_t* data = job.data_;
+        auto& column = frame.column(static_cast<position_t>(job.mapping_.dest_col_));
+        decode_or_expand(
+            data,
+            column,
+            job.encoded_field_,
+            shared_data,
+            handler_data,
+            encoding_version,
+            job.mapping_,
+            string_pool,
+            read_options.output_format()
+        );
+        if (job.promote_type_)
+            handle_type_promotion(job.mapping_, shared_data, read_options, column);
+
+        ARCTICDB_TRACE(log::codec(), "Decoded or expanded column {}", frame.field(job.mapping_.dest_col_).name());
+    };
+
+    auto group_ends = get_field_decode_groups(jobs);
+    if (group_ends.size() == 1) {
+        for (size_t job = 0; job < jobs.size(); ++job)
+            decode_job(job);
+
+        return;
+    }
+
+    ARCTICDB_DEBUG(log::version(), "Decoding {} fields in {} groups", jobs.size(), group_ends.size());
+    async::run_groups_on_cpu_pool(group_ends.size(), [&group_ends, &decode_job](size_t group) {
+        const auto first_job = group == 0 ? 0 : group_ends[group - 1];
+        for (auto job = first_job; job < group_ends[group]; ++job)
+            decode_job(job);
+    });
+}
+
 void decode_into_frame_static(
         SegmentInMemory &frame,
         PipelineContextRow &context,
@@ -572,6 +708,7 @@ void decode_into_frame_static(
         if(it.invalid())
             return;
 
+        std::vector<FieldDecodeJob> jobs;
         while (it.has_next()) {
             advance_skipped_cols(data, it, fields, hdr);
             if(has_magic_nums)
@@ -580,26 +717,15 @@ void decode_into_frame_static(
             auto& encoded_field = fields.at(it.source_field_pos());
             util::check(it.source_field_pos() < size_t(fields.size()), "Field index out of range: {} !< {}", it.source_field_pos(), fields.size());
             auto field_name = context.descriptor().fields(it.source_field_pos()).name();
-            auto& column = frame.column(static_cast<ssize_t>(it.dest_col()));
             ColumnMapping mapping{frame, it.dest_col(), it.source_field_pos(), context, read_options.output_format()};
             mapping.set_truncate(truncate_range);
 
             check_type_compatibility(mapping, field_name, it.source_col(), it.dest_col());
             check_data_left_for_subsequent_fields(data, end, it, context);
 
-            decode_or_expand(
-                data,
-                column,
-                encoded_field,
-                shared_data,
-                handler_data,
-                encoding_version,
-                mapping,
-                context.string_pool_ptr(),
-                read_options.output_format()
-            );
-
-            ARCTICDB_TRACE(log::codec(), "Decoded or expanded static column {} to position {}", field_name, data - begin);
+            jobs.emplace_back(FieldDecodeJob{data, encoded_field, std::move(mapping), false});
+            advance_field_size(encoded_field, data, has_magic_nums);
+            ARCTICDB_TRACE(log::codec(), "Static column {} ends at position {}", field_name, data - begin);
 
             it.advance();
             if(it.at_end_of_selected()) {
@@ -609,67 +735,11 @@ void decode_into_frame_static(
                 util::check_magic_in_place<ColumnMagic>(data);
             }
         }
+        decode_field_jobs(frame, jobs, shared_data, handler_data, encoding_version, context.string_pool_ptr(), read_options);
     }
     ARCTICDB_TRACE(log::codec(), "Frame decoded into static schema");
 }
 
-void check_mapping_type_compatibility(const ColumnMapping& m) {
-    util::check(
-        is_valid_type_promotion_to_target(m.source_type_desc_, m.dest_type_desc_),
-        "Can't promote type {} to type {} in field {}",
-        m.source_type_desc_,
-        m.dest_type_desc_,
-        m.frame_field_descriptor_.name()
-    );
-}
-
-// If the source and destination types are different, then sizeof(destination type) >= sizeof(source type)
-// We have decoded the column of source type directly onto the output buffer above
-// We therefore need to iterate backwards through the source values, static casting them to the destination
-// type to avoid overriding values we haven't cast yet.
-template <typename SourceType, typename DestinationType>
-void promote_integral_type(
-    const ColumnMapping& m,
-    const ReadOptions& read_options,
-    Column& column) {
-    const auto src_data_type_size = data_type_size(m.source_type_desc_, read_options.output_format(), DataTypeMode::INTERNAL);
-    const auto dest_data_type_size = data_type_size(m.dest_type_desc_, read_options.output_format(), DataTypeMode::INTERNAL);
-
-    const auto src_ptr_offset = src_data_type_size * (m.num_rows_ - 1);
-    const auto dest_ptr_offset = dest_data_type_size * (m.num_rows_ - 1);
-
-    auto src_ptr = reinterpret_cast<SourceType*>(column.bytes_at(m.offset_bytes_ + src_ptr_offset, 0UL)); // No bytes required as we are at the end
-    auto dest_ptr = reinterpret_cast<DestinationType*>(column.bytes_at(m.offset_bytes_ + dest_ptr_offset, 0UL));
-    for (auto i = 0u; i < m.num_rows_; ++i) {
-        *dest_ptr-- = static_cast<DestinationType>(*src_ptr--);
-    }
-}
-
-bool source_is_empty(const ColumnMapping& m) {
-    return is_empty_type(m.source_type_desc_.data_type());
-}
-
-void handle_type_promotion(
-    const ColumnMapping& m,
-    const DecodePathData& shared_data,
-    const ReadOptions& read_options,
-    Column& column
-    ) {
-    if (!trivially_compatible_types(m.source_type_desc_, m.dest_type_desc_) && !source_is_empty(m)) {
-        m.dest_type_desc_.visit_tag([&column, &m, shared_data, &read_options] (auto dest_desc_tag) {
-            using DestinationType =  typename decltype(dest_desc_tag)::DataTypeTag::raw_type;
-            m.source_type_desc_.visit_tag([&column, &m, &read_options] (auto src_desc_tag ) {
-                using SourceType =  typename decltype(src_desc_tag)::DataTypeTag::raw_type;
-                if constexpr(std::is_arithmetic_v<SourceType> && std::is_arithmetic_v<DestinationType>) {
-                    promote_integral_type<SourceType, DestinationType>(m, read_options, column);
-                } else {
-                    util::raise_rte("Can't promote type {} to type {} in field {}", m.source_type_desc_, m.dest_type_desc_, m.frame_field_descriptor_.name());
-                }
-            });
-        });
-    }
-}
-
 void decode_into_frame_dynamic(
         SegmentInMemory& frame,
         PipelineContextRow& context,
@@ -707,6 +777,7 @@ void decode_into_frame_dynamic(
         }
 
         auto field_count = context.slice_and_key().slice_.col_range.diff() + index_fieldcount;
+        std::vector<FieldDecodeJob> jobs;
         for (auto field_col = index_fieldcount; field_col < field_count; ++field_col) {
             auto field_name = context.descriptor().fields(field_col).name();
             auto& encoded_field = fields.at(field_col);
@@ -717,27 +788,16 @@ void decode_into_frame_dynamic(
             }
 
             auto dst_col = *column_output_destination;
-            auto& column = frame.column(static_cast<position_t>(dst_col));
             ColumnMapping mapping{frame, dst_col, field_col, context, read_options.output_format()};
             check_mapping_type_compatibility(mapping);
             mapping.set_truncate(truncate_range);
             util::check(data != end || source_is_empty(mapping), "Reached end of input block with {} fields to decode", field_count - field_col);
 
-            decode_or_expand(
-                data,
-                column,
-                encoded_field,
-                shared_data,
-                handler_data,
-                encoding_version,
-                mapping,
-                context.string_pool_ptr(),
-                read_options.output_format()
-            );
-
-            handle_type_promotion(mapping, shared_data, read_options, column);
-            ARCTICDB_TRACE(log::codec(), "Decoded or expanded dynamic column {} to position {}", frame.field(dst_col).name(), data - begin);
+            jobs.emplace_back(FieldDecodeJob{data, encoded_field, std::move(mapping), true});
+            advance_field_size(encoded_field, data, has_magic_numbers);
+            ARCTICDB_TRACE(log::codec(), "Dynamic column {} ends at position {}", frame.field(dst_col).name(), data - begin);
         }
+        decode_field_jobs(frame, jobs, shared_data, handler_data, encoding_version, context.string_pool_ptr(), read_options);
     } else {
         ARCTICDB_DEBUG(log::version(), "Empty segment");
     }
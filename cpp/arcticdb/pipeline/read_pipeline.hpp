@@ -160,7 +160,7 @@ inline std::vector<FilterQuery<ContainerType>> get_column_bitset_and_query_funct
     if(!dynamic_schema || column_groups) {
         get_column_bitset_in_context(query, pipeline_context);
     }
-    return build_read_query_filters<ContainerType>(pipeline_context, query.row_filter, dynamic_schema, column_groups);
+    return build_read_query_filters<ContainerType>(pipeline_context, query.row_filter, dynamic_schema, column_groups, query.clauses_);
 }
 
 } // arcticdb::pipelines
@@ -13,4 +13,27 @@ size_t first_context_row(const pipelines::SliceAndKey& slice_and_key, size_t fir
     return slice_and_key.slice_.row_range.first - first_row_in_frame;
 }
 
+void remap_strings(SegmentInMemory& segment, StringPool& string_pool) {
+    const auto& segment_pool = segment.const_string_pool();
+    for (auto idx = 0UL; idx < segment.num_columns(); ++idx) {
+        auto& column = segment.column(static_cast<position_t>(idx));
+        details::visit_type(column.type().data_type(), [&](auto col_tag) {
+            using type_info = ScalarTypeInfo<decltype(col_tag)>;
+            if constexpr (is_sequence_type(type_info::data_type)) {
+                Column::transform<typename type_info::TDT, typename type_info::TDT>(
+                    column,
+                    column,
+                    [&segment_pool, &string_pool](auto string_pool_offset) -> typename type_info::RawType {
+                        if (is_a_string(string_pool_offset)) {
+                            const std::string_view string = get_string_from_pool(string_pool_offset, segment_pool);
+                            return string_pool.get(string).offset();
+                        }
+                        return string_pool_offset;
+                    }
+                );
+            }
+        });
+    }
+}
+
 }
\ No newline at end of file
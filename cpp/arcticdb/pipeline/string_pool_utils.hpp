@@ -15,6 +15,8 @@
 
 namespace arcticdb {
 
+class SegmentInMemory;
+
 namespace pipelines {
     struct SliceAndKey;
     struct PipelineContextRow;
@@ -52,6 +54,10 @@ inline std::variant<std::string_view, entity::position_t> get_string_from_buffer
         return get_string_from_pool(offset_val, string_pool);
 }
 
+// Rewrites the string pool offsets in the sequence columns of segment to refer to the same strings in string_pool, so
+// that its columns can be added to, or appended to those of, the segment that owns string_pool
+void remap_strings(SegmentInMemory& segment, StringPool& string_pool);
+
 size_t first_context_row(const pipelines::SliceAndKey& slice_and_key, size_t first_row_in_frame);
 
 position_t get_offset_string(const pipelines::PipelineContextRow& context_row, ChunkedBuffer &src, std::size_t first_row_in_frame);
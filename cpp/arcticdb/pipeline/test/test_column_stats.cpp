@@ -0,0 +1,190 @@
+/* Copyright 2024 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/pipeline/column_stats.hpp>
+#include <arcticdb/pipeline/string_pool_utils.hpp>
+#include <arcticdb/processing/expression_context.hpp>
+#include <arcticdb/processing/unsorted_aggregation.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+// Column stats segment for three row-slices where col has values in [0, 9], [10, 19] and [20, 29] respectively
+SegmentInMemory three_row_column_stats_segment() {
+    SegmentInMemory seg;
+    seg.descriptor().set_index(IndexDescriptorImpl(IndexDescriptorImpl::Type::ROWCOUNT, 0));
+    auto add_column = [&seg](DataType data_type, std::string_view name, const std::vector<int64_t>& values) {
+        auto col = std::make_shared<Column>(make_scalar_type(data_type), Sparsity::PERMITTED);
+        for (auto value: values) {
+            col->push_back<int64_t>(value);
+        }
+        seg.add_column(scalar_field(data_type, name), col);
+    };
+    add_column(DataType::NANOSECONDS_UTC64, start_index_column_name, {0, 10, 20});
+    add_column(DataType::NANOSECONDS_UTC64, end_index_column_name, {10, 20, 30});
+    add_column(DataType::INT64, "v1.0_MIN(col)", {0, 10, 20});
+    add_column(DataType::INT64, "v1.0_MAX(col)", {9, 19, 29});
+    seg.set_row_id(2);
+    return seg;
+}
+
+std::vector<size_t> matching_rows(const SegmentInMemory& seg, const ExpressionContext& expression_context) {
+    auto bitset = column_stats_rows_matching_filter(seg, expression_context);
+    std::vector<size_t> res;
+    for (auto it = bitset.first(); it != bitset.end(); ++it) {
+        res.emplace_back(*it);
+    }
+    return res;
+}
+
+ExpressionContext comparison_context(OperationType operation_type, std::string_view column, int64_t value) {
+    ExpressionContext expression_context;
+    expression_context.add_value("value", std::make_shared<Value>(value, DataType::INT64));
+    expression_context.add_expression_node(
+            "root",
+            std::make_shared<ExpressionNode>(ColumnName(column), ValueName("value"), operation_type));
+    expression_context.root_node_name_ = ExpressionName("root");
+    return expression_context;
+}
+
+} // namespace
+
+TEST(ColumnStatsFilter, Comparisons) {
+    auto seg = three_row_column_stats_segment();
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::EQ, "col", 15)), std::vector<size_t>({1}));
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::EQ, "col", 30)), std::vector<size_t>());
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::LT, "col", 10)), std::vector<size_t>({0}));
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::LE, "col", 10)), std::vector<size_t>({0, 1}));
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::GT, "col", 19)), std::vector<size_t>({2}));
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::GE, "col", 19)), std::vector<size_t>({1, 2}));
+}
+
+TEST(ColumnStatsFilter, ValueOnLeft) {
+    auto seg = three_row_column_stats_segment();
+    ExpressionContext expression_context;
+    expression_context.add_value("value", std::make_shared<Value>(int64_t{10}, DataType::INT64));
+    // 10 > col
+    expression_context.add_expression_node(
+            "root",
+            std::make_shared<ExpressionNode>(ValueName("value"), ColumnName("col"), OperationType::GT));
+    expression_context.root_node_name_ = ExpressionName("root");
+    ASSERT_EQ(matching_rows(seg, expression_context), std::vector<size_t>({0}));
+}
+
+TEST(ColumnStatsFilter, BooleanCombinations) {
+    auto seg = three_row_column_stats_segment();
+    ExpressionContext expression_context;
+    expression_context.add_value("five", std::make_shared<Value>(int64_t{5}, DataType::INT64));
+    expression_context.add_value("twenty_five", std::make_shared<Value>(int64_t{25}, DataType::INT64));
+    expression_context.add_expression_node(
+            "lt", std::make_shared<ExpressionNode>(ColumnName("col"), ValueName("five"), OperationType::LT));
+    expression_context.add_expression_node(
+            "gt", std::make_shared<ExpressionNode>(ColumnName("col"), ValueName("twenty_five"), OperationType::GT));
+    expression_context.add_expression_node(
+            "or", std::make_shared<ExpressionNode>(ExpressionName("lt"), ExpressionName("gt"), OperationType::OR));
+    expression_context.add_expression_node(
+            "and", std::make_shared<ExpressionNode>(ExpressionName("lt"), ExpressionName("gt"), OperationType::AND));
+
+    expression_context.root_node_name_ = ExpressionName("or");
+    ASSERT_EQ(matching_rows(seg, expression_context), std::vector<size_t>({0, 2}));
+    expression_context.root_node_name_ = ExpressionName("and");
+    ASSERT_EQ(matching_rows(seg, expression_context), std::vector<size_t>());
+}
+
+TEST(ColumnStatsFilter, IsIn) {
+    auto seg = three_row_column_stats_segment();
+    ExpressionContext expression_context;
+    expression_context.add_value_set(
+            "values",
+            std::make_shared<ValueSet>(std::make_shared<std::unordered_set<int64_t>>(std::unordered_set<int64_t>{3, 25, 100})));
+    expression_context.add_expression_node(
+            "root",
+            std::make_shared<ExpressionNode>(ColumnName("col"), ValueSetName("values"), OperationType::ISIN));
+    expression_context.root_node_name_ = ExpressionName("root");
+    ASSERT_EQ(matching_rows(seg, expression_context), std::vector<size_t>({0, 2}));
+}
+
+TEST(ColumnStatsFilter, UnknownColumnsAndOperationsKeepEverything) {
+    auto seg = three_row_column_stats_segment();
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::EQ, "other_col", 15)), std::vector<size_t>({0, 1, 2}));
+    ASSERT_EQ(matching_rows(seg, comparison_context(OperationType::NE, "col", 15)), std::vector<size_t>({0, 1, 2}));
+}
+
+TEST(ColumnStatsFilter, CanUseMinMaxStats) {
+    ASSERT_TRUE(filter_can_use_minmax_stats(comparison_context(OperationType::LT, "col", 5)));
+    ASSERT_FALSE(filter_can_use_minmax_stats(comparison_context(OperationType::NE, "col", 5)));
+
+    ExpressionContext expression_context;
+    expression_context.add_value("five", std::make_shared<Value>(int64_t{5}, DataType::INT64));
+    expression_context.add_value_set(
+            "values",
+            std::make_shared<ValueSet>(std::make_shared<std::unordered_set<int64_t>>(std::unordered_set<int64_t>{3, 25})));
+    expression_context.add_expression_node(
+            "lt", std::make_shared<ExpressionNode>(ColumnName("col"), ValueName("five"), OperationType::LT));
+    expression_context.add_expression_node(
+            "isin", std::make_shared<ExpressionNode>(ColumnName("col"), ValueSetName("values"), OperationType::ISIN));
+    expression_context.add_expression_node(
+            "isnull", std::make_shared<ExpressionNode>(ColumnName("col"), OperationType::ISNULL));
+    expression_context.add_expression_node(
+            "columns", std::make_shared<ExpressionNode>(ColumnName("col"), ColumnName("other_col"), OperationType::LT));
+    expression_context.add_expression_node(
+            "and", std::make_shared<ExpressionNode>(ExpressionName("lt"), ExpressionName("isnull"), OperationType::AND));
+    expression_context.add_expression_node(
+            "or", std::make_shared<ExpressionNode>(ExpressionName("lt"), ExpressionName("isnull"), OperationType::OR));
+
+    auto can_use_with_root = [&expression_context](const std::string& root) {
+        expression_context.root_node_name_ = ExpressionName(root);
+        return filter_can_use_minmax_stats(expression_context);
+    };
+    ASSERT_TRUE(can_use_with_root("isin"));
+    ASSERT_FALSE(can_use_with_root("isnull"));
+    ASSERT_FALSE(can_use_with_root("columns"));
+    // One side of an AND is enough to prune on, both sides of an OR are needed
+    ASSERT_TRUE(can_use_with_root("and"));
+    ASSERT_FALSE(can_use_with_root("or"));
+}
+
+TEST(ColumnStats, HyperLogLogSketchesMerged) {
+    // One column stats segment per row-slice, as built by ColumnStatsGenerationClause
+    auto row_slice_stats = [](int64_t start, int64_t end) {
+        auto values = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::NOT_PERMITTED);
+        for (auto value = start; value < end; ++value)
+            values->push_back<int64_t>(value);
+        HyperLogLogAggregatorData aggregator_data;
+        aggregator_data.aggregate(ColumnWithStrings(values, nullptr, "col"));
+
+        SegmentInMemory seg;
+        seg.descriptor().set_index(IndexDescriptorImpl(IndexDescriptorImpl::Type::ROWCOUNT, 0));
+        for (auto [name, value] : {std::pair{start_index_column_name, start}, std::pair{end_index_column_name, end}}) {
+            auto col = std::make_shared<Column>(make_scalar_type(DataType::NANOSECONDS_UTC64), Sparsity::PERMITTED);
+            col->push_back<int64_t>(value);
+            seg.add_column(scalar_field(DataType::NANOSECONDS_UTC64, name), col);
+        }
+        auto sketch = aggregator_data.finalize({ColumnName("v1.0_HLL(col)")});
+        remap_strings(sketch, seg.string_pool());
+        seg.concatenate(std::move(sketch));
+        seg.set_row_id(0);
+        return seg;
+    };
+
+    auto merged = merge_column_stats_segments({row_slice_stats(100, 200), row_slice_stats(0, 150)});
+    ASSERT_EQ(merged.row_count(), 2);
+    ColumnStats column_stats(merged.fields());
+    ASSERT_EQ(column_stats.to_map(), (std::unordered_map<std::string, std::unordered_set<std::string>>{{"col", {"HYPERLOGLOG"}}}));
+    const auto sketch_column = static_cast<position_t>(merged.column_index(column_stats.hyperloglog_column_name("col").value()).value());
+
+    // Sorted by start index
+    auto first = HyperLogLog::deserialize(merged.string_at(0, sketch_column).value());
+    auto second = HyperLogLog::deserialize(merged.string_at(1, sketch_column).value());
+    ASSERT_NEAR(static_cast<double>(first.estimate()), 150, 5);
+    ASSERT_NEAR(static_cast<double>(second.estimate()), 100, 5);
+    first.merge(second);
+    ASSERT_NEAR(static_cast<double>(first.estimate()), 200, 5);
+}
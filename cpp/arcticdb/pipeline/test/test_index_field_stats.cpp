@@ -0,0 +1,186 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/pipeline/index_field_stats.hpp>
+#include <arcticdb/pipeline/index_writer.hpp>
+#include <arcticdb/storage/test/in_memory_store.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace arcticdb;
+using namespace arcticdb::pipelines;
+
+namespace {
+
+constexpr size_t rows_per_slice = 10;
+
+ColumnFieldStats minmax_stats(const std::string& name, int64_t min, int64_t max) {
+    return {name, DataType::INT64, FieldStatsImpl{min, max, 0, UniqueCountType::PRECISE}, std::nullopt};
+}
+
+ColumnFieldStats null_count_stats(const std::string& name, uint64_t null_count) {
+    return {name, DataType::FLOAT64, FieldStatsImpl{}, null_count};
+}
+
+/*
+ * Writes the index for three row-slices of two column slices each, holding a and b respectively. a has values in
+ * [0, 9], [10, 19] and [20, 29] in each row-slice, and b is entirely null in the first row-slice and has no nulls in
+ * the second. The third row-slice was written without statistics.
+ */
+SegmentInMemory index_with_field_stats() {
+    const StreamId stream_id{"field_stats"};
+    StreamDescriptor stream_desc{stream_id, IndexDescriptorImpl{IndexDescriptorImpl::Type::TIMESTAMP, 1}};
+    stream_desc.add_field(scalar_field(DataType::NANOSECONDS_UTC64, "time"));
+    stream_desc.add_field(scalar_field(DataType::INT64, "a"));
+    stream_desc.add_field(scalar_field(DataType::FLOAT64, "b"));
+    TimeseriesDescriptor tsd;
+    tsd.set_stream_descriptor(stream_desc);
+    tsd.set_total_rows(3 * rows_per_slice);
+
+    auto store = std::make_shared<InMemoryStore>();
+    index::IndexWriter<stream::TimeseriesIndex> writer(store, IndexPartialKey{stream_id, 0}, tsd);
+    for (size_t col = 1; col < 3; ++col) {
+        for (size_t row_slice = 0; row_slice < 3; ++row_slice) {
+            const auto start = static_cast<timestamp>(row_slice * rows_per_slice);
+            const auto end = static_cast<timestamp>((row_slice + 1) * rows_per_slice);
+            FrameSlice slice{ColRange{col, col + 1}, RowRange{row_slice * rows_per_slice, (row_slice + 1) * rows_per_slice}};
+            if (row_slice < 2) {
+                auto field_stats = std::make_shared<SegmentFieldStats>();
+                if (col == 1)
+                    field_stats->emplace_back(minmax_stats("a", start, end - 1));
+                else
+                    field_stats->emplace_back(null_count_stats("b", row_slice == 0 ? rows_per_slice : 0));
+                slice.set_field_stats(std::move(field_stats));
+            }
+            writer.add(AtomKey{stream_id, 0, 0, row_slice, IndexValue{start}, IndexValue{end}, KeyType::TABLE_DATA}, slice);
+        }
+    }
+    auto key = writer.commit().get();
+    return store->read_sync(key).second;
+}
+
+ExpressionContext comparison_context(OperationType operation_type, std::string_view column, int64_t value) {
+    ExpressionContext expression_context;
+    expression_context.add_value("value", std::make_shared<Value>(value, DataType::INT64));
+    expression_context.add_expression_node(
+            "root",
+            std::make_shared<ExpressionNode>(ColumnName(column), ValueName("value"), operation_type));
+    expression_context.root_node_name_ = ExpressionName("root");
+    return expression_context;
+}
+
+ExpressionContext null_check_context(OperationType operation_type, std::string_view column) {
+    ExpressionContext expression_context;
+    expression_context.add_expression_node("root", std::make_shared<ExpressionNode>(ColumnName(column), operation_type));
+    expression_context.root_node_name_ = ExpressionName("root");
+    return expression_context;
+}
+
+std::vector<size_t> matching_rows(const SegmentInMemory& index_segment, const ExpressionContext& expression_context) {
+    auto bitset = index::index_rows_matching_filter(index_segment, expression_context);
+    std::vector<size_t> res;
+    for (auto it = bitset.first(); it != bitset.end(); ++it) {
+        res.emplace_back(*it);
+    }
+    return res;
+}
+
+} // namespace
+
+TEST(IndexFieldStats, NumericStatisticsIgnoreNaN) {
+    const std::vector<double> values{10.0, NAN, 3.0};
+    auto stats = generate_numeric_statistics<double>(values);
+    ASSERT_EQ(stats.get_min<double>(), 3.0);
+    ASSERT_EQ(stats.get_max<double>(), 10.0);
+
+    const std::vector<double> all_nan{NAN, NAN};
+    stats = generate_numeric_statistics<double>(all_nan);
+    ASSERT_FALSE(stats.has_min());
+    ASSERT_FALSE(stats.has_max());
+}
+
+TEST(IndexFieldStats, CollectFromSegment) {
+    SegmentInMemory seg;
+    seg.descriptor().set_index(IndexDescriptorImpl(IndexDescriptorImpl::Type::ROWCOUNT, 0));
+    auto floats = std::make_shared<Column>(make_scalar_type(DataType::FLOAT64), Sparsity::PERMITTED);
+    floats->set_scalar<double>(0, 1.5);
+    floats->set_scalar<double>(1, NAN);
+    floats->set_scalar<double>(3, -2.0);
+    auto ints = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::PERMITTED);
+    for (int64_t value : {4, 7, 5, 6})
+        ints->push_back<int64_t>(value);
+    seg.add_column(scalar_field(DataType::FLOAT64, "floats"), floats);
+    seg.add_column(scalar_field(DataType::INT64, "ints"), ints);
+    seg.set_row_id(3);
+    seg.calculate_statistics();
+
+    auto field_stats = index::collect_field_stats(seg);
+    ASSERT_TRUE(field_stats);
+    ASSERT_EQ(field_stats->size(), 2);
+    auto float_stats = field_stats->at(0);
+    ASSERT_EQ(float_stats.name_, "floats");
+    ASSERT_EQ(float_stats.stats_.get_min<double>(), -2.0);
+    ASSERT_EQ(float_stats.stats_.get_max<double>(), 1.5);
+    // The NaN and the missing row
+    ASSERT_EQ(float_stats.null_count_, 2);
+    auto int_stats = field_stats->at(1);
+    ASSERT_EQ(int_stats.name_, "ints");
+    ASSERT_EQ(int_stats.stats_.get_min<int64_t>(), 4);
+    ASSERT_EQ(int_stats.stats_.get_max<int64_t>(), 7);
+    ASSERT_FALSE(int_stats.null_count_.has_value());
+}
+
+TEST(IndexFieldStats, WrittenToIndex) {
+    auto index_segment = index_with_field_stats();
+    ASSERT_EQ(index_segment.row_count(), 6);
+    ASSERT_TRUE(index::has_field_stats(index_segment));
+
+    auto field_stats = index::read_field_stats(index_segment);
+    ASSERT_EQ(field_stats.size(), 6);
+    for (size_t row_slice = 0; row_slice < 2; ++row_slice) {
+        ASSERT_TRUE(field_stats[row_slice]);
+        auto a_stats = field_stats[row_slice]->at(0);
+        ASSERT_EQ(a_stats.name_, "a");
+        ASSERT_EQ(a_stats.stats_.get_min<int64_t>(), static_cast<int64_t>(row_slice * rows_per_slice));
+        ASSERT_FALSE(a_stats.null_count_.has_value());
+        auto b_stats = field_stats[row_slice + 3]->at(0);
+        ASSERT_EQ(b_stats.name_, "b");
+        ASSERT_EQ(b_stats.data_type_, DataType::FLOAT64);
+        ASSERT_EQ(b_stats.null_count_, row_slice == 0 ? rows_per_slice : 0);
+    }
+    ASSERT_FALSE(field_stats[2]);
+    ASSERT_FALSE(field_stats[5]);
+}
+
+TEST(IndexFieldStats, ExcludeRowSlices) {
+    auto index_segment = index_with_field_stats();
+    // Both column slices of a row-slice are excluded if the stats of either rule it out, and the row-slice without
+    // stats is always kept
+    ASSERT_EQ(matching_rows(index_segment, comparison_context(OperationType::GT, "a", 15)), std::vector<size_t>({1, 2, 4, 5}));
+    ASSERT_EQ(matching_rows(index_segment, comparison_context(OperationType::LT, "a", 5)), std::vector<size_t>({0, 2, 3, 5}));
+    ASSERT_EQ(matching_rows(index_segment, comparison_context(OperationType::EQ, "c", 5)), std::vector<size_t>({0, 1, 2, 3, 4, 5}));
+    ASSERT_EQ(matching_rows(index_segment, null_check_context(OperationType::ISNULL, "b")), std::vector<size_t>({0, 2, 3, 5}));
+    ASSERT_EQ(matching_rows(index_segment, null_check_context(OperationType::NOTNULL, "b")), std::vector<size_t>({1, 2, 4, 5}));
+}
+
+TEST(IndexFieldStats, NotKeptBySlicesReadFromIndex) {
+    index::IndexSegmentReader reader(index_with_field_stats());
+    std::vector<SliceAndKey> slices;
+    std::copy(reader.begin(), reader.end(), std::back_inserter(slices));
+    // Slices read back from the index do not carry the statistics unless they are attached with read_field_stats, as
+    // is done on append
+    auto store = std::make_shared<InMemoryStore>();
+    index::IndexWriter<stream::TimeseriesIndex> writer(store, IndexPartialKey{StreamId{"field_stats"}, 1}, reader.tsd());
+    for (const auto& slice_and_key : slices)
+        writer.add(slice_and_key.key(), slice_and_key.slice());
+
+    auto rewritten = store->read_sync(writer.commit().get()).second;
+    ASSERT_FALSE(index::has_field_stats(rewritten));
+}
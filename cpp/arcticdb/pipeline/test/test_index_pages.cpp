@@ -0,0 +1,147 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/pipeline/index_pages.hpp>
+#include <arcticdb/pipeline/index_segment_reader.hpp>
+#include <arcticdb/pipeline/index_writer.hpp>
+#include <arcticdb/storage/test/in_memory_store.hpp>
+#include <arcticdb/util/key_utils.hpp>
+
+using namespace arcticdb;
+using namespace arcticdb::pipelines;
+
+namespace {
+
+constexpr size_t rows_per_slice = 10;
+
+std::pair<TimeseriesDescriptor, std::vector<SliceAndKey>> timeseries_slice_and_keys(
+        const StreamId& stream_id,
+        VersionId version_id,
+        size_t row_slices) {
+    StreamDescriptor stream_desc{stream_id, IndexDescriptorImpl{IndexDescriptorImpl::Type::TIMESTAMP, 1}};
+    stream_desc.add_field(scalar_field(DataType::NANOSECONDS_UTC64, "time"));
+    stream_desc.add_field(scalar_field(DataType::UINT8, "col"));
+    TimeseriesDescriptor tsd;
+    tsd.set_stream_descriptor(stream_desc);
+    tsd.set_total_rows(row_slices * rows_per_slice);
+
+    std::vector<SliceAndKey> slice_and_keys;
+    for (size_t i = 0; i < row_slices; ++i) {
+        const auto start = static_cast<timestamp>(i * rows_per_slice);
+        const auto end = static_cast<timestamp>((i + 1) * rows_per_slice);
+        slice_and_keys.emplace_back(
+            FrameSlice{ColRange{1, 2}, RowRange{i * rows_per_slice, (i + 1) * rows_per_slice}},
+            AtomKey{stream_id, version_id, 0, i, IndexValue{start}, IndexValue{end}, KeyType::TABLE_DATA});
+    }
+    return {std::move(tsd), std::move(slice_and_keys)};
+}
+
+AtomKey write_index(
+        const std::shared_ptr<InMemoryStore>& store,
+        const StreamId& stream_id,
+        TimeseriesDescriptor&& tsd,
+        const std::vector<SliceAndKey>& slice_and_keys) {
+    index::IndexWriter<stream::TimeseriesIndex> writer(store, IndexPartialKey{stream_id, 0}, std::move(tsd));
+    for (const auto& slice_and_key : slice_and_keys)
+        writer.add(slice_and_key.key(), slice_and_key.slice());
+
+    return writer.commit().get();
+}
+
+} // namespace
+
+TEST(IndexPages, NotPagedByDefault) {
+    const StreamId stream_id{"not_paged"};
+    auto [tsd, slice_and_keys] = timeseries_slice_and_keys(stream_id, 0, 10);
+    auto store = std::make_shared<InMemoryStore>();
+    auto key = write_index(store, stream_id, std::move(tsd), slice_and_keys);
+
+    auto seg = store->read_sync(key).second;
+    ASSERT_FALSE(index::is_paged_index(seg));
+    ASSERT_EQ(seg.row_count(), 10);
+}
+
+TEST(IndexPages, ReadAllPages) {
+    ScopedConfig page_rows("VersionStore.IndexPageRows", 3);
+    const StreamId stream_id{"paged"};
+    auto [tsd, slice_and_keys] = timeseries_slice_and_keys(stream_id, 0, 10);
+    auto store = std::make_shared<InMemoryStore>();
+    auto key = write_index(store, stream_id, std::move(tsd), slice_and_keys);
+
+    auto top_level = store->read_sync(key).second;
+    ASSERT_TRUE(index::is_paged_index(top_level));
+    ASSERT_EQ(top_level.row_count(), 4);
+    ASSERT_EQ(top_level.index_descriptor().total_rows(), 100);
+
+    auto isr = index::get_index_reader(key, store);
+    ASSERT_EQ(isr.size(), slice_and_keys.size());
+    ASSERT_EQ(isr.tsd().total_rows(), 100);
+    for (size_t i = 0; i < slice_and_keys.size(); ++i) {
+        const auto row = isr.row(i);
+        ASSERT_EQ(row.key(), slice_and_keys[i].key());
+        ASSERT_EQ(row.slice().row_range, slice_and_keys[i].slice().row_range);
+    }
+}
+
+TEST(IndexPages, ReadPagesInRange) {
+    ScopedConfig page_rows("VersionStore.IndexPageRows", 3);
+    const StreamId stream_id{"paged"};
+    auto [tsd, slice_and_keys] = timeseries_slice_and_keys(stream_id, 0, 10);
+    auto store = std::make_shared<InMemoryStore>();
+    auto key = write_index(store, stream_id, std::move(tsd), slice_and_keys);
+
+    // Rows 35 to 45 are in the keys at positions 3 and 4, which are both in the second page
+    auto pages = index::read_index_pages(
+        store,
+        store->read_sync(key).second,
+        IndexRange{NumericIndex{35}, NumericIndex{45}}).get();
+    ASSERT_EQ(pages.row_count(), 3);
+    ASSERT_EQ(stream::read_key_row(pages, 0), slice_and_keys[3].key());
+    ASSERT_EQ(stream::read_key_row(pages, 2), slice_and_keys[5].key());
+
+    // A range before all of the data still yields a page so that the schema is retained
+    auto first_page = index::read_index_pages(
+        store,
+        store->read_sync(key).second,
+        IndexRange{NumericIndex{-20}, NumericIndex{-10}}).get();
+    ASSERT_EQ(first_page.row_count(), 3);
+    ASSERT_EQ(stream::read_key_row(first_page, 0), slice_and_keys[0].key());
+}
+
+TEST(IndexPages, RecurseIndexKeysIncludesPages) {
+    ScopedConfig page_rows("VersionStore.IndexPageRows", 3);
+    const StreamId stream_id{"paged"};
+    auto [tsd, slice_and_keys] = timeseries_slice_and_keys(stream_id, 0, 10);
+    auto store = std::make_shared<InMemoryStore>();
+    auto key = write_index(store, stream_id, std::move(tsd), slice_and_keys);
+
+    auto keys = recurse_index_keys(store, std::vector<AtomKey>{key}, storage::ReadKeyOpts{});
+    // Four pages and ten data keys
+    ASSERT_EQ(keys.size(), 14);
+    for (const auto& slice_and_key : slice_and_keys)
+        ASSERT_TRUE(keys.contains(slice_and_key.key()));
+
+    auto top_level = store->read_sync(key).second;
+    for (size_t i = 0; i < top_level.row_count(); ++i)
+        ASSERT_TRUE(keys.contains(stream::read_key_row(top_level, static_cast<ssize_t>(i))));
+}
+
+TEST(IndexPages, GetDataKeysExpandsPages) {
+    ScopedConfig page_rows("VersionStore.IndexPageRows", 3);
+    const StreamId stream_id{"paged"};
+    auto [tsd, slice_and_keys] = timeseries_slice_and_keys(stream_id, 0, 10);
+    auto store = std::make_shared<InMemoryStore>();
+    auto key = write_index(store, stream_id, std::move(tsd), slice_and_keys);
+
+    // Only the data keys, as used for de-duplicating against the version, without its pages
+    auto keys = get_data_keys(store, key, storage::ReadKeyOpts{});
+    ASSERT_EQ(keys.size(), slice_and_keys.size());
+    for (const auto& slice_and_key : slice_and_keys)
+        ASSERT_NE(std::ranges::find(keys, slice_and_key.key()), keys.end());
+}
@@ -8,6 +8,7 @@
 #include <arcticdb/pipeline/input_tensor_frame.hpp>
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/pipeline/index_utils.hpp>
+#include <arcticdb/pipeline/index_field_stats.hpp>
 #include <arcticdb/pipeline/slicing.hpp>
 #include <arcticdb/stream/protobuf_mappings.hpp>
 #include <arcticdb/stream/stream_sink.hpp>
@@ -107,10 +108,16 @@ std::tuple<stream::StreamSink::PartialKey, SegmentInMemory, FrameSlice> WriteToS
 
         agg.end_block_write(rows_to_write);
 
-        if(ConfigsMap().instance()->get_int("Statistics.GenerateOnWrite", 0) == 1)
+        std::shared_ptr<const SegmentFieldStats> field_stats;
+        if(index::generate_field_stats_on_write()) {
             agg.segment().calculate_statistics();
+            field_stats = index::collect_field_stats(agg.segment());
+        }
 
         agg.finalize();
+        if(field_stats)
+            std::get<FrameSlice>(output).set_field_stats(std::move(field_stats));
+
         return output;
     });
 }
@@ -230,6 +237,12 @@ folly::Future<entity::AtomKey> append_frame(
     );
 
     auto existing_slices = unfiltered_index(index_segment_reader);
+    if (index::has_field_stats(index_segment_reader.seg())) {
+        // Carry the statistics of the existing data segments over into the index of the new version
+        auto field_stats = index::read_field_stats(index_segment_reader.seg());
+        for (size_t row = 0; row < existing_slices.size(); ++row)
+            existing_slices[row].slice().set_field_stats(std::move(field_stats[row]));
+    }
     auto keys_fut = slice_and_write(frame, slicing, IndexPartialKey{key}, store);
     return std::move(keys_fut)
     .thenValue([dynamic_schema, slices_to_write=std::move(existing_slices), frame=frame, index_segment_reader=std::move(index_segment_reader), key=std::move(key), store](auto&& slice_and_keys_to_append) mutable {
@@ -14,11 +14,14 @@
 #include <arcticdb/stream/merge.hpp>
 
 #include <arcticdb/processing/clause.hpp>
+#include <arcticdb/processing/grouping_hash_table.hpp>
 #include <arcticdb/pipeline/column_stats.hpp>
 #include <arcticdb/pipeline/frame_slice.hpp>
+#include <arcticdb/pipeline/string_pool_utils.hpp>
 #include <arcticdb/stream/segment_aggregator.hpp>
 #include <arcticdb/util/test/random_throw.hpp>
 #include <ankerl/unordered_dense.h>
+#include <folly/Demangle.h>
 #include <ranges>
 
 namespace arcticdb {
@@ -29,17 +32,17 @@ using namespace pipelines;
 class GroupingMap {
     using NumericMapType = std::variant<
             std::monostate,
-            std::shared_ptr<ankerl::unordered_dense::map<bool, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint8_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint16_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint32_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint64_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int8_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int16_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int32_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int64_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<float, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<double, size_t>>>;
+            std::shared_ptr<grouping::GroupingHashTable<bool>>,
+            std::shared_ptr<grouping::GroupingHashTable<uint8_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<uint16_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<uint32_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<uint64_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<int8_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<int16_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<int32_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<int64_t>>,
+            std::shared_ptr<grouping::GroupingHashTable<float>>,
+            std::shared_ptr<grouping::GroupingHashTable<double>>>;
 
     NumericMapType map_;
 
@@ -55,17 +58,17 @@ public:
     }
 
     template<typename T>
-    std::shared_ptr<ankerl::unordered_dense::map<T, size_t>> get() {
+    std::shared_ptr<grouping::GroupingHashTable<T>> get() {
         ARCTICDB_DEBUG_THROW(5)
         return util::variant_match(map_,
                                    [that = this](const std::monostate &) {
-                                       that->map_ = std::make_shared<ankerl::unordered_dense::map<T, size_t>>();
-                                       return std::get<std::shared_ptr<ankerl::unordered_dense::map<T, size_t>>>(that->map_);
+                                       that->map_ = std::make_shared<grouping::GroupingHashTable<T>>();
+                                       return std::get<std::shared_ptr<grouping::GroupingHashTable<T>>>(that->map_);
                                    },
-                                   [](const std::shared_ptr<ankerl::unordered_dense::map<T, size_t>> &ptr) {
+                                   [](const std::shared_ptr<grouping::GroupingHashTable<T>> &ptr) {
                                        return ptr;
                                    },
-                                   [](const auto &) -> std::shared_ptr<ankerl::unordered_dense::map<T, size_t>> {
+                                   [](const auto &) -> std::shared_ptr<grouping::GroupingHashTable<T>> {
                                        schema::raise<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
                                                "GroupBy does not support the grouping column type changing with dynamic schema");
                                    });
@@ -96,6 +99,15 @@ struct SegmentWrapper {
     }
 };
 
+std::string clause_name(const Clause& clause) {
+    const auto demangled = folly::demangle(folly::poly_type(clause));
+    std::string_view name{demangled.data(), demangled.size()};
+    name = name.substr(0, name.find('<'));
+    if (const auto pos = name.rfind("::"); pos != std::string_view::npos)
+        name.remove_prefix(pos + 2);
+    return std::string{name};
+}
+
 void check_column_presence(OutputSchema& output_schema, const std::unordered_set<std::string>& required_columns, std::string_view clause_name) {
     const auto& column_types = output_schema.column_types();
     for (const auto& input_column: required_columns) {
@@ -130,7 +142,10 @@ std::vector<EntityId> FilterClause::process(std::vector<EntityId>&& entity_ids)
     auto proc = gather_entities<std::shared_ptr<SegmentInMemory>, std::shared_ptr<RowRange>, std::shared_ptr<ColRange>>(*component_manager_, std::move(entity_ids));
     proc.set_expression_context(expression_context_);
     ARCTICDB_RUNTIME_DEBUG(log::memory(), "Doing filter {} for entity ids {}", root_node_name_, entity_ids);
-    auto variant_data = proc.get(root_node_name_);
+    std::optional<VariantData> precomputed;
+    if (precomputed_results_)
+        precomputed = precomputed_results_->extract(proc.row_ranges_->front()->first);
+    auto variant_data = precomputed.has_value() ? std::move(*precomputed) : proc.get(root_node_name_);
     std::vector<EntityId> output;
     util::variant_match(variant_data,
                         [&proc, &output, this](util::BitSet &bitset) {
@@ -405,80 +420,54 @@ std::vector<EntityId> AggregationClause::process(std::vector<EntityId>&& entity_
                     grouping_data_type = col_type_info::data_type;
                     // Faster to initialise to zero (missing value group) and use raw ptr than repeated calls to emplace_back
                     std::vector<size_t> row_to_group(col.column_->last_row() + 1, 0);
-                    size_t* row_to_group_ptr = row_to_group.data();
                     auto hash_to_group = grouping_map.get<typename col_type_info::RawType>();
-                    // For string grouping columns, keep a local map within this ProcessingUnit
-                    // from offsets to groups, to avoid needless calls to col.string_at_offset and
-                    // string_pool->get
-                    // This could be slower in cases where there aren't many repeats in string
-                    // grouping columns. Maybe track hit ratio of finds and stop using it if it is
-                    // too low?
-                    // Tested with 100,000,000 row dataframe with 100,000 unique values in the grouping column. Timings:
-                    // 11.14 seconds without caching
-                    // 11.01 seconds with caching
-                    // Not worth worrying about right now
-                    ankerl::unordered_dense::map<typename col_type_info::RawType, size_t> offset_to_group;
 
                     const bool is_sparse = col.column_->is_sparse();
                     if (is_sparse && next_group_id == 0) {
                         // We use 0 for the missing value group id
                         ++next_group_id;
                     }
-                    ssize_t previous_value_index = 0;
-
-                    Column::for_each_enumerated<typename col_type_info::TDT>(
-                            *col.column_,
-                            [&](auto enumerating_it) {
-                                typename col_type_info::RawType val;
-                                if constexpr (is_sequence_type(col_type_info::data_type)) {
-                                    auto offset = enumerating_it.value();
-                                    if (auto it = offset_to_group.find(offset); it !=
-                                                                                offset_to_group.end()) {
-                                        val = it->second;
-                                    } else {
-                                        std::optional<std::string_view> str = col.string_at_offset(
-                                                offset);
-                                        if (str.has_value()) {
-                                            val = string_pool->get(*str, true).offset();
-                                        } else {
-                                            val = offset;
-                                        }
-                                        typename col_type_info::RawType val_copy(val);
-                                        offset_to_group.insert(
-                                                std::make_pair<typename col_type_info::RawType, size_t>(
-                                                        std::forward<typename col_type_info::RawType>(
-                                                                offset),
-                                                        std::forward<typename col_type_info::RawType>(
-                                                                val_copy)));
-                                    }
-                                } else {
-                                    val = enumerating_it.value();
-                                }
-
-                                if (is_sparse) {
-                                    constexpr size_t missing_value_group_id = 0;
-                                    for (auto j = previous_value_index;
-                                         j != enumerating_it.idx(); ++j) {
-                                        *row_to_group_ptr++ = missing_value_group_id;
-                                    }
-                                    previous_value_index = enumerating_it.idx() + 1;
-                                }
+                    // The values of a sparse column are stored contiguously, so group them into a separate buffer
+                    // and then scatter the groups to the rows that have values. All other rows stay in the missing
+                    // value group
+                    std::vector<size_t> value_to_group;
+                    size_t* value_to_group_ptr = row_to_group.data();
+                    if (is_sparse) {
+                        value_to_group.resize(col.column_->row_count());
+                        value_to_group_ptr = value_to_group.data();
+                    }
+                    auto new_group = [&next_group_id](typename col_type_info::RawType) {
+                        return next_group_id++;
+                    };
+
+                    auto column_data = col.column_->data();
+                    if constexpr (is_sequence_type(col_type_info::data_type)) {
+                        // For string grouping columns, keep a local table within this ProcessingUnit from offsets
+                        // to groups, so that col.string_at_offset and string_pool->get are only called once for
+                        // each distinct string. The table of all groups is keyed on the offsets in string_pool
+                        grouping::GroupingHashTable<typename col_type_info::RawType> offset_to_group;
+                        auto string_group = [&col, &string_pool, &hash_to_group, &new_group](typename col_type_info::RawType offset) {
+                            std::optional<std::string_view> str = col.string_at_offset(offset);
+                            const typename col_type_info::RawType val = str.has_value() ? string_pool->get(*str, true).offset() : offset;
+                            return hash_to_group->find_or_insert(val, new_group);
+                        };
+                        while (auto block = column_data.next<typename col_type_info::TDT>()) {
+                            offset_to_group.find_or_insert(block->data(), block->row_count(), value_to_group_ptr, string_group);
+                            value_to_group_ptr += block->row_count();
+                        }
+                    } else {
+                        while (auto block = column_data.next<typename col_type_info::TDT>()) {
+                            hash_to_group->find_or_insert(block->data(), block->row_count(), value_to_group_ptr, new_group);
+                            value_to_group_ptr += block->row_count();
+                        }
+                    }
 
-                                if (auto it = hash_to_group->find(val); it ==
-                                                                        hash_to_group->end()) {
-                                    *row_to_group_ptr++ = next_group_id;
-                                    auto group_id = next_group_id++;
-                                    hash_to_group->insert(
-                                            std::make_pair<typename col_type_info::RawType, size_t>(
-                                                    std::forward<typename col_type_info::RawType>(
-                                                            val),
-                                                    std::forward<typename col_type_info::RawType>(
-                                                            group_id)));
-                                } else {
-                                    *row_to_group_ptr++ = it->second;
-                                }
-                            }
-                    );
+                    if (is_sparse) {
+                        const auto& sparse_map = col.column_->sparse_map();
+                        size_t value_idx = 0;
+                        for (auto set_bit = sparse_map.first(); set_bit < sparse_map.end(); ++set_bit)
+                            row_to_group[*set_bit] = value_to_group[value_idx++];
+                    }
 
                     num_unique = next_group_id;
                     util::check(num_unique != 0, "Got zero unique values");
@@ -510,21 +499,10 @@ std::vector<EntityId> AggregationClause::process(std::vector<EntityId>&& entity_
 
     details::visit_type(grouping_data_type, [&grouping_map, &index_col](auto data_type_tag) {
         using col_type_info = ScalarTypeInfo<decltype(data_type_tag)>;
-        auto hashes = grouping_map.get<typename col_type_info::RawType>();
-        std::vector<std::pair<typename col_type_info::RawType, size_t>> elements;
-        for (const auto &hash : *hashes)
-            elements.emplace_back(std::make_pair(hash.first, hash.second));
-
-        std::sort(std::begin(elements),
-                  std::end(elements),
-                  [](const std::pair<typename col_type_info::RawType, size_t> &l, const std::pair<typename col_type_info::RawType, size_t> &r) {
-                      return l.second < r.second;
-                  });
-
+        // Group ids are handed out in the order that values are inserted, so the keys are already in group id order
+        const auto& keys = grouping_map.get<typename col_type_info::RawType>()->keys();
         auto column_data = index_col->data();
-        std::transform(elements.cbegin(), elements.cend(), column_data.begin<typename col_type_info::TDT>(), [](const auto& element) {
-            return element.first;
-        });
+        std::copy(keys.cbegin(), keys.cend(), column_data.begin<typename col_type_info::TDT>());
     });
     index_col->set_row_data(grouping_map.size() - 1);
 
@@ -1099,26 +1077,12 @@ std::vector<std::vector<EntityId>> MergeClause::structure_for_processing(std::ve
     auto entity_ids = flatten_entities(std::move(entity_ids_vec));
     auto proc = gather_entities<std::shared_ptr<SegmentInMemory>, std::shared_ptr<RowRange>, std::shared_ptr<ColRange>>(*component_manager_, std::move(entity_ids));
 
-    auto compare =
-            [](const std::unique_ptr<SegmentWrapper> &left,
-               const std::unique_ptr<SegmentWrapper> &right) {
-                if (left->seg_.row_count() == 0) {
-                    return false;
-                } else if (right->seg_.row_count() == 0) {
-                    return true;
-                }
-                const auto left_index = index::index_value_from_row(left->row(), IndexDescriptorImpl::Type::TIMESTAMP, 0);
-                const auto right_index = index::index_value_from_row(right->row(), IndexDescriptorImpl::Type::TIMESTAMP, 0);
-                return left_index > right_index;
-            };
-
-    movable_priority_queue<std::unique_ptr<SegmentWrapper>, std::vector<std::unique_ptr<SegmentWrapper>>, decltype(compare)> input_streams{
-            compare};
-
     size_t min_start_row = std::numeric_limits<size_t>::max();
     size_t max_end_row = 0;
     size_t min_start_col = std::numeric_limits<size_t>::max();
     size_t max_end_col = 0;
+    std::vector<SegmentInMemory> segments;
+    segments.reserve(proc.segments_->size());
     for (auto&& [idx, segment]: folly::enumerate(proc.segments_.value())) {
         size_t start_row = proc.row_ranges_->at(idx)->start();
         size_t end_row = proc.row_ranges_->at(idx)->end();
@@ -1130,11 +1094,43 @@ std::vector<std::vector<EntityId>> MergeClause::structure_for_processing(std::ve
         min_start_col = std::min(start_col, min_start_col);
         max_end_col = std::max(end_col, max_end_col);
 
-        input_streams.push(std::make_unique<SegmentWrapper>(std::move(*segment)));
+        segments.emplace_back(std::move(*segment));
     }
     const RowRange row_range{min_start_row, max_end_row};
     const ColRange col_range{min_start_col, max_end_col};
     std::vector<std::vector<EntityId>> ret;
+    if (!add_symbol_column_ && stream_descriptor_.index().type() == IndexDescriptorImpl::Type::TIMESTAMP) {
+        // Merge whole runs of rows from each input a column at a time rather than one row at a time
+        const auto allow_sparse = std::visit([](auto density) { return decltype(density)::allow_sparse; }, density_policy_);
+        const auto num_segment_rows = static_cast<size_t>(ConfigsMap::instance()->get_int("Merge.SegmentSize", 100000));
+        auto merged = stream::merge_sorted_segments(std::move(segments), stream_descriptor_, allow_sparse, num_segment_rows);
+        size_t start_row = row_range.first;
+        for (auto& segment : merged) {
+            const size_t end_row = start_row + segment.row_count();
+            ret.emplace_back(push_entities(*component_manager_, ProcessingUnit{std::move(segment), RowRange{start_row, end_row}, col_range}));
+            start_row = end_row;
+        }
+        return ret;
+    }
+
+    auto compare =
+            [](const std::unique_ptr<SegmentWrapper> &left,
+               const std::unique_ptr<SegmentWrapper> &right) {
+                if (left->seg_.row_count() == 0) {
+                    return false;
+                } else if (right->seg_.row_count() == 0) {
+                    return true;
+                }
+                const auto left_index = index::index_value_from_row(left->row(), IndexDescriptorImpl::Type::TIMESTAMP, 0);
+                const auto right_index = index::index_value_from_row(right->row(), IndexDescriptorImpl::Type::TIMESTAMP, 0);
+                return left_index > right_index;
+            };
+
+    movable_priority_queue<std::unique_ptr<SegmentWrapper>, std::vector<std::unique_ptr<SegmentWrapper>>, decltype(compare)> input_streams{
+            compare};
+    for (auto& segment : segments)
+        input_streams.push(std::make_unique<SegmentWrapper>(std::move(segment)));
+
     std::visit([this, &ret, &input_streams, stream_id=stream_id_, &row_range, &col_range](auto idx, auto density) {
             if (dynamic_schema_) {
                 merge_impl<decltype(idx), decltype(density), decltype(input_streams), true>(
@@ -1225,7 +1221,11 @@ std::vector<EntityId> ColumnStatsGenerationClause::process(std::vector<EntityId>
     seg.add_column(scalar_field(DataType::NANOSECONDS_UTC64, start_index_column_name), start_index_col);
     seg.add_column(scalar_field(DataType::NANOSECONDS_UTC64, end_index_column_name), end_index_col);
     for (const auto& agg_data: folly::enumerate(aggregators_data)) {
-        seg.concatenate(agg_data->finalize(column_stats_aggregators_->at(agg_data.index).get_output_column_names()));
+        auto stats = agg_data->finalize(column_stats_aggregators_->at(agg_data.index).get_output_column_names());
+        // Concatenating does not bring the string pool of stats with it
+        if (stats.has_string_pool())
+            remap_strings(stats, seg.string_pool());
+        seg.concatenate(std::move(stats));
     }
     seg.set_row_id(0);
     return push_entities(*component_manager_, ProcessingUnit(std::move(seg)));
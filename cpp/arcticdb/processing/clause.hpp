@@ -32,6 +32,7 @@
 #include <string>
 #include <variant>
 #include <memory>
+#include <mutex>
 #include <atomic>
 
 namespace arcticdb {
@@ -95,6 +96,9 @@ struct IClause {
 
 using Clause = folly::Poly<IClause>;
 
+// The unqualified name of the concrete clause type, e.g. FilterClause or ResampleClause
+std::string clause_name(const Clause& clause);
+
 void check_column_presence(OutputSchema& output_schema,
                            const std::unordered_set<std::string>& required_columns,
                            std::string_view clause_name);
@@ -133,12 +137,39 @@ struct PassthroughClause {
     }
 };
 
+// Results of a FilterClause already evaluated on whole row-slices, by the first row of each row-slice. Filled in when
+// the column-slices the filter reads are fetched first, see read_filter_slices_first, so that the FilterClause does not
+// evaluate it again.
+class PrecomputedFilterResults {
+public:
+    void insert(size_t row_slice_start, VariantData&& result) {
+        std::lock_guard lock(mutex_);
+        results_.insert_or_assign(row_slice_start, std::move(result));
+    }
+
+    std::optional<VariantData> extract(size_t row_slice_start) {
+        std::lock_guard lock(mutex_);
+        auto it = results_.find(row_slice_start);
+        if (it == results_.end())
+            return std::nullopt;
+
+        auto result = std::move(it->second);
+        results_.erase(it);
+        return result;
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<size_t, VariantData> results_;
+};
+
 struct FilterClause {
     ClauseInfo clause_info_;
     std::shared_ptr<ComponentManager> component_manager_;
     std::shared_ptr<ExpressionContext> expression_context_;
     ExpressionName root_node_name_;
     PipelineOptimisation optimisation_;
+    std::shared_ptr<PrecomputedFilterResults> precomputed_results_;
 
     explicit FilterClause(std::unordered_set<std::string> input_columns,
                           ExpressionContext expression_context,
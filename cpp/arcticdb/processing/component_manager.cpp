@@ -9,9 +9,15 @@
 #include <atomic>
 
 #include <arcticdb/processing/component_manager.hpp>
+#include <arcticdb/util/configs_map.hpp>
 
 namespace arcticdb {
 
+ComponentManager::ComponentManager() {
+    if (ConfigsMap::instance()->get_int("Allocator.UseQueryArena", 0) == 1)
+        arena_ = std::make_shared<Arena>();
+}
+
 std::vector<EntityId> ComponentManager::get_new_entity_ids(size_t count) {
     std::vector<EntityId> ids(count);
     std::unique_lock lock(mtx_);
@@ -14,6 +14,7 @@
 
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/util/constructors.hpp>
+#include <arcticdb/util/arena.hpp>
 
 namespace arcticdb {
 
@@ -26,9 +27,15 @@ using namespace entt::literals;
 
 class ComponentManager {
 public:
-    ComponentManager() = default;
+    ComponentManager();
     ARCTICDB_NO_MOVE_OR_COPY(ComponentManager)
 
+    // Arena for the transient allocations made while processing the clauses of the query, or nullptr if
+    // Allocator.UseQueryArena is not set
+    const std::shared_ptr<Arena>& arena() const {
+        return arena_;
+    }
+
     std::vector<EntityId> get_new_entity_ids(size_t count);
 
     // Add a single entity with the components defined by args
@@ -156,6 +163,7 @@ private:
 
     entt::registry registry_;
     std::shared_mutex mtx_;
+    std::shared_ptr<Arena> arena_;
 };
 
 } // namespace arcticdb
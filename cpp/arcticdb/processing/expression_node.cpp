@@ -132,6 +132,16 @@ std::variant<BitSetTag, DataType> ExpressionNode::compute(
                             std::get<DataType>(left_type), operation_type_);
                 }
                 break;
+            case OperationType::LEN:
+            case OperationType::LOWER:
+            case OperationType::UPPER:
+                user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(std::holds_alternative<DataType>(left_type), "Unexpected bitset input to {}", operation_type_);
+                user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+                        is_dynamic_string_type(std::get<DataType>(left_type)),
+                        "Unexpected data type {} input to {}",
+                        std::get<DataType>(left_type), operation_type_);
+                res = operation_type_ == OperationType::LEN ? DataType::FLOAT64 : DataType::UTF_DYNAMIC64;
+                break;
             default:
                 internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unexpected unary operator {}", operation_type_);
         }
@@ -210,6 +220,20 @@ std::variant<BitSetTag, DataType> ExpressionNode::compute(
                             std::get<DataType>(left_type), std::get<DataType>(right_type), operation_type_);
                 } // else - Empty value set compatible with all data types
                 break;
+            case OperationType::STARTSWITH:
+            case OperationType::CONTAINS:
+            case OperationType::CONCAT:
+                user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(std::holds_alternative<DataType>(left_type), "Unexpected bitset input as left operand to {}", operation_type_);
+                user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(std::holds_alternative<DataType>(right_type), "Unexpected bitset input as right operand to {}", operation_type_);
+                user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(right_value_set_state == ValueSetState::NOT_A_SET, "Unexpected value set input to {}", operation_type_);
+                user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+                        is_dynamic_string_type(std::get<DataType>(left_type)) && is_dynamic_string_type(std::get<DataType>(right_type)),
+                        "Unexpected data types {} {} input to {}",
+                        std::get<DataType>(left_type), std::get<DataType>(right_type), operation_type_);
+                if (operation_type_ == OperationType::CONCAT) {
+                    res = DataType::UTF_DYNAMIC64;
+                }
+                break;
             case OperationType::AND:
             case OperationType::OR:
             case OperationType::XOR:
@@ -229,6 +253,23 @@ std::variant<BitSetTag, DataType> ExpressionNode::compute(
             default:
                 internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unexpected binary operator {}", operation_type_);
         }
+    } else if (operation_type_ == OperationType::SUBSTRING) {
+        // The string column is held in the condition slot, and the start and length values in left and right
+        ValueSetState condition_value_set_state;
+        auto condition_type = child_return_type(condition_, expression_context, column_types, condition_value_set_state);
+        ValueSetState right_value_set_state;
+        auto right_type = child_return_type(right_, expression_context, column_types, right_value_set_state);
+        user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(condition_value_set_state == ValueSetState::NOT_A_SET &&
+                                                              right_value_set_state == ValueSetState::NOT_A_SET,
+                                                              "Unexpected value set input to {}", operation_type_);
+        user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+                std::holds_alternative<DataType>(condition_type) && is_dynamic_string_type(std::get<DataType>(condition_type)),
+                "Unexpected non-string input to {}", operation_type_);
+        user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+                std::holds_alternative<DataType>(left_type) && is_integer_type(std::get<DataType>(left_type)) &&
+                std::holds_alternative<DataType>(right_type) && is_integer_type(std::get<DataType>(right_type)),
+                "Unexpected non-integer start or length input to {}", operation_type_);
+        res = DataType::UTF_DYNAMIC64;
     } else {
         // Ternary operation
         ValueSetState condition_value_set_state;
@@ -0,0 +1,154 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/preprocess.hpp>
+
+namespace arcticdb::grouping {
+
+/*
+ * Open-addressing hash table from the values in a grouping column to group ids.
+ *
+ * Each slot holds a key next to its group id, and slots are probed linearly in a power-of-two sized array, so a
+ * lookup usually touches a single cache line. Values are looked up a block at a time: the hashes of the whole block
+ * are computed in one loop that does not touch the table, and the table is then probed for each of them. Capacity
+ * for the whole block is reserved up front, so the table never grows part of the way through a block.
+ *
+ * Keys compare with operator==, so as with std::unordered_map a NaN never matches an existing key. NaNs are therefore
+ * given a new group without being stored in a slot, as they would otherwise all collide in the same probe sequence.
+ */
+template<typename T>
+requires std::is_arithmetic_v<T>
+class GroupingHashTable {
+public:
+    static constexpr size_t batch_size = 256;
+
+    explicit GroupingHashTable(size_t initial_capacity = 64) {
+        resize(std::bit_ceil(std::max<size_t>(initial_capacity, 16)));
+    }
+
+    /*
+     * Writes the id of the group of each of the count values at keys to group_ids. The id of a value not seen before is
+     * obtained by calling new_group(value), and is then stored for subsequent lookups.
+     */
+    template<typename NewGroup>
+    requires std::is_invocable_r_v<size_t, NewGroup, T>
+    void find_or_insert(const T* keys, size_t count, size_t* group_ids, NewGroup&& new_group) {
+        std::array<uint64_t, batch_size> hashes;
+        for (size_t batch_start = 0; batch_start < count; batch_start += batch_size) {
+            const size_t batch_count = std::min(batch_size, count - batch_start);
+            const T* batch_keys = keys + batch_start;
+            reserve(keys_.size() + batch_count);
+            for (size_t i = 0; i < batch_count; ++i)
+                hashes[i] = hash(batch_keys[i]);
+
+            for (size_t i = 0; i < batch_count; ++i)
+                group_ids[batch_start + i] = probe(batch_keys[i], hashes[i], new_group);
+        }
+    }
+
+    template<typename NewGroup>
+    requires std::is_invocable_r_v<size_t, NewGroup, T>
+    size_t find_or_insert(T key, NewGroup&& new_group) {
+        reserve(keys_.size() + 1);
+        return probe(key, hash(key), new_group);
+    }
+
+    [[nodiscard]] size_t size() const {
+        return keys_.size();
+    }
+
+    // The distinct values in the table, in the order in which they were inserted
+    [[nodiscard]] const std::vector<T>& keys() const {
+        return keys_;
+    }
+
+private:
+    static constexpr size_t empty_slot = std::numeric_limits<size_t>::max();
+
+    struct Slot {
+        T key_{};
+        size_t group_id_ = empty_slot;
+    };
+
+    using Bits = std::conditional_t<sizeof(T) <= 4, uint32_t, uint64_t>;
+
+    static uint64_t hash(T key) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // -0.0 == 0.0, so the two must hash the same. Adding zero turns -0.0 into 0.0 and leaves everything else alone
+            key += T(0);
+        }
+        Bits bits{0};
+        std::memcpy(&bits, &key, sizeof(T));
+        // Fibonacci hashing: the high bits of the product depend on all the bits of the key, and are the ones used to
+        // pick a slot
+        return static_cast<uint64_t>(bits) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    template<typename NewGroup>
+    size_t probe(T key, uint64_t key_hash, NewGroup& new_group) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (ARCTICDB_UNLIKELY(std::isnan(key))) {
+                keys_.emplace_back(key);
+                return new_group(key);
+            }
+        }
+        for (auto pos = static_cast<size_t>(key_hash >> shift_);; pos = (pos + 1) & mask_) {
+            auto& slot = slots_[pos];
+            if (slot.group_id_ == empty_slot) {
+                slot.key_ = key;
+                slot.group_id_ = new_group(key);
+                keys_.emplace_back(key);
+                return slot.group_id_;
+            }
+            if (slot.key_ == key)
+                return slot.group_id_;
+        }
+    }
+
+    // Keeps the load factor at or below one half, so that probe sequences stay short
+    void reserve(size_t num_keys) {
+        if (num_keys * 2 > slots_.size())
+            resize(std::bit_ceil(num_keys * 2));
+    }
+
+    void resize(size_t capacity) {
+        util::check(std::has_single_bit(capacity), "Expected grouping hash table capacity to be a power of two, got {}", capacity);
+        std::vector<Slot> old_slots(capacity);
+        std::swap(old_slots, slots_);
+        mask_ = capacity - 1;
+        shift_ = 64 - std::countr_zero(capacity);
+        for (const auto& slot : old_slots) {
+            if (slot.group_id_ == empty_slot)
+                continue;
+
+            auto pos = static_cast<size_t>(hash(slot.key_) >> shift_);
+            while (slots_[pos].group_id_ != empty_slot)
+                pos = (pos + 1) & mask_;
+
+            slots_[pos] = slot;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<T> keys_;
+    size_t mask_ = 0;
+    int shift_ = 64;
+};
+
+} // namespace arcticdb::grouping
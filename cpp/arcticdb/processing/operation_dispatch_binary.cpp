@@ -7,6 +7,7 @@
  */
 
 #include <arcticdb/processing/operation_dispatch_binary.hpp>
+#include <arcticdb/processing/operation_dispatch_string.hpp>
 
 namespace arcticdb {
 
@@ -157,6 +158,10 @@ VariantData dispatch_binary(const VariantData& left, const VariantData& right, O
             return visit_binary_comparator(left, right, GreaterThanEqualsOperator{});
         case OperationType::REGEX_MATCH:
             return visit_binary_comparator(left, right, RegexMatchOperator{});
+        case OperationType::STARTSWITH:
+        case OperationType::CONTAINS:
+        case OperationType::CONCAT:
+            return dispatch_string_binary(left, right, operation);
         case OperationType::ISIN:
             return visit_binary_membership(left, right, IsInOperator{});
         case OperationType::ISNOTIN:
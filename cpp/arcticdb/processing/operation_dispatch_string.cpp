@@ -0,0 +1,385 @@
+/*
+ * Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <ankerl/unordered_dense.h>
+
+#include <arcticdb/column_store/column.hpp>
+#include <arcticdb/column_store/segment_utils.hpp>
+#include <arcticdb/column_store/string_pool.hpp>
+#include <arcticdb/entity/type_utils.hpp>
+#include <arcticdb/log/log.hpp>
+#include <arcticdb/processing/operation_dispatch.hpp>
+#include <arcticdb/processing/operation_dispatch_string.hpp>
+#include <arcticdb/util/offset_string.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/variant.hpp>
+
+namespace arcticdb {
+
+namespace {
+
+using OutputStringTDT = ScalarTagType<DataTypeTag<DataType::UTF_DYNAMIC64>>;
+
+constexpr bool is_utf8_continuation_byte(char c) {
+    return (static_cast<uint8_t>(c) & 0xC0) == 0x80;
+}
+
+// Byte position at which the code point with the given index starts, or the size of the string if it has fewer code points
+size_t utf8_byte_position(std::string_view str, size_t code_point) {
+    for (size_t pos = 0; pos < str.size(); ++pos) {
+        if (!is_utf8_continuation_byte(str[pos])) {
+            if (code_point == 0)
+                return pos;
+            --code_point;
+        }
+    }
+    return str.size();
+}
+
+template<typename Func>
+void visit_dynamic_string_column(const ColumnWithStrings& col, OperationType operation, Func&& func) {
+    details::visit_type(col.column_->type().data_type(), [&](auto col_tag) {
+        using col_type_info = ScalarTypeInfo<decltype(col_tag)>;
+        if constexpr (is_dynamic_string_type(col_type_info::data_type)) {
+            func(col_tag);
+        } else {
+            user_input::raise<ErrorCode::E_INVALID_USER_ARGUMENT>(
+                    "Cannot perform {} on column '{}' of type {}, only dynamic string columns are supported",
+                    operation, col.column_name_, get_user_friendly_type_string(col.column_->type()));
+        }
+    });
+}
+
+ankerl::unordered_dense::set<entity::position_t> unique_strings(const ColumnWithStrings& col) {
+    auto unique_values = unique_values_for_string_column(*col.column_);
+    remove_nones_and_nans(unique_values);
+    return unique_values;
+}
+
+std::string_view string_value(const Value& value, OperationType operation) {
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+            is_sequence_type(value.data_type_),
+            "Unexpected non-string value of type {} provided to {}",
+            get_user_friendly_type_string(value.type()), operation);
+    return {*value.str_data(), value.len()};
+}
+
+int64_t integer_value(const VariantData& data, std::string_view argument_name) {
+    const auto* value = std::get_if<std::shared_ptr<Value>>(&data);
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+            value != nullptr, "SUBSTRING {} argument must be a fixed integer value", argument_name);
+    int64_t res{0};
+    details::visit_type((*value)->data_type_, [&](auto val_tag) {
+        using val_type_info = ScalarTypeInfo<decltype(val_tag)>;
+        if constexpr (is_integer_type(val_type_info::data_type)) {
+            using RawType = typename val_type_info::RawType;
+            const auto raw = (*value)->template get<RawType>();
+            if constexpr (std::is_unsigned_v<RawType>) {
+                res = static_cast<int64_t>(std::min<uint64_t>(raw, std::numeric_limits<int64_t>::max()));
+            } else {
+                res = static_cast<int64_t>(raw);
+            }
+        } else {
+            user_input::raise<ErrorCode::E_INVALID_USER_ARGUMENT>(
+                    "SUBSTRING {} argument must be an integer, got {}",
+                    argument_name, get_user_friendly_type_string((*value)->type()));
+        }
+    });
+    return res;
+}
+
+// Evaluates predicate once per distinct string in the column. None and NaN never match.
+template<typename Predicate>
+VariantData string_predicate(const ColumnWithStrings& col, OperationType operation, Predicate&& predicate) {
+    if (is_empty_type(col.column_->type().data_type())) {
+        return EmptyResult{};
+    }
+    util::BitSet output_bitset;
+    visit_dynamic_string_column(col, operation, [&](auto col_tag) {
+        using col_type_info = ScalarTypeInfo<decltype(col_tag)>;
+        ankerl::unordered_dense::set<entity::position_t> matching_offsets;
+        for (auto offset: unique_strings(col)) {
+            if (predicate(col.string_pool_->get_const_view(offset)))
+                matching_offsets.insert(offset);
+        }
+        Column::transform<typename col_type_info::TDT>(
+                *col.column_,
+                output_bitset,
+                false,
+                [&matching_offsets](auto input_value) {
+                    return matching_offsets.contains(static_cast<entity::position_t>(input_value));
+                });
+    });
+    ARCTICDB_DEBUG(log::version(), "Filtered column of size {} down to {} bits", col.column_->last_row() + 1, output_bitset.count());
+    return transform_to_placeholder(VariantData{std::move(output_bitset)});
+}
+
+// Evaluates transform once per distinct string in the column, writing the results to a new string pool, and produces
+// an offsets column remapped into that pool. transform may return a view of its input or of the provided buffer.
+template<typename Transform>
+VariantData string_transform(const ColumnWithStrings& col, OperationType operation, std::string_view output_name, Transform&& transform) {
+    schema::check<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
+            !is_empty_type(col.column_->type().data_type()),
+            "Empty column '{}' provided to {}", col.column_name_, operation);
+    auto string_pool = std::make_shared<StringPool>();
+    std::unique_ptr<Column> output_column;
+    visit_dynamic_string_column(col, operation, [&](auto col_tag) {
+        using col_type_info = ScalarTypeInfo<decltype(col_tag)>;
+        ankerl::unordered_dense::map<entity::position_t, entity::position_t> remapped_offsets;
+        auto unique_values = unique_strings(col);
+        remapped_offsets.reserve(unique_values.size());
+        std::string buffer;
+        for (auto offset: unique_values) {
+            remapped_offsets.emplace(offset, string_pool->get(transform(col.string_pool_->get_const_view(offset), buffer)).offset());
+        }
+        output_column = std::make_unique<Column>(make_scalar_type(OutputStringTDT::DataTypeTag::data_type), Sparsity::PERMITTED);
+        Column::transform<typename col_type_info::TDT, OutputStringTDT>(
+                *col.column_,
+                *output_column,
+                [&remapped_offsets](auto input_value) -> entity::position_t {
+                    const auto it = remapped_offsets.find(static_cast<entity::position_t>(input_value));
+                    // None and NaN are not in the map and pass through unchanged
+                    return it == remapped_offsets.end() ? static_cast<entity::position_t>(input_value) : it->second;
+                });
+    });
+    return ColumnWithStrings(std::move(output_column), std::move(string_pool), output_name);
+}
+
+VariantData string_length(const ColumnWithStrings& col) {
+    schema::check<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
+            !is_empty_type(col.column_->type().data_type()),
+            "Empty column '{}' provided to {}", col.column_name_, OperationType::LEN);
+    using OutputTDT = ScalarTagType<DataTypeTag<DataType::FLOAT64>>;
+    std::unique_ptr<Column> output_column;
+    visit_dynamic_string_column(col, OperationType::LEN, [&](auto col_tag) {
+        using col_type_info = ScalarTypeInfo<decltype(col_tag)>;
+        ankerl::unordered_dense::map<entity::position_t, double> lengths;
+        auto unique_values = unique_strings(col);
+        lengths.reserve(unique_values.size());
+        for (auto offset: unique_values) {
+            lengths.emplace(offset, static_cast<double>(utf8_length(col.string_pool_->get_const_view(offset))));
+        }
+        output_column = std::make_unique<Column>(make_scalar_type(OutputTDT::DataTypeTag::data_type), Sparsity::PERMITTED);
+        Column::transform<typename col_type_info::TDT, OutputTDT>(
+                *col.column_,
+                *output_column,
+                [&lengths](auto input_value) -> double {
+                    const auto it = lengths.find(static_cast<entity::position_t>(input_value));
+                    return it == lengths.end() ? std::numeric_limits<double>::quiet_NaN() : it->second;
+                });
+    });
+    return ColumnWithStrings(std::move(output_column), fmt::format("{}({})", OperationType::LEN, col.column_name_));
+}
+
+VariantData string_case(const ColumnWithStrings& col, OperationType operation) {
+    const bool to_lower = operation == OperationType::LOWER;
+    return string_transform(
+            col,
+            operation,
+            fmt::format("{}({})", operation, col.column_name_),
+            [to_lower](std::string_view input, std::string& buffer) -> std::string_view {
+                buffer.assign(input);
+                for (auto& c: buffer) {
+                    // Bytes of multi-byte UTF-8 sequences are all >= 0x80 so are never modified
+                    if (to_lower && c >= 'A' && c <= 'Z')
+                        c = static_cast<char>(c - 'A' + 'a');
+                    else if (!to_lower && c >= 'a' && c <= 'z')
+                        c = static_cast<char>(c - 'a' + 'A');
+                }
+                return buffer;
+            });
+}
+
+struct OffsetPairHash {
+    uint64_t operator()(const std::pair<entity::position_t, entity::position_t>& offsets) const noexcept {
+        const ankerl::unordered_dense::hash<entity::position_t> hash;
+        const auto first = hash(offsets.first);
+        return first ^ (hash(offsets.second) + 0x9e3779b97f4a7c15ULL + (first << 6) + (first >> 2));
+    }
+};
+
+// Both columns are typically slices of the same segment and so share a string pool, but this is not required
+VariantData concat_columns(const ColumnWithStrings& left, const ColumnWithStrings& right) {
+    schema::check<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
+            !is_empty_type(left.column_->type().data_type()) && !is_empty_type(right.column_->type().data_type()),
+            "Empty column provided to {}", OperationType::CONCAT);
+    auto string_pool = std::make_shared<StringPool>();
+    std::unique_ptr<Column> output_column;
+    visit_dynamic_string_column(left, OperationType::CONCAT, [&](auto left_tag) {
+        using left_type_info = ScalarTypeInfo<decltype(left_tag)>;
+        visit_dynamic_string_column(right, OperationType::CONCAT, [&](auto right_tag) {
+            using right_type_info = ScalarTypeInfo<decltype(right_tag)>;
+            ankerl::unordered_dense::map<std::pair<entity::position_t, entity::position_t>, entity::position_t, OffsetPairHash> concatenated_offsets;
+            std::string buffer;
+            output_column = std::make_unique<Column>(make_scalar_type(OutputStringTDT::DataTypeTag::data_type), Sparsity::PERMITTED);
+            Column::transform<typename left_type_info::TDT, typename right_type_info::TDT, OutputStringTDT>(
+                    *left.column_,
+                    *right.column_,
+                    *output_column,
+                    [&](auto left_value, auto right_value) -> entity::position_t {
+                        const auto left_offset = static_cast<entity::position_t>(left_value);
+                        const auto right_offset = static_cast<entity::position_t>(right_value);
+                        // As in Pandas, concatenating with None or NaN produces None or NaN
+                        if (!is_a_string(left_offset))
+                            return left_offset;
+                        if (!is_a_string(right_offset))
+                            return right_offset;
+                        auto [it, inserted] = concatenated_offsets.try_emplace({left_offset, right_offset}, 0);
+                        if (inserted) {
+                            buffer.assign(left.string_pool_->get_const_view(left_offset));
+                            buffer.append(right.string_pool_->get_const_view(right_offset));
+                            it->second = string_pool->get(buffer).offset();
+                        }
+                        return it->second;
+                    });
+        });
+    });
+    return ColumnWithStrings(
+            std::move(output_column),
+            std::move(string_pool),
+            fmt::format("{}({}, {})", OperationType::CONCAT, left.column_name_, right.column_name_));
+}
+
+template<bool arguments_reversed>
+VariantData concat_value(const ColumnWithStrings& col, const Value& val) {
+    const auto affix = string_value(val, OperationType::CONCAT);
+    const auto output_name = arguments_reversed ?
+            fmt::format("{}({}, {})", OperationType::CONCAT, val.to_string<uint64_t>(), col.column_name_) :
+            fmt::format("{}({}, {})", OperationType::CONCAT, col.column_name_, val.to_string<uint64_t>());
+    return string_transform(
+            col,
+            OperationType::CONCAT,
+            output_name,
+            [affix](std::string_view input, std::string& buffer) -> std::string_view {
+                if constexpr (arguments_reversed) {
+                    buffer.assign(affix);
+                    buffer.append(input);
+                } else {
+                    buffer.assign(input);
+                    buffer.append(affix);
+                }
+                return buffer;
+            });
+}
+
+VariantData visit_string_concat(const VariantData& left, const VariantData& right) {
+    return std::visit(util::overload{
+            [](const ColumnWithStrings& l, const ColumnWithStrings& r) -> VariantData {
+                return concat_columns(l, r);
+            },
+            [](const ColumnWithStrings& l, const std::shared_ptr<Value>& r) -> VariantData {
+                return concat_value<false>(l, *r);
+            },
+            [](const std::shared_ptr<Value>& l, const ColumnWithStrings& r) -> VariantData {
+                return concat_value<true>(r, *l);
+            },
+            [](const auto&, const auto&) -> VariantData {
+                user_input::raise<ErrorCode::E_INVALID_USER_ARGUMENT>("{} requires at least one string column input", OperationType::CONCAT);
+                return EmptyResult{};
+            }
+    }, left, right);
+}
+
+VariantData visit_string_predicate(const VariantData& left, const VariantData& right, OperationType operation) {
+    if (std::holds_alternative<EmptyResult>(left))
+        return EmptyResult{};
+
+    return std::visit(util::overload{
+            [operation](const ColumnWithStrings& l, const std::shared_ptr<Value>& r) -> VariantData {
+                const auto pattern = string_value(*r, operation);
+                if (operation == OperationType::STARTSWITH) {
+                    return string_predicate(l, operation, [pattern](std::string_view str) {
+                        return str.substr(0, pattern.size()) == pattern;
+                    });
+                } else {
+                    return string_predicate(l, operation, [pattern](std::string_view str) {
+                        return str.find(pattern) != std::string_view::npos;
+                    });
+                }
+            },
+            [operation](const auto&, const auto&) -> VariantData {
+                user_input::raise<ErrorCode::E_INVALID_USER_ARGUMENT>("{} requires a string column and a string value", operation);
+                return EmptyResult{};
+            }
+    }, left, right);
+}
+
+} // namespace
+
+size_t utf8_length(std::string_view str) {
+    return std::count_if(str.begin(), str.end(), [](char c) { return !is_utf8_continuation_byte(c); });
+}
+
+std::string_view utf8_substring(std::string_view str, int64_t start, int64_t length) {
+    const auto num_code_points = static_cast<int64_t>(utf8_length(str));
+    if (start < 0)
+        start = std::max<int64_t>(num_code_points + start, 0);
+    if (start >= num_code_points || length <= 0)
+        return {};
+    // Written this way round to avoid overflow when length is int64 max
+    const auto end = length >= num_code_points - start ? num_code_points : start + length;
+    const auto begin_pos = utf8_byte_position(str, start);
+    const auto end_pos = utf8_byte_position(str, end);
+    return str.substr(begin_pos, end_pos - begin_pos);
+}
+
+VariantData dispatch_string_unary(const VariantData& input, OperationType operation) {
+    return std::visit(util::overload{
+            [operation](const ColumnWithStrings& col) -> VariantData {
+                switch (operation) {
+                    case OperationType::LEN:
+                        return string_length(col);
+                    case OperationType::LOWER:
+                    case OperationType::UPPER:
+                        return string_case(col, operation);
+                    default:
+                        internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unexpected string operation {}", operation);
+                        return EmptyResult{};
+                }
+            },
+            [operation](const auto&) -> VariantData {
+                user_input::raise<ErrorCode::E_INVALID_USER_ARGUMENT>("{} requires a string column input", operation);
+                return EmptyResult{};
+            }
+    }, input);
+}
+
+VariantData dispatch_string_binary(const VariantData& left, const VariantData& right, OperationType operation) {
+    switch (operation) {
+        case OperationType::STARTSWITH:
+        case OperationType::CONTAINS:
+            return visit_string_predicate(left, right, operation);
+        case OperationType::CONCAT:
+            return visit_string_concat(left, right);
+        default:
+            internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unexpected string operation {}", operation);
+            return EmptyResult{};
+    }
+}
+
+VariantData dispatch_substring(const VariantData& input, const VariantData& start, const VariantData& length) {
+    const auto* col = std::get_if<ColumnWithStrings>(&input);
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(col != nullptr, "{} requires a string column input", OperationType::SUBSTRING);
+    const auto start_value = integer_value(start, "start");
+    const auto length_value = integer_value(length, "length");
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(length_value >= 0, "SUBSTRING length must be non-negative, got {}", length_value);
+    return string_transform(
+            *col,
+            OperationType::SUBSTRING,
+            fmt::format("{}({}, {}, {})", OperationType::SUBSTRING, col->column_name_, start_value, length_value),
+            [start_value, length_value](std::string_view input, std::string&) {
+                return utf8_substring(input, start_value, length_value);
+            });
+}
+
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include <arcticdb/processing/expression_node.hpp>
+#include <arcticdb/processing/operation_types.hpp>
+
+namespace arcticdb {
+
+/*
+ * String functions (LEN, LOWER, UPPER, STARTSWITH, CONTAINS, CONCAT and SUBSTRING).
+ *
+ * Dynamic string columns hold offsets into a string pool that stores each distinct string once, so rather than
+ * operating on every row these functions are evaluated once per distinct offset referenced by the column, and the
+ * per-offset results are then broadcast back over the rows:
+ *  - STARTSWITH and CONTAINS produce a bitset, as for REGEX_MATCH
+ *  - LEN produces a FLOAT64 column, with NaN for None/NaN input strings as in Pandas
+ *  - LOWER, UPPER, CONCAT and SUBSTRING produce a new string pool holding only the transformed strings, and an offsets
+ *    column remapped into it. None/NaN input strings are passed through unchanged.
+ * LEN and SUBSTRING count UTF-8 code points, LOWER and UPPER only change the case of ASCII characters.
+ */
+
+VariantData dispatch_string_unary(const VariantData& input, OperationType operation);
+
+VariantData dispatch_string_binary(const VariantData& left, const VariantData& right, OperationType operation);
+
+// start may be negative to count back from the end of the string, as in Python. length must be non-negative.
+VariantData dispatch_substring(const VariantData& input, const VariantData& start, const VariantData& length);
+
+size_t utf8_length(std::string_view str);
+
+std::string_view utf8_substring(std::string_view str, int64_t start, int64_t length);
+
+}
@@ -12,6 +12,7 @@
 #include <arcticdb/entity/type_utils.hpp>
 #include <arcticdb/processing/operation_dispatch.hpp>
 #include <arcticdb/processing/operation_dispatch_ternary.hpp>
+#include <arcticdb/processing/operation_dispatch_string.hpp>
 #include <arcticdb/processing/ternary_utils.hpp>
 
 namespace arcticdb {
@@ -582,6 +583,9 @@ VariantData dispatch_ternary(const VariantData& condition, const VariantData& le
     switch(operation) {
         case OperationType::TERNARY:
             return visit_ternary_operator(condition, left, right);
+        case OperationType::SUBSTRING:
+            // The string column is held in the condition slot, and the start and length values in left and right
+            return dispatch_substring(condition, left, right);
         default:
             util::raise_rte("Unknown operation {}", int(operation));
     }
@@ -7,6 +7,7 @@
  */
 
 #include <arcticdb/processing/operation_dispatch_unary.hpp>
+#include <arcticdb/processing/operation_dispatch_string.hpp>
 
 namespace arcticdb {
 
@@ -77,6 +78,10 @@ VariantData dispatch_unary(const VariantData& left, OperationType operation) {
         case OperationType::IDENTITY:
         case OperationType::NOT:
             return visit_unary_boolean(left, operation);
+        case OperationType::LEN:
+        case OperationType::LOWER:
+        case OperationType::UPPER:
+            return dispatch_string_unary(left, operation);
         default:
             util::raise_rte("Unknown operation {}", int(operation));
     }
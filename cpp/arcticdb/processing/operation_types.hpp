@@ -29,6 +29,10 @@ enum class OperationType : uint8_t {
     // Boolean
     IDENTITY,
     NOT,
+    // String
+    LEN,
+    LOWER,
+    UPPER,
     // Binary
     // Operator
     ADD,
@@ -45,12 +49,18 @@ enum class OperationType : uint8_t {
     ISIN,
     ISNOTIN,
     REGEX_MATCH,
+    STARTSWITH,
+    CONTAINS,
     // Boolean
     AND,
     OR,
     XOR,
+    // String
+    CONCAT,
     // Ternary
-    TERNARY
+    TERNARY,
+    // String
+    SUBSTRING
 };
 
 inline std::string_view operation_type_to_str(const OperationType ot) {
@@ -62,6 +72,9 @@ inline std::string_view operation_type_to_str(const OperationType ot) {
         TO_STR(NOTNULL)
         TO_STR(IDENTITY)
         TO_STR(NOT)
+        TO_STR(LEN)
+        TO_STR(LOWER)
+        TO_STR(UPPER)
         TO_STR(ADD)
         TO_STR(SUB)
         TO_STR(MUL)
@@ -75,17 +88,21 @@ inline std::string_view operation_type_to_str(const OperationType ot) {
         TO_STR(ISIN)
         TO_STR(ISNOTIN)
         TO_STR(REGEX_MATCH)
+        TO_STR(STARTSWITH)
+        TO_STR(CONTAINS)
         TO_STR(AND)
         TO_STR(OR)
         TO_STR(XOR)
+        TO_STR(CONCAT)
         TO_STR(TERNARY)
+        TO_STR(SUBSTRING)
 #undef TO_STR
         default:return std::string_view("UNKNOWN");
     }
 }
 
 constexpr bool is_unary_operation(OperationType o) {
-    return uint8_t(o) <= uint8_t(OperationType::NOT);
+    return uint8_t(o) <= uint8_t(OperationType::UPPER);
 }
 
 constexpr bool is_binary_operation(OperationType o) {
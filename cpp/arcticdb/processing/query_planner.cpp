@@ -6,9 +6,329 @@
  */
 
 #include <arcticdb/processing/query_planner.hpp>
+#include <arcticdb/processing/operation_dispatch_binary.hpp>
+#include <arcticdb/processing/operation_dispatch_unary.hpp>
 
 namespace arcticdb {
 
+namespace {
+
+// Operations that give the same result when evaluated once on constant inputs as when evaluated for every row
+bool is_foldable_operation(OperationType operation) {
+    switch (operation) {
+        case OperationType::ABS:
+        case OperationType::NEG:
+        case OperationType::ADD:
+        case OperationType::SUB:
+        case OperationType::MUL:
+        case OperationType::DIV:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::string value_key(const Value& value) {
+    if (value.has_sequence_type())
+        return fmt::format("{}:{}", static_cast<int>(value.data_type_), std::string_view(*value.str_data(), value.len()));
+    return fmt::format("{}:{}", static_cast<int>(value.data_type_), std::string_view(value.data_, sizeof(value.data_)));
+}
+
+std::string node_name(const VariantNode& node) {
+    return util::variant_match(
+            node,
+            [](const std::monostate&) {
+                return std::string{};
+            },
+            [](const auto& name) {
+                return name.value;
+            });
+}
+
+/*
+ * Rebuilds the expressions of the FilterClauses and ProjectClauses in a query into new ExpressionContexts, in which:
+ * - Structurally identical sub-expressions have the same name, so that ProcessingUnit::get only computes them once per
+ *   processing unit, even if the QueryBuilder built them separately.
+ * - Arithmetic on constants is evaluated once here, rather than once per processing unit.
+ * - Sub-expressions that an earlier ProjectClause has already computed into a column are read from that column.
+ * Names are consistent across all of the clauses planned with the same instance, so the expressions of adjacent
+ * FilterClauses can be combined into a single ExpressionContext.
+ */
+class ExpressionPlanner {
+public:
+    // Adds the tree rooted at node in source to target, and returns the name of its root in target
+    VariantNode import(const VariantNode& node, const ExpressionContext& source, ExpressionContext& target, bool is_root) {
+        return util::variant_match(
+                node,
+                [](const std::monostate& monostate) -> VariantNode {
+                    return monostate;
+                },
+                [](const ColumnName& column_name) -> VariantNode {
+                    return column_name;
+                },
+                [&](const ValueName& value_name) -> VariantNode {
+                    auto value = source.values_.get_value(value_name.value);
+                    return add_value(value_name.value, std::move(value), target);
+                },
+                [&](const ValueSetName& value_set_name) -> VariantNode {
+                    // Value sets can be large, so they are only treated as the same if they are the same object
+                    auto value_set = source.value_sets_.get_value(value_set_name.value);
+                    auto name = canonical_name(value_set_name.value, fmt::format("S{}", fmt::ptr(value_set.get())));
+                    target.add_value_set(name, std::move(value_set));
+                    return ValueSetName(name);
+                },
+                [&](const RegexName& regex_name) -> VariantNode {
+                    auto regex = source.regex_matches_.get_value(regex_name.value);
+                    auto name = canonical_name(regex_name.value, fmt::format("R{}", fmt::ptr(regex.get())));
+                    target.add_regex(name, std::move(regex));
+                    return RegexName(name);
+                },
+                [&](const ExpressionName& expression_name) -> VariantNode {
+                    const auto& expression_node = *source.expression_nodes_.get_value(expression_name.value);
+                    auto condition = import(expression_node.condition_, source, target, false);
+                    auto left = import(expression_node.left_, source, target, false);
+                    auto right = import(expression_node.right_, source, target, false);
+                    const auto operation = expression_node.operation_type_;
+                    if (auto folded = fold(left, right, operation, target); folded.has_value())
+                        return add_value(expression_name.value, std::move(*folded), target);
+
+                    if (!is_root) {
+                        if (auto it = projected_columns_.find(expression_key(condition, left, right, operation));
+                            it != projected_columns_.end()) {
+                            return ColumnName(it->second.column_);
+                        }
+                    }
+                    return add_expression(expression_name.value, std::move(condition), std::move(left), std::move(right), operation, target);
+                });
+    }
+
+    VariantNode add_expression(
+            std::string_view name,
+            VariantNode condition,
+            VariantNode left,
+            VariantNode right,
+            OperationType operation,
+            ExpressionContext& target) {
+        auto key = expression_key(condition, left, right, operation);
+        auto canonical = canonical_name(name, key);
+        if (!expression_input_columns_.contains(canonical)) {
+            std::unordered_set<std::string> input_columns;
+            for (const auto* child: {&condition, &left, &right}) {
+                auto child_columns = columns_read(*child);
+                input_columns.insert(child_columns.begin(), child_columns.end());
+            }
+            expression_input_columns_.try_emplace(canonical, std::move(input_columns));
+            expression_keys_.try_emplace(canonical, std::move(key));
+        }
+        std::shared_ptr<ExpressionNode> expression_node;
+        if (is_ternary_operation(operation))
+            expression_node = std::make_shared<ExpressionNode>(std::move(condition), std::move(left), std::move(right), operation);
+        else if (is_binary_operation(operation))
+            expression_node = std::make_shared<ExpressionNode>(std::move(left), std::move(right), operation);
+        else
+            expression_node = std::make_shared<ExpressionNode>(std::move(left), operation);
+        target.add_expression_node(canonical, std::move(expression_node));
+        return ExpressionName(canonical);
+    }
+
+    [[nodiscard]] std::unordered_set<std::string> columns_read(const VariantNode& node) const {
+        if (const auto* column_name = std::get_if<ColumnName>(&node))
+            return {column_name->value};
+        if (const auto* expression_name = std::get_if<ExpressionName>(&node))
+            return expression_input_columns_.at(expression_name->value);
+        return {};
+    }
+
+    // Records that output_column now holds the result of root, which must already have been imported
+    void add_projection(const std::string& output_column, const VariantNode& root) {
+        std::erase_if(projected_columns_, [&output_column](const auto& key_and_projection) {
+            const auto& projection = key_and_projection.second;
+            return projection.column_ == output_column || projection.input_columns_.contains(output_column);
+        });
+        if (const auto* expression_name = std::get_if<ExpressionName>(&root)) {
+            const auto& input_columns = expression_input_columns_.at(expression_name->value);
+            // e.g. col = col * 2, after which the column no longer holds the result of the expression
+            if (!input_columns.contains(output_column))
+                projected_columns_.try_emplace(expression_keys_.at(expression_name->value), Projection{output_column, input_columns});
+        }
+    }
+
+    // Called at clauses other than FilterClause and ProjectClause, after which projected columns may have changed
+    void clear_projections() {
+        projected_columns_.clear();
+    }
+
+private:
+    struct Projection {
+        std::string column_;
+        std::unordered_set<std::string> input_columns_;
+    };
+
+    // Child names are length-prefixed, so that the key is unambiguous whatever characters the names contain
+    static std::string expression_key(
+            const VariantNode& condition,
+            const VariantNode& left,
+            const VariantNode& right,
+            OperationType operation) {
+        std::string key = fmt::format("E{}", static_cast<int>(operation));
+        for (const auto* child: {&condition, &left, &right}) {
+            const auto name = node_name(*child);
+            key += fmt::format("|{}:{}:{}", child->index(), name.size(), name);
+        }
+        return key;
+    }
+
+    VariantNode add_value(std::string_view name, std::shared_ptr<Value> value, ExpressionContext& target) {
+        auto canonical = canonical_name(name, fmt::format("V{}", value_key(*value)));
+        target.add_value(canonical, std::move(value));
+        return ValueName(canonical);
+    }
+
+    static std::optional<std::shared_ptr<Value>> fold(
+            const VariantNode& left,
+            const VariantNode& right,
+            OperationType operation,
+            const ExpressionContext& target) {
+        if (!is_foldable_operation(operation))
+            return std::nullopt;
+
+        // Leave other types to be rejected with the usual error when the clause is processed
+        auto numeric_value = [&target](const VariantNode& node) -> std::shared_ptr<Value> {
+            const auto* value_name = std::get_if<ValueName>(&node);
+            if (value_name == nullptr)
+                return nullptr;
+            auto value = target.values_.get_value(value_name->value);
+            return is_numeric_type(value->data_type_) ? value : nullptr;
+        };
+        auto left_value = numeric_value(left);
+        if (!left_value)
+            return std::nullopt;
+
+        VariantData result;
+        if (is_binary_operation(operation)) {
+            auto right_value = numeric_value(right);
+            if (!right_value)
+                return std::nullopt;
+            result = dispatch_binary(VariantData{std::move(left_value)}, VariantData{std::move(right_value)}, operation);
+        } else {
+            result = dispatch_unary(VariantData{std::move(left_value)}, operation);
+        }
+        if (auto* value = std::get_if<std::shared_ptr<Value>>(&result))
+            return std::move(*value);
+        return std::nullopt;
+    }
+
+    // The name used in the new ExpressionContexts for the node identified by key. The name it had in the QueryBuilder
+    // is kept where possible, as it is shown when the clauses are printed
+    std::string canonical_name(std::string_view name, const std::string& key) {
+        if (auto it = key_names_.find(key); it != key_names_.end())
+            return it->second;
+
+        std::string canonical{name};
+        for (size_t suffix = 1; used_names_.contains(canonical); ++suffix)
+            canonical = fmt::format("{}#{}", name, suffix);
+        used_names_.insert(canonical);
+        key_names_.try_emplace(key, canonical);
+        return canonical;
+    }
+
+    std::unordered_map<std::string, std::string> key_names_;
+    std::unordered_set<std::string> used_names_;
+    std::unordered_map<std::string, std::string> expression_keys_;
+    std::unordered_map<std::string, std::unordered_set<std::string>> expression_input_columns_;
+    // From the key of an expression to the column an earlier ProjectClause wrote its result to
+    std::unordered_map<std::string, Projection> projected_columns_;
+};
+
+std::shared_ptr<FilterClause> plan_filter(ExpressionPlanner& planner, const FilterClause& clause) {
+    ExpressionContext expression_context;
+    expression_context.root_node_name_ = planner.import(clause.root_node_name_, *clause.expression_context_, expression_context, true);
+    auto input_columns = planner.columns_read(expression_context.root_node_name_);
+    return std::make_shared<FilterClause>(std::move(input_columns), std::move(expression_context), clause.optimisation_);
+}
+
+std::shared_ptr<ProjectClause> plan_projection(ExpressionPlanner& planner, const ProjectClause& clause) {
+    ExpressionContext expression_context;
+    expression_context.root_node_name_ = planner.import(clause.expression_context_->root_node_name_, *clause.expression_context_, expression_context, true);
+    auto input_columns = planner.columns_read(expression_context.root_node_name_);
+    planner.add_projection(clause.output_column_, expression_context.root_node_name_);
+    return std::make_shared<ProjectClause>(std::move(input_columns), clause.output_column_, std::move(expression_context));
+}
+
+// Two filters applied one after the other keep the same rows as the AND of the two applied once. Evaluating them
+// together saves gathering and filtering every processing unit twice, and sub-expressions common to both are only
+// computed once
+std::shared_ptr<FilterClause> merge_filters(ExpressionPlanner& planner, const FilterClause& first, const FilterClause& second) {
+    ExpressionContext expression_context;
+    auto left = planner.import(first.root_node_name_, *first.expression_context_, expression_context, true);
+    auto right = planner.import(second.root_node_name_, *second.expression_context_, expression_context, true);
+    auto name = fmt::format("({} {} {})", node_name(left), OperationType::AND, node_name(right));
+    expression_context.root_node_name_ = planner.add_expression(name, std::monostate{}, std::move(left), std::move(right), OperationType::AND, expression_context);
+    auto input_columns = planner.columns_read(expression_context.root_node_name_);
+    return std::make_shared<FilterClause>(std::move(input_columns), std::move(expression_context), first.optimisation_);
+}
+
+// Rebuilds the FilterClauses and ProjectClauses. New clauses are created rather than modifying the ones provided, as
+// the same clauses are used again if the QueryBuilder is reused
+void plan_expressions(std::vector<ClauseVariant>& clauses, ExpressionPlanner& planner) {
+    for (auto& clause: clauses) {
+        util::variant_match(
+                clause,
+                [&planner, &clause](const std::shared_ptr<FilterClause>& filter_clause) {
+                    clause = plan_filter(planner, *filter_clause);
+                },
+                [&planner, &clause](const std::shared_ptr<ProjectClause>& project_clause) {
+                    clause = plan_projection(planner, *project_clause);
+                },
+                [&planner](const auto&) {
+                    planner.clear_projections();
+                });
+    }
+}
+
+// Moves each FilterClause ahead of earlier ProjectClauses that produce columns it does not read, so that the projections
+// are only computed for the rows that pass the filter. Filters can be reordered freely, so it may also move ahead of
+// other FilterClauses on the way. A FilterClause that reads an earlier projection, including one substituted for a
+// common sub-expression above, stays after it
+void push_down_filters(std::vector<ClauseVariant>& clauses) {
+    for (size_t idx = 1; idx < clauses.size(); ++idx) {
+        const auto* filter_clause = std::get_if<std::shared_ptr<FilterClause>>(&clauses[idx]);
+        if (filter_clause == nullptr)
+            continue;
+
+        const auto& input_columns = *(*filter_clause)->clause_info_.input_columns_;
+        std::optional<size_t> target;
+        for (size_t pos = idx; pos > 0; --pos) {
+            if (std::holds_alternative<std::shared_ptr<FilterClause>>(clauses[pos - 1]))
+                continue;
+
+            const auto* project_clause = std::get_if<std::shared_ptr<ProjectClause>>(&clauses[pos - 1]);
+            if (project_clause == nullptr || input_columns.contains((*project_clause)->output_column_))
+                break;
+
+            target = pos - 1;
+        }
+        if (target.has_value())
+            std::rotate(clauses.begin() + *target, clauses.begin() + idx, clauses.begin() + idx + 1);
+    }
+}
+
+void merge_adjacent_filters(std::vector<ClauseVariant>& clauses, ExpressionPlanner& planner) {
+    std::vector<ClauseVariant> merged;
+    merged.reserve(clauses.size());
+    for (auto& clause: clauses) {
+        auto* filter_clause = std::get_if<std::shared_ptr<FilterClause>>(&clause);
+        auto* previous_filter_clause = merged.empty() ? nullptr : std::get_if<std::shared_ptr<FilterClause>>(&merged.back());
+        if (filter_clause != nullptr && previous_filter_clause != nullptr)
+            *previous_filter_clause = merge_filters(planner, **previous_filter_clause, **filter_clause);
+        else
+            merged.emplace_back(std::move(clause));
+    }
+    clauses = std::move(merged);
+}
+
+} // namespace
+
 std::vector<ClauseVariant> plan_query(std::vector<ClauseVariant>&& clauses) {
     if (clauses.size() >= 2 && std::holds_alternative<std::shared_ptr<DateRangeClause>>(clauses[0])) {
         util::variant_match(
@@ -23,6 +343,12 @@ std::vector<ClauseVariant> plan_query(std::vector<ClauseVariant>&& clauses) {
                     }
                 });
     }
+    ExpressionPlanner planner;
+    plan_expressions(clauses, planner);
+    push_down_filters(clauses);
+    // The filters have been moved, so the projections recorded while planning the expressions no longer apply
+    planner.clear_projections();
+    merge_adjacent_filters(clauses, planner);
     return clauses;
 }
 
@@ -5,19 +5,46 @@
  * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
  */
 
+#include <arcticdb/async/task_scheduler.hpp>
 #include <arcticdb/column_store/string_pool.hpp>
 #include <arcticdb/processing/aggregation_utils.hpp>
 #include <arcticdb/processing/sorted_aggregation.hpp>
+#include <arcticdb/util/configs_map.hpp>
 
 namespace arcticdb {
 
+std::vector<size_t> get_row_slice_groups(const std::vector<std::shared_ptr<Column>>& input_index_columns) {
+    const auto configured_group_rows = ConfigsMap::instance()->get_int("Resample.RowSliceGroupRows", 2'000'000);
+    if (configured_group_rows <= 0 || input_index_columns.size() < 2)
+        return {input_index_columns.size()};
+
+    size_t total_rows = 0;
+    for (const auto& index_column : input_index_columns)
+        total_rows += static_cast<size_t>(index_column->row_count());
+
+    const auto max_groups = std::max(async::TaskScheduler::instance()->cpu_thread_count(), size_t{1});
+    const auto group_rows = std::max({static_cast<size_t>(configured_group_rows), total_rows / max_groups, size_t{1}});
+    std::vector<size_t> group_ends;
+    size_t group_total = 0;
+    for (size_t row_slice = 0; row_slice < input_index_columns.size(); ++row_slice) {
+        group_total += static_cast<size_t>(input_index_columns[row_slice]->row_count());
+        if (group_total >= group_rows) {
+            group_ends.emplace_back(row_slice + 1);
+            group_total = 0;
+        }
+    }
+    if (group_ends.empty() || group_ends.back() != input_index_columns.size())
+        group_ends.emplace_back(input_index_columns.size());
+
+    return group_ends;
+}
+
 template<AggregationOperator aggregation_operator, ResampleBoundary closed_boundary>
 Column SortedAggregator<aggregation_operator, closed_boundary>::aggregate(const std::vector<std::shared_ptr<Column>>& input_index_columns,
                                                                           const std::vector<std::optional<ColumnWithStrings>>& input_agg_columns,
                                                                           const std::vector<timestamp>& bucket_boundaries,
                                                                           const Column& output_index_column,
                                                                           StringPool& string_pool) const {
-    using IndexTDT = ScalarTagType<DataTypeTag<DataType::NANOSECONDS_UTC64>>;
     auto common_input_type = generate_common_input_type(input_agg_columns);
     Column res(TypeDescriptor(generate_output_data_type(common_input_type), Dimension::Dim0), output_index_column.row_count(), AllocationType::PRESIZED, Sparsity::NOT_PERMITTED);
     details::visit_type(
@@ -39,92 +66,88 @@ Column SortedAggregator<aggregation_operator, closed_boundary>::aggregate(const
                                                                (aggregation_operator == AggregationOperator::FIRST ||
                                                                 aggregation_operator == AggregationOperator::LAST));
             if constexpr (supported_aggregation_type_combo) {
-                auto bucket_aggregator = get_bucket_aggregator<output_type_info>();
-                bool reached_end_of_buckets{false};
-                auto bucket_start_it = bucket_boundaries.cbegin();
-                auto bucket_end_it = std::next(bucket_start_it);
-                Bucket<closed_boundary> current_bucket(*bucket_start_it, *bucket_end_it);
-                bool bucket_has_values{false};
-                const auto bucket_boundaries_end = bucket_boundaries.cend();
-                for (auto [idx, input_agg_column]: folly::enumerate(input_agg_columns)) {
-                    // Always true right now due to earlier check
-                    if (input_agg_column.has_value()) {
-                        details::visit_type(
-                            input_agg_column->column_->type().data_type(),
-                            [this,
-                            &output_it,
-                            &output_end_it,
-                            &bucket_aggregator,
-                            &agg_column = *input_agg_column,
-                            &input_index_column = input_index_columns.at(idx),
-                            &bucket_boundaries_end,
-                            &string_pool,
-                            &bucket_start_it,
-                            &bucket_end_it,
-                            &current_bucket,
-                            &bucket_has_values,
-                            &reached_end_of_buckets](auto input_type_desc_tag) {
-                                using input_type_info = ScalarTypeInfo<decltype(input_type_desc_tag)>;
-                                // Again, only needed to generate valid code below, exception will have been thrown earlier at runtime
-                                if constexpr ((is_numeric_type(input_type_info::data_type) && is_numeric_type(output_type_info::data_type)) ||
-                                              (is_sequence_type(input_type_info::data_type) && (is_sequence_type(output_type_info::data_type) || aggregation_operator == AggregationOperator::COUNT)) ||
-                                              (is_bool_type(input_type_info::data_type) && (is_bool_type(output_type_info::data_type) || is_numeric_type(output_type_info::data_type)))) {
-                                    schema::check<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
-                                            !agg_column.column_->is_sparse() && agg_column.column_->row_count() == input_index_column->row_count(),
-                                            "Resample: Cannot aggregate column '{}' as it is sparse",
-                                            get_input_column_name().value);
-                                    auto index_data = input_index_column->data();
-                                    const auto index_cend = index_data.template cend<IndexTDT>();
-                                    auto agg_data = agg_column.column_->data();
-                                    auto agg_it = agg_data.template cbegin<typename input_type_info::TDT>();
-                                    for (auto index_it = index_data.template cbegin<IndexTDT>(); index_it != index_cend && !reached_end_of_buckets; ++index_it, ++agg_it) {
-                                        if (ARCTICDB_LIKELY(current_bucket.contains(*index_it))) {
-                                            push_to_aggregator<input_type_info::data_type>(bucket_aggregator, *agg_it, agg_column);
-                                            bucket_has_values = true;
-                                        } else if (ARCTICDB_LIKELY(index_value_past_end_of_bucket(*index_it, *bucket_end_it)) && output_it != output_end_it) {
-                                            if (bucket_has_values) {
-                                                *output_it++ = finalize_aggregator<output_type_info::data_type>(bucket_aggregator, string_pool);
-                                            }
-                                            // The following code is equivalent to:
-                                            // if constexpr (closed_boundary == ResampleBoundary::LEFT) {
-                                            //     bucket_end_it = std::upper_bound(bucket_end_it, bucket_boundaries_end, *index_it);
-                                            // } else {
-                                            //     bucket_end_it = std::upper_bound(bucket_end_it, bucket_boundaries_end, *index_it, std::less_equal{});
-                                            // }
-                                            // bucket_start_it = std::prev(bucket_end_it);
-                                            // reached_end_of_buckets = bucket_end_it == bucket_boundaries_end;
-                                            // The above code will be more performant when the vast majority of buckets are empty
-                                            // See comment in  ResampleClause::advance_boundary_past_value for mathematical and experimental bounds
-                                            ++bucket_start_it;
-                                            if (ARCTICDB_UNLIKELY(++bucket_end_it == bucket_boundaries_end)) {
-                                                reached_end_of_buckets = true;
-                                            } else {
-                                                while (ARCTICDB_UNLIKELY(index_value_past_end_of_bucket(*index_it, *bucket_end_it))) {
-                                                    ++bucket_start_it;
-                                                    if (ARCTICDB_UNLIKELY(++bucket_end_it == bucket_boundaries_end)) {
-                                                        reached_end_of_buckets = true;
-                                                        break;
-                                                    }
-                                                }
-                                            }
-                                            if (ARCTICDB_LIKELY(!reached_end_of_buckets)) {
-                                                bucket_has_values = false;
-                                                current_bucket.set_boundaries(*bucket_start_it, *bucket_end_it);
-                                                if (ARCTICDB_LIKELY(current_bucket.contains(*index_it))) {
-                                                    push_to_aggregator<input_type_info::data_type>(bucket_aggregator, *agg_it, agg_column);
-                                                    bucket_has_values = true;
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
+                using BucketAggregator = decltype(get_bucket_aggregator<output_type_info>());
+                const auto row_slice_groups = get_row_slice_groups(input_index_columns);
+                if (row_slice_groups.size() == 1) {
+                    auto bucket_aggregator = get_bucket_aggregator<output_type_info>();
+                    aggregate_row_slices<output_type_info>(
+                        input_index_columns,
+                        input_agg_columns,
+                        0,
+                        input_agg_columns.size(),
+                        bucket_boundaries,
+                        std::next(bucket_boundaries.cbegin()),
+                        bucket_aggregator,
+                        [this, &output_it, &output_end_it, &string_pool](size_t, BucketAggregator& aggregator) {
+                            if (output_it == output_end_it) {
+                                return false;
                             }
-                        );
+                            *output_it++ = finalize_aggregator<output_type_info::data_type>(aggregator, string_pool);
+                            return true;
+                        });
+                    // We were in the middle of aggregating a bucket when we ran out of index values
+                    if (output_it != output_end_it) {
+                        *output_it++ = finalize_aggregator<output_type_info::data_type>(bucket_aggregator, string_pool);
+                    }
+                } else {
+                    // Each group of row slices is aggregated on its own thread into the states of the buckets it has
+                    // values for. Only the first and last buckets of a group can also have values in the neighbouring
+                    // groups, and their states are merged before all of the buckets are finalized in order.
+                    struct BucketState {
+                        size_t bucket_;
+                        BucketAggregator aggregator_;
+                    };
+                    std::vector<std::vector<BucketState>> group_bucket_states(row_slice_groups.size());
+                    async::run_groups_on_cpu_pool(row_slice_groups.size(), [this, &input_index_columns, &input_agg_columns, &bucket_boundaries, &row_slice_groups, &group_bucket_states](size_t group) {
+                        const size_t first_row_slice = group == 0 ? 0 : row_slice_groups[group - 1];
+                        auto bucket_end_it = std::next(bucket_boundaries.cbegin());
+                        if (group > 0) {
+                            bucket_end_it = first_bucket_end(bucket_boundaries, *input_index_columns[first_row_slice]);
+                            if (bucket_end_it == bucket_boundaries.cend()) {
+                                return;
+                            }
+                        }
+                        auto& bucket_states = group_bucket_states[group];
+                        auto bucket_aggregator = get_bucket_aggregator<output_type_info>();
+                        const auto last_bucket = aggregate_row_slices<output_type_info>(
+                            input_index_columns,
+                            input_agg_columns,
+                            first_row_slice,
+                            row_slice_groups[group],
+                            bucket_boundaries,
+                            bucket_end_it,
+                            bucket_aggregator,
+                            [this, &bucket_states](size_t bucket, BucketAggregator& aggregator) {
+                                bucket_states.emplace_back(BucketState{bucket, std::exchange(aggregator, get_bucket_aggregator<output_type_info>())});
+                                return true;
+                            });
+                        if (last_bucket.has_value()) {
+                            bucket_states.emplace_back(BucketState{*last_bucket, std::move(bucket_aggregator)});
+                        }
+                    });
+
+                    std::optional<BucketState> pending;
+                    for (auto& bucket_states : group_bucket_states) {
+                        for (auto& bucket_state : bucket_states) {
+                            if (pending.has_value() && pending->bucket_ == bucket_state.bucket_) {
+                                pending->aggregator_.merge(bucket_state.aggregator_);
+                                continue;
+                            }
+                            if (pending.has_value() && output_it != output_end_it) {
+                                *output_it++ = finalize_aggregator<output_type_info::data_type>(pending->aggregator_, string_pool);
+                            }
+                            pending.emplace(std::move(bucket_state));
+                        }
+                    }
+                    if (pending.has_value() && output_it != output_end_it) {
+                        *output_it++ = finalize_aggregator<output_type_info::data_type>(pending->aggregator_, string_pool);
+                    }
+                    // As above, finalize the bucket that was being aggregated when the index values ran out, which
+                    // only reaches here if it has no values
+                    if (output_it != output_end_it) {
+                        auto bucket_aggregator = get_bucket_aggregator<output_type_info>();
+                        *output_it++ = finalize_aggregator<output_type_info::data_type>(bucket_aggregator, string_pool);
                     }
-                }
-                // We were in the middle of aggregating a bucket when we ran out of index values
-                if (output_it != output_end_it) {
-                    *output_it++ = finalize_aggregator<output_type_info::data_type>(bucket_aggregator, string_pool);
                 }
             }
         }
@@ -132,6 +155,127 @@ Column SortedAggregator<aggregation_operator, closed_boundary>::aggregate(const
     return res;
 }
 
+template<AggregationOperator aggregation_operator, ResampleBoundary closed_boundary>
+template<typename output_type_info, typename BucketAggregator, typename OnBucketEnd>
+std::optional<size_t> SortedAggregator<aggregation_operator, closed_boundary>::aggregate_row_slices(
+        const std::vector<std::shared_ptr<Column>>& input_index_columns,
+        const std::vector<std::optional<ColumnWithStrings>>& input_agg_columns,
+        size_t first_row_slice,
+        size_t end_row_slice,
+        const std::vector<timestamp>& bucket_boundaries,
+        std::vector<timestamp>::const_iterator bucket_end_it,
+        BucketAggregator& bucket_aggregator,
+        OnBucketEnd&& on_bucket_end) const {
+    using IndexTDT = ScalarTagType<DataTypeTag<DataType::NANOSECONDS_UTC64>>;
+    bool reached_end_of_buckets{false};
+    auto bucket_start_it = std::prev(bucket_end_it);
+    Bucket<closed_boundary> current_bucket(*bucket_start_it, *bucket_end_it);
+    bool bucket_has_values{false};
+    const auto bucket_boundaries_end = bucket_boundaries.cend();
+    for (auto idx = first_row_slice; idx < end_row_slice && !reached_end_of_buckets; ++idx) {
+        const auto& input_agg_column = input_agg_columns[idx];
+        // Always true right now due to earlier check
+        if (input_agg_column.has_value()) {
+            details::visit_type(
+                input_agg_column->column_->type().data_type(),
+                [this,
+                &bucket_aggregator,
+                &on_bucket_end,
+                &agg_column = *input_agg_column,
+                &input_index_column = input_index_columns.at(idx),
+                &bucket_boundaries,
+                &bucket_boundaries_end,
+                &bucket_start_it,
+                &bucket_end_it,
+                &current_bucket,
+                &bucket_has_values,
+                &reached_end_of_buckets](auto input_type_desc_tag) {
+                    using input_type_info = ScalarTypeInfo<decltype(input_type_desc_tag)>;
+                    // Again, only needed to generate valid code below, exception will have been thrown earlier at runtime
+                    if constexpr ((is_numeric_type(input_type_info::data_type) && is_numeric_type(output_type_info::data_type)) ||
+                                  (is_sequence_type(input_type_info::data_type) && (is_sequence_type(output_type_info::data_type) || aggregation_operator == AggregationOperator::COUNT)) ||
+                                  (is_bool_type(input_type_info::data_type) && (is_bool_type(output_type_info::data_type) || is_numeric_type(output_type_info::data_type)))) {
+                        schema::check<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
+                                !agg_column.column_->is_sparse() && agg_column.column_->row_count() == input_index_column->row_count(),
+                                "Resample: Cannot aggregate column '{}' as it is sparse",
+                                get_input_column_name().value);
+                        auto index_data = input_index_column->data();
+                        const auto index_cend = index_data.template cend<IndexTDT>();
+                        auto agg_data = agg_column.column_->data();
+                        auto agg_it = agg_data.template cbegin<typename input_type_info::TDT>();
+                        for (auto index_it = index_data.template cbegin<IndexTDT>(); index_it != index_cend && !reached_end_of_buckets; ++index_it, ++agg_it) {
+                            if (ARCTICDB_LIKELY(current_bucket.contains(*index_it))) {
+                                push_to_aggregator<input_type_info::data_type>(bucket_aggregator, *agg_it, agg_column);
+                                bucket_has_values = true;
+                            } else if (ARCTICDB_LIKELY(index_value_past_end_of_bucket(*index_it, *bucket_end_it))) {
+                                if (bucket_has_values) {
+                                    const auto bucket = static_cast<size_t>(std::distance(bucket_boundaries.cbegin(), bucket_start_it));
+                                    if (ARCTICDB_UNLIKELY(!on_bucket_end(bucket, bucket_aggregator))) {
+                                        // No more buckets are wanted
+                                        reached_end_of_buckets = true;
+                                        break;
+                                    }
+                                }
+                                // The following code is equivalent to:
+                                // if constexpr (closed_boundary == ResampleBoundary::LEFT) {
+                                //     bucket_end_it = std::upper_bound(bucket_end_it, bucket_boundaries_end, *index_it);
+                                // } else {
+                                //     bucket_end_it = std::upper_bound(bucket_end_it, bucket_boundaries_end, *index_it, std::less_equal{});
+                                // }
+                                // bucket_start_it = std::prev(bucket_end_it);
+                                // reached_end_of_buckets = bucket_end_it == bucket_boundaries_end;
+                                // The above code will be more performant when the vast majority of buckets are empty
+                                // See comment in  ResampleClause::advance_boundary_past_value for mathematical and experimental bounds
+                                ++bucket_start_it;
+                                if (ARCTICDB_UNLIKELY(++bucket_end_it == bucket_boundaries_end)) {
+                                    reached_end_of_buckets = true;
+                                } else {
+                                    while (ARCTICDB_UNLIKELY(index_value_past_end_of_bucket(*index_it, *bucket_end_it))) {
+                                        ++bucket_start_it;
+                                        if (ARCTICDB_UNLIKELY(++bucket_end_it == bucket_boundaries_end)) {
+                                            reached_end_of_buckets = true;
+                                            break;
+                                        }
+                                    }
+                                }
+                                if (ARCTICDB_LIKELY(!reached_end_of_buckets)) {
+                                    bucket_has_values = false;
+                                    current_bucket.set_boundaries(*bucket_start_it, *bucket_end_it);
+                                    if (ARCTICDB_LIKELY(current_bucket.contains(*index_it))) {
+                                        push_to_aggregator<input_type_info::data_type>(bucket_aggregator, *agg_it, agg_column);
+                                        bucket_has_values = true;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            );
+        }
+    }
+    if (reached_end_of_buckets || !bucket_has_values) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(std::distance(bucket_boundaries.cbegin(), bucket_start_it));
+}
+
+template<AggregationOperator aggregation_operator, ResampleBoundary closed_boundary>
+std::vector<timestamp>::const_iterator SortedAggregator<aggregation_operator, closed_boundary>::first_bucket_end(
+        const std::vector<timestamp>& bucket_boundaries,
+        const Column& input_index_column) const {
+    const auto first_bucket_end_it = std::next(bucket_boundaries.cbegin());
+    if (input_index_column.row_count() == 0) {
+        return first_bucket_end_it;
+    }
+    const auto first_index_value = input_index_column.template scalar_at<timestamp>(0).value();
+    if constexpr (closed_boundary == ResampleBoundary::LEFT) {
+        return std::upper_bound(first_bucket_end_it, bucket_boundaries.cend(), first_index_value);
+    } else {
+        // closed_boundary == ResampleBoundary::RIGHT
+        return std::lower_bound(first_bucket_end_it, bucket_boundaries.cend(), first_index_value);
+    }
+}
+
 template<AggregationOperator aggregation_operator, ResampleBoundary closed_boundary>
 DataType SortedAggregator<aggregation_operator, closed_boundary>::generate_common_input_type(
         const std::vector<std::optional<ColumnWithStrings>>& input_agg_columns
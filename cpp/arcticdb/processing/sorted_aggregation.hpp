@@ -93,6 +93,11 @@ public:
         }
     }
 
+    // Merges in the state of an aggregator that was pushed the values following those pushed to this one
+    void merge(const SumAggregatorSorted& other) {
+        sum_ += other.sum_;
+    }
+
     T finalize() {
         T res{sum_};
         sum_ = 0;
@@ -122,6 +127,11 @@ public:
         }
     }
 
+    void merge(const MeanAggregatorSorted& other) {
+        sum_ += other.sum_;
+        count_ += other.count_;
+    }
+
     std::conditional_t<TimeType, timestamp, double> finalize() {
         if constexpr (std::is_same_v<T, timestamp> && TimeType) {
             timestamp res;
@@ -173,6 +183,16 @@ public:
         }
     }
 
+    void merge(const MinAggregatorSorted& other) {
+        if constexpr (std::is_floating_point_v<T> || TimeType) {
+            if (other.min_.has_value()) {
+                push(*other.min_);
+            }
+        } else {
+            push(other.min_);
+        }
+    }
+
     T finalize() {
         T res;
         if constexpr (std::is_floating_point_v<T>) {
@@ -215,6 +235,16 @@ public:
         }
     }
 
+    void merge(const MaxAggregatorSorted& other) {
+        if constexpr (std::is_floating_point_v<T> || TimeType) {
+            if (other.max_.has_value()) {
+                push(*other.max_);
+            }
+        } else {
+            push(other.max_);
+        }
+    }
+
     T finalize() {
         T res;
         if constexpr (std::is_floating_point_v<T>) {
@@ -257,6 +287,13 @@ public:
         }
     }
 
+    // push only replaces a missing value, so this keeps the first value unless all of the values pushed here were missing
+    void merge(const FirstAggregatorSorted& other) {
+        if (other.first_.has_value()) {
+            push(*other.first_);
+        }
+    }
+
     T finalize() {
         T res;
         if constexpr (std::is_floating_point_v<T>) {
@@ -295,6 +332,14 @@ public:
         }
     }
 
+    // push does not replace a value with a missing one, so this keeps the last value unless all of the values pushed
+    // to other were missing
+    void merge(const LastAggregatorSorted& other) {
+        if (other.last_.has_value()) {
+            push(*other.last_);
+        }
+    }
+
     T finalize() {
         T res;
         if constexpr (std::is_floating_point_v<T>) {
@@ -333,6 +378,10 @@ public:
         }
     }
 
+    void merge(const CountAggregatorSorted& other) {
+        count_ += other.count_;
+    }
+
     uint64_t finalize() {
         uint64_t res{count_};
         count_ = 0;
@@ -342,6 +391,10 @@ private:
     uint64_t count_{0};
 };
 
+// Splits the row slices being resampled into consecutive groups each containing at least Resample.RowSliceGroupRows
+// rows, with no more groups than there are CPU threads. Returns the index one past the last row slice of each group.
+std::vector<size_t> get_row_slice_groups(const std::vector<std::shared_ptr<Column>>& input_index_columns);
+
 template<AggregationOperator aggregation_operator, ResampleBoundary closed_boundary>
 class SortedAggregator
 {
@@ -368,6 +421,24 @@ private:
     [[nodiscard]] DataType generate_common_input_type(const std::vector<std::optional<ColumnWithStrings>>& input_agg_columns) const;
     [[nodiscard]] bool index_value_past_end_of_bucket(timestamp index_value, timestamp bucket_end) const;
 
+    // Pushes the values in the given row slices to bucket_aggregator, starting from the bucket ending at bucket_end_it.
+    // on_bucket_end(bucket, bucket_aggregator) is called with the index of each bucket that has values once a later
+    // value is reached, and returns false if no more buckets are wanted. Returns the index of the bucket that
+    // bucket_aggregator still holds values for, if any.
+    template<typename output_type_info, typename BucketAggregator, typename OnBucketEnd>
+    std::optional<size_t> aggregate_row_slices(const std::vector<std::shared_ptr<Column>>& input_index_columns,
+                                               const std::vector<std::optional<ColumnWithStrings>>& input_agg_columns,
+                                               size_t first_row_slice,
+                                               size_t end_row_slice,
+                                               const std::vector<timestamp>& bucket_boundaries,
+                                               std::vector<timestamp>::const_iterator bucket_end_it,
+                                               BucketAggregator& bucket_aggregator,
+                                               OnBucketEnd&& on_bucket_end) const;
+
+    // The end of the first bucket that the first value in input_index_column could be in
+    [[nodiscard]] std::vector<timestamp>::const_iterator first_bucket_end(const std::vector<timestamp>& bucket_boundaries,
+                                                                          const Column& input_index_column) const;
+
     template<DataType input_data_type, typename Aggregator, typename T>
     void push_to_aggregator(Aggregator& bucket_aggregator, T value, ARCTICDB_UNUSED const ColumnWithStrings& column_with_strings) const {
         if constexpr(is_time_type(input_data_type) && aggregation_operator == AggregationOperator::COUNT) {
@@ -6,6 +6,8 @@
  */
 #include <arcticdb/processing/test/benchmark_common.hpp>
 #include <arcticdb/processing/operation_dispatch_binary.hpp>
+#include <arcticdb/util/bitset_packing.hpp>
+#include <arcticdb/util/simd_dispatch.hpp>
 #include <arcticdb/util/regex_filter.hpp>
 
 using namespace arcticdb;
@@ -25,4 +27,111 @@ BENCHMARK(BM_regex_match)
         ->Args({100'000, 1'000, true})
         ->Args({100'000, 1'000, false})
         ->Args({100'000, 10'000, true})
-        ->Args({100'000, 10'000, false});
\ No newline at end of file
+        ->Args({100'000, 10'000, false});
+
+// Caps the instruction set of the dense kernels at the level given by the third argument, so that each level can be
+// compared against the baseline build, and labels the benchmark with the level used
+static void set_simd_level(benchmark::State& state) {
+    util::_test_set_max_simd_level(static_cast<util::SimdLevel>(state.range(2)));
+    state.SetLabel(std::string(util::simd_level_name(util::simd_level())));
+}
+
+static void BM_compare_numeric_col_val(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    const auto left = state.range(1) ? generate_numeric_dense_column(num_rows) : generate_numeric_sparse_column(num_rows);
+    const auto right = construct_value<int64_t>(0);
+    set_simd_level(state);
+    for (auto _ : state) {
+        binary_comparator(left, right, LessThanOperator{});
+    }
+    util::_test_set_max_simd_level(std::nullopt);
+}
+
+static void BM_compare_numeric_col_col(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    const auto left = state.range(1) ? generate_numeric_dense_column(num_rows) : generate_numeric_sparse_column(num_rows);
+    const auto right = state.range(1) ? generate_numeric_dense_column(num_rows) : generate_numeric_sparse_column(num_rows);
+    set_simd_level(state);
+    for (auto _ : state) {
+        binary_comparator(left, right, LessThanOperator{});
+    }
+    util::_test_set_max_simd_level(std::nullopt);
+}
+
+static void BM_arithmetic_numeric_col_val(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    const auto left = state.range(1) ? generate_numeric_dense_column(num_rows) : generate_numeric_sparse_column(num_rows);
+    const auto right = generate_numeric_value();
+    set_simd_level(state);
+    for (auto _ : state) {
+        binary_operator(left, right, PlusOperator{});
+    }
+    util::_test_set_max_simd_level(std::nullopt);
+}
+
+static void BM_arithmetic_numeric_col_col(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    const auto left = state.range(1) ? generate_numeric_dense_column(num_rows) : generate_numeric_sparse_column(num_rows);
+    const auto right = state.range(1) ? generate_numeric_dense_column(num_rows) : generate_numeric_sparse_column(num_rows);
+    set_simd_level(state);
+    for (auto _ : state) {
+        binary_operator(left, right, PlusOperator{});
+    }
+    util::_test_set_max_simd_level(std::nullopt);
+}
+
+// Packing of comparison mask bytes into bitset words, against setting the bits one at a time as the sparse path does
+static void BM_pack_byte_mask(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    const bool packed = state.range(1);
+    const auto bits = generate_bitset(num_rows);
+    std::vector<uint8_t> mask(num_rows);
+    for (size_t idx = 0; idx < num_rows; ++idx) {
+        mask[idx] = static_cast<uint8_t>(bits.test(idx));
+    }
+    state.SetLabel(packed ? std::string(util::pack_byte_mask_implementation()) : "bulk_insert_iterator");
+    for (auto _ : state) {
+        util::BitSet bitset;
+        bitset.resize(num_rows);
+        if (packed) {
+            util::ByteMaskBitSetBuilder builder(bitset);
+            for (size_t pos = 0; pos < num_rows;) {
+                auto chunk = builder.next_chunk(num_rows - pos);
+                std::memcpy(chunk.data(), mask.data() + pos, chunk.size());
+                pos += chunk.size();
+            }
+            builder.flush();
+        } else {
+            util::BitSet::bulk_insert_iterator inserter(bitset);
+            for (size_t idx = 0; idx < num_rows; ++idx) {
+                if (mask[idx]) {
+                    inserter = idx;
+                }
+            }
+            inserter.flush();
+        }
+        benchmark::DoNotOptimize(bitset);
+    }
+}
+
+BENCHMARK(BM_compare_numeric_col_val)
+        ->ArgsProduct({{100'000, 1'000'000}, {true}, {0, 1, 2}})
+        ->ArgsProduct({{100'000, 1'000'000}, {false}, {2}});
+
+BENCHMARK(BM_compare_numeric_col_col)
+        ->ArgsProduct({{100'000, 1'000'000}, {true}, {0, 1, 2}})
+        ->ArgsProduct({{100'000, 1'000'000}, {false}, {2}});
+
+BENCHMARK(BM_arithmetic_numeric_col_val)
+        ->ArgsProduct({{100'000, 1'000'000}, {true}, {0, 1, 2}})
+        ->ArgsProduct({{100'000, 1'000'000}, {false}, {2}});
+
+BENCHMARK(BM_arithmetic_numeric_col_col)
+        ->ArgsProduct({{100'000, 1'000'000}, {true}, {0, 1, 2}})
+        ->ArgsProduct({{100'000, 1'000'000}, {false}, {2}});
+
+BENCHMARK(BM_pack_byte_mask)
+        ->Args({100'000, true})
+        ->Args({100'000, false})
+        ->Args({1'000'000, true})
+        ->Args({1'000'000, false});
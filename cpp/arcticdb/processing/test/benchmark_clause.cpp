@@ -10,6 +10,7 @@
 #include <benchmark/benchmark.h>
 
 #include <arcticdb/processing/clause.hpp>
+#include <arcticdb/processing/grouping_hash_table.hpp>
 #include <arcticdb/util/test/generators.hpp>
 #include <arcticdb/column_store/memory_segment.hpp>
 #include <folly/futures/Future.h>
@@ -19,16 +20,22 @@ using namespace arcticdb;
 
 // run like: --benchmark_time_unit=ms --benchmark_filter=.* --benchmark_min_time=5x
 
-SegmentInMemory get_segment_for_merge(const StreamId &id, size_t num_rows, size_t start, size_t step){
+SegmentInMemory get_segment_for_merge(const StreamId &id, size_t num_rows, size_t start, size_t step, size_t num_columns = 1){
+    std::vector<FieldRef> fields;
+    std::vector<std::string> column_names;
+    for (auto col = 0u; col < num_columns; ++col)
+        column_names.emplace_back("column_" + std::to_string(col));
+    for (const auto& name : column_names)
+        fields.emplace_back(scalar_field(DataType::UINT8, name));
     auto segment = SegmentInMemory{
-        get_test_descriptor<stream::TimeseriesIndex>(id, std::array{scalar_field(DataType::UINT8, "column")}),
+        get_test_descriptor<stream::TimeseriesIndex>(id, fields),
         num_rows
     };
     auto& index_col = segment.column(0);
-    auto& value_col = segment.column(1);
     for (auto i=0u; i<num_rows; ++i){
         index_col.push_back(static_cast<int64_t>(start + i*step));
-        value_col.push_back(static_cast<uint8_t>(i));
+        for (auto col = 0u; col < num_columns; ++col)
+            segment.column(static_cast<position_t>(col + 1)).push_back(static_cast<uint8_t>(i));
     }
     segment.set_row_data(num_rows-1);
     return segment;
@@ -40,28 +47,31 @@ void time_merge_on_segments(const std::vector<SegmentInMemory> &segments, benchm
     auto component_manager = std::make_shared<ComponentManager>();
     std::vector<EntityId> entity_ids;
     for (auto& segment : segments){
-        auto proc_unit = ProcessingUnit{segment.clone()};
+        auto proc_unit = ProcessingUnit{segment.clone(), RowRange{0, static_cast<size_t>(segment.row_count())}, ColRange{1, segment.descriptor().field_count()}};
         entity_ids.push_back(push_entities(*component_manager, std::move(proc_unit))[0]);
     }
 
     auto stream_id = StreamId("Merge");
-    StreamDescriptor descriptor{};
-    descriptor.add_field(FieldRef{make_scalar_type(DataType::NANOSECONDS_UTC64),"time"});
+    auto descriptor = segments.front().descriptor().clone();
+    descriptor.set_id(stream_id);
     MergeClause merge_clause{TimeseriesIndex{"time"}, DenseColumnPolicy{}, stream_id, descriptor, false};
     merge_clause.set_component_manager(component_manager);
+    std::vector<std::vector<EntityId>> entity_ids_vec{std::move(entity_ids)};
     state.ResumeTiming();
 
-    auto _ = merge_clause.process(std::move(entity_ids));
+    // The merge itself happens when structuring the input, process passes the merged segments straight through
+    auto _ = merge_clause.structure_for_processing(std::move(entity_ids_vec));
 }
 
 static void BM_merge_interleaved(benchmark::State& state){
     const auto num_segs = state.range(0);
     const auto num_rows = state.range(1);
+    const auto num_columns = state.range(2);
     std::vector<SegmentInMemory> segments;
     for (auto i = 0u; i<num_segs; ++i){
         auto id = "merge_" + std::to_string(i);
         // step size of [num_segs] guarantees the segments will merge completely interleaved
-        auto seg = get_segment_for_merge(id, num_rows, i, num_segs);
+        auto seg = get_segment_for_merge(id, num_rows, i, num_segs, num_columns);
         segments.emplace_back(std::move(seg));
     }
 
@@ -73,11 +83,12 @@ static void BM_merge_interleaved(benchmark::State& state){
 static void BM_merge_ordered(benchmark::State& state){
     const auto num_segs = state.range(0);
     const auto num_rows = state.range(1);
+    const auto num_columns = state.range(2);
     std::vector<SegmentInMemory> segments;
     for (auto i = 0u; i<num_segs; ++i){
         auto id = "merge_" + std::to_string(i);
-        // start of [i*num_segs] guarantees the segments will merge completely in order
-        auto seg = get_segment_for_merge(id, num_rows, i*num_segs, 1);
+        // start of [i*num_rows] guarantees the segments will merge completely in order
+        auto seg = get_segment_for_merge(id, num_rows, i*num_rows, 1, num_columns);
         segments.emplace_back(std::move(seg));
     }
 
@@ -126,6 +137,39 @@ void BM_hash_grouping_int(benchmark::State& state) {
     }
 }
 
+template<typename integer>
+requires std::integral<integer>
+void BM_grouping_hash_table_int(benchmark::State& state) {
+    auto num_rows = state.range(0);
+    auto num_unique_values = state.range(1);
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int64_t> dis(static_cast<int64_t>(std::numeric_limits<integer>::lowest()),
+                                               static_cast<int64_t>(std::numeric_limits<integer>::max()));
+    std::vector<integer> unique_values;
+    unique_values.reserve(num_unique_values);
+    for (auto idx = 0; idx < num_unique_values; ++idx) {
+        unique_values.emplace_back(static_cast<integer>(dis(gen)));
+    }
+
+    std::uniform_int_distribution<size_t> unique_values_dis(0, num_unique_values - 1);
+
+    std::vector<integer> data;
+    data.reserve(num_rows);
+    for(int idx = 0; idx < num_rows; ++idx) {
+        data.emplace_back(unique_values[unique_values_dis(gen)]);
+    }
+    std::vector<size_t> group_ids(num_rows);
+
+    for (auto _ : state) {
+        grouping::GroupingHashTable<integer> table;
+        size_t next_group_id = 0;
+        table.find_or_insert(data.data(), data.size(), group_ids.data(), [&next_group_id](integer) { return next_group_id++; });
+        benchmark::DoNotOptimize(group_ids.data());
+    }
+}
+
 void BM_hash_grouping_string(benchmark::State& state) {
     auto num_rows = state.range(0);
     auto num_unique_values = state.range(1);
@@ -167,12 +211,15 @@ void BM_hash_grouping_string(benchmark::State& state) {
     }
 }
 
-BENCHMARK(BM_merge_interleaved)->Args({10'000, 100});
-BENCHMARK(BM_merge_ordered)->Args({10'000, 100});
+BENCHMARK(BM_merge_interleaved)->Args({10'000, 100, 1})->Args({100, 10'000, 20});
+BENCHMARK(BM_merge_ordered)->Args({10'000, 100, 1})->Args({100, 10'000, 20});
 
 BENCHMARK(BM_hash_grouping_int<int8_t>)->Args({100'000, 10, 2});
 BENCHMARK(BM_hash_grouping_int<int16_t>)->Args({100'000, 10, 2})->Args({100'000, 10'000, 2});
 BENCHMARK(BM_hash_grouping_int<int32_t>)->Args({100'000, 10, 2})->Args({100'000, 100'000, 2});
 BENCHMARK(BM_hash_grouping_int<int64_t>)->Args({100'000, 10, 2})->Args({100'000, 100'000, 2});
 
+BENCHMARK(BM_grouping_hash_table_int<int32_t>)->Args({100'000, 10})->Args({100'000, 100'000});
+BENCHMARK(BM_grouping_hash_table_int<int64_t>)->Args({100'000, 10})->Args({100'000, 100'000});
+
 BENCHMARK(BM_hash_grouping_string)->Args({100'000, 10, 2, 10})->Args({100'000, 100'000, 2, 10})->Args({100'000, 10, 2, 100})->Args({100'000, 100'000, 2, 100});
@@ -0,0 +1,95 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <cmath>
+#include <numeric>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/processing/grouping_hash_table.hpp>
+
+using namespace arcticdb::grouping;
+
+TEST(GroupingHashTable, IntegersAcrossBatchesAndGrowth) {
+    // Enough distinct values to span several batches and force the table to grow from its initial capacity
+    constexpr size_t num_values = 10'000;
+    std::vector<int64_t> keys(num_values);
+    for (size_t i = 0; i < num_values; ++i)
+        keys[i] = static_cast<int64_t>((i * 7919) % 1'000) - 500;
+
+    GroupingHashTable<int64_t> table;
+    size_t next_group_id = 0;
+    std::vector<size_t> group_ids(num_values);
+    table.find_or_insert(keys.data(), keys.size(), group_ids.data(), [&next_group_id](int64_t) { return next_group_id++; });
+
+    ASSERT_EQ(table.size(), 1'000);
+    ASSERT_EQ(next_group_id, 1'000);
+    std::unordered_map<int64_t, size_t> expected;
+    for (size_t i = 0; i < num_values; ++i) {
+        auto [it, inserted] = expected.try_emplace(keys[i], expected.size());
+        ASSERT_EQ(group_ids[i], it->second);
+    }
+    // The keys are in group id order
+    for (size_t group = 0; group < table.size(); ++group)
+        ASSERT_EQ(expected.at(table.keys()[group]), group);
+}
+
+TEST(GroupingHashTable, SmallIntegerTypes) {
+    std::vector<uint8_t> keys(1'000);
+    std::iota(keys.begin(), keys.end(), 0);
+    GroupingHashTable<uint8_t> table;
+    size_t next_group_id = 0;
+    std::vector<size_t> group_ids(keys.size());
+    table.find_or_insert(keys.data(), keys.size(), group_ids.data(), [&next_group_id](uint8_t) { return next_group_id++; });
+    ASSERT_EQ(table.size(), 256);
+    for (size_t i = 0; i < keys.size(); ++i)
+        ASSERT_EQ(group_ids[i], i % 256);
+}
+
+TEST(GroupingHashTable, FloatingPoint) {
+    const std::vector<double> keys{0.0, -0.0, 1.5, NAN, 1.5, NAN};
+    GroupingHashTable<double> table;
+    size_t next_group_id = 0;
+    std::vector<size_t> group_ids(keys.size());
+    table.find_or_insert(keys.data(), keys.size(), group_ids.data(), [&next_group_id](double) { return next_group_id++; });
+    // Negative and positive zero are equal, and as with a std::unordered_map every NaN is in its own group
+    ASSERT_EQ(group_ids, (std::vector<size_t>{0, 0, 1, 2, 1, 3}));
+    ASSERT_EQ(table.size(), 4);
+    ASSERT_TRUE(std::isnan(table.keys()[3]));
+}
+
+TEST(GroupingHashTable, GroupIdsFromAnotherTable) {
+    // As for string columns, where each segment's offsets are looked up in a local table that falls back to a shared
+    // table keyed on something else
+    GroupingHashTable<uint64_t> shared;
+    size_t next_group_id = 1;
+    auto new_group = [&next_group_id](uint64_t) { return next_group_id++; };
+
+    const std::vector<uint64_t> first_offsets{10, 20, 10, 30};
+    const std::vector<uint64_t> second_offsets{5, 40, 5};
+    // Offset 5 in the second segment refers to the same value as offset 10 in the first
+    auto lookup = [&shared, &new_group](const std::vector<uint64_t>& offsets, uint64_t remap_from, uint64_t remap_to) {
+        GroupingHashTable<uint64_t> local;
+        size_t misses = 0;
+        std::vector<size_t> group_ids(offsets.size());
+        local.find_or_insert(offsets.data(), offsets.size(), group_ids.data(), [&](uint64_t offset) {
+            ++misses;
+            return shared.find_or_insert(offset == remap_from ? remap_to : offset, new_group);
+        });
+        return std::make_pair(group_ids, misses);
+    };
+
+    auto [first_groups, first_misses] = lookup(first_offsets, 0, 0);
+    ASSERT_EQ(first_groups, (std::vector<size_t>{1, 2, 1, 3}));
+    ASSERT_EQ(first_misses, 3);
+
+    auto [second_groups, second_misses] = lookup(second_offsets, 5, 10);
+    ASSERT_EQ(second_groups, (std::vector<size_t>{1, 4, 1}));
+    ASSERT_EQ(second_misses, 2);
+    ASSERT_EQ(shared.keys(), (std::vector<uint64_t>{10, 20, 30, 40}));
+}
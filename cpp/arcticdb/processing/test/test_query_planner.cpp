@@ -0,0 +1,166 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/processing/query_planner.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+// Builds (Column[column] op Num(value)), as the QueryBuilder would name it
+ExpressionName add_column_value_node(ExpressionContext& context, const std::string& column, int64_t value, OperationType op) {
+    auto value_name = fmt::format("Num({})", value);
+    auto name = fmt::format("(Column[\"{}\"] {} {})", column, op, value_name);
+    context.add_value(value_name, std::make_shared<Value>(value, DataType::INT64));
+    context.add_expression_node(name, std::make_shared<ExpressionNode>(ColumnName(column), ValueName(value_name), op));
+    return ExpressionName(name);
+}
+
+ExpressionName add_product_node(ExpressionContext& context, const std::string& name) {
+    context.add_expression_node(name, std::make_shared<ExpressionNode>(ColumnName("a"), ColumnName("b"), OperationType::MUL));
+    return ExpressionName(name);
+}
+
+std::shared_ptr<FilterClause> column_filter(const std::string& column, int64_t value, OperationType op) {
+    ExpressionContext context;
+    context.root_node_name_ = add_column_value_node(context, column, value, op);
+    return std::make_shared<FilterClause>(std::unordered_set<std::string>{column}, std::move(context), std::nullopt);
+}
+
+// Projects a * b into output_column
+std::shared_ptr<ProjectClause> product_projection(const std::string& output_column) {
+    ExpressionContext context;
+    context.root_node_name_ = add_product_node(context, "(Column[\"a\"] MUL Column[\"b\"])");
+    return std::make_shared<ProjectClause>(std::unordered_set<std::string>{"a", "b"}, output_column, std::move(context));
+}
+
+// Filters on a * b > 5
+std::shared_ptr<FilterClause> product_filter() {
+    ExpressionContext context;
+    auto product = add_product_node(context, "(Column[\"a\"] MUL Column[\"b\"])");
+    context.add_value("Num(5)", std::make_shared<Value>(int64_t{5}, DataType::INT64));
+    context.add_expression_node("product filter", std::make_shared<ExpressionNode>(product, ValueName("Num(5)"), OperationType::GT));
+    context.root_node_name_ = ExpressionName("product filter");
+    return std::make_shared<FilterClause>(std::unordered_set<std::string>{"a", "b"}, std::move(context), std::nullopt);
+}
+
+const ExpressionNode& root_node(const FilterClause& clause) {
+    return *clause.expression_context_->expression_nodes_.get_value(clause.root_node_name_.value);
+}
+
+} // namespace
+
+TEST(QueryPlanner, MergeAdjacentFilters) {
+    std::vector<ClauseVariant> clauses{
+        column_filter("a", 10, OperationType::LT),
+        column_filter("b", 2, OperationType::GT),
+        column_filter("a", 0, OperationType::NE)
+    };
+    auto planned = plan_query(std::move(clauses));
+    ASSERT_EQ(planned.size(), 1);
+    const auto& filter_clause = *std::get<std::shared_ptr<FilterClause>>(planned[0]);
+    ASSERT_EQ(*filter_clause.clause_info().input_columns_, (std::unordered_set<std::string>{"a", "b"}));
+    ASSERT_EQ(
+        filter_clause.root_node_name_.value,
+        "(((Column[\"a\"] LT Num(10)) AND (Column[\"b\"] GT Num(2))) AND (Column[\"a\"] NE Num(0)))");
+    const auto& root = root_node(filter_clause);
+    ASSERT_EQ(root.operation_type_, OperationType::AND);
+    ASSERT_EQ(std::get<ExpressionName>(root.right_).value, "(Column[\"a\"] NE Num(0))");
+}
+
+TEST(QueryPlanner, FoldConstants) {
+    // Column["a"] + (Num(1) + Num(2))
+    ExpressionContext context;
+    context.add_value("Num(1)", std::make_shared<Value>(int64_t{1}, DataType::INT64));
+    context.add_value("Num(2)", std::make_shared<Value>(int64_t{2}, DataType::INT64));
+    context.add_expression_node("constant", std::make_shared<ExpressionNode>(ValueName("Num(1)"), ValueName("Num(2)"), OperationType::ADD));
+    context.add_expression_node("sum", std::make_shared<ExpressionNode>(ColumnName("a"), ExpressionName("constant"), OperationType::ADD));
+    context.root_node_name_ = ExpressionName("sum");
+    std::vector<ClauseVariant> clauses{std::make_shared<ProjectClause>(std::unordered_set<std::string>{"a"}, "c", std::move(context))};
+
+    auto planned = plan_query(std::move(clauses));
+    const auto& project_clause = *std::get<std::shared_ptr<ProjectClause>>(planned[0]);
+    const auto& planned_context = *project_clause.expression_context_;
+    const auto& root = *planned_context.expression_nodes_.get_value("sum");
+    const auto& folded = std::get<ValueName>(root.right_);
+    const auto value = planned_context.values_.get_value(folded.value);
+    ASSERT_EQ(value->data_type_, DataType::INT64);
+    ASSERT_EQ(value->get<int64_t>(), 3);
+
+    // An expression that is entirely constant becomes a value
+    ExpressionContext constant_context;
+    constant_context.add_value("Num(2)", std::make_shared<Value>(int64_t{2}, DataType::INT64));
+    constant_context.add_expression_node("negated", std::make_shared<ExpressionNode>(ValueName("Num(2)"), OperationType::NEG));
+    constant_context.root_node_name_ = ExpressionName("negated");
+    clauses = {std::make_shared<ProjectClause>(std::unordered_set<std::string>{}, "d", std::move(constant_context))};
+    planned = plan_query(std::move(clauses));
+    const auto& constant_projection = *std::get<std::shared_ptr<ProjectClause>>(planned[0]);
+    const auto& root_value = std::get<ValueName>(constant_projection.expression_context_->root_node_name_);
+    ASSERT_EQ(constant_projection.expression_context_->values_.get_value(root_value.value)->get<int64_t>(), -2);
+}
+
+TEST(QueryPlanner, DeduplicateSubexpressions) {
+    // Column["a"] * Column["b"] built twice under different names
+    ExpressionContext context;
+    auto first = add_product_node(context, "first");
+    auto second = add_product_node(context, "second");
+    context.add_expression_node("root", std::make_shared<ExpressionNode>(first, second, OperationType::EQ));
+    context.root_node_name_ = ExpressionName("root");
+    std::vector<ClauseVariant> clauses{std::make_shared<FilterClause>(std::unordered_set<std::string>{"a", "b"}, std::move(context), std::nullopt)};
+
+    auto planned = plan_query(std::move(clauses));
+    const auto& root = root_node(*std::get<std::shared_ptr<FilterClause>>(planned[0]));
+    ASSERT_EQ(std::get<ExpressionName>(root.left_), std::get<ExpressionName>(root.right_));
+}
+
+TEST(QueryPlanner, ReuseProjectedColumn) {
+    auto projection = product_projection("c");
+    auto filter = product_filter();
+    std::vector<ClauseVariant> clauses{projection, filter};
+    auto planned = plan_query(std::move(clauses));
+    ASSERT_EQ(planned.size(), 2);
+    ASSERT_TRUE(std::holds_alternative<std::shared_ptr<ProjectClause>>(planned[0]));
+    const auto& filter_clause = *std::get<std::shared_ptr<FilterClause>>(planned[1]);
+    ASSERT_EQ(*filter_clause.clause_info().input_columns_, (std::unordered_set<std::string>{"c"}));
+    ASSERT_EQ(std::get<ColumnName>(root_node(filter_clause).left_).value, "c");
+
+    // The clauses provided are left as they were, in case the QueryBuilder is used again
+    ASSERT_TRUE(std::holds_alternative<ExpressionName>(root_node(*filter).left_));
+    ASSERT_EQ(*filter->clause_info().input_columns_, (std::unordered_set<std::string>{"a", "b"}));
+}
+
+TEST(QueryPlanner, ProjectedColumnOverwritten) {
+    // a is overwritten after c is projected, so c no longer holds a * b
+    std::vector<ClauseVariant> clauses{product_projection("c"), product_projection("a"), product_filter()};
+    auto planned = plan_query(std::move(clauses));
+    ASSERT_EQ(planned.size(), 3);
+    const auto& filter_clause = *std::get<std::shared_ptr<FilterClause>>(planned[2]);
+    ASSERT_EQ(*filter_clause.clause_info().input_columns_, (std::unordered_set<std::string>{"a", "b"}));
+    ASSERT_TRUE(std::holds_alternative<ExpressionName>(root_node(filter_clause).left_));
+}
+
+TEST(QueryPlanner, PushFiltersBelowProjections) {
+    std::vector<ClauseVariant> clauses{
+        product_projection("c"),
+        column_filter("d", 1, OperationType::GT),
+        column_filter("c", 1, OperationType::GT),
+        product_projection("e"),
+        column_filter("a", 1, OperationType::GT)
+    };
+    auto planned = plan_query(std::move(clauses));
+    // The filters on d and a are moved ahead of the projections and merged, and the filter on c stays after c is
+    // projected
+    ASSERT_EQ(planned.size(), 4);
+    const auto& first_filter = *std::get<std::shared_ptr<FilterClause>>(planned[0]);
+    ASSERT_EQ(*first_filter.clause_info().input_columns_, (std::unordered_set<std::string>{"a", "d"}));
+    ASSERT_EQ(std::get<std::shared_ptr<ProjectClause>>(planned[1])->output_column_, "c");
+    const auto& second_filter = *std::get<std::shared_ptr<FilterClause>>(planned[2]);
+    ASSERT_EQ(*second_filter.clause_info().input_columns_, (std::unordered_set<std::string>{"c"}));
+    ASSERT_EQ(std::get<std::shared_ptr<ProjectClause>>(planned[3])->output_column_, "e");
+}
@@ -6,10 +6,13 @@
  */
 
 #include <gtest/gtest.h>
+#include <folly/ScopeGuard.h>
 
+#include <arcticdb/async/task_scheduler.hpp>
 #include <arcticdb/entity/atom_key.hpp>
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/processing/clause.hpp>
+#include <arcticdb/util/configs_map.hpp>
 
 using namespace arcticdb;
 
@@ -371,3 +374,80 @@ TEST(Resample, ProcessMultipleSegments) {
     ASSERT_EQ(46, resampled_index_column_2.scalar_at<int64_t>(0));
     ASSERT_EQ(50, resampled_sum_column_2.scalar_at<int64_t>(0));
 }
+
+TEST(Resample, AggregateRowSliceGroupsInParallel) {
+    // Ten row slices of ten rows each, with index values 0 to 99 and buckets spanning several row slices, so that when
+    // the row slices are aggregated in groups the buckets straddling groups have their states merged
+    constexpr size_t num_row_slices = 10;
+    // There are no more groups than CPU threads, so the thread count is fixed for the row slices to be split into
+    // several groups on any machine. The guard reattaches a scheduler with the original thread count afterwards
+    auto restore_scheduler = folly::makeGuard([] { async::TaskScheduler::reattach_instance(); });
+    ScopedConfig cpu_threads("VersionStore.NumCPUThreads", 4);
+    async::TaskScheduler::reattach_instance();
+    constexpr size_t rows_per_slice = 10;
+    using index_TDT = TypeDescriptorTag<DataTypeTag<DataType::NANOSECONDS_UTC64>, DimensionTag<Dimension ::Dim0>>;
+    using col_TDT = TypeDescriptorTag<DataTypeTag<DataType::FLOAT64>, DimensionTag<Dimension ::Dim0>>;
+    std::vector<std::shared_ptr<Column>> index_columns;
+    std::vector<std::optional<ColumnWithStrings>> agg_columns;
+    for (size_t row_slice = 0; row_slice < num_row_slices; ++row_slice) {
+        auto index_column = std::make_shared<Column>(static_cast<TypeDescriptor>(index_TDT{}), 0, AllocationType::DYNAMIC, Sparsity::PERMITTED);
+        auto agg_column = std::make_shared<Column>(static_cast<TypeDescriptor>(col_TDT{}), 0, AllocationType::DYNAMIC, Sparsity::PERMITTED);
+        for (size_t idx = 0; idx < rows_per_slice; ++idx) {
+            const auto row = row_slice * rows_per_slice + idx;
+            index_column->set_scalar<int64_t>(static_cast<ssize_t>(idx), static_cast<int64_t>(row));
+            // Some buckets start and end with NaNs, which first, last, min and max must skip
+            agg_column->set_scalar<double>(static_cast<ssize_t>(idx), row % 7 == 3 || row == 25 ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(row));
+        }
+        index_columns.emplace_back(std::move(index_column));
+        agg_columns.emplace_back(ColumnWithStrings{std::move(agg_column), {}, "agg_column"});
+    }
+    const std::vector<timestamp> bucket_boundaries{0, 24, 25, 26, 57, 100};
+    Column output_index_column(make_scalar_type(DataType::NANOSECONDS_UTC64), bucket_boundaries.size() - 1, AllocationType::PRESIZED, Sparsity::NOT_PERMITTED);
+    output_index_column.set_row_data(bucket_boundaries.size() - 2);
+    {
+        ScopedConfig group_rows("Resample.RowSliceGroupRows", 1);
+        ASSERT_EQ(get_row_slice_groups(index_columns), std::vector<size_t>({3, 6, 9, 10}));
+    }
+
+    std::vector<SortedAggregatorInterface> aggregators{
+        SortedAggregator<AggregationOperator::SUM, ResampleBoundary::LEFT>{ColumnName{"agg_column"}, ColumnName{"sum"}},
+        SortedAggregator<AggregationOperator::MEAN, ResampleBoundary::LEFT>{ColumnName{"agg_column"}, ColumnName{"mean"}},
+        SortedAggregator<AggregationOperator::MIN, ResampleBoundary::LEFT>{ColumnName{"agg_column"}, ColumnName{"min"}},
+        SortedAggregator<AggregationOperator::MAX, ResampleBoundary::LEFT>{ColumnName{"agg_column"}, ColumnName{"max"}},
+        SortedAggregator<AggregationOperator::FIRST, ResampleBoundary::LEFT>{ColumnName{"agg_column"}, ColumnName{"first"}},
+        SortedAggregator<AggregationOperator::LAST, ResampleBoundary::LEFT>{ColumnName{"agg_column"}, ColumnName{"last"}},
+        SortedAggregator<AggregationOperator::COUNT, ResampleBoundary::LEFT>{ColumnName{"agg_column"}, ColumnName{"count"}}
+    };
+    for (const auto& aggregator : aggregators) {
+        StringPool string_pool;
+        auto aggregate = [&]() {
+            return aggregator.aggregate(index_columns, agg_columns, bucket_boundaries, output_index_column, string_pool);
+        };
+        Column serial = [&]() {
+            ScopedConfig group_rows("Resample.RowSliceGroupRows", 0);
+            return aggregate();
+        }();
+        Column parallel = [&]() {
+            ScopedConfig group_rows("Resample.RowSliceGroupRows", 1);
+            return aggregate();
+        }();
+        ASSERT_EQ(static_cast<size_t>(serial.row_count()), bucket_boundaries.size() - 1);
+        ASSERT_EQ(parallel.row_count(), serial.row_count());
+        details::visit_type(serial.type().data_type(), [&](auto col_tag) {
+            using type_info = ScalarTypeInfo<decltype(col_tag)>;
+            if constexpr (is_numeric_type(type_info::data_type)) {
+                for (auto row = 0; row < serial.row_count(); ++row) {
+                    const auto serial_value = serial.scalar_at<typename type_info::RawType>(row).value();
+                    const auto parallel_value = parallel.scalar_at<typename type_info::RawType>(row).value();
+                    if constexpr (is_floating_point_type(type_info::data_type)) {
+                        if (std::isnan(serial_value)) {
+                            ASSERT_TRUE(std::isnan(parallel_value)) << aggregator.get_output_column_name().value << " row " << row;
+                            continue;
+                        }
+                    }
+                    ASSERT_EQ(serial_value, parallel_value) << aggregator.get_output_column_name().value << " row " << row;
+                }
+            }
+        });
+    }
+}
@@ -0,0 +1,151 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <arcticdb/column_store/string_pool.hpp>
+#include <arcticdb/processing/expression_context.hpp>
+#include <arcticdb/processing/expression_node.hpp>
+#include <arcticdb/processing/operation_dispatch_binary.hpp>
+#include <arcticdb/processing/operation_dispatch_ternary.hpp>
+#include <arcticdb/processing/operation_dispatch_string.hpp>
+#include <arcticdb/processing/operation_dispatch_unary.hpp>
+#include <arcticdb/util/test/generators.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+ColumnWithStrings string_column(const std::vector<std::optional<std::string>>& values, std::string_view name = "col") {
+    auto string_pool = std::make_shared<StringPool>();
+    auto column = std::make_unique<Column>(make_scalar_type(DataType::UTF_DYNAMIC64), Sparsity::PERMITTED);
+    for (const auto& value: values) {
+        column->push_back<entity::position_t>(value.has_value() ? string_pool->get(*value).offset() : not_a_string());
+    }
+    return {std::move(column), string_pool, name};
+}
+
+std::vector<std::optional<std::string>> strings(const VariantData& data) {
+    const auto& col = std::get<ColumnWithStrings>(data);
+    EXPECT_EQ(col.column_->type().data_type(), DataType::UTF_DYNAMIC64);
+    std::vector<std::optional<std::string>> res;
+    for (ssize_t idx = 0; idx < col.column_->row_count(); ++idx) {
+        auto str = col.string_at_offset(*col.column_->scalar_at<entity::position_t>(idx));
+        res.emplace_back(str.has_value() ? std::make_optional<std::string>(*str) : std::nullopt);
+    }
+    return res;
+}
+
+std::vector<size_t> set_bits(const VariantData& data) {
+    std::vector<size_t> res;
+    const auto& bitset = std::get<util::BitSet>(data);
+    for (auto it = bitset.first(); it != bitset.end(); ++it) {
+        res.emplace_back(*it);
+    }
+    return res;
+}
+
+std::shared_ptr<Value> string_value(const std::string& str) {
+    return std::make_shared<Value>(construct_string_value(str));
+}
+
+} // namespace
+
+TEST(StringOperations, Utf8Helpers) {
+    ASSERT_EQ(utf8_length(""), 0);
+    ASSERT_EQ(utf8_length("abc"), 3);
+    // "é" and "€" are two and three bytes respectively
+    ASSERT_EQ(utf8_length("caf\xC3\xA9 \xE2\x82\xAC"), 6);
+    ASSERT_EQ(utf8_substring("abcdef", 1, 3), "bcd");
+    ASSERT_EQ(utf8_substring("abcdef", -2, 10), "ef");
+    ASSERT_EQ(utf8_substring("abcdef", -10, 2), "ab");
+    ASSERT_EQ(utf8_substring("abcdef", 6, 2), "");
+    ASSERT_EQ(utf8_substring("abcdef", 2, 0), "");
+    ASSERT_EQ(utf8_substring("abcdef", 2, std::numeric_limits<int64_t>::max()), "cdef");
+    ASSERT_EQ(utf8_substring("caf\xC3\xA9 \xE2\x82\xAC", 3, 3), "\xC3\xA9 \xE2\x82\xAC");
+}
+
+TEST(StringOperations, Predicates) {
+    auto col = string_column({"apple", std::nullopt, "banana", "apricot", "apple", "grape"});
+    ASSERT_EQ(set_bits(dispatch_binary(col, string_value("ap"), OperationType::STARTSWITH)), std::vector<size_t>({0, 3, 4}));
+    ASSERT_EQ(set_bits(dispatch_binary(col, string_value("an"), OperationType::CONTAINS)), std::vector<size_t>({2}));
+    ASSERT_TRUE(std::holds_alternative<EmptyResult>(dispatch_binary(col, string_value("x"), OperationType::CONTAINS)));
+    EXPECT_THROW(dispatch_binary(col, std::make_shared<Value>(int64_t{1}, DataType::INT64), OperationType::STARTSWITH), UserInputException);
+    auto int_col = ColumnWithStrings(std::make_unique<Column>(generate_int_column(10)), "int_col");
+    EXPECT_THROW(dispatch_binary(int_col, string_value("a"), OperationType::CONTAINS), UserInputException);
+}
+
+TEST(StringOperations, Len) {
+    auto col = string_column({"a", std::nullopt, "abc", "caf\xC3\xA9", "abc"});
+    auto res = dispatch_unary(col, OperationType::LEN);
+    const auto& res_col = *std::get<ColumnWithStrings>(res).column_;
+    ASSERT_EQ(res_col.type().data_type(), DataType::FLOAT64);
+    ASSERT_EQ(res_col.scalar_at<double>(0), 1);
+    ASSERT_TRUE(std::isnan(*res_col.scalar_at<double>(1)));
+    ASSERT_EQ(res_col.scalar_at<double>(2), 3);
+    ASSERT_EQ(res_col.scalar_at<double>(3), 4);
+    ASSERT_EQ(res_col.scalar_at<double>(4), 3);
+}
+
+TEST(StringOperations, Case) {
+    auto col = string_column({"Hello", std::nullopt, "WORLD", "caf\xC3\xA9", "Hello"});
+    ASSERT_EQ(strings(dispatch_unary(col, OperationType::LOWER)),
+              std::vector<std::optional<std::string>>({"hello", std::nullopt, "world", "caf\xC3\xA9", "hello"}));
+    auto upper = dispatch_unary(col, OperationType::UPPER);
+    ASSERT_EQ(strings(upper),
+              std::vector<std::optional<std::string>>({"HELLO", std::nullopt, "WORLD", "CAF\xC3\xA9", "HELLO"}));
+    // Each distinct string is only transformed and stored once
+    const auto& upper_col = std::get<ColumnWithStrings>(upper);
+    ASSERT_EQ(upper_col.column_->scalar_at<entity::position_t>(0), upper_col.column_->scalar_at<entity::position_t>(4));
+    ASSERT_NE(upper_col.string_pool_, col.string_pool_);
+}
+
+TEST(StringOperations, Substring) {
+    auto col = string_column({"abcdef", std::nullopt, "xy"});
+    auto start = std::make_shared<Value>(int8_t{-4}, DataType::INT8);
+    auto length = std::make_shared<Value>(uint8_t{2}, DataType::UINT8);
+    ASSERT_EQ(strings(dispatch_ternary(col, start, length, OperationType::SUBSTRING)),
+              std::vector<std::optional<std::string>>({"cd", std::nullopt, "xy"}));
+    auto negative_length = std::make_shared<Value>(int8_t{-1}, DataType::INT8);
+    EXPECT_THROW(dispatch_ternary(col, start, negative_length, OperationType::SUBSTRING), UserInputException);
+    EXPECT_THROW(dispatch_ternary(col, string_value("a"), length, OperationType::SUBSTRING), UserInputException);
+}
+
+TEST(StringOperations, Concat) {
+    auto left = string_column({"a", "b", std::nullopt, "a"}, "left");
+    auto right = string_column({"x", std::nullopt, "y", "x"}, "right");
+    ASSERT_EQ(strings(dispatch_binary(left, right, OperationType::CONCAT)),
+              std::vector<std::optional<std::string>>({"ax", std::nullopt, std::nullopt, "ax"}));
+    ASSERT_EQ(strings(dispatch_binary(left, string_value("_1"), OperationType::CONCAT)),
+              std::vector<std::optional<std::string>>({"a_1", "b_1", std::nullopt, "a_1"}));
+    ASSERT_EQ(strings(dispatch_binary(string_value("1_"), left, OperationType::CONCAT)),
+              std::vector<std::optional<std::string>>({"1_a", "1_b", std::nullopt, "1_a"}));
+    EXPECT_THROW(dispatch_binary(string_value("a"), string_value("b"), OperationType::CONCAT), UserInputException);
+}
+
+TEST(StringOperations, OutputTypes) {
+    ExpressionContext expression_context;
+    expression_context.add_value("prefix", string_value("a"));
+    expression_context.add_value("start", std::make_shared<Value>(uint8_t{1}, DataType::UINT8));
+    ankerl::unordered_dense::map<std::string, DataType> column_types{{"col", DataType::UTF_DYNAMIC64}, {"int_col", DataType::INT64}};
+
+    ExpressionNode len(ColumnName("col"), OperationType::LEN);
+    ASSERT_EQ(std::get<DataType>(len.compute(expression_context, column_types)), DataType::FLOAT64);
+    ExpressionNode lower(ColumnName("col"), OperationType::LOWER);
+    ASSERT_EQ(std::get<DataType>(lower.compute(expression_context, column_types)), DataType::UTF_DYNAMIC64);
+    ExpressionNode startswith(ColumnName("col"), ValueName("prefix"), OperationType::STARTSWITH);
+    ASSERT_TRUE(std::holds_alternative<BitSetTag>(startswith.compute(expression_context, column_types)));
+    ExpressionNode concat(ColumnName("col"), ValueName("prefix"), OperationType::CONCAT);
+    ASSERT_EQ(std::get<DataType>(concat.compute(expression_context, column_types)), DataType::UTF_DYNAMIC64);
+    ExpressionNode substring(ColumnName("col"), ValueName("start"), ValueName("start"), OperationType::SUBSTRING);
+    ASSERT_EQ(std::get<DataType>(substring.compute(expression_context, column_types)), DataType::UTF_DYNAMIC64);
+
+    ExpressionNode int_len(ColumnName("int_col"), OperationType::LEN);
+    EXPECT_THROW(int_len.compute(expression_context, column_types), UserInputException);
+}
@@ -6,6 +6,7 @@
  */
 
 #include <arcticdb/processing/unsorted_aggregation.hpp>
+#include <arcticdb/util/constants.hpp>
 
 #include <cmath>
 
@@ -55,6 +56,47 @@ SegmentInMemory MinMaxAggregatorData::finalize(const std::vector<ColumnName>& ou
     return seg;
 }
 
+void HyperLogLogAggregatorData::aggregate(const ColumnWithStrings& input_column) {
+    column_seen_ = true;
+    details::visit_type(input_column.column_->type().data_type(), [&] (auto col_tag) {
+        using type_info = ScalarTypeInfo<decltype(col_tag)>;
+        if constexpr (is_sequence_type(type_info::data_type)) {
+            Column::for_each<typename type_info::TDT>(*input_column.column_, [this, &input_column](auto offset) {
+                // None and NaN have no string to add
+                if (auto str = input_column.string_at_offset(offset, true); str.has_value())
+                    sketch_.add(*str);
+            });
+        } else if constexpr (is_time_type(type_info::data_type)) {
+            Column::for_each<typename type_info::TDT>(*input_column.column_, [this](auto value) {
+                if (value != NaT)
+                    sketch_.add(value);
+            });
+        } else if constexpr (is_numeric_type(type_info::data_type) || is_bool_type(type_info::data_type)) {
+            Column::for_each<typename type_info::TDT>(*input_column.column_, [this](auto value) {
+                sketch_.add(value);
+            });
+        } else if constexpr (!is_empty_type(type_info::data_type)) {
+            schema::raise<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
+                    "HyperLogLog column stat generation not supported with type {} of column '{}'",
+                    type_info::data_type, input_column.column_name_);
+        }
+    });
+}
+
+SegmentInMemory HyperLogLogAggregatorData::finalize(const std::vector<ColumnName>& output_column_names) const {
+    internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+            output_column_names.size() == 1,
+            "Expected 1 output column name in HyperLogLogAggregatorData::finalize, but got {}",
+            output_column_names.size());
+    SegmentInMemory seg;
+    if (column_seen_) {
+        auto sketch_col = std::make_shared<Column>(make_scalar_type(DataType::UTF_DYNAMIC64), Sparsity::PERMITTED);
+        sketch_col->push_back<entity::position_t>(seg.string_pool().get(sketch_.serialize()).offset());
+        seg.add_column(scalar_field(DataType::UTF_DYNAMIC64, output_column_names[0].value), sketch_col);
+    }
+    return seg;
+}
+
 namespace {
 
 template<typename T, typename T2=void>
@@ -12,6 +12,7 @@
 #include <arcticdb/entity/type_utils.hpp>
 #include <arcticdb/processing/aggregation_utils.hpp>
 #include <arcticdb/processing/expression_node.hpp>
+#include <arcticdb/util/hyperloglog.hpp>
 
 namespace arcticdb {
 
@@ -53,6 +54,43 @@ private:
     ColumnName output_column_name_max_;
 };
 
+class HyperLogLogAggregatorData
+{
+public:
+
+    HyperLogLogAggregatorData() = default;
+    ARCTICDB_MOVE_COPY_DEFAULT(HyperLogLogAggregatorData)
+
+    void aggregate(const ColumnWithStrings& input_column);
+    SegmentInMemory finalize(const std::vector<ColumnName>& output_column_names) const;
+
+private:
+
+    HyperLogLog sketch_;
+    // So that row-slices without the column (possible with dynamic schema) have no sketch, rather than an empty one
+    bool column_seen_{false};
+};
+
+class HyperLogLogAggregator
+{
+public:
+
+    explicit HyperLogLogAggregator(ColumnName column_name, ColumnName output_column_name)
+        : column_name_(std::move(column_name))
+        , output_column_name_(std::move(output_column_name))
+    {}
+    ARCTICDB_MOVE_COPY_DEFAULT(HyperLogLogAggregator)
+
+    [[nodiscard]] ColumnName get_input_column_name() const { return column_name_; }
+    [[nodiscard]] std::vector<ColumnName> get_output_column_names() const { return {output_column_name_}; }
+    [[nodiscard]] HyperLogLogAggregatorData get_aggregator_data() const { return HyperLogLogAggregatorData(); }
+
+private:
+
+    ColumnName column_name_;
+    ColumnName output_column_name_;
+};
+
 class AggregatorDataBase
 {
 public:
@@ -13,6 +13,7 @@
 #include <arcticdb/util/sparse_utils.hpp>
 #include <arcticdb/python/python_strings.hpp>
 #include <arcticdb/python/python_utils.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 
 namespace arcticdb {
 
@@ -185,10 +186,12 @@ void PythonStringHandler::handle_type(
         EncodingVersion encoding_version,
         const std::shared_ptr<StringPool>& string_pool) {
     ARCTICDB_SAMPLE(PythonHandleString, 0)
-    util::check(field.has_ndarray(), "String handler expected array");
+    // Dictionary encoded fields have had their codes expanded back into string pool offsets when decoded, so pandas
+    // gets object strings here rather than a Categorical built from the codes
+    util::check(field.has_ndarray() || field.has_dictionary(), "String handler expected array or dictionary");
     ARCTICDB_DEBUG(log::version(), "String handler got encoded field: {}", field.DebugString());
     const auto &ndarray = field.ndarray();
-    const auto bytes = encoding_sizes::data_uncompressed_size(ndarray);
+    const auto bytes = encoding_sizes::decoded_data_size(field);
 
     auto decoded_data = [&m, &ndarray, bytes, &dest_column]() {
         if(ndarray.sparse_map_bytes() > 0) {
@@ -222,6 +225,9 @@ void PythonStringHandler::convert_type(
         const std::shared_ptr<StringPool>& string_pool) const {
     auto dest_data = dest_column.bytes_at(mapping.offset_bytes_, mapping.num_rows_ * sizeof(PyObject*));
     auto ptr_dest = reinterpret_cast<PyObject**>(dest_data);
+    const auto source_type_name = datatype_to_str(mapping.source_type_desc_.data_type());
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::ProcessingType::PythonStringReduction, source_type_name);
+    query_stats::add(query_stats::ProcessingType::PythonStringReduction, source_type_name, query_stats::StatType::SIZE_BYTES, source_column.bytes());
     DynamicStringReducer string_reducer{shared_data, cast_handler_data(handler_data), ptr_dest, mapping.num_rows_};
     string_reducer.reduce(source_column, mapping.source_type_desc_, mapping.dest_type_desc_, mapping.num_rows_, *string_pool, source_column.opt_sparse_map());
     string_reducer.finalize();
@@ -23,6 +23,7 @@
 #include <arcticdb/storage/azure/azure_client_impl.hpp>
 #include <arcticdb/storage/mock/azure_mock_client.hpp>
 #include <arcticdb/storage/storage_exceptions.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 
 #include <azure/storage/blobs.hpp>
 
@@ -117,8 +118,12 @@ void do_write_impl(
     auto& k = key_seg.variant_key();
     auto blob_name = object_path(bucketizer.bucketize(key_type_dir, k), k);
 
+    auto& seg = *key_seg.segment_ptr();
+    const auto segment_size = seg.calculate_size();
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Azure_Write, key_seg.key_type());
     try {
-        azure_client.write_blob(blob_name, *key_seg.segment_ptr(), upload_option, request_timeout);
+        azure_client.write_blob(blob_name, seg, upload_option, request_timeout);
+        query_stats::add(query_stats::TaskType::Azure_Write, key_seg.key_type(), query_stats::StatType::SIZE_BYTES, segment_size);
     }
     catch (const Azure::Core::RequestFailedException& e) {
         raise_azure_exception(e, blob_name);
@@ -152,8 +157,10 @@ void do_read_impl(
 
     auto key_type_dir = key_type_folder(root_folder, variant_key_type(variant_key));
     auto blob_name = object_path(bucketizer.bucketize(key_type_dir, variant_key), variant_key);
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Azure_Read, variant_key_type(variant_key));
     try {
         Segment segment = azure_client.read_blob(blob_name, download_option, request_timeout);
+        query_stats::add(query_stats::TaskType::Azure_Read, variant_key_type(variant_key), query_stats::StatType::SIZE_BYTES, segment.calculate_size());
         visitor(variant_key, std::move(segment));
         ARCTICDB_DEBUG(log::storage(), "Read key {}: {}", variant_key_type(variant_key), variant_key_view(variant_key));
     }
@@ -186,8 +193,11 @@ KeySegmentPair do_read_impl(
 
     auto key_type_dir = key_type_folder(root_folder, variant_key_type(variant_key));
     auto blob_name = object_path(bucketizer.bucketize(key_type_dir, variant_key), variant_key);
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Azure_Read, variant_key_type(variant_key));
     try {
-        return {VariantKey{variant_key}, azure_client.read_blob(blob_name, download_option, request_timeout)};
+        auto segment = azure_client.read_blob(blob_name, download_option, request_timeout);
+        query_stats::add(query_stats::TaskType::Azure_Read, variant_key_type(variant_key), query_stats::StatType::SIZE_BYTES, segment.calculate_size());
+        return {VariantKey{variant_key}, std::move(segment)};
         ARCTICDB_DEBUG(log::storage(), "Read key {}: {}", variant_key_type(variant_key), variant_key_view(variant_key));
     }
     catch (const Azure::Core::RequestFailedException& e) {
@@ -227,7 +237,8 @@ void do_remove_impl(
     static const size_t delete_object_limit =
         std::min(BATCH_SUBREQUEST_LIMIT, static_cast<size_t>(ConfigsMap::instance()->get_int("AzureStorage.DeleteBatchSize", BATCH_SUBREQUEST_LIMIT)));
 
-    auto submit_batch = [&azure_client, &request_timeout](auto &to_delete) {
+    auto submit_batch = [&azure_client, &request_timeout](auto &to_delete, KeyType key_type) {
+        auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Azure_Delete, key_type);
         try {
             azure_client.delete_blobs(to_delete, request_timeout);
         } catch (const Azure::Core::RequestFailedException& e) {
@@ -243,15 +254,12 @@ void do_remove_impl(
             for (auto k : folly::enumerate(group.values())) {
                 auto blob_name = object_path(b.bucketize(key_type_dir, *k), *k);
                 to_delete.emplace_back(std::move(blob_name));
-                if (to_delete.size() == delete_object_limit) {
-                    submit_batch(to_delete);
+                if (to_delete.size() == delete_object_limit || k.index + 1 == group.size()) {
+                    submit_batch(to_delete, group.key());
                 }
             }
         }
     );
-    if (!to_delete.empty()) {
-        submit_batch(to_delete);
-    }
 }
 
 std::string prefix_handler(const std::string& prefix,
@@ -280,6 +288,7 @@ bool do_iterate_type_impl(KeyType key_type,
                                  FormatType::TOKENIZED);
     auto key_prefix = prefix_handler(prefix, key_type_dir, key_descriptor, key_type);
 
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Azure_List, key_type);
     try {
         for (auto page = azure_client.list_blobs(key_prefix); page.HasPage(); page.MoveToNextPage()) {
             for (const auto& blob : page.Blobs) {
@@ -314,6 +323,7 @@ bool do_key_exists_impl(
     AzureClientWrapper& azure_client) {
     auto key_type_dir = key_type_folder(root_folder, variant_key_type(key));
     auto blob_name = object_path(key_type_dir, key);
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Azure_KeyExists, variant_key_type(key));
     try {
         return azure_client.blob_exists(blob_name);
     }
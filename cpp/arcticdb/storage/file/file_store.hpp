@@ -7,6 +7,7 @@
 
 #include <arcticdb/entity/types.hpp>
 #include <arcticdb/codec/codec.hpp>
+#include <arcticdb/codec/column_codec.hpp>
 #include <arcticdb/storage/coalesced/multi_segment_header.hpp>
 #include <arcticdb/codec/default_codecs.hpp>
 #include <arcticdb/version/version_core.hpp>
@@ -24,17 +25,20 @@
 #include <arcticdb/version/version_core.hpp>
 #include <arcticdb/entity/serialized_key.hpp>
 
+#include <numeric>
+
 namespace arcticdb {
 
 
 size_t max_data_size(
     const std::vector<std::tuple<stream::StreamSink::PartialKey, SegmentInMemory, FrameSlice>>& items,
+    const std::vector<std::vector<arcticdb::proto::encoding::VariantCodec>>& codecs,
     const arcticdb::proto::encoding::VariantCodec& codec_opts,
     EncodingVersion encoding_version) {
     auto max_file_size = 0UL;
-    for(const auto& item : items) {
-        const auto& [pk, seg, slice] = item;
-        auto result = max_compressed_size_dispatch(seg, codec_opts, encoding_version);
+    for(size_t idx = 0; idx < items.size(); ++idx) {
+        const auto& [pk, seg, slice] = items[idx];
+        auto result = max_compressed_size_dispatch(seg, codec_opts, encoding_version, codecs[idx]);
         max_file_size += result.max_compressed_bytes_ + result.encoded_blocks_bytes_;
         const auto header_size = SegmentHeader::required_bytes(seg);
         max_file_size += header_size;
@@ -82,17 +86,29 @@ void write_dataframe_to_file_internal(
          write_window_size())).via(&async::io_executor());
     auto segments = std::move(key_seg_futs).get();
 
-    auto data_size = max_data_size(segments, codec_opts, encoding_version);
+    // The file is sized for the segments before they are written, so their codecs are chosen once and used for both
+    std::vector<std::vector<arcticdb::proto::encoding::VariantCodec>> codecs;
+    codecs.reserve(segments.size());
+    for(const auto& [pk, seg, slice] : segments)
+        codecs.emplace_back(column_codecs(seg, codec_opts, encoding_version));
+
+    auto data_size = max_data_size(segments, codecs, codec_opts, encoding_version);
     ARCTICDB_DEBUG(log::version(), "Estimated max data size: {}", data_size);
     auto config = storage::file::pack_config(path, data_size, segments.size(), stream_id, stream::get_descriptor_from_index(frame->index), encoding_version, codec_opts);
 
     storage::LibraryPath lib_path{std::string{"file"}, fmt::format("{}", stream_id)};
     auto library = create_library(lib_path, storage::OpenMode::WRITE, {std::move(config)});
     auto store = std::make_shared<async::AsyncStore<PilotedClock>>(library, codec_opts, encoding_version);
-    auto dedup_map = std::make_shared<DeDupMap>();
     size_t batch_size = ConfigsMap::instance()->get_int("FileWrite.BatchSize", 50);
-    auto index_fut = folly::collect(folly::window(std::move(segments), [store, dedup_map] (auto key_seg) {
-        return store->async_write(key_seg, dedup_map);
+    std::vector<size_t> segment_indices(segments.size());
+    std::iota(segment_indices.begin(), segment_indices.end(), 0);
+    auto index_fut = folly::collect(folly::window(std::move(segment_indices), [store, &segments, &codecs, &codec_opts, encoding_version] (size_t idx) {
+        auto& [partial_key, seg, slice] = segments[idx];
+        auto enc_seg = encode_dispatch(std::move(seg), codec_opts, encoding_version, codecs[idx]);
+        auto key = partial_key.build_key(PilotedClock::nanos_since_epoch(), get_segment_hash(enc_seg));
+        return store->write_compressed(storage::KeySegmentPair{VariantKey{key}, std::move(enc_seg)}).thenValue([slice=slice, key] (auto&&) {
+            return SliceAndKey{slice, key};
+        });
     }, batch_size)).via(&async::io_executor())
     .thenValue([&frame, stream_id, store] (auto&& slice_and_keys) {
         return index::write_index(frame, std::forward<decltype(slice_and_keys)>(slice_and_keys), IndexPartialKey{stream_id, VersionId{0}}, store);
@@ -98,6 +98,15 @@ class Library {
         storages_->write(key_seg);
     }
 
+    void write_batch(std::span<KeySegmentPair> key_segs) {
+        ARCTICDB_SAMPLE(LibraryWriteBatch, 0)
+        if (open_mode() < OpenMode::WRITE) {
+            throw LibraryPermissionException(library_path_, open_mode(), "write");
+        }
+
+        storages_->write_batch(key_segs);
+    }
+
     void write_if_none(KeySegmentPair& kv) {
         if (open_mode() < OpenMode::WRITE) {
             throw LibraryPermissionException(library_path_, open_mode(), "write");
@@ -133,6 +142,11 @@ class Library {
         return storages_->read_sync(key, opts, !storage_fallthrough_);
     }
 
+    std::vector<folly::Try<KeySegmentPair>> read_batch(std::span<VariantKey> variant_keys, ReadKeyOpts opts = ReadKeyOpts{}) {
+        ARCTICDB_SAMPLE(LibraryReadBatch, 0)
+        return storages_->read_batch(variant_keys, opts, !storage_fallthrough_);
+    }
+
     void remove(std::span<VariantKey> variant_keys, storage::RemoveOpts opts) {
         if (open_mode() < arcticdb::storage::OpenMode::DELETE) {
             throw LibraryPermissionException(library_path_, open_mode(), "delete");
@@ -184,6 +198,8 @@ class Library {
 
     bool supports_atomic_writes() const { return storages_->supports_atomic_writes(); }
 
+    [[nodiscard]] bool supports_batch_operations() const { return storages_->supports_batch_operations(); }
+
     [[nodiscard]] const LibraryPath &library_path() const { return library_path_; }
 
     [[nodiscard]] OpenMode open_mode() const { return storages_->open_mode(); }
@@ -24,6 +24,7 @@
 
 #include <folly/gen/Base.h>
 #include <arcticdb/storage/storage_exceptions.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 
 namespace arcticdb::storage::lmdb {
 
@@ -88,8 +89,11 @@ void LmdbStorage::do_write_internal(KeySegmentPair& key_seg, ::lmdb::txn& txn) {
     auto k = to_serialized_key(key_seg.variant_key());
     auto& seg = *key_seg.segment_ptr();
     int64_t overwrite_flag = std::holds_alternative<RefKey>(key_seg.variant_key()) ? 0 : MDB_NOOVERWRITE;
+    const auto segment_size = seg.calculate_size();
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::LMDB_Write, key_seg.key_type());
     try {
         lmdb_client_->write(db_name, k, seg, txn, dbi, overwrite_flag);
+        query_stats::add(query_stats::TaskType::LMDB_Write, key_seg.key_type(), query_stats::StatType::SIZE_BYTES, segment_size);
     } catch (const ::lmdb::key_exist_error& e) {
         throw DuplicateKeyException(fmt::format("Key already exists: {}: {}", key_seg.variant_key(), e.what()));
     } catch (const ::lmdb::error& ex) {
@@ -101,12 +105,64 @@ std::string LmdbStorage::name() const {
     return fmt::format("lmdb_storage-{}", lib_dir_.string());
 }
 
+void LmdbStorage::commit_group(const std::vector<PendingWrite*>& group) {
+    ARCTICDB_SAMPLE(LmdbStorageCommitGroup, 0)
+    try {
+        std::lock_guard<std::mutex> lock{*write_mutex_};
+        auto txn = ::lmdb::txn::begin(env()); // scoped abort on exception, so no partial writes
+        ARCTICDB_SUBSAMPLE(LmdbStorageInTransaction, 0)
+        for (auto* write : group) {
+            try {
+                do_write_internal(write->key_seg_, txn);
+            } catch (const DuplicateKeyException&) {
+                // A rejected put leaves the transaction usable, so only this write fails
+                write->error_ = std::current_exception();
+            }
+        }
+        ARCTICDB_SUBSAMPLE(LmdbStorageCommit, 0)
+        txn.commit();
+    } catch (...) {
+        // Any other error aborts the transaction, so none of the writes in the group were made
+        for (auto* write : group)
+            write->error_ = std::current_exception();
+    }
+}
+
 void LmdbStorage::do_write(KeySegmentPair& key_seg) {
     ARCTICDB_SAMPLE(LmdbStorageWrite, 0)
+    auto& queue = *group_commit_queue_;
+    PendingWrite pending{key_seg};
+    std::unique_lock lock{queue.mutex_};
+    queue.pending_.push_back(&pending);
+    while (!pending.done_) {
+        if (queue.committing_) {
+            queue.committed_.wait(lock);
+            continue;
+        }
+        queue.committing_ = true;
+        auto group = std::exchange(queue.pending_, {});
+        lock.unlock();
+        commit_group(group);
+        lock.lock();
+        queue.committing_ = false;
+        for (auto* write : group)
+            write->done_ = true;
+
+        queue.committed_.notify_all();
+    }
+    lock.unlock();
+    if (pending.error_)
+        std::rethrow_exception(pending.error_);
+}
+
+void LmdbStorage::do_write_batch(std::span<KeySegmentPair> key_segs) {
+    ARCTICDB_SAMPLE(LmdbStorageWriteBatch, 0)
     std::lock_guard<std::mutex> lock{*write_mutex_};
     auto txn = ::lmdb::txn::begin(env()); // scoped abort on exception, so no partial writes
     ARCTICDB_SUBSAMPLE(LmdbStorageInTransaction, 0)
-    do_write_internal(key_seg, txn);
+    for (auto& key_seg : key_segs)
+        do_write_internal(key_seg, txn);
+
     ARCTICDB_SUBSAMPLE(LmdbStorageCommit, 0)
     txn.commit();
 }
@@ -133,21 +189,19 @@ void LmdbStorage::do_update(KeySegmentPair& key_seg, UpdateOpts opts) {
     txn.commit();
 }
 
-KeySegmentPair LmdbStorage::do_read(VariantKey&& variant_key, ReadKeyOpts) {
-    ARCTICDB_SAMPLE(LmdbStorageReadReturn, 0)
-    std::optional<VariantKey> failed_read;
+KeySegmentPair LmdbStorage::do_read_internal(VariantKey&& variant_key, const std::shared_ptr<::lmdb::txn>& txn) {
     auto db_name = fmt::format(FMT_COMPILE("{}"), variant_key_type(variant_key));
     ::lmdb::dbi& dbi = get_dbi(db_name);
     ARCTICDB_SUBSAMPLE(LmdbStorageOpenDb, 0)
     auto stored_key = to_serialized_key(variant_key);
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::LMDB_Read, variant_key_type(variant_key));
     try {
-        auto txn = std::make_shared<::lmdb::txn>(::lmdb::txn::begin(env(), nullptr, MDB_RDONLY));
-        ARCTICDB_SUBSAMPLE(LmdbStorageInTransaction, 0)
         auto segment = lmdb_client_->read(db_name, stored_key, *txn, dbi);
 
         if (segment.has_value()) {
             ARCTICDB_SUBSAMPLE(LmdbStorageVisitSegment, 0)
-            segment->set_keepalive(std::any{LmdbKeepalive{lmdb_instance_, std::move(txn)}});
+            query_stats::add(query_stats::TaskType::LMDB_Read, variant_key_type(variant_key), query_stats::StatType::SIZE_BYTES, segment->calculate_size());
+            segment->set_keepalive(std::any{LmdbKeepalive{lmdb_instance_, txn}});
             ARCTICDB_DEBUG(log::storage(), "Read key {}: {}, with {} bytes of data",variant_key_type(variant_key), variant_key_view(variant_key), segment->size());
             return {VariantKey{variant_key}, std::move(*segment)};
         } else {
@@ -163,6 +217,35 @@ KeySegmentPair LmdbStorage::do_read(VariantKey&& variant_key, ReadKeyOpts) {
     return KeySegmentPair{};
 }
 
+KeySegmentPair LmdbStorage::do_read(VariantKey&& variant_key, ReadKeyOpts) {
+    ARCTICDB_SAMPLE(LmdbStorageReadReturn, 0)
+    std::shared_ptr<::lmdb::txn> txn;
+    try {
+        txn = std::make_shared<::lmdb::txn>(::lmdb::txn::begin(env(), nullptr, MDB_RDONLY));
+    } catch (const ::lmdb::error& ex) {
+        raise_lmdb_exception(ex, to_serialized_key(variant_key));
+    }
+    ARCTICDB_SUBSAMPLE(LmdbStorageInTransaction, 0)
+    return do_read_internal(std::move(variant_key), txn);
+}
+
+std::vector<folly::Try<KeySegmentPair>> LmdbStorage::do_read_batch(std::span<VariantKey> variant_keys, ReadKeyOpts) {
+    ARCTICDB_SAMPLE(LmdbStorageReadBatch, 0)
+    std::shared_ptr<::lmdb::txn> txn;
+    try {
+        txn = std::make_shared<::lmdb::txn>(::lmdb::txn::begin(env(), nullptr, MDB_RDONLY));
+    } catch (const ::lmdb::error& ex) {
+        raise_lmdb_exception(ex, "read batch");
+    }
+    ARCTICDB_SUBSAMPLE(LmdbStorageInTransaction, 0)
+    std::vector<folly::Try<KeySegmentPair>> results;
+    results.reserve(variant_keys.size());
+    for (auto& variant_key : variant_keys)
+        results.emplace_back(folly::makeTryWith([&]() { return do_read_internal(std::move(variant_key), txn); }));
+
+    return results;
+}
+
 void LmdbStorage::do_read(VariantKey&& key, const ReadVisitor& visitor, storage::ReadKeyOpts) {
     ARCTICDB_SAMPLE(LmdbStorageRead, 0)
     std::optional<VariantKey> failed_read;
@@ -170,6 +253,7 @@ void LmdbStorage::do_read(VariantKey&& key, const ReadVisitor& visitor, storage:
     ::lmdb::dbi& dbi = get_dbi(db_name);
     ARCTICDB_SUBSAMPLE(LmdbStorageOpenDb, 0)
     auto stored_key = to_serialized_key(key);
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::LMDB_Read, variant_key_type(key));
     try {
         auto txn = std::make_shared<::lmdb::txn>(::lmdb::txn::begin(env(), nullptr, MDB_RDONLY));
         ARCTICDB_SUBSAMPLE(LmdbStorageInTransaction, 0)
@@ -177,6 +261,7 @@ void LmdbStorage::do_read(VariantKey&& key, const ReadVisitor& visitor, storage:
 
         if (segment.has_value()) {
             ARCTICDB_SUBSAMPLE(LmdbStorageVisitSegment, 0)
+            query_stats::add(query_stats::TaskType::LMDB_Read, variant_key_type(key), query_stats::StatType::SIZE_BYTES, segment->calculate_size());
             segment->set_keepalive(std::any{LmdbKeepalive{lmdb_instance_, std::move(txn)}});
             ARCTICDB_DEBUG(log::storage(), "Read key {}: {}, with {} bytes of data",variant_key_type(key), variant_key_view(key), segment->size());
             visitor(key, std::move(*segment));
@@ -197,6 +282,7 @@ void LmdbStorage::do_read(VariantKey&& key, const ReadVisitor& visitor, storage:
 
 bool LmdbStorage::do_key_exists(const VariantKey& key) {
     ARCTICDB_SAMPLE(LmdbStorageKeyExists, 0)
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::LMDB_KeyExists, variant_key_type(key));
     auto txn = ::lmdb::txn::begin(env(), nullptr, MDB_RDONLY);
     ARCTICDB_SUBSAMPLE(LmdbStorageInTransaction, 0)
     ARCTICDB_DEBUG_THROW(5)
@@ -221,6 +307,7 @@ boost::container::small_vector<VariantKey, 1> LmdbStorage::do_remove_internal(st
     for(auto&& key : variant_keys) {
         auto db_name = fmt::format("{}", variant_key_type(key));
         ARCTICDB_SUBSAMPLE(LmdbStorageOpenDb, 0)
+        auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::LMDB_Delete, variant_key_type(key));
         try {
             ::lmdb::dbi& dbi = get_dbi(db_name);
             auto stored_key = to_serialized_key(key);
@@ -305,6 +392,7 @@ bool LmdbStorage::do_iterate_type_until_match(KeyType key_type,
                                               const IterateTypePredicate& visitor,
                                               const std::string& prefix) {
     ARCTICDB_SAMPLE(LmdbStorageItType, 0)
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::LMDB_List, key_type);
     auto txn = ::lmdb::txn::begin(env(), nullptr, MDB_RDONLY); // scoped abort on
     std::string type_db = fmt::format("{}", key_type);
     ::lmdb::dbi& dbi = get_dbi(type_db);
@@ -397,6 +485,7 @@ LmdbStorage::LmdbStorage(const LibraryPath& library_path, OpenMode mode, const C
     lib_dir_ = root_path / lib_path_str;
 
     write_mutex_ = std::make_unique<std::mutex>();
+    group_commit_queue_ = std::make_unique<GroupCommitQueue>();
     lmdb_instance_ = std::make_shared<LmdbInstance>(LmdbInstance{::lmdb::env::create(conf.flags()), {}});
 
     warn_if_lmdb_already_open();
@@ -473,6 +562,7 @@ void LmdbStorage::warn_if_lmdb_already_open() {
 LmdbStorage::LmdbStorage(LmdbStorage&& other) noexcept:
     Storage(std::move(static_cast<Storage&>(other))),
     write_mutex_(std::move(other.write_mutex_)),
+    group_commit_queue_(std::move(other.group_commit_queue_)),
     lmdb_instance_(std::move(other.lmdb_instance_)),
     lib_dir_(std::move(other.lib_dir_)) {
     other.lib_dir_ = "";
@@ -13,7 +13,9 @@
 #include <arcticdb/util/composite.hpp>
 #include <arcticdb/storage/lmdb/lmdb_client_interface.hpp>
 
+#include <condition_variable>
 #include <filesystem>
+#include <mutex>
 
 namespace fs = std::filesystem;
 
@@ -42,12 +44,20 @@ class LmdbStorage final : public Storage {
         storage::raise<ErrorCode::E_UNSUPPORTED_ATOMIC_OPERATION>("Atomic operations are only supported for s3 backend");
     };
 
+    void do_write_batch(std::span<KeySegmentPair> key_segs) final;
+
     void do_update(KeySegmentPair& key_seg, UpdateOpts opts) final;
 
     void do_read(VariantKey&& variant_key, const ReadVisitor& visitor, storage::ReadKeyOpts opts) final;
 
     KeySegmentPair do_read(VariantKey&& variant_key, ReadKeyOpts) final;
 
+    std::vector<folly::Try<KeySegmentPair>> do_read_batch(std::span<VariantKey> variant_keys, ReadKeyOpts opts) final;
+
+    bool supports_batch_operations() const final {
+        return true;
+    }
+
     void do_remove(VariantKey&& variant_key, RemoveOpts opts) final;
 
     void do_remove(std::span<VariantKey> variant_keys, RemoveOpts opts) final;
@@ -78,10 +88,31 @@ class LmdbStorage final : public Storage {
 
     void warn_if_lmdb_already_open();
 
+    KeySegmentPair do_read_internal(VariantKey&& variant_key, const std::shared_ptr<::lmdb::txn>& txn);
+
+    // A write from do_write waiting for the next group commit
+    struct PendingWrite {
+        KeySegmentPair& key_seg_;
+        std::exception_ptr error_ = nullptr;
+        bool done_ = false;
+    };
+
+    // Concurrent calls to do_write queue their writes here, and whichever caller finds no commit in progress writes
+    // everything queued so far in one transaction, so that concurrent writers share the cost of each commit
+    struct GroupCommitQueue {
+        std::mutex mutex_;
+        std::condition_variable committed_;
+        std::vector<PendingWrite*> pending_;
+        bool committing_ = false;
+    };
+
+    void commit_group(const std::vector<PendingWrite*>& group);
+
     // _internal methods assume the write mutex is already held
     void do_write_internal(KeySegmentPair& key_seg, ::lmdb::txn& txn);
     boost::container::small_vector<VariantKey, 1> do_remove_internal(std::span<VariantKey> variant_key, ::lmdb::txn& txn, RemoveOpts opts);
     std::unique_ptr<std::mutex> write_mutex_;
+    std::unique_ptr<GroupCommitQueue> group_commit_queue_;
     std::shared_ptr<LmdbInstance> lmdb_instance_;
 
     std::filesystem::path lib_dir_;
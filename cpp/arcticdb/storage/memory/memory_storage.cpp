@@ -12,6 +12,7 @@
 #include <arcticdb/codec/protobuf_mappings.hpp>
 #include <arcticdb/storage/storage_utils.hpp>
 #include <arcticdb/storage/storage_exceptions.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 
 namespace arcticdb::storage::memory {
 
@@ -31,8 +32,10 @@ std::string MemoryStorage::name() const {
 
 void MemoryStorage::do_write(KeySegmentPair& key_seg) {
     ARCTICDB_SAMPLE(MemoryStorageWrite, 0)
+    const auto key_type = variant_key_type(key_seg.variant_key());
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Memory_Write, key_type);
 
-    auto& key_vec = data_[variant_key_type(key_seg.variant_key())];
+    auto& key_vec = data_[key_type];
 
     util::variant_match(key_seg.variant_key(),
         [&](const RefKey& key) {
@@ -50,12 +53,15 @@ void MemoryStorage::do_write(KeySegmentPair& key_seg) {
             key_vec.try_emplace(key, key_seg.segment().clone());
         }
     );
+    query_stats::add(query_stats::TaskType::Memory_Write, key_type, query_stats::StatType::SIZE_BYTES, key_seg.segment().size());
 }
 
 void MemoryStorage::do_update(KeySegmentPair& key_seg, UpdateOpts opts) {
     ARCTICDB_SAMPLE(MemoryStorageUpdate, 0)
+    const auto key_type = variant_key_type(key_seg.variant_key());
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Memory_Write, key_type);
 
-    auto& key_vec = data_[variant_key_type(key_seg.variant_key())];
+    auto& key_vec = data_[key_type];
     auto it = key_vec.find(key_seg.variant_key());
 
     if (!opts.upsert_ && it == key_vec.end()) {
@@ -70,6 +76,7 @@ void MemoryStorage::do_update(KeySegmentPair& key_seg, UpdateOpts opts) {
 
     add_serialization_fields(key_seg);
     key_vec.insert(std::make_pair(key_seg.variant_key(), key_seg.segment().clone()));
+    query_stats::add(query_stats::TaskType::Memory_Write, key_type, query_stats::StatType::SIZE_BYTES, key_seg.segment().size());
 }
 
 void MemoryStorage::do_read(VariantKey&& variant_key, const ReadVisitor& visitor, ReadKeyOpts) {
@@ -79,11 +86,14 @@ void MemoryStorage::do_read(VariantKey&& variant_key, const ReadVisitor& visitor
 
 KeySegmentPair MemoryStorage::do_read(VariantKey&& variant_key, ReadKeyOpts) {
     ARCTICDB_SAMPLE(MemoryStorageRead, 0)
-    auto& key_vec = data_[variant_key_type(variant_key)];
+    const auto key_type = variant_key_type(variant_key);
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Memory_Read, key_type);
+    auto& key_vec = data_[key_type];
     auto it = key_vec.find(variant_key);
 
     if (it != key_vec.end()) {
         ARCTICDB_DEBUG(log::storage(), "Read key {}: {}", variant_key_type(variant_key), variant_key_view(variant_key));
+        query_stats::add(query_stats::TaskType::Memory_Read, key_type, query_stats::StatType::SIZE_BYTES, it->second.size());
         return {std::move(variant_key), it->second.clone()};
     } else {
         throw KeyNotFoundException(variant_key);
@@ -92,6 +102,7 @@ KeySegmentPair MemoryStorage::do_read(VariantKey&& variant_key, ReadKeyOpts) {
 
 bool MemoryStorage::do_key_exists(const VariantKey& key) {
     ARCTICDB_SAMPLE(MemoryStorageKeyExists, 0)
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Memory_KeyExists, variant_key_type(key));
     const auto& key_vec = data_[variant_key_type(key)];
     auto it = key_vec.find(key);
     return it != key_vec.end();
@@ -99,6 +110,7 @@ bool MemoryStorage::do_key_exists(const VariantKey& key) {
 
 void MemoryStorage::do_remove(VariantKey&& variant_key, RemoveOpts opts) {
     ARCTICDB_SAMPLE(MemoryStorageRemove, 0)
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Memory_Delete, variant_key_type(variant_key));
     auto& key_vec = data_[variant_key_type(variant_key)];
 
     auto it = key_vec.find(variant_key);
@@ -131,6 +143,7 @@ bool MemoryStorage::do_iterate_type_until_match(KeyType key_type,
                                                 const IterateTypePredicate& visitor,
                                                 const std::string& prefix) {
     ARCTICDB_SAMPLE(MemoryStorageItType, 0)
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Memory_List, key_type);
     auto& key_vec = data_[key_type];
     auto prefix_matcher = stream_id_prefix_matcher(prefix);
 
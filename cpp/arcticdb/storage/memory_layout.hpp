@@ -64,10 +64,12 @@ struct PassthroughCodec {
 struct PforCodec {
     static constexpr Codec type_ = Codec::PFOR;
 
-    uint32_t unused_ = 0;
+    uint32_t sub_codec_ = 0;
     uint16_t padding_ = 0;
 };
 
+static_assert(sizeof(PforCodec) == encoding_size);
+
 struct BlockCodec {
     Codec codec_ = Codec::UNKNOWN;
     constexpr static size_t DataSize = 24;
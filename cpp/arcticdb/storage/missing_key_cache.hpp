@@ -0,0 +1,61 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <mutex>
+
+#include <arcticdb/entity/atom_key.hpp>
+#include <arcticdb/util/clock.hpp>
+#include <arcticdb/util/lru_cache.hpp>
+
+namespace arcticdb {
+
+/*
+ * Keys recently found not to exist in a store, so that callers looking for keys that are usually absent, such as
+ * column stats, do not go to storage on every call. Entries expire so that keys written by other clients are found
+ * eventually, and once the cache is full the least recently used entry is evicted to make room for each new one.
+ */
+class MissingKeyCache {
+public:
+    static constexpr size_t default_capacity = 100'000;
+
+    explicit MissingKeyCache(size_t capacity = default_capacity) :
+        missing_since_(capacity) {
+    }
+
+    // Whether the key was found to be missing less than expiry_nanos ago
+    bool contains(const AtomKey& key, timestamp expiry_nanos) {
+        // LRUCache::get reorders its entries, so lookups are serialised too
+        std::lock_guard lock(mutex_);
+        const auto missing_since = missing_since_.get(key);
+        if (!missing_since)
+            return false;
+
+        if (util::SysClock::coarse_nanos_since_epoch() - *missing_since < expiry_nanos)
+            return true;
+
+        missing_since_.remove(key);
+        return false;
+    }
+
+    void insert(const AtomKey& key) {
+        std::lock_guard lock(mutex_);
+        missing_since_.put(key, util::SysClock::coarse_nanos_since_epoch());
+    }
+
+    void erase(const AtomKey& key) {
+        std::lock_guard lock(mutex_);
+        missing_since_.remove(key);
+    }
+
+private:
+    std::mutex mutex_;
+    LRUCache<AtomKey, timestamp> missing_since_;
+};
+
+} // namespace arcticdb
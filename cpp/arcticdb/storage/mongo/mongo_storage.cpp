@@ -21,6 +21,7 @@
 #include <arcticdb/storage/storage_options.hpp>
 #include <arcticdb/storage/storage.hpp>
 #include <arcticdb/storage/storage_exceptions.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 
 namespace arcticdb::storage::mongo {
 
@@ -79,11 +80,14 @@ void MongoStorage::do_write(KeySegmentPair &key_seg) {
 
     auto collection = collection_name(key_seg.key_type());
     auto key_view = key_seg.key_view();
+    const auto segment_size = key_seg.segment_ptr()->calculate_size();
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Mongo_Write, key_seg.key_type());
     try {
         auto success = client_->write_segment(db_, collection, key_seg);
         storage::check<ErrorCode::E_MONGO_BULK_OP_NO_REPLY>(success,
                                                             "Mongo did not acknowledge write for key {}",
                                                             key_view);
+        query_stats::add(query_stats::TaskType::Mongo_Write, key_seg.key_type(), query_stats::StatType::SIZE_BYTES, segment_size);
     } catch (const mongocxx::operation_exception &ex) {
         std::string object_name = std::string(key_view);
         raise_mongo_exception(ex, object_name);
@@ -95,6 +99,8 @@ void MongoStorage::do_update(KeySegmentPair &key_seg, UpdateOpts opts) {
 
     auto collection = collection_name(key_seg.key_type());
     auto key_view = key_seg.key_view();
+    const auto segment_size = key_seg.segment_ptr()->calculate_size();
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Mongo_Write, key_seg.key_type());
     try {
         auto result = client_->update_segment(db_, collection, key_seg, opts.upsert_);
         storage::check<ErrorCode::E_MONGO_BULK_OP_NO_REPLY>(result.modified_count.has_value(),
@@ -104,6 +110,7 @@ void MongoStorage::do_update(KeySegmentPair &key_seg, UpdateOpts opts) {
             throw storage::KeyNotFoundException(
                 fmt::format("update called with upsert=false but key does not exist: {}", key_view));
         }
+        query_stats::add(query_stats::TaskType::Mongo_Write, key_seg.key_type(), query_stats::StatType::SIZE_BYTES, segment_size);
     } catch (const mongocxx::operation_exception &ex) {
         std::string object_name = std::string(key_view);
         raise_mongo_exception(ex, object_name);
@@ -120,12 +127,14 @@ KeySegmentPair MongoStorage::do_read(VariantKey&& variant_key, ReadKeyOpts opts)
     boost::container::small_vector<VariantKey, 1> keys_not_found;
 
     auto collection = collection_name(variant_key_type(variant_key));
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Mongo_Read, variant_key_type(variant_key));
     try {
         auto kv = client_->read_segment(db_, collection, variant_key);
         // later we should add the key to failed_reads in this case
         if (!kv.has_value()) {
             throw KeyNotFoundException(variant_key);
         } else {
+            query_stats::add(query_stats::TaskType::Mongo_Read, variant_key_type(variant_key), query_stats::StatType::SIZE_BYTES, kv->segment_ptr()->calculate_size());
             return *kv;
         }
     } catch (const mongocxx::operation_exception &ex) {
@@ -159,6 +168,7 @@ void MongoStorage::do_remove(std::span<VariantKey> variant_keys, RemoveOpts opts
     (fg::from(variant_keys) | fg::move | fg::groupBy(fmt_db)).foreach([&](auto &&group) {
         for (auto &k : group.values()) {
             auto collection = collection_name(variant_key_type(k));
+            auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Mongo_Delete, group.key());
             try {
                 auto result = client_->remove_keyvalue(db_, collection, k);
                 storage::check<ErrorCode::E_MONGO_BULK_OP_NO_REPLY>(result.delete_count.has_value(),
@@ -193,6 +203,7 @@ bool MongoStorage::do_iterate_type_until_match(KeyType key_type,
     ARCTICDB_SAMPLE(MongoStorageItType, 0)
     std::vector<VariantKey> keys;
     try {
+        auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Mongo_List, key_type);
         keys = client_->list_keys(db_, collection, key_type, prefix);
     } catch (const mongocxx::operation_exception &ex) {
         // We don't raise when key is not found because we want to return an empty list instead of raising.
@@ -218,6 +229,7 @@ bool MongoStorage::do_is_path_valid(std::string_view path) const {
 
 bool MongoStorage::do_key_exists(const VariantKey &key) {
     auto collection = collection_name(variant_key_type(key));
+    auto query_stat_operation_time = query_stats::add_task_count_and_time(query_stats::TaskType::Mongo_KeyExists, variant_key_type(key));
     try {
         return client_->key_exists(db_, collection, key);
     } catch (const mongocxx::operation_exception &ex) {
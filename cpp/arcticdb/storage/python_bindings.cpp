@@ -135,6 +135,8 @@ void register_bindings(py::module& storage, py::exception<arcticdb::ArcticExcept
         .value("SNAPSHOT_TOMBSTONE", KeyType::SNAPSHOT_TOMBSTONE)
         .value("LOG_COMPACTED", KeyType::LOG_COMPACTED)
         .value("COLUMN_STATS", KeyType::COLUMN_STATS)
+        .value("ZSTD_DICTIONARY", KeyType::ZSTD_DICTIONARY)
+        .value("SNAPSHOT_GENERATION", KeyType::SNAPSHOT_GENERATION)
         ;
 
     py::enum_<OpenMode>(storage, "OpenMode")
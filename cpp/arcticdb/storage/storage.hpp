@@ -14,6 +14,7 @@
 #include <arcticdb/codec/codec.hpp>
 
 #include <folly/futures/Future.h>
+#include <folly/Try.h>
 
 #include <span>
 
@@ -99,6 +100,23 @@ public:
         return do_read(std::move(variant_key), opts);
     }
 
+    // Writes all the given keys, atomically for storages that support batch operations
+    void write_batch(std::span<KeySegmentPair> key_segs) {
+        ARCTICDB_SAMPLE(StorageWriteBatch, 0)
+        do_write_batch(key_segs);
+    }
+
+    // Reads all the given keys, returning the segment or the exception raised for each key in the same order
+    std::vector<folly::Try<KeySegmentPair>> read_batch(std::span<VariantKey> variant_keys, ReadKeyOpts opts) {
+        return do_read_batch(variant_keys, opts);
+    }
+
+    // True if write_batch and read_batch are cheaper than writing or reading the keys one at a time, for example
+    // because the whole batch shares a single transaction
+    [[nodiscard]] virtual bool supports_batch_operations() const {
+        return false;
+    }
+
     [[nodiscard]] virtual bool has_async_api() const {
         return false;
     }
@@ -235,6 +253,20 @@ private:
 
     virtual KeySegmentPair do_read(VariantKey&& variant_key, ReadKeyOpts opts) = 0;
 
+    virtual void do_write_batch(std::span<KeySegmentPair> key_segs) {
+        for (auto& key_seg : key_segs)
+            do_write(key_seg);
+    }
+
+    virtual std::vector<folly::Try<KeySegmentPair>> do_read_batch(std::span<VariantKey> variant_keys, ReadKeyOpts opts) {
+        std::vector<folly::Try<KeySegmentPair>> results;
+        results.reserve(variant_keys.size());
+        for (auto& variant_key : variant_keys)
+            results.emplace_back(folly::makeTryWith([&]() { return do_read(std::move(variant_key), opts); }));
+
+        return results;
+    }
+
     virtual void do_remove(VariantKey&& variant_key, RemoveOpts opts) = 0;
 
     virtual void do_remove(std::span<VariantKey> variant_keys, RemoveOpts opts) = 0;
@@ -1,5 +1,6 @@
 #include <arcticdb/storage/storage_utils.hpp>
 #include <arcticdb/pipeline/index_writer.hpp>
+#include <arcticdb/pipeline/index_segment_reader.hpp>
 #include <arcticdb/stream/index_aggregator.hpp>
 #include <arcticdb/async/tasks.hpp>
 
@@ -46,8 +47,7 @@ AtomKey write_table_index_tree_from_source_to_target(
 ) {
     ARCTICDB_SAMPLE(WriteIndexSourceToTarget, 0)
     // In
-    auto [_, index_seg] = source_store->read_sync(index_key);
-    index::IndexSegmentReader index_segment_reader{std::move(index_seg)};
+    auto index_segment_reader = index::get_index_reader(index_key, source_store);
     // Out
     index::IndexWriter<stream::RowCountIndex> writer(target_store,
             {index_key.id(), new_version_id.value_or(index_key.version_id())},
@@ -47,6 +47,11 @@ public:
         primary().write(key_seg);
     }
 
+    void write_batch(std::span<KeySegmentPair> key_segs) {
+        ARCTICDB_SAMPLE(StoragesWriteBatch, 0)
+        primary().write_batch(key_segs);
+    }
+
     void write_if_none(KeySegmentPair& kv) {
         primary().write_if_none(kv);
     }
@@ -64,6 +69,10 @@ public:
         return primary().supports_atomic_writes();
     }
 
+    [[nodiscard]] bool supports_batch_operations() const {
+        return primary().supports_batch_operations();
+    }
+
     [[nodiscard]] bool supports_object_size_calculation() {
         return std::all_of(storages_.begin(), storages_.end(), [](const auto& storage) {return storage->supports_object_size_calculation();});
     }
@@ -175,6 +184,19 @@ public:
         return folly::makeFuture(std::move(res));
     }
 
+    std::vector<folly::Try<KeySegmentPair>> read_batch(std::span<VariantKey> variant_keys, ReadKeyOpts opts, bool primary_only = true) {
+        ARCTICDB_RUNTIME_SAMPLE(StoragesReadBatch, 0)
+        if (primary_only)
+            return primary().read_batch(variant_keys, opts);
+
+        std::vector<folly::Try<KeySegmentPair>> results;
+        results.reserve(variant_keys.size());
+        for (const auto& variant_key : variant_keys)
+            results.emplace_back(folly::makeTryWith([&]() { return read_sync(variant_key, opts, primary_only); }));
+
+        return results;
+    }
+
     void iterate_type(KeyType key_type,
                       const IterateTypeVisitor& visitor,
                       const std::string& prefix = std::string{},
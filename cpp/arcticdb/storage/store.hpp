@@ -12,8 +12,12 @@
 #include <arcticdb/stream/stream_source.hpp>
 #include <arcticdb/stream/stream_sink.hpp>
 #include <arcticdb/entity/protobufs.hpp>
+#include <arcticdb/storage/missing_key_cache.hpp>
 
 namespace arcticdb {
+
+class ZstdDictionary;
+
 /*
  * The Store class aims, as much as possible, to be a fundamental, non-leaky abstraction.
  *
@@ -29,6 +33,9 @@ class Store : public stream::StreamSink, public stream::StreamSource, public std
 public:
     virtual void set_failure_sim(const arcticdb::proto::storage::VersionStoreConfig::StorageFailureSimulator& cfg) = 0;
 
+    /// Segments of the key types that use it are compressed with the dictionary from then on, see uses_zstd_dictionary
+    virtual void set_zstd_dictionary(std::shared_ptr<const ZstdDictionary> dictionary) = 0;
+
     virtual void move_storage(KeyType key_type, timestamp horizon, size_t storage_index) = 0;
 
     virtual folly::Future<VariantKey> copy(KeyType key_type, const StreamId& stream_id, VersionId version_id, const VariantKey& source_key) = 0;
@@ -36,6 +43,14 @@ public:
     virtual VariantKey copy_sync(KeyType key_type, const StreamId& stream_id, VersionId version_id, const VariantKey& source_key) = 0;
     
     virtual std::string name() const = 0;
+
+    /// Keys of this store recently found not to exist, see MissingKeyCache
+    MissingKeyCache& missing_keys() {
+        return *missing_keys_;
+    }
+
+private:
+    std::shared_ptr<MissingKeyCache> missing_keys_ = std::make_shared<MissingKeyCache>();
 };
 
 } // namespace arcticdb
\ No newline at end of file
@@ -508,6 +508,9 @@ public:
 
     void set_failure_sim(const arcticdb::proto::storage::VersionStoreConfig::StorageFailureSimulator&) override {}
 
+    // Segments are held uncompressed
+    void set_zstd_dictionary(std::shared_ptr<const ZstdDictionary>) override {}
+
     std::string name() const override {
         return "InMemoryStore";
     }
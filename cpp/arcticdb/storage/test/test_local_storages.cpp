@@ -11,8 +11,10 @@
 #include <arcticdb/storage/storage.hpp>
 #include <arcticdb/stream/test/stream_test_common.hpp>
 
+#include <atomic>
 #include <filesystem>
 #include <stdexcept>
+#include <thread>
 #include <arcticdb/entity/atom_key.hpp>
 #include <arcticdb/entity/types.hpp>
 #include <arcticdb/util/test/test_utils.hpp>
@@ -147,6 +149,82 @@ TEST_P(LocalStorageTestSuite, Strings) {
   ASSERT_EQ(std::string("baggy"), res_mem.string_at(1, 3));
 }
 
+as::KeySegmentPair test_key_segment(ac::entity::AtomKey key) {
+  auto segment_in_memory = get_test_frame<arcticdb::stream::TimeseriesIndex>("symbol", {}, 10, 0).segment_;
+  auto segment = encode_dispatch(std::move(segment_in_memory), proto::encoding::VariantCodec(), arcticdb::EncodingVersion::V2);
+  return {std::move(key), std::move(segment)};
+}
+
+TEST_P(LocalStorageTestSuite, BatchOperations) {
+  std::unique_ptr<as::Storage> storage = GetParam().new_storage();
+  std::vector<as::KeySegmentPair> kvs;
+  std::vector<ac::entity::VariantKey> keys;
+  for (auto i = 0; i < 5; ++i) {
+    auto k = ac::entity::atom_key_builder().gen_id(i).build<ac::entity::KeyType::TABLE_DATA>(NumericId{999});
+    keys.emplace_back(k);
+    kvs.emplace_back(test_key_segment(std::move(k)));
+  }
+  storage->write_batch(std::span(kvs));
+  for (const auto& k : keys)
+    ASSERT_TRUE(storage->key_exists(k));
+
+  auto missing = ac::entity::atom_key_builder().gen_id(10).build<ac::entity::KeyType::TABLE_DATA>(NumericId{999});
+  auto keys_to_read = keys;
+  keys_to_read.insert(keys_to_read.begin() + 2, missing);
+  // read_batch consumes the keys, so read from a copy
+  auto read_keys = keys_to_read;
+  auto results = storage->read_batch(std::span(read_keys), as::ReadKeyOpts{});
+  ASSERT_EQ(results.size(), keys_to_read.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    if (i == 2) {
+      ASSERT_TRUE(results[i].hasException<as::KeyNotFoundException>());
+    } else {
+      ASSERT_TRUE(results[i].hasValue());
+      ASSERT_EQ(results[i].value().variant_key(), keys_to_read[i]);
+      auto seg = decode_segment(*results[i].value().segment_ptr());
+      ASSERT_EQ(seg.row_count(), 10);
+    }
+  }
+}
+
+TEST_P(LocalStorageTestSuite, ConcurrentWrites) {
+  std::unique_ptr<as::Storage> storage = GetParam().new_storage();
+  if (!storage->supports_batch_operations())
+    GTEST_SKIP() << "Storage does not support concurrent writers";
+
+  constexpr auto num_threads = 8;
+  constexpr auto writes_per_thread = 20;
+  auto key_for = [](int thread, int write) {
+    return ac::entity::atom_key_builder().gen_id(thread * writes_per_thread + write).build<ac::entity::KeyType::TABLE_DATA>(NumericId{999});
+  };
+  // Every writer also attempts to write one key that another writer has written, which must fail without affecting the
+  // other writes committed alongside it
+  std::atomic<int> duplicate_failures{0};
+  std::vector<std::thread> threads;
+  for (auto t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (auto w = 0; w < writes_per_thread; ++w) {
+        auto kv = test_key_segment(key_for(t, w));
+        storage->write(kv);
+      }
+      auto duplicate = test_key_segment(key_for((t + 1) % num_threads, 0));
+      try {
+        storage->write(duplicate);
+      } catch (const as::DuplicateKeyException&) {
+        ++duplicate_failures;
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  ASSERT_EQ(duplicate_failures, num_threads);
+  for (auto t = 0; t < num_threads; ++t) {
+    for (auto w = 0; w < writes_per_thread; ++w)
+      ASSERT_TRUE(storage->key_exists(key_for(t, w)));
+  }
+}
+
 using namespace std::string_literals;
 
 std::vector<StorageGenerator> get_storage_generators() {
@@ -0,0 +1,61 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/storage/missing_key_cache.hpp>
+#include <arcticdb/storage/test/in_memory_store.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+constexpr timestamp one_minute = 60'000'000'000;
+
+AtomKey column_stats_key(const std::string& symbol) {
+    return entity::atom_key_builder().version_id(1).build<KeyType::COLUMN_STATS>(StreamId{symbol});
+}
+
+} // namespace
+
+TEST(MissingKeyCache, EvictsLeastRecentlyUsed) {
+    MissingKeyCache cache{2};
+    const auto first = column_stats_key("first");
+    const auto second = column_stats_key("second");
+    const auto third = column_stats_key("third");
+    cache.insert(first);
+    cache.insert(second);
+    // Looking up the first key makes the second the least recently used
+    ASSERT_TRUE(cache.contains(first, one_minute));
+    cache.insert(third);
+    ASSERT_TRUE(cache.contains(first, one_minute));
+    ASSERT_FALSE(cache.contains(second, one_minute));
+    ASSERT_TRUE(cache.contains(third, one_minute));
+}
+
+TEST(MissingKeyCache, ExpiryAndErase) {
+    MissingKeyCache cache;
+    const auto key = column_stats_key("sym");
+    cache.insert(key);
+    ASSERT_FALSE(cache.contains(key, 0));
+    // Expired entries are removed
+    ASSERT_FALSE(cache.contains(key, one_minute));
+
+    cache.insert(key);
+    ASSERT_TRUE(cache.contains(key, one_minute));
+    cache.erase(key);
+    ASSERT_FALSE(cache.contains(key, one_minute));
+}
+
+TEST(MissingKeyCache, ScopedToStore) {
+    auto first_store = std::make_shared<InMemoryStore>();
+    auto second_store = std::make_shared<InMemoryStore>();
+    const auto key = column_stats_key("sym");
+    first_store->missing_keys().insert(key);
+    ASSERT_TRUE(first_store->missing_keys().contains(key, one_minute));
+    ASSERT_FALSE(second_store->missing_keys().contains(key, one_minute));
+}
@@ -0,0 +1,307 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/stream/merge.hpp>
+#include <arcticdb/column_store/string_pool.hpp>
+#include <arcticdb/entity/type_utils.hpp>
+#include <arcticdb/util/bitset.hpp>
+
+#include <folly/container/Enumerate.h>
+#include <ankerl/unordered_dense.h>
+
+#include <queue>
+
+namespace arcticdb::stream {
+
+namespace {
+
+// Returns the end of the run of rows of index starting at from whose values are before bound, or equal to it if
+// inclusive. Gallops forward in doubling steps before binary searching, so that long runs are found in logarithmic time
+// and runs of a single row in constant time
+size_t gallop(std::span<const timestamp> index, size_t from, timestamp bound, bool inclusive) {
+    const auto in_run = [bound, inclusive](timestamp value) {
+        return inclusive ? value <= bound : value < bound;
+    };
+    size_t last_in_run = from;
+    size_t step = 1;
+    while (from + step < index.size() && in_run(index[from + step])) {
+        last_in_run = from + step;
+        step *= 2;
+    }
+    const auto search_end = std::min(index.size(), from + step);
+    return static_cast<size_t>(std::partition_point(index.begin() + last_in_run + 1, index.begin() + search_end, in_run) - index.begin());
+}
+
+// The runs making up one output segment
+struct OutputSegmentRuns {
+    std::vector<MergeRun> runs_;
+    size_t num_rows_ = 0;
+};
+
+std::vector<OutputSegmentRuns> split_runs(const std::vector<MergeRun>& runs, size_t rows_per_segment) {
+    std::vector<OutputSegmentRuns> output;
+    for (auto run : runs) {
+        while (run.num_rows_ > 0) {
+            if (output.empty() || output.back().num_rows_ == rows_per_segment)
+                output.emplace_back();
+
+            auto& current = output.back();
+            const auto num_rows = std::min(run.num_rows_, rows_per_segment - current.num_rows_);
+            current.runs_.emplace_back(MergeRun{run.input_, run.start_row_, num_rows});
+            current.num_rows_ += num_rows;
+            run.start_row_ += num_rows;
+            run.num_rows_ -= num_rows;
+        }
+    }
+    return output;
+}
+
+// The number of rows in [start_row, start_row + num_rows) of the column that have a value
+size_t values_in_range(const Column& column, size_t start_row, size_t num_rows) {
+    if (!column.is_sparse())
+        return num_rows;
+
+    const auto& sparse_map = column.sparse_map();
+    // Sparse maps do not include trailing unset bits
+    const auto end_row = std::min(start_row + num_rows, static_cast<size_t>(sparse_map.size()));
+    return start_row < end_row ? sparse_map.count_range(bv_size(start_row), bv_size(end_row - 1)) : 0;
+}
+
+// Input columns are only converted to the output type along the promotions that has_valid_common_type allows, so
+// merging never narrows values or reinterprets them as another kind of type. Strings are copied between string pools,
+// whatever their encoding
+void check_convertible(const TypeDescriptor& input_type, const TypeDescriptor& output_type, std::string_view column_name) {
+    if (is_sequence_type(input_type.data_type()) && is_sequence_type(output_type.data_type()))
+        return;
+
+    schema::check<ErrorCode::E_DESCRIPTOR_MISMATCH>(
+        has_valid_common_type(input_type, output_type) == output_type,
+        "Cannot convert {} to {} when merging column '{}'",
+        input_type,
+        output_type,
+        column_name);
+}
+
+// The types have already been checked with check_convertible, the conditions here only exclude the pairs that cannot
+// be instantiated
+template<typename OutputTag, typename InputTag>
+void copy_values(
+        const typename InputTag::raw_type* input,
+        size_t count,
+        typename OutputTag::raw_type* output,
+        const StringPool& input_pool,
+        StringPool& output_pool,
+        ankerl::unordered_dense::map<position_t, position_t>& string_mapping,
+        std::string_view column_name) {
+    using OutputRawType = typename OutputTag::raw_type;
+    constexpr auto input_type = InputTag::data_type;
+    constexpr auto output_type = OutputTag::data_type;
+    if constexpr (is_sequence_type(input_type) && is_sequence_type(output_type)) {
+        // Each distinct string is only looked up in the output pool once
+        for (size_t idx = 0; idx < count; ++idx) {
+            const auto offset = static_cast<position_t>(input[idx]);
+            if (offset == not_a_string() || offset == nan_placeholder()) {
+                output[idx] = static_cast<OutputRawType>(offset);
+            } else {
+                auto [it, inserted] = string_mapping.try_emplace(offset, 0);
+                if (inserted)
+                    it->second = output_pool.get(input_pool.get_const_view(offset)).offset();
+
+                output[idx] = static_cast<OutputRawType>(it->second);
+            }
+        }
+    } else if constexpr (input_type == output_type) {
+        std::memcpy(output, input, count * sizeof(OutputRawType));
+    } else if constexpr (!is_sequence_type(input_type) && !is_sequence_type(output_type) &&
+                         !is_empty_type(input_type) && !is_empty_type(output_type) &&
+                         std::is_convertible_v<typename InputTag::raw_type, OutputRawType>) {
+        for (size_t idx = 0; idx < count; ++idx)
+            output[idx] = static_cast<OutputRawType>(input[idx]);
+    } else {
+        schema::raise<ErrorCode::E_DESCRIPTOR_MISMATCH>(
+            "Cannot convert {} to {} when merging column '{}'",
+            input_type,
+            output_type,
+            column_name);
+    }
+}
+
+// Gathers one field of the output across all of the output segments. The runs of each input are in row order across
+// the output segments, so the physical row that the next run of each input starts from only ever moves forward
+void gather_field(
+        std::vector<SegmentInMemory>& inputs,
+        const std::vector<OutputSegmentRuns>& output_runs,
+        std::vector<SegmentInMemory>& outputs,
+        const Field& field,
+        size_t field_idx,
+        Sparsity allow_sparse) {
+    const auto output_data_type = field.type().data_type();
+    if (is_empty_type(output_data_type))
+        return;
+
+    util::check(field.type().dimension() == Dimension::Dim0, "Cannot merge non-scalar column '{}'", field.name());
+
+    std::vector<std::optional<position_t>> input_columns;
+    input_columns.reserve(inputs.size());
+    for (const auto& input : inputs) {
+        const auto column_idx = input.column_index(field.name());
+        if (column_idx && !is_empty_type(input.column(static_cast<position_t>(*column_idx)).type().data_type())) {
+            check_convertible(input.column(static_cast<position_t>(*column_idx)).type(), field.type(), field.name());
+            input_columns.emplace_back(static_cast<position_t>(*column_idx));
+        } else {
+            input_columns.emplace_back(std::nullopt);
+        }
+    }
+    std::vector<size_t> next_physical_row(inputs.size(), 0);
+
+    details::visit_type(output_data_type, [&](auto output_tag) {
+        using OutputTag = decltype(output_tag);
+        using OutputRawType = typename OutputTag::raw_type;
+        for (auto&& [segment_idx, segment_runs] : folly::enumerate(output_runs)) {
+            size_t num_values = 0;
+            for (const auto& run : segment_runs.runs_) {
+                if (const auto& column_idx = input_columns[run.input_]; column_idx)
+                    num_values += values_in_range(inputs[run.input_].column(*column_idx), run.start_row_, run.num_rows_);
+            }
+            if (num_values == 0)
+                continue;
+
+            util::check(num_values == segment_runs.num_rows_ || allow_sparse == Sparsity::PERMITTED,
+                        "Cannot merge column '{}' with missing values when sparse columns are not permitted", field.name());
+
+            auto buffer = ChunkedBuffer::presized(num_values * sizeof(OutputRawType));
+            auto* output_ptr = buffer.ptr_cast<OutputRawType>(0, num_values * sizeof(OutputRawType));
+            std::optional<util::BitSet> sparse_map;
+            if (num_values < segment_runs.num_rows_)
+                sparse_map.emplace(bv_size(segment_runs.num_rows_));
+
+            auto& output_pool = outputs[segment_idx].string_pool();
+            std::vector<ankerl::unordered_dense::map<position_t, position_t>> string_mappings(inputs.size());
+            size_t output_row = 0;
+            for (const auto& run : segment_runs.runs_) {
+                const auto& column_idx = input_columns[run.input_];
+                const auto count = column_idx ? values_in_range(inputs[run.input_].column(*column_idx), run.start_row_, run.num_rows_) : 0;
+                if (count > 0) {
+                    const auto& column = inputs[run.input_].column(*column_idx);
+                    auto& physical_row = next_physical_row[run.input_];
+                    details::visit_type(column.type().data_type(), [&](auto input_tag) {
+                        using InputTag = decltype(input_tag);
+                        using InputRawType = typename InputTag::raw_type;
+                        const auto* input_ptr = column.ptr_cast<InputRawType>(static_cast<position_t>(physical_row), count * sizeof(InputRawType));
+                        copy_values<OutputTag, InputTag>(
+                            input_ptr,
+                            count,
+                            output_ptr,
+                            inputs[run.input_].const_string_pool(),
+                            output_pool,
+                            string_mappings[run.input_],
+                            field.name());
+                    });
+                    if (sparse_map) {
+                        if (column.is_sparse()) {
+                            const auto run_end = run.start_row_ + run.num_rows_;
+                            for (util::BitSet::enumerator en{&column.sparse_map(), bv_size(run.start_row_)}; en.valid() && *en < run_end; ++en)
+                                sparse_map->set(bv_size(output_row + (*en - run.start_row_)));
+                        } else {
+                            sparse_map->set_range(bv_size(output_row), bv_size(output_row + run.num_rows_ - 1));
+                        }
+                    }
+                    output_ptr += count;
+                    physical_row += count;
+                }
+                output_row += run.num_rows_;
+            }
+
+            Column output_column{field.type(), allow_sparse, std::move(buffer)};
+            if (sparse_map)
+                output_column.set_sparse_map(std::move(*sparse_map));
+
+            outputs[segment_idx].column(static_cast<position_t>(field_idx)) = std::move(output_column);
+        }
+    });
+}
+
+} // namespace
+
+std::vector<MergeRun> merge_runs(const std::vector<std::span<const timestamp>>& indexes) {
+    // Heads of the inputs ordered by value and then by input, smallest first
+    using Head = std::pair<timestamp, size_t>;
+    std::priority_queue<Head, std::vector<Head>, std::greater<>> heads;
+    for (size_t input = 0; input < indexes.size(); ++input) {
+        if (!indexes[input].empty())
+            heads.emplace(indexes[input].front(), input);
+    }
+
+    std::vector<size_t> positions(indexes.size(), 0);
+    std::vector<MergeRun> runs;
+    while (!heads.empty()) {
+        const auto input = heads.top().second;
+        heads.pop();
+        const auto& index = indexes[input];
+        auto& position = positions[input];
+        size_t end;
+        if (heads.empty()) {
+            end = index.size();
+        } else {
+            // Rows equal to the next head only belong to this run if this input is ordered before the next head's
+            const auto [bound, bound_input] = heads.top();
+            end = gallop(index, position, bound, input < bound_input);
+        }
+        runs.emplace_back(MergeRun{input, position, end - position});
+        position = end;
+        if (position < index.size())
+            heads.emplace(index[position], input);
+    }
+    return runs;
+}
+
+std::vector<SegmentInMemory> merge_sorted_segments(
+        std::vector<SegmentInMemory>&& inputs,
+        const StreamDescriptor& output_descriptor,
+        Sparsity allow_sparse,
+        size_t rows_per_segment) {
+    util::check(rows_per_segment > 0, "Expected positive rows per segment in merge_sorted_segments");
+    std::vector<std::span<const timestamp>> indexes;
+    indexes.reserve(inputs.size());
+    for (auto& input : inputs) {
+        const auto num_rows = static_cast<size_t>(input.row_count());
+        if (num_rows == 0) {
+            indexes.emplace_back();
+            continue;
+        }
+        // Every run is then contiguous in memory and can be copied in one go
+        input.compact_blocks();
+        const auto& index_column = input.column(0);
+        util::check(index_column.type().data_type() == DataType::NANOSECONDS_UTC64 && !index_column.is_sparse(),
+                    "Expected a dense timestamp index in the first column of each input to merge_sorted_segments, got {}",
+                    index_column.type());
+        indexes.emplace_back(index_column.ptr_cast<timestamp>(0, num_rows * sizeof(timestamp)), num_rows);
+    }
+
+    const auto runs = merge_runs(indexes);
+    // NaT is definied as std::numeric_limits<int64_t>::min(), if there are any NaT values they will be at the start of the merge
+    if (!runs.empty()) {
+        sorting::check<ErrorCode::E_UNSORTED_DATA>(indexes[runs[0].input_][runs[0].start_row_] != NaT,
+                                                   "NaT values are not allowed in the index");
+    }
+
+    const auto output_runs = split_runs(runs, rows_per_segment);
+    std::vector<SegmentInMemory> outputs;
+    outputs.reserve(output_runs.size());
+    for (size_t idx = 0; idx < output_runs.size(); ++idx)
+        outputs.emplace_back(output_descriptor.clone(), 0, AllocationType::DYNAMIC, allow_sparse);
+
+    for (size_t field_idx = 0; field_idx < output_descriptor.field_count(); ++field_idx)
+        gather_field(inputs, output_runs, outputs, output_descriptor.field(field_idx), field_idx, allow_sparse);
+
+    for (auto&& [idx, output] : folly::enumerate(outputs))
+        output.set_row_data(static_cast<ssize_t>(output_runs[idx].num_rows_) - 1);
+
+    return outputs;
+}
+
+} // namespace arcticdb::stream
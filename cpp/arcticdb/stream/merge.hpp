@@ -13,12 +13,15 @@
 #include <arcticdb/util/constants.hpp>
 #include <arcticdb/stream/schema.hpp>
 #include <arcticdb/storage/memory_layout.hpp>
+#include <arcticdb/column_store/memory_segment.hpp>
 #include <arcticdb/entity/stream_descriptor.hpp>
 #include <arcticdb/entity/types.hpp>
 #include <arcticdb/util/preconditions.hpp>
 #include <arcticdb/util/error_code.hpp>
 #include <ankerl/unordered_dense.h>
 
+#include <span>
+
 template<typename Aggregator>
 inline consteval bool is_static_schema() {
     if constexpr (std::is_same_v<typename Aggregator::SchemaPolicy, arcticdb::stream::DynamicSchema>) {
@@ -37,6 +40,38 @@ inline consteval bool is_dynamic_schema() {
 
 
 namespace arcticdb::stream {
+
+// A run of consecutive rows of one input that are also consecutive in the merged output
+struct MergeRun {
+    size_t input_;
+    size_t start_row_;
+    size_t num_rows_;
+
+    bool operator==(const MergeRun&) const = default;
+};
+
+// Computes the order of the rows in the k-way merge of the given index columns, each of which must be sorted, as runs
+// of consecutive rows from a single input. Rather than comparing a row at a time, each run is found by galloping
+// through the input at the top of the heap to the head of the next input. Rows with equal index values are ordered by
+// input, so the merge is stable.
+std::vector<MergeRun> merge_runs(const std::vector<std::span<const timestamp>>& indexes);
+
+/*
+ * Columnar alternative to do_merge for segments that are each sorted on a timestamp index in their first column.
+ * The merged row order is computed on the index columns alone with merge_runs, and then every column of the output is
+ * gathered run by run with typed bulk copies, rather than a row at a time through an aggregator.
+ *
+ * The output segments each have the fields of output_descriptor and at most rows_per_segment rows. Columns missing from
+ * an input, or sparse in it, are sparse in the output, which requires allow_sparse to be PERMITTED. Values are
+ * converted to the output type where this differs from the input type, and strings are copied into the string pool of
+ * each output segment.
+ */
+std::vector<SegmentInMemory> merge_sorted_segments(
+    std::vector<SegmentInMemory>&& inputs,
+    const StreamDescriptor& output_descriptor,
+    Sparsity allow_sparse,
+    size_t rows_per_segment);
+
 template<typename IndexType, typename AggregatorType, typename QueueType>
 void do_merge(
     QueueType& input_streams,
@@ -0,0 +1,192 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/stream/merge.hpp>
+#include <arcticdb/stream/index.hpp>
+
+using namespace arcticdb;
+namespace as = arcticdb::stream;
+
+namespace {
+
+// A segment with a timestamp index and one column, where missing values leave the column sparse
+template<typename T>
+SegmentInMemory make_segment(const std::vector<timestamp>& index, std::string_view name, const std::vector<std::optional<T>>& values) {
+    constexpr auto data_type = data_type_from_raw_type<T>();
+    auto desc = as::TimeseriesIndex::default_index().create_stream_descriptor(NumericId{123}, {scalar_field(data_type, name)});
+    SegmentInMemory segment{desc, index.size(), AllocationType::DYNAMIC, Sparsity::PERMITTED};
+    for (size_t row = 0; row < index.size(); ++row) {
+        segment.column(0).push_back(index[row]);
+        if (values[row])
+            segment.column(1).set_scalar(static_cast<ssize_t>(row), *values[row]);
+    }
+    segment.set_row_data(static_cast<ssize_t>(index.size()) - 1);
+    return segment;
+}
+
+SegmentInMemory make_string_segment(const std::vector<timestamp>& index, const std::vector<std::optional<std::string>>& values) {
+    auto desc = as::TimeseriesIndex::default_index().create_stream_descriptor(NumericId{123}, {scalar_field(DataType::UTF_DYNAMIC64, "str")});
+    SegmentInMemory segment{desc, index.size(), AllocationType::DYNAMIC, Sparsity::PERMITTED};
+    for (size_t row = 0; row < index.size(); ++row) {
+        segment.column(0).push_back(index[row]);
+        const auto offset = values[row] ? segment.string_pool().get(*values[row]).offset() : not_a_string();
+        segment.column(1).push_back(offset);
+    }
+    segment.set_row_data(static_cast<ssize_t>(index.size()) - 1);
+    return segment;
+}
+
+std::vector<timestamp> index_values(const std::vector<SegmentInMemory>& segments) {
+    std::vector<timestamp> res;
+    for (const auto& segment : segments) {
+        for (position_t row = 0; row < segment.row_count(); ++row)
+            res.emplace_back(*segment.column(0).scalar_at<timestamp>(row));
+    }
+    return res;
+}
+
+template<typename T>
+std::vector<std::optional<T>> column_values(const std::vector<SegmentInMemory>& segments, position_t column) {
+    std::vector<std::optional<T>> res;
+    for (const auto& segment : segments) {
+        for (position_t row = 0; row < segment.row_count(); ++row)
+            res.emplace_back(segment.column(column).scalar_at<T>(row));
+    }
+    return res;
+}
+
+} // namespace
+
+TEST(Merge, RunsInterleaved) {
+    const std::vector<timestamp> first{0, 2, 4, 6};
+    const std::vector<timestamp> second{1, 3, 5, 7};
+    const auto runs = as::merge_runs({first, second});
+    std::vector<as::MergeRun> expected;
+    for (size_t row = 0; row < 4; ++row) {
+        expected.emplace_back(as::MergeRun{0, row, 1});
+        expected.emplace_back(as::MergeRun{1, row, 1});
+    }
+    ASSERT_EQ(runs, expected);
+}
+
+TEST(Merge, RunsOrdered) {
+    std::vector<timestamp> first(1000);
+    std::vector<timestamp> second(1000);
+    std::iota(first.begin(), first.end(), 1000);
+    std::iota(second.begin(), second.end(), 0);
+    const std::vector<timestamp> empty;
+    // Inputs that do not overlap are each taken in a single run
+    const auto runs = as::merge_runs({first, empty, second});
+    ASSERT_EQ(runs, std::vector<as::MergeRun>({{2, 0, 1000}, {0, 0, 1000}}));
+}
+
+TEST(Merge, RunsTies) {
+    // Equal index values are taken from the inputs in order
+    const std::vector<timestamp> first{1, 1, 2, 2, 3};
+    const std::vector<timestamp> second{1, 2, 2, 3, 3};
+    const auto runs = as::merge_runs({first, second});
+    ASSERT_EQ(runs, std::vector<as::MergeRun>({{0, 0, 2}, {1, 0, 1}, {0, 2, 2}, {1, 1, 2}, {0, 4, 1}, {1, 3, 2}}));
+}
+
+TEST(Merge, SegmentsSplitByRowCount) {
+    std::vector<SegmentInMemory> inputs;
+    inputs.emplace_back(make_segment<int64_t>({0, 2, 4, 6, 8}, "col", {0, 2, 4, 6, 8}));
+    inputs.emplace_back(make_segment<int64_t>({1, 3, 5, 7, 9}, "col", {1, 3, 5, 7, 9}));
+    const auto desc = inputs[0].descriptor().clone();
+    const auto outputs = as::merge_sorted_segments(std::move(inputs), desc, Sparsity::NOT_PERMITTED, 4);
+    ASSERT_EQ(outputs.size(), 3);
+    ASSERT_EQ(outputs[0].row_count(), 4);
+    ASSERT_EQ(outputs[2].row_count(), 2);
+    std::vector<timestamp> expected_index(10);
+    std::iota(expected_index.begin(), expected_index.end(), 0);
+    ASSERT_EQ(index_values(outputs), expected_index);
+    std::vector<std::optional<int64_t>> expected_values(expected_index.begin(), expected_index.end());
+    ASSERT_EQ(column_values<int64_t>(outputs, 1), expected_values);
+}
+
+TEST(Merge, SparseAndMissingColumns) {
+    std::vector<SegmentInMemory> inputs;
+    inputs.emplace_back(make_segment<double>({0, 2, 4}, "col", {1.0, std::nullopt, 3.0}));
+    inputs.emplace_back(make_segment<double>({1, 3, 5}, "other", {10.0, 20.0, 30.0}));
+    auto desc = inputs[0].descriptor().clone();
+    desc.add_scalar_field(DataType::FLOAT64, "other");
+    const auto outputs = as::merge_sorted_segments(std::move(inputs), desc, Sparsity::PERMITTED, 100);
+    ASSERT_EQ(outputs.size(), 1);
+    ASSERT_EQ(column_values<double>(outputs, 1),
+              std::vector<std::optional<double>>({1.0, std::nullopt, std::nullopt, std::nullopt, 3.0, std::nullopt}));
+    ASSERT_EQ(column_values<double>(outputs, 2),
+              std::vector<std::optional<double>>({std::nullopt, 10.0, std::nullopt, 20.0, std::nullopt, 30.0}));
+}
+
+TEST(Merge, MissingValuesNotPermitted) {
+    std::vector<SegmentInMemory> inputs;
+    inputs.emplace_back(make_segment<double>({0, 2}, "col", {1.0, 2.0}));
+    inputs.emplace_back(make_segment<double>({1, 3}, "other", {1.0, 2.0}));
+    const auto desc = inputs[0].descriptor().clone();
+    ASSERT_THROW(as::merge_sorted_segments(std::move(inputs), desc, Sparsity::NOT_PERMITTED, 100), ArcticException);
+}
+
+TEST(Merge, TypePromotion) {
+    std::vector<SegmentInMemory> inputs;
+    inputs.emplace_back(make_segment<int8_t>({0, 2}, "col", {1, 2}));
+    inputs.emplace_back(make_segment<int64_t>({1, 3}, "col", {std::numeric_limits<int64_t>::max(), -4}));
+    const auto desc = inputs[1].descriptor().clone();
+    const auto outputs = as::merge_sorted_segments(std::move(inputs), desc, Sparsity::NOT_PERMITTED, 100);
+    ASSERT_EQ(column_values<int64_t>(outputs, 1),
+              std::vector<std::optional<int64_t>>({1, std::numeric_limits<int64_t>::max(), 2, -4}));
+}
+
+TEST(Merge, NarrowingConversionRejected) {
+    // Only the promotions that has_valid_common_type allows are applied, so narrowing or changing the sign is rejected
+    std::vector<SegmentInMemory> narrowing;
+    narrowing.emplace_back(make_segment<int32_t>({0, 2}, "col", {1, 2}));
+    narrowing.emplace_back(make_segment<int64_t>({1, 3}, "col", {std::numeric_limits<int64_t>::max(), -4}));
+    const auto narrowing_desc = narrowing[0].descriptor().clone();
+    ASSERT_THROW(as::merge_sorted_segments(std::move(narrowing), narrowing_desc, Sparsity::NOT_PERMITTED, 100), SchemaException);
+
+    std::vector<SegmentInMemory> signed_to_unsigned;
+    signed_to_unsigned.emplace_back(make_segment<uint64_t>({0, 2}, "col", {1, 2}));
+    signed_to_unsigned.emplace_back(make_segment<int8_t>({1, 3}, "col", {3, -4}));
+    const auto unsigned_desc = signed_to_unsigned[0].descriptor().clone();
+    ASSERT_THROW(as::merge_sorted_segments(std::move(signed_to_unsigned), unsigned_desc, Sparsity::NOT_PERMITTED, 100), SchemaException);
+
+    std::vector<SegmentInMemory> integer_to_float;
+    integer_to_float.emplace_back(make_segment<double>({0, 2}, "col", {0.5, 2.5}));
+    integer_to_float.emplace_back(make_segment<int64_t>({1, 3}, "col", {1, -4}));
+    const auto float_desc = integer_to_float[0].descriptor().clone();
+    const auto outputs = as::merge_sorted_segments(std::move(integer_to_float), float_desc, Sparsity::NOT_PERMITTED, 100);
+    ASSERT_EQ(column_values<double>(outputs, 1), std::vector<std::optional<double>>({0.5, 1.0, 2.5, -4.0}));
+}
+
+TEST(Merge, Strings) {
+    std::vector<SegmentInMemory> inputs;
+    inputs.emplace_back(make_string_segment({0, 2, 4}, {"a", std::nullopt, "a"}));
+    inputs.emplace_back(make_string_segment({1, 3, 5}, {"b", "c", "a"}));
+    const auto desc = inputs[0].descriptor().clone();
+    const auto outputs = as::merge_sorted_segments(std::move(inputs), desc, Sparsity::NOT_PERMITTED, 4);
+    ASSERT_EQ(outputs.size(), 2);
+    std::vector<std::optional<std::string>> values;
+    for (const auto& output : outputs) {
+        for (position_t row = 0; row < output.row_count(); ++row) {
+            const auto str = output.string_at(row, 1);
+            values.emplace_back(str ? std::make_optional<std::string>(*str) : std::nullopt);
+        }
+    }
+    ASSERT_EQ(values, std::vector<std::optional<std::string>>({"a", "b", std::nullopt, "c", "a", "a"}));
+    // Strings are only stored once in each output segment
+    ASSERT_EQ(outputs[1].column(1).scalar_at<position_t>(0), outputs[1].column(1).scalar_at<position_t>(1));
+}
+
+TEST(Merge, NaTInIndex) {
+    std::vector<SegmentInMemory> inputs;
+    inputs.emplace_back(make_segment<int64_t>({0, 1}, "col", {0, 1}));
+    inputs.emplace_back(make_segment<int64_t>({NaT, 2}, "col", {0, 1}));
+    const auto desc = inputs[0].descriptor().clone();
+    ASSERT_THROW(as::merge_sorted_segments(std::move(inputs), desc, Sparsity::NOT_PERMITTED, 100), SortingException);
+}
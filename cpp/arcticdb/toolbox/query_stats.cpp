@@ -15,7 +15,7 @@ namespace arcticdb::query_stats {
 std::shared_ptr<QueryStats> QueryStats::instance_;
 std::once_flag QueryStats::init_flag_;
 
-std::shared_ptr<QueryStats> QueryStats::instance() {
+const std::shared_ptr<QueryStats>& QueryStats::instance() {
     std::call_once(init_flag_, [] () {
         instance_ = std::make_shared<QueryStats>();
     });
@@ -32,6 +32,12 @@ void QueryStats::reset_stats() {
             op_stat.reset_stats();
         }
     }
+    std::unique_lock lock(processing_stats_mutex_);
+    for (auto& stats_by_name : stats_by_processing_type_) {
+        for (auto& [name, op_stat] : stats_by_name) {
+            op_stat.reset_stats();
+        }
+    }
 }
 
 void QueryStats::enable() {
@@ -60,12 +66,70 @@ std::string task_type_to_string(TaskType task_type) {
         return "S3_DeleteObjects";
     case TaskType::S3_HeadObject:
         return "S3_HeadObject";
+    case TaskType::LMDB_Write:
+        return "LMDB_Write";
+    case TaskType::LMDB_Read:
+        return "LMDB_Read";
+    case TaskType::LMDB_Delete:
+        return "LMDB_Delete";
+    case TaskType::LMDB_List:
+        return "LMDB_List";
+    case TaskType::LMDB_KeyExists:
+        return "LMDB_KeyExists";
+    case TaskType::Azure_Write:
+        return "Azure_Write";
+    case TaskType::Azure_Read:
+        return "Azure_Read";
+    case TaskType::Azure_Delete:
+        return "Azure_Delete";
+    case TaskType::Azure_List:
+        return "Azure_List";
+    case TaskType::Azure_KeyExists:
+        return "Azure_KeyExists";
+    case TaskType::Mongo_Write:
+        return "Mongo_Write";
+    case TaskType::Mongo_Read:
+        return "Mongo_Read";
+    case TaskType::Mongo_Delete:
+        return "Mongo_Delete";
+    case TaskType::Mongo_List:
+        return "Mongo_List";
+    case TaskType::Mongo_KeyExists:
+        return "Mongo_KeyExists";
+    case TaskType::Memory_Write:
+        return "Memory_Write";
+    case TaskType::Memory_Read:
+        return "Memory_Read";
+    case TaskType::Memory_Delete:
+        return "Memory_Delete";
+    case TaskType::Memory_List:
+        return "Memory_List";
+    case TaskType::Memory_KeyExists:
+        return "Memory_KeyExists";
     default:
         log::version().warn("Unknown task type {}", static_cast<int>(task_type));
         return "Unknown";
     }
 }
 
+std::string processing_type_to_string(ProcessingType processing_type) {
+    switch (processing_type) {
+    case ProcessingType::DecodeBlock:
+        return "DecodeBlock";
+    case ProcessingType::DecodeSlice:
+        return "DecodeSlice";
+    case ProcessingType::ClauseProcess:
+        return "ClauseProcess";
+    case ProcessingType::PythonStringReduction:
+        return "PythonStringReduction";
+    case ProcessingType::QueryArena:
+        return "QueryArena";
+    default:
+        log::version().warn("Unknown processing type {}", static_cast<int>(processing_type));
+        return "Unknown";
+    }
+}
+
 std::string stat_type_to_string(StatType stat_type) {
     switch (stat_type) {
         case StatType::TOTAL_TIME_MS:
@@ -87,6 +151,33 @@ std::string get_key_type_str(entity::KeyType key) {
     return token_pos == std::string::npos ? key_type_str : key_type_str.substr(token_pos + token.size());	
 }
 
+QueryStats::OperationStatsOutput get_operation_stats_output(const QueryStats::OperationStats& op_stats) {
+    QueryStats::OperationStatsOutput op_output;
+    // Only non-zero stats will be added to the output
+    if (!op_stats.count_.readFull())
+        return op_output;
+
+    for (size_t stat_idx = 0; stat_idx < static_cast<size_t>(StatType::END); ++stat_idx) {
+        auto stat_type = static_cast<StatType>(stat_idx);
+        uint64_t value = 0;
+        switch (stat_type) {
+            case StatType::TOTAL_TIME_MS:
+                value = op_stats.total_time_ns_.readFull() / 1e6;
+                break;
+            case StatType::COUNT:
+                value = op_stats.count_.readFull();
+                break;
+            case StatType::SIZE_BYTES:
+                value = op_stats.size_bytes_.readFull();
+                break;
+            default:
+                continue;
+        }
+        op_output[stat_type_to_string(stat_type)] = value;
+    }
+    return op_output;
+}
+
 QueryStats::QueryStatsOutput QueryStats::get_stats() const {
     QueryStatsOutput result;
     
@@ -95,39 +186,23 @@ QueryStats::QueryStatsOutput QueryStats::get_stats() const {
         std::string task_type_str = task_type_to_string(task_type);
 
         for (size_t key_idx = 0; key_idx < static_cast<size_t>(entity::KeyType::UNDEFINED); ++key_idx) {
-            const auto& op_stats = stats_by_storage_op_type_[task_idx][key_idx];
-            std::string key_type_str = get_key_type_str(static_cast<entity::KeyType>(key_idx));
-            OperationStatsOutput op_output;
-            
-            bool has_non_zero_stats = op_stats.count_.readFull();
-            for (size_t stat_idx = 0; stat_idx < static_cast<size_t>(StatType::END); ++stat_idx) {
-                auto stat_type = static_cast<StatType>(stat_idx);
-                uint64_t value = 0;
-                switch (stat_type) {
-                    case StatType::TOTAL_TIME_MS:
-                        value = op_stats.total_time_ns_.readFull() / 1e6;
-                        break;
-                    case StatType::COUNT:
-                        value = op_stats.count_.readFull();
-                        break;
-                    case StatType::SIZE_BYTES:
-                        value = op_stats.size_bytes_.readFull();
-                        break;
-                    default:
-                        continue;
-                }
-                if (has_non_zero_stats) {
-                    std::string stat_name = stat_type_to_string(stat_type);
-                    op_output[stat_name] = value;
-                }
-            }
-            
-            // Only non-zero stats will be added to the output
+            auto op_output = get_operation_stats_output(stats_by_storage_op_type_[task_idx][key_idx]);
             if (!op_output.empty()) {
+                std::string key_type_str = get_key_type_str(static_cast<entity::KeyType>(key_idx));
                 result["storage_operations"][task_type_str][key_type_str] = std::move(op_output);
             }
         }
     }
+
+    std::shared_lock lock(processing_stats_mutex_);
+    for (size_t processing_idx = 0; processing_idx < static_cast<size_t>(ProcessingType::END); ++processing_idx) {
+        std::string processing_type_str = processing_type_to_string(static_cast<ProcessingType>(processing_idx));
+        for (const auto& [name, op_stats] : stats_by_processing_type_[processing_idx]) {
+            auto op_output = get_operation_stats_output(op_stats);
+            if (!op_output.empty())
+                result["processing_operations"][processing_type_str][name] = std::move(op_output);
+        }
+    }
     
     return result;
 }
@@ -162,6 +237,47 @@ void QueryStats::add(TaskType task_type, entity::KeyType key_type, StatType stat
     return std::nullopt;
 }
 
+QueryStats::OperationStats& QueryStats::processing_stats(ProcessingType processing_type, std::string_view name) {
+    auto& stats_by_name = stats_by_processing_type_[static_cast<size_t>(processing_type)];
+    {
+        std::shared_lock lock(processing_stats_mutex_);
+        if (auto it = stats_by_name.find(name); it != stats_by_name.end())
+            return it->second;
+    }
+    std::unique_lock lock(processing_stats_mutex_);
+    return stats_by_name.try_emplace(std::string{name}).first->second;
+}
+
+void QueryStats::add(ProcessingType processing_type, std::string_view name, StatType stat_type, uint64_t value) {
+    if (is_enabled()) {
+        auto& stats = processing_stats(processing_type, name);
+        switch (stat_type) {
+            case StatType::TOTAL_TIME_MS:
+                stats.total_time_ns_.increment(value);
+                break;
+            case StatType::COUNT:
+                stats.count_.increment(value);
+                break;
+            case StatType::SIZE_BYTES:
+                stats.size_bytes_.increment(value);
+                break;
+            default:
+                internal::raise<ErrorCode::E_INVALID_ARGUMENT>("Invalid stat type");
+        }
+    }
+}
+
+[[nodiscard]] std::optional<RAIIAddTime> QueryStats::add_task_count_and_time(
+        ProcessingType processing_type, std::string_view name, std::optional<TimePoint> start
+) {
+    if (is_enabled()) {
+        auto& stats = processing_stats(processing_type, name);
+        stats.count_.increment(1);
+        return std::make_optional<RAIIAddTime>(stats.total_time_ns_, start.value_or(std::chrono::steady_clock::now()));
+    }
+    return std::nullopt;
+}
+
 RAIIAddTime::RAIIAddTime(folly::ThreadCachedInt<timestamp>& time_var, TimePoint start) :
     time_var_(time_var),
     start_(start) {
@@ -182,4 +298,26 @@ void add(TaskType task_type, entity::KeyType key_type, StatType stat_type, uint6
     return QueryStats::instance()->add_task_count_and_time(task_type, key_type, start);
 }
 
-}
\ No newline at end of file
+void add(ProcessingType processing_type, std::string_view name, StatType stat_type, uint64_t value) {
+    QueryStats::instance()->add(processing_type, name, stat_type, value);
+}
+
+[[nodiscard]] std::optional<RAIIAddTime> add_task_count_and_time(
+    ProcessingType processing_type, std::string_view name, std::optional<TimePoint> start
+) {
+    return QueryStats::instance()->add_task_count_and_time(processing_type, name, start);
+}
+
+void add_arena_stats(const ArenaStats& arena_stats) {
+    const auto add_allocations = [](std::string_view name, uint64_t count, uint64_t bytes) {
+        if (count > 0) {
+            add(ProcessingType::QueryArena, name, StatType::COUNT, count);
+            add(ProcessingType::QueryArena, name, StatType::SIZE_BYTES, bytes);
+        }
+    };
+    add_allocations("ArenaAllocation", arena_stats.allocations_, arena_stats.allocated_bytes_);
+    add_allocations("ArenaChunk", arena_stats.chunks_, arena_stats.chunk_bytes_);
+    add_allocations("MallocFallback", arena_stats.fallback_allocations_, arena_stats.fallback_bytes_);
+}
+
+}
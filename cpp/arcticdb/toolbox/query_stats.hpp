@@ -13,10 +13,14 @@
 #include <chrono>
 #include <array>
 #include <memory>
+#include <map>
+#include <shared_mutex>
+#include <string_view>
 #include <folly/ThreadCachedInt.h>
 
 #include <arcticdb/entity/key.hpp>
 #include <arcticdb/util/constants.hpp>
+#include <arcticdb/util/arena.hpp>
 #include <arcticdb/column_store/memory_segment.hpp>
 
 namespace arcticdb::query_stats{
@@ -27,6 +31,38 @@ enum class TaskType : size_t {
     S3_GetObjectAsync = 3,
     S3_DeleteObjects = 4,
     S3_HeadObject = 5,
+    LMDB_Write = 6,
+    LMDB_Read = 7,
+    LMDB_Delete = 8,
+    LMDB_List = 9,
+    LMDB_KeyExists = 10,
+    Azure_Write = 11,
+    Azure_Read = 12,
+    Azure_Delete = 13,
+    Azure_List = 14,
+    Azure_KeyExists = 15,
+    Mongo_Write = 16,
+    Mongo_Read = 17,
+    Mongo_Delete = 18,
+    Mongo_List = 19,
+    Mongo_KeyExists = 20,
+    Memory_Write = 21,
+    Memory_Read = 22,
+    Memory_Delete = 23,
+    Memory_List = 24,
+    Memory_KeyExists = 25,
+    END
+};
+
+// Stages of a query that happen after the data has been fetched from storage. Unlike storage operations these are not
+// broken down by key type, but by a stage specific name: the codec for DecodeBlock, the key type for DecodeSlice,
+// the clause for ClauseProcess, the source data type for PythonStringReduction and the kind of allocation for QueryArena.
+enum class ProcessingType : size_t {
+    DecodeBlock = 0,
+    DecodeSlice = 1,
+    ClauseProcess = 2,
+    PythonStringReduction = 3,
+    QueryArena = 4,
     END
 };
 
@@ -87,15 +123,20 @@ public:
     using QueryStatsOutput = std::map<std::string, std::map<std::string, std::map<std::string, OperationStatsOutput>>>;
     using STATS_BY_KEY_TYPE = std::array<OperationStats, static_cast<size_t>(entity::KeyType::UNDEFINED)>;
     using STATS_BY_STORAGE_OP_TYPE = std::array<STATS_BY_KEY_TYPE, static_cast<size_t>(TaskType::END)>;
+    // Node based so that references to the stats stay valid while other names are inserted
+    using STATS_BY_NAME = std::map<std::string, OperationStats, std::less<>>;
+    using STATS_BY_PROCESSING_TYPE = std::array<STATS_BY_NAME, static_cast<size_t>(ProcessingType::END)>;
 
     ARCTICDB_NO_MOVE_OR_COPY(QueryStats);
     void reset_stats();
-    static std::shared_ptr<QueryStats> instance();
+    static const std::shared_ptr<QueryStats>& instance();
     void enable();
     void disable();
     bool is_enabled() const;
     void add(TaskType task_type, entity::KeyType key_type, StatType stat_type, uint64_t value);
     [[nodiscard]] std::optional<RAIIAddTime> add_task_count_and_time(TaskType task_type, entity::KeyType key_type, std::optional<TimePoint> start = std::nullopt);
+    void add(ProcessingType processing_type, std::string_view name, StatType stat_type, uint64_t value);
+    [[nodiscard]] std::optional<RAIIAddTime> add_task_count_and_time(ProcessingType processing_type, std::string_view name, std::optional<TimePoint> start = std::nullopt);
     QueryStatsOutput get_stats() const;
     QueryStats();
 
@@ -104,9 +145,19 @@ private:
     static std::shared_ptr<QueryStats> instance_;
     std::atomic<bool> is_enabled_ = false;
 
+    OperationStats& processing_stats(ProcessingType processing_type, std::string_view name);
+
     STATS_BY_STORAGE_OP_TYPE stats_by_storage_op_type_;
+    mutable std::shared_mutex processing_stats_mutex_;
+    STATS_BY_PROCESSING_TYPE stats_by_processing_type_;
 };
 
+std::string get_key_type_str(entity::KeyType key);
+
 void add(TaskType task_type, entity::KeyType key_type, StatType stat_type, uint64_t value);
 [[nodiscard]] std::optional<RAIIAddTime> add_task_count_and_time(TaskType task_type, entity::KeyType key_type, std::optional<TimePoint> start = std::nullopt);
+void add(ProcessingType processing_type, std::string_view name, StatType stat_type, uint64_t value);
+[[nodiscard]] std::optional<RAIIAddTime> add_task_count_and_time(ProcessingType processing_type, std::string_view name, std::optional<TimePoint> start = std::nullopt);
+// Adds the allocations made through the arena of a query once it has finished processing
+void add_arena_stats(const ArenaStats& arena_stats);
 }
@@ -20,6 +20,7 @@
 #include <pipeline/index_writer.hpp>
 #include <util/format_bytes.hpp>
 #include <numeric>
+#include <arcticdb/async/task_scheduler.hpp>
 
 #include <arcticdb/stream/stream_source.hpp>
 #include <arcticdb/entity/metrics.hpp>
@@ -34,27 +35,40 @@ namespace arcticdb {
 
 constexpr std::size_t NumThreads = 50;
 
+/*
+ * Copies keys from one store to another as a pipeline of batches: each batch is read from the source and written to
+ * the target asynchronously, so that reads of later batches overlap the writes of earlier ones. The compressed bytes of
+ * the batches that have been read but not yet written are bounded by StorageMover.MaxInFlightBytes, using the same
+ * admission scheme as the in-flight bytes limit on reads, and at most thread_count batches are copied at once.
+ */
 struct BatchCopier {
     std::atomic<uint64_t> count_ = 0;
     std::atomic<uint64_t> objects_moved_ = 0;
     std::atomic<uint64_t> bytes_moved_ = 0;
     std::atomic<uint64_t> skipped_ = 0;
-    interval_timer timers_;
+    uint64_t total_objects_ = 0;
+    std::chrono::steady_clock::time_point start_time_;
+    std::mutex report_mutex_;
     std::vector<VariantKey> keys_;
+    std::vector<folly::Future<folly::Unit>> pending_batches_;
     std::shared_ptr<Store> source_store_;
     std::shared_ptr<Store> target_store_;
     size_t batch_size_;
     size_t thread_count_;
+    async::InFlightBytesBudget in_flight_bytes_;
 
     BatchCopier(std::shared_ptr<Store> source_store,
                 std::shared_ptr<Store> target_store,
                 size_t batch_size,
                 size_t thread_count=32) :
+        start_time_(std::chrono::steady_clock::now()),
         source_store_(std::move(source_store)),
         target_store_(std::move(target_store)),
         batch_size_(batch_size),
-        thread_count_{thread_count}{
-        timers_.start_timer();
+        thread_count_{thread_count},
+        in_flight_bytes_(static_cast<size_t>(ConfigsMap::instance()->get_int("StorageMover.MaxInFlightBytes", 1024 * 1024 * 1024))) {
+        user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(thread_count_ > 0 && batch_size_ > 0,
+            "StorageMover needs a positive batch size and thread count, got {} and {}", batch_size_, thread_count_);
     }
 
     void add_key(const VariantKey& key, bool check_target=true, bool check_source=true) {
@@ -69,139 +83,166 @@ struct BatchCopier {
         }
 
         keys_.push_back(key);
+        ++total_objects_;
         if(keys_.size() == batch_size_) {
-            copy_keys();
-            keys_ = std::vector<VariantKey>();
-
-            if(++count_ %10 == 0) {
-                timers_.stop_timer();
-                auto bps = bytes_moved_ / timers_.get_timer().get_results().total;
-                log::storage().info("Moved {}, {} objects ({} skipped), {} per second", format_bytes(bytes_moved_), objects_moved_, skipped_, format_bytes(bps));
-                timers_.start_timer();
+            submit_pending_keys();
+            if(++count_ % 10 == 0)
+                report_progress();
+        }
+    }
+
+    // Starts copying the keys added so far, first waiting for the oldest batch if thread_count_ are already in progress
+    void submit_pending_keys() {
+        if(pending_batches_.size() >= thread_count_) {
+            auto oldest = std::move(pending_batches_.front()).getTry();
+            pending_batches_.erase(pending_batches_.begin());
+            if(oldest.hasException()) {
+                wait_for_batches(std::exchange(pending_batches_, {}));
+                oldest.throwUnlessValue();
             }
         }
+        pending_batches_.emplace_back(copy_batch(std::exchange(keys_, std::vector<VariantKey>{}), false, false));
+    }
+
+    // The batches refer to this copier, so all of them must finish before the first failure is rethrown
+    static void wait_for_batches(std::vector<folly::Future<folly::Unit>>&& batches) {
+        for(auto& result : folly::collectAll(std::move(batches)).get())
+            result.throwUnlessValue();
     }
 
     void go(std::unordered_map<KeyType, std::vector<VariantKey>>&& keys, bool perform_checks) {
         size_t batch_size_per_thread = std::max(batch_size_ / thread_count_, size_t{1});
         // Log approximately every 10000 objects
-        uint64_t logging_frequency = 10000 / batch_size_per_thread;
-        folly::FutureExecutor<folly::IOThreadPoolExecutor> exec{thread_count_};
-        std::vector<folly::Future<folly::Unit>> futures;
+        const uint64_t logging_frequency = std::max(10000 / batch_size_per_thread, size_t{1});
+        for (const auto& [key_type, keys_of_type] : keys)
+            total_objects_ += keys_of_type.size();
 
         foreach_key_type_write_precedence([&](auto key_type) {
             bool check_target = perform_checks && !is_ref_key_class(key_type);
             bool check_source = perform_checks;
             if (auto it = keys.find(key_type); it != keys.end()) {
+                std::vector<std::vector<VariantKey>> batches;
                 while(it->second.size() > 0) {
                     const auto start = it->second.size() >= batch_size_per_thread ? it->second.end() - batch_size_per_thread : it->second.begin();
                     const auto end = it->second.end();
-                    const size_t size = std::distance(start, end);
-                    std::vector<std::pair<VariantKey, StreamSource::ReadContinuation>> keys_to_copy;
-                    keys_to_copy.reserve(size);
-                    auto segments_ptr = std::make_unique<std::vector<storage::KeySegmentPair>>(size);
-                    std::transform(
-                        std::make_move_iterator(start),
-                        std::make_move_iterator(end),
-                        std::back_inserter(keys_to_copy),
-                        [segments = segments_ptr.get(), pos = 0](VariantKey&& key) mutable {
-                            return std::pair{std::move(key), [segments, pos=pos++](storage::KeySegmentPair&& segment) {
-                                segments->at(pos) = std::move(segment);
-                                return segments->at(pos).variant_key();
-                            }};
-                        }
-                    );
+                    batches.emplace_back(std::make_move_iterator(start), std::make_move_iterator(end));
                     it->second.erase(start, end);
-                    futures.emplace_back(exec.addFuture(
-                    [this, keys_to_copy=std::move(keys_to_copy), &logging_frequency, check_target, check_source, segments_ptr=std::move(segments_ptr)]() mutable {
-                        for (const auto& key: keys_to_copy) {
-                            if(check_source && !source_store_->key_exists(key.first).get()) {
-                                log::storage().warn("Found an unreadable key {}", key.first);
-                            }
-                            if(check_target && target_store_->key_exists(key.first).get()) {
-                                ++skipped_;
-                            }
-                        }
-
-                        size_t n_keys = keys_to_copy.size();
-                        auto collected_kvs = folly::collect(source_store_->batch_read_compressed(std::move(keys_to_copy), BatchReadArgs{}))
-                            .via(&async::io_executor())
-                            .get();
-                        if (n_keys > 0) {
-                            const size_t bytes_being_copied = std::accumulate(segments_ptr->begin(), segments_ptr->end(), size_t{0}, [] (size_t a, const storage::KeySegmentPair& ks) {
-                                return a + ks.segment().size();
-                            });
-                            target_store_->batch_write_compressed(*segments_ptr.release()).get();
-                            bytes_moved_.fetch_add(bytes_being_copied, std::memory_order_relaxed);
-                            objects_moved_.fetch_add(n_keys, std::memory_order_relaxed);
-                        }
-                        ++count_;
-                        if (count_.compare_exchange_strong(logging_frequency, 0)) {
-                            timers_.stop_timer();
-                            auto bps = bytes_moved_.load() / timers_.get_timer().get_results().total;
-                            log::storage().info("Moved {}, {} objects ({} skipped), {} per second",
-                                                format_bytes(bytes_moved_.load()),
-                                                objects_moved_.load(),
-                                                skipped_.load(),
-                                                format_bytes(bps));
-                            timers_.start_timer();
-                        }
-                        // count_ could be incremented to a value greater than logging_frequency, just reset it in this case
-                        if (count_.load() > logging_frequency) {
-                            count_.store(0);
-                        }
-                        return makeFuture(folly::Unit{});
-                    }));
                 }
+                // Keys of this type must all be in the target before any keys that may refer to them are written
+                wait_for_batches(folly::window(std::move(batches), [this, logging_frequency, check_target, check_source](std::vector<VariantKey>&& batch) {
+                    return copy_batch(std::move(batch), check_target, check_source).thenValue([this, logging_frequency](auto&&) {
+                        if (++count_ % logging_frequency == 0)
+                            report_progress();
+                    });
+                }, thread_count_));
             }
         });
-        collect(futures).get();
-        timers_.stop_timer();
-        auto bps = bytes_moved_.load() / timers_.get_timer().get_results().total;
-        log::storage().info("Moved {}, {} objects ({} skipped), {} per second",
-                            format_bytes(bytes_moved_.load()),
-                            objects_moved_.load(),
-                            skipped_.load(),
-                            format_bytes(bps));
+        report_progress();
     }
 
-    void copy_keys() {
-        std::vector<storage::KeySegmentPair> segments(keys_.size());
+    // Reads a batch of keys from the source and writes them to the target once there is room in the in-flight budget
+    folly::Future<folly::Unit> copy_batch(std::vector<VariantKey>&& keys, bool check_target, bool check_source) {
+        if (keys.empty())
+            return folly::makeFuture(folly::Unit{});
+
+        auto promise = std::make_shared<folly::Promise<folly::Unit>>();
+        auto future = promise->getFuture();
+        in_flight_bytes_.submit([this, keys=std::move(keys), check_target, check_source, promise](async::InFlightBytesReservation&& reservation) mutable {
+            folly::makeFutureWith([this, &keys, check_target, check_source]() {
+                return check_keys(keys, check_target, check_source);
+            })
+            .thenValue([this, keys=std::move(keys)](auto&&) mutable {
+                return read_batch(std::move(keys));
+            })
+            .thenValue([this, reservation=std::move(reservation)](std::vector<storage::KeySegmentPair>&& segments) mutable {
+                const size_t bytes_being_copied = std::accumulate(segments.begin(), segments.end(), size_t{0}, [] (size_t a, const storage::KeySegmentPair& ks) {
+                    return a + ks.segment().size();
+                });
+                reservation.resize(bytes_being_copied);
+                const size_t n_keys = segments.size();
+                return target_store_->batch_write_compressed(std::move(segments))
+                .thenValue([this, bytes_being_copied, n_keys, reservation=std::move(reservation)](auto&&) {
+                    bytes_moved_.fetch_add(bytes_being_copied, std::memory_order_relaxed);
+                    objects_moved_.fetch_add(n_keys, std::memory_order_relaxed);
+                });
+            })
+            .thenTry([promise](folly::Try<folly::Unit>&& result) {
+                promise->setTry(std::move(result));
+            });
+        });
+        return future;
+    }
+
+    folly::Future<folly::Unit> check_keys(const std::vector<VariantKey>& keys, bool check_target, bool check_source) {
+        if (!check_target && !check_source)
+            return folly::makeFuture(folly::Unit{});
+
+        std::vector<folly::Future<folly::Unit>> checks;
+        checks.reserve(keys.size() * 2);
+        for (const auto& key: keys) {
+            if(check_source) {
+                checks.emplace_back(source_store_->key_exists(key).thenValue([key](bool exists) {
+                    if (!exists)
+                        log::storage().warn("Found an unreadable key {}", key);
+                }));
+            }
+            if(check_target) {
+                checks.emplace_back(target_store_->key_exists(key).thenValue([this](bool exists) {
+                    if (exists)
+                        ++skipped_;
+                }));
+            }
+        }
+        return folly::collect(checks).via(&async::io_executor()).unit();
+    }
+
+    folly::Future<std::vector<storage::KeySegmentPair>> read_batch(std::vector<VariantKey>&& keys) {
+        auto segments = std::make_shared<std::vector<storage::KeySegmentPair>>(keys.size());
         std::vector<std::pair<VariantKey, StreamSource::ReadContinuation>> keys_to_copy;
-        keys_to_copy.reserve(keys_.size());
+        keys_to_copy.reserve(keys.size());
         std::transform(
-            std::make_move_iterator(keys_.begin()),
-            std::make_move_iterator(keys_.end()),
+            std::make_move_iterator(keys.begin()),
+            std::make_move_iterator(keys.end()),
             std::back_inserter(keys_to_copy),
-            [&segments, i=0](VariantKey&& key) mutable {
-                return std::pair{std::move(key), [&segments, i=i++](storage::KeySegmentPair&& ks) {
-                    segments.at(i) = std::move(ks);
-                    return segments.at(i).variant_key();
+            [segments, pos = 0](VariantKey&& key) mutable {
+                return std::pair{std::move(key), [segments, pos=pos++](storage::KeySegmentPair&& segment) {
+                    segments->at(pos) = std::move(segment);
+                    return segments->at(pos).variant_key();
                 }};
             }
         );
-        keys_.clear();
-        size_t n_keys = keys_to_copy.size();
-        auto collected_kvs = folly::collect(source_store_->batch_read_compressed(std::move(keys_to_copy), BatchReadArgs{}))
+        return folly::collect(source_store_->batch_read_compressed(std::move(keys_to_copy), BatchReadArgs{}))
             .via(&async::io_executor())
-            .get();
-        if (n_keys > 0) {
-            bytes_moved_ += std::accumulate(segments.begin(), segments.end(), size_t{0}, [] (size_t a, const storage::KeySegmentPair& ks) {
-                return a + ks.segment().size();
+            .thenValue([segments](auto&&) {
+                return std::move(*segments);
             });
-            target_store_->batch_write_compressed(std::move(segments)).get();
-        }
-        objects_moved_ += keys_.size();
+    }
+
+    void report_progress() {
+        std::lock_guard lock{report_mutex_};
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+        const auto bytes_moved = bytes_moved_.load();
+        const auto objects_moved = objects_moved_.load();
+        const auto bps = seconds > 0 ? bytes_moved / seconds : 0.0;
+        const auto ops = seconds > 0 ? objects_moved / seconds : 0.0;
+        const auto percent = total_objects_ > 0 ? 100.0 * static_cast<double>(objects_moved) / static_cast<double>(total_objects_) : 0.0;
+        log::storage().info("Moved {}, {} of {} objects ({:.1f}%, {} skipped), {} per second, {:.0f} objects per second, {} in flight",
+                            format_bytes(bytes_moved),
+                            objects_moved,
+                            total_objects_,
+                            percent,
+                            skipped_.load(),
+                            format_bytes(bps),
+                            ops,
+                            format_bytes(in_flight_bytes_.in_flight_bytes()));
     }
 
     void finalize() {
-        if(!keys_.empty()) {
-            copy_keys();
-        }
-        timers_.stop_timer();
-        auto total = timers_.get_timer().get_results().total;
-        auto bps = bytes_moved_ / total;
-        log::storage().info("Moved {} {} objects  in {} - {} bps ", format_bytes(bytes_moved_), objects_moved_, total, format_bytes(bps));
+        if(!keys_.empty())
+            submit_pending_keys();
+
+        wait_for_batches(std::exchange(pending_batches_, {}));
+        report_progress();
     }
 };
 
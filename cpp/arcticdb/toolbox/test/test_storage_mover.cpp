@@ -0,0 +1,103 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/toolbox/storage_mover.hpp>
+#include <arcticdb/util/test/generators.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+constexpr size_t num_symbols = 5;
+
+std::shared_ptr<Store> source_store_with_symbols(version_store::LocalVersionedEngine& engine) {
+    for(size_t i = 0; i < num_symbols; ++i) {
+        auto symbol = fmt::format("symbol_{}", i);
+        auto wrapper = get_test_simple_frame(symbol, 10, i);
+        engine.write_versioned_dataframe_internal(symbol, std::move(wrapper.frame_), false, false, false);
+    }
+    return engine._test_get_store();
+}
+
+std::vector<VariantKey> all_keys(const std::shared_ptr<Store>& store) {
+    std::vector<VariantKey> keys;
+    foreach_key_type([&](KeyType key_type) {
+        store->iterate_type(key_type, [&keys](VariantKey&& key) {
+            keys.emplace_back(std::move(key));
+        });
+    });
+    return keys;
+}
+
+} // namespace
+
+TEST(BatchCopier, BudgetSmallerThanOneSegment) {
+    ScopedConfig max_in_flight("StorageMover.MaxInFlightBytes", 1);
+    auto source_engine = get_test_engine();
+    auto target_engine = get_test_engine();
+    auto source = source_store_with_symbols(source_engine);
+    auto target = target_engine._test_get_store();
+    const auto keys = all_keys(source);
+    ASSERT_GT(keys.size(), num_symbols);
+
+    BatchCopier copier{source, target, 2, 2};
+    for(const auto& key : keys)
+        copier.add_key(key);
+
+    copier.finalize();
+    ASSERT_EQ(copier.objects_moved_.load(), keys.size());
+    ASSERT_EQ(copier.in_flight_bytes_.in_flight_bytes(), 0);
+    for(const auto& key : keys)
+        ASSERT_TRUE(target->key_exists_sync(key));
+
+    ASSERT_EQ(all_keys(target).size(), keys.size());
+}
+
+TEST(BatchCopier, GoBudgetSmallerThanOneSegment) {
+    ScopedConfig max_in_flight("StorageMover.MaxInFlightBytes", 1);
+    auto source_engine = get_test_engine();
+    auto target_engine = get_test_engine();
+    auto source = source_store_with_symbols(source_engine);
+    auto target = target_engine._test_get_store();
+    const auto keys = all_keys(source);
+
+    std::unordered_map<KeyType, std::vector<VariantKey>> keys_by_type;
+    for(const auto& key : keys)
+        keys_by_type[variant_key_type(key)].emplace_back(key);
+
+    BatchCopier copier{source, target, 2, 2};
+    copier.go(std::move(keys_by_type), true);
+    ASSERT_EQ(copier.objects_moved_.load(), keys.size());
+    ASSERT_EQ(copier.in_flight_bytes_.in_flight_bytes(), 0);
+    for(const auto& key : keys)
+        ASSERT_TRUE(target->key_exists_sync(key));
+}
+
+TEST(BatchCopier, ReadFailurePropagates) {
+    auto source_engine = get_test_engine();
+    auto target_engine = get_test_engine();
+    auto source = source_store_with_symbols(source_engine);
+    auto target = target_engine._test_get_store();
+    const auto keys = all_keys(source);
+    const auto missing = entity::atom_key_builder().gen_id(1).build<KeyType::TABLE_DATA>(StreamId{"missing"});
+
+    // One key per batch, so the failure surfaces when finalize waits for the batch of the missing key
+    BatchCopier copier{source, target, 1, 2};
+    for(const auto& key : keys)
+        copier.add_key(key, false, false);
+
+    copier.add_key(missing, false, false);
+
+    ASSERT_THROW(copier.finalize(), storage::KeyNotFoundException);
+    ASSERT_EQ(copier.in_flight_bytes_.in_flight_bytes(), 0);
+    ASSERT_FALSE(target->key_exists_sync(missing));
+    for(const auto& key : keys)
+        ASSERT_TRUE(target->key_exists_sync(key));
+}
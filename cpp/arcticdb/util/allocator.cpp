@@ -6,6 +6,7 @@
  */
 
 #include <arcticdb/util/allocator.hpp>
+#include <arcticdb/util/arena.hpp>
 
 #include <arcticdb/log/log.hpp>
 #include <arcticdb/util/preconditions.hpp>
@@ -17,6 +18,10 @@
 
 #include <fmt/std.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 namespace arcticdb {
 
     bool use_slab_allocator()
@@ -155,6 +160,14 @@ namespace arcticdb {
             static ThreadCachedInt<uint32_t> free_count;
             return free_count;
         };
+
+        // Set in the timestamp returned with allocations served by an Arena, so that they are handed back to it when
+        // freed. Timestamps from both clocks are otherwise non-negative
+        constexpr entity::timestamp arena_timestamp_flag = std::numeric_limits<entity::timestamp>::min();
+
+        bool is_arena_allocation(entity::timestamp ts) {
+            return (ts & arena_timestamp_flag) != 0;
+        }
     }
 
     template<typename TracingPolicy, typename ClockType>
@@ -265,10 +278,29 @@ namespace arcticdb {
         AllocatorImpl<TracingPolicy, ClockType>::instance_.reset();
     }
 
+    template<class TracingPolicy, class ClockType>
+    std::optional<std::pair<uint8_t*, entity::timestamp>> AllocatorImpl<TracingPolicy, ClockType>::arena_alloc(size_t size) {
+        auto* arena = Arena::current();
+        if (arena == nullptr)
+            return std::nullopt;
+
+        auto ret = arena->allocate(size);
+        if (ret == nullptr) {
+            arena->record_fallback(size);
+            return std::nullopt;
+        }
+        auto ts = current_timestamp() | arena_timestamp_flag;
+        TracingPolicy::track_alloc(std::make_pair(uintptr_t(ret), ts), size);
+        return std::make_pair(ret, ts);
+    }
+
     template<typename TracingPolicy, typename ClockType>
     std::pair<uint8_t*, entity::timestamp>
     AllocatorImpl<TracingPolicy, ClockType>::alloc(size_t size, bool no_realloc ARCTICDB_UNUSED) {
         util::check(size != 0, "Should not allocate zero bytes");
+        if (auto arena_ret = arena_alloc(size))
+            return *arena_ret;
+
         auto ts = current_timestamp();
 
         uint8_t* ret = internal_alloc(size);
@@ -298,9 +330,10 @@ namespace arcticdb {
     template<typename TracingPolicy, typename ClockType>
     std::pair<uint8_t*, entity::timestamp> AllocatorImpl<TracingPolicy, ClockType>::aligned_alloc(size_t size, bool no_realloc ARCTICDB_UNUSED) {
         util::check(size != 0, "Should not allocate zero bytes");
-        auto ts = current_timestamp();
+        if (auto arena_ret = arena_alloc(size))
+            return *arena_ret;
 
-        util::check(size != 0, "Should not allocate zero bytes");
+        auto ts = current_timestamp();
         auto ret = internal_alloc(size);
         util::check(ret != nullptr, "Failed to aligned allocate {} bytes", size);
         TracingPolicy::track_alloc(std::make_pair(uintptr_t(ret), ts), size);
@@ -310,6 +343,14 @@ namespace arcticdb {
     template<class TracingPolicy, class ClockType>
     std::pair<uint8_t*, entity::timestamp>
     AllocatorImpl<TracingPolicy, ClockType>::realloc(std::pair<uint8_t*, entity::timestamp> ptr, size_t size) {
+        if (ptr.first != nullptr && is_arena_allocation(ptr.second)) {
+            // Arena allocations cannot grow in place
+            auto new_ptr = alloc(size);
+            std::memcpy(new_ptr.first, ptr.first, std::min(size, Arena::allocation_size(ptr.first)));
+            free(ptr);
+            return new_ptr;
+        }
+
         auto ret = internal_realloc(ptr.first, size);
 
 #ifdef ARCTICDB_TRACK_ALLOCS
@@ -329,7 +370,10 @@ namespace arcticdb {
             return;
 
         TracingPolicy::track_free(std::make_pair(uintptr_t(ptr.first), ptr.second));
-        internal_free(ptr.first);
+        if (is_arena_allocation(ptr.second))
+            Arena::deallocate(ptr.first);
+        else
+            internal_free(ptr.first);
     }
 
     template<class TracingPolicy, class ClockType>
@@ -11,6 +11,7 @@
 
 
 #include <memory>
+#include <optional>
 
 // for malloc_trim on linux
 #if defined(__linux__) && defined(__GLIBC__)
@@ -132,6 +133,8 @@ private:
     }
 #endif
 
+    // Serves the allocation from the current Arena on this thread, if there is one and the allocation fits in it
+    static std::optional<std::pair<uint8_t*, entity::timestamp>> arena_alloc(size_t size);
     static uint8_t* internal_alloc(size_t size);
     static void internal_free(uint8_t* p);
     static uint8_t* internal_realloc(uint8_t* p, std::size_t size);
@@ -0,0 +1,192 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/util/arena.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <cstdlib>
+#include <new>
+
+namespace arcticdb {
+
+namespace {
+
+// Matches the alignment of malloc, which is all that callers of the Allocator currently rely on
+constexpr size_t arena_alignment = alignof(std::max_align_t);
+
+constexpr size_t round_to_arena_alignment(size_t size) {
+    return (size + arena_alignment - 1) & ~(arena_alignment - 1);
+}
+
+thread_local Arena* current_arena = nullptr;
+
+std::atomic<uint64_t> next_arena_id{1};
+
+} // namespace
+
+struct ArenaChunk {
+    // One for each live allocation, plus one while the arena is still allocating from the chunk
+    std::atomic<uint64_t> references_{1};
+};
+
+// The chunk a thread is allocating from. The counters are only written by that thread, and are atomic so that stats()
+// can read them from another
+struct alignas(64) ArenaThreadChunk {
+    ArenaChunk* chunk_ = nullptr;
+    size_t offset_ = 0;
+    std::atomic<uint64_t> allocations_{0};
+    std::atomic<uint64_t> allocated_bytes_{0};
+    std::atomic<uint64_t> chunks_{0};
+    std::atomic<uint64_t> chunk_bytes_{0};
+};
+
+namespace {
+
+// Precedes every allocation so that it can be freed without knowing which arena it came from
+struct ArenaAllocationHeader {
+    ArenaChunk* chunk_;
+    uint64_t size_;
+};
+
+constexpr size_t chunk_header_size = round_to_arena_alignment(sizeof(ArenaChunk));
+constexpr size_t allocation_header_size = round_to_arena_alignment(sizeof(ArenaAllocationHeader));
+
+ArenaAllocationHeader* header_of(const uint8_t* p) {
+    return reinterpret_cast<ArenaAllocationHeader*>(const_cast<uint8_t*>(p) - allocation_header_size);
+}
+
+void release_reference(ArenaChunk* chunk) {
+    if (chunk->references_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        chunk->~ArenaChunk();
+        std::free(chunk);
+    }
+}
+
+void add_owned(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// The thread chunk of the arena this thread last allocated from
+struct ThreadArenaCache {
+    uint64_t arena_id_ = 0;
+    ArenaThreadChunk* thread_chunk_ = nullptr;
+};
+
+thread_local ThreadArenaCache thread_arena_cache;
+
+} // namespace
+
+Arena::Arena() :
+    Arena(
+        ConfigsMap::instance()->get_int("Arena.ChunkSize", 4 * 1024 * 1024),
+        ConfigsMap::instance()->get_int("Arena.MaxAllocationSize", 256 * 1024)) {
+}
+
+Arena::Arena(size_t chunk_size, size_t max_allocation_size) :
+    id_(next_arena_id.fetch_add(1, std::memory_order_relaxed)),
+    chunk_size_(chunk_size),
+    max_allocation_size_(max_allocation_size) {
+    util::check(chunk_size_ >= chunk_header_size + allocation_header_size + round_to_arena_alignment(max_allocation_size_),
+                "Arena chunk size {} is too small for allocations of up to {} bytes", chunk_size_, max_allocation_size_);
+}
+
+Arena::~Arena() {
+    [[maybe_unused]] const auto final_stats = stats();
+    ARCTICDB_DEBUG(log::memory(), "Arena served {} allocations totalling {} bytes from {} chunks, {} allocations fell back to malloc",
+                   final_stats.allocations_, final_stats.allocated_bytes_, final_stats.chunks_, final_stats.fallback_allocations_);
+    for (auto& [thread_id, thread_chunk] : thread_chunks_) {
+        if (thread_chunk->chunk_ != nullptr)
+            release_reference(thread_chunk->chunk_);
+    }
+}
+
+Arena* Arena::current() {
+    return current_arena;
+}
+
+uint8_t* Arena::allocate(size_t size) {
+    if (size > max_allocation_size_)
+        return nullptr;
+
+    const auto required = allocation_header_size + round_to_arena_alignment(size);
+    auto& thread_chunk = this_thread_chunk();
+    if (thread_chunk.chunk_ == nullptr || thread_chunk.offset_ + required > chunk_size_)
+        next_chunk(thread_chunk);
+
+    auto* header = reinterpret_cast<ArenaAllocationHeader*>(reinterpret_cast<uint8_t*>(thread_chunk.chunk_) + thread_chunk.offset_);
+    header->chunk_ = thread_chunk.chunk_;
+    header->size_ = size;
+    thread_chunk.chunk_->references_.fetch_add(1, std::memory_order_relaxed);
+    thread_chunk.offset_ += required;
+    add_owned(thread_chunk.allocations_, 1);
+    add_owned(thread_chunk.allocated_bytes_, size);
+    return reinterpret_cast<uint8_t*>(header) + allocation_header_size;
+}
+
+ArenaThreadChunk& Arena::this_thread_chunk() {
+    if (thread_arena_cache.arena_id_ != id_) {
+        std::lock_guard lock{mutex_};
+        auto& thread_chunk = thread_chunks_[std::this_thread::get_id()];
+        if (!thread_chunk)
+            thread_chunk = std::make_unique<ArenaThreadChunk>();
+
+        thread_arena_cache = {id_, thread_chunk.get()};
+    }
+    return *thread_arena_cache.thread_chunk_;
+}
+
+void Arena::next_chunk(ArenaThreadChunk& thread_chunk) {
+    if (thread_chunk.chunk_ != nullptr)
+        release_reference(thread_chunk.chunk_);
+
+    auto* memory = std::malloc(chunk_size_);
+    util::check(memory != nullptr, "Failed to allocate arena chunk of {} bytes", chunk_size_);
+    thread_chunk.chunk_ = new (memory) ArenaChunk{};
+    thread_chunk.offset_ = chunk_header_size;
+    add_owned(thread_chunk.chunks_, 1);
+    add_owned(thread_chunk.chunk_bytes_, chunk_size_);
+}
+
+void Arena::record_fallback(size_t size) {
+    std::lock_guard lock{mutex_};
+    ++stats_.fallback_allocations_;
+    stats_.fallback_bytes_ += size;
+}
+
+ArenaStats Arena::stats() const {
+    std::lock_guard lock{mutex_};
+    auto res = stats_;
+    for (const auto& [thread_id, thread_chunk] : thread_chunks_) {
+        res.allocations_ += thread_chunk->allocations_.load(std::memory_order_relaxed);
+        res.allocated_bytes_ += thread_chunk->allocated_bytes_.load(std::memory_order_relaxed);
+        res.chunks_ += thread_chunk->chunks_.load(std::memory_order_relaxed);
+        res.chunk_bytes_ += thread_chunk->chunk_bytes_.load(std::memory_order_relaxed);
+    }
+    return res;
+}
+
+size_t Arena::allocation_size(const uint8_t* p) {
+    return header_of(p)->size_;
+}
+
+void Arena::deallocate(uint8_t* p) {
+    release_reference(header_of(p)->chunk_);
+}
+
+ArenaScope::ArenaScope(std::shared_ptr<Arena> arena) :
+    arena_(std::move(arena)),
+    previous_(current_arena) {
+    current_arena = arena_.get();
+}
+
+ArenaScope::~ArenaScope() {
+    current_arena = previous_;
+}
+
+} // namespace arcticdb
@@ -0,0 +1,107 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/util/constructors.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace arcticdb {
+
+struct ArenaChunk;
+struct ArenaThreadChunk;
+
+struct ArenaStats {
+    // Allocations served from the arena's chunks
+    uint64_t allocations_ = 0;
+    uint64_t allocated_bytes_ = 0;
+    // Chunks obtained from malloc to serve them
+    uint64_t chunks_ = 0;
+    uint64_t chunk_bytes_ = 0;
+    // Allocations made while the arena was in scope that were too large for it, and so went to malloc
+    uint64_t fallback_allocations_ = 0;
+    uint64_t fallback_bytes_ = 0;
+};
+
+/*
+ * Bump allocator for the short-lived buffers of a single query, such as ChunkedBuffer blocks, string pools and bitsets
+ * created while processing clauses. While an ArenaScope for the arena is active on a thread, allocations made through
+ * the Allocator on that thread no larger than Arena.MaxAllocationSize are carved from chunks of Arena.ChunkSize bytes
+ * instead of going to malloc, and freeing them individually does not return memory to malloc.
+ *
+ * Each thread allocating from the arena bumps through a chunk of its own, so that allocating takes no lock, and only
+ * looks up or registers that chunk under the arena's mutex when it allocates from a different arena than last time.
+ *
+ * Each chunk counts its live allocations, and is returned to malloc in one go once the arena has moved on from it and
+ * all of its allocations have been freed. Allocations may therefore outlive the arena, e.g. when they are part of the
+ * result of the query, at the cost of keeping the rest of their chunk alive.
+ */
+class Arena {
+public:
+    Arena();
+    Arena(size_t chunk_size, size_t max_allocation_size);
+    ~Arena();
+
+    ARCTICDB_NO_MOVE_OR_COPY(Arena)
+
+    // The arena of the innermost ArenaScope on this thread, if any
+    static Arena* current();
+
+    // Returns nullptr if size is larger than the arena serves, in which case the caller should use malloc
+    uint8_t* allocate(size_t size);
+
+    // Records an allocation made with malloc while the arena was in scope
+    void record_fallback(size_t size);
+
+    ArenaStats stats() const;
+
+    size_t max_allocation_size() const {
+        return max_allocation_size_;
+    }
+
+    // The size requested when p was returned by allocate
+    static size_t allocation_size(const uint8_t* p);
+
+    // Frees p, returned by allocate on any arena, releasing its chunk if it was the last live allocation in it
+    static void deallocate(uint8_t* p);
+
+private:
+    ArenaThreadChunk& this_thread_chunk();
+    void next_chunk(ArenaThreadChunk& thread_chunk);
+
+    // Identifies the arena to the thread-local cache of the chunk last allocated from, as addresses can be reused
+    const uint64_t id_;
+    const size_t chunk_size_;
+    const size_t max_allocation_size_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::thread::id, std::unique_ptr<ArenaThreadChunk>> thread_chunks_;
+    // Only the fallback allocations, the rest are counted by each thread's chunk
+    ArenaStats stats_;
+};
+
+// Makes arena the current arena on this thread until destroyed. A null arena leaves allocations going to malloc
+class ArenaScope {
+public:
+    explicit ArenaScope(std::shared_ptr<Arena> arena);
+    ~ArenaScope();
+
+    ARCTICDB_NO_MOVE_OR_COPY(ArenaScope)
+
+private:
+    std::shared_ptr<Arena> arena_;
+    Arena* previous_;
+};
+
+} // namespace arcticdb
@@ -0,0 +1,173 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/util/bitset_packing.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ARCTICDB_PACK_BYTE_MASK_X86
+#include <immintrin.h>
+#endif
+
+namespace arcticdb::util {
+
+namespace {
+
+using PackByteMaskFunc = void (*)(const uint8_t*, size_t, uint64_t*);
+
+void pack_byte_mask_scalar(const uint8_t* mask, size_t count, uint64_t* words) {
+    for (size_t word = 0; word * 64 < count; ++word) {
+        const auto bits = std::min<size_t>(64, count - word * 64);
+        const auto* bytes = mask + word * 64;
+        uint64_t res = 0;
+        for (size_t bit = 0; bit < bits; ++bit) {
+            res |= uint64_t(bytes[bit] & 1) << bit;
+        }
+        words[word] = res;
+    }
+}
+
+#ifdef ARCTICDB_PACK_BYTE_MASK_X86
+
+// The mask bytes are 0 or 1, so shifting each 16-bit lane left by 7 moves bit 0 of each byte into its top bit without
+// crossing into the neighbouring byte, which is where movemask reads from
+
+void pack_byte_mask_sse2(const uint8_t* mask, size_t count, uint64_t* words) {
+    size_t word = 0;
+    for (; (word + 1) * 64 <= count; ++word) {
+        const auto* bytes = mask + word * 64;
+        uint64_t res = 0;
+        for (size_t lane = 0; lane < 4; ++lane) {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + lane * 16));
+            res |= uint64_t(static_cast<uint16_t>(_mm_movemask_epi8(_mm_slli_epi16(v, 7)))) << (lane * 16);
+        }
+        words[word] = res;
+    }
+    pack_byte_mask_scalar(mask + word * 64, count - word * 64, words + word);
+}
+
+__attribute__((target("avx2")))
+void pack_byte_mask_avx2(const uint8_t* mask, size_t count, uint64_t* words) {
+    size_t word = 0;
+    for (; (word + 1) * 64 <= count; ++word) {
+        const auto* bytes = mask + word * 64;
+        const auto low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+        const auto high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + 32));
+        const auto low_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(low, 7)));
+        const auto high_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(high, 7)));
+        words[word] = uint64_t(low_bits) | (uint64_t(high_bits) << 32);
+    }
+    pack_byte_mask_scalar(mask + word * 64, count - word * 64, words + word);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void pack_byte_mask_avx512(const uint8_t* mask, size_t count, uint64_t* words) {
+    size_t word = 0;
+    for (; (word + 1) * 64 <= count; ++word) {
+        const auto v = _mm512_loadu_si512(mask + word * 64);
+        words[word] = _mm512_test_epi8_mask(v, v);
+    }
+    pack_byte_mask_scalar(mask + word * 64, count - word * 64, words + word);
+}
+
+#endif
+
+struct PackByteMaskImplementation {
+    PackByteMaskFunc func_;
+    std::string_view name_;
+};
+
+PackByteMaskImplementation select_pack_byte_mask() {
+#ifdef ARCTICDB_PACK_BYTE_MASK_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw"))
+        return {pack_byte_mask_avx512, "avx512bw"};
+
+    if (__builtin_cpu_supports("avx2"))
+        return {pack_byte_mask_avx2, "avx2"};
+
+    return {pack_byte_mask_sse2, "sse2"};
+#else
+    return {pack_byte_mask_scalar, "scalar"};
+#endif
+}
+
+const PackByteMaskImplementation& pack_byte_mask_impl() {
+    static const auto impl = select_pack_byte_mask();
+    return impl;
+}
+
+} // namespace
+
+void pack_byte_mask(const uint8_t* mask, size_t count, uint64_t* words) {
+    pack_byte_mask_impl().func_(mask, count, words);
+}
+
+std::string_view pack_byte_mask_implementation() {
+    return pack_byte_mask_impl().name_;
+}
+
+void ByteMaskBitSetBuilder::flush() {
+    flush_chunk();
+    if (block_pos_ > 0) {
+        std::fill(block_words_.begin() + (block_pos_ + 63) / 64, block_words_.end(), 0);
+        flush_block();
+    }
+    inserter_.flush();
+}
+
+void ByteMaskBitSetBuilder::flush_chunk() {
+    if (pos_ == 0)
+        return;
+
+    // Chunks are full until the last one, so each starts on a word boundary of the block
+    pack_byte_mask(mask_.data(), pos_, block_words_.data() + block_pos_ / 64);
+    block_pos_ += pos_;
+    pos_ = 0;
+    if (block_pos_ == block_size)
+        flush_block();
+}
+
+void ByteMaskBitSetBuilder::flush_block() {
+    // A BitMagic bit block is an array of 32-bit words with bit i in word i / 32, which on a little-endian CPU has the
+    // same layout as the packed 64-bit words
+    static_assert(std::endian::native == std::endian::little);
+    static_assert(sizeof(block_words_) == bm::set_block_size * sizeof(bm::word_t));
+
+    const auto num_words = (block_pos_ + 63) / 64;
+    size_t set_bits = 0;
+    for (size_t word = 0; word < num_words; ++word)
+        set_bits += std::popcount(block_words_[word]);
+
+    if (set_bits == block_pos_) {
+        output_.set_range(block_start_, block_start_ + BitSetSizeType(block_pos_ - 1), true);
+    } else if (set_bits > 0) {
+        auto& blocks_manager = output_.get_blocks_manager();
+        const auto block_idx = BitSet::block_idx_type(block_start_ >> bm::set_block_shift);
+        if (blocks_manager.get_block(block_idx) == nullptr) {
+            auto* block = blocks_manager.get_allocator().alloc_bit_block();
+            std::memcpy(block, block_words_.data(), sizeof(block_words_));
+            blocks_manager.set_block(block_idx, block);
+        } else {
+            // The block already has bits set, e.g. by set_range before building, which copying would overwrite
+            for (size_t word = 0; word < num_words; ++word) {
+                auto bits = block_words_[word];
+                while (bits != 0) {
+                    inserter_ = block_start_ + BitSetSizeType(word * 64 + std::countr_zero(bits));
+                    bits &= bits - 1;
+                }
+            }
+        }
+    }
+    block_start_ += BitSetSizeType(block_pos_);
+    block_pos_ = 0;
+}
+
+} // namespace arcticdb::util
@@ -0,0 +1,70 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/util/bitset.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace arcticdb::util {
+
+/// @brief Packs count bytes, each of which must be 0 or 1, into ceil(count / 64) little-endian words, so that byte i
+/// becomes bit i % 64 of word i / 64. Unused high bits of the last word are zeroed.
+/// Uses AVX-512BW, AVX2 or SSE2 when available on the running CPU, with a scalar fallback.
+void pack_byte_mask(const uint8_t* mask, size_t count, uint64_t* words);
+
+/// @brief The implementation selected by pack_byte_mask on this CPU, for logging and benchmarks
+std::string_view pack_byte_mask_implementation();
+
+/// @brief Builds a bitset from per-row 0/1 mask bytes, which are cheap for the compiler to vectorise when produced by a
+/// tight comparison loop over contiguous data. The bytes are buffered in fixed size chunks and packed into words with
+/// pack_byte_mask, with the first byte corresponding to bit 0. The words of each BitMagic block are then copied into
+/// the bitset as a whole block rather than bit by bit.
+class ByteMaskBitSetBuilder {
+public:
+    static constexpr size_t chunk_size = 1024;
+    static constexpr size_t block_size = bm::gap_max_bits;
+    static_assert(block_size % chunk_size == 0);
+
+    explicit ByteMaskBitSetBuilder(BitSet& output) :
+        output_(output),
+        inserter_(output) {
+    }
+
+    /// @brief Returns space for the next min(count, N) mask bytes, where N > 0. All of the returned bytes must be
+    /// written before the next call.
+    std::span<uint8_t> next_chunk(size_t count) {
+        if (pos_ == chunk_size)
+            flush_chunk();
+
+        const auto size = std::min(count, chunk_size - pos_);
+        std::span<uint8_t> res{mask_.data() + pos_, size};
+        pos_ += size;
+        return res;
+    }
+
+    void flush();
+
+private:
+    void flush_chunk();
+    void flush_block();
+
+    BitSet& output_;
+    std::array<uint8_t, chunk_size> mask_;
+    std::array<uint64_t, block_size / 64> block_words_;
+    size_t pos_ = 0;
+    // The number of bits packed into block_words_, and the position in the bitset of the first of them
+    size_t block_pos_ = 0;
+    BitSetSizeType block_start_ = 0;
+    BitSet::bulk_insert_iterator inserter_;
+};
+
+} // namespace arcticdb::util
@@ -0,0 +1,86 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/util/hyperloglog.hpp>
+#include <arcticdb/util/hash.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace arcticdb {
+
+namespace {
+
+// The largest register value, for a hash whose bits after the register index are all zero
+constexpr uint8_t max_rank = 64 - HyperLogLog::precision + 1;
+constexpr char zero_rank_char = '0';
+
+} // namespace
+
+void HyperLogLog::add_hash(uint64_t hash) {
+    // The top bits pick the register, which records the longest run of leading zeros seen in the remaining bits
+    const auto index = hash >> (64 - precision);
+    const auto remaining = hash << precision;
+    const auto rank = remaining == 0 ? max_rank : static_cast<uint8_t>(std::countl_zero(remaining) + 1);
+    registers_[index] = std::max(registers_[index], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    for (size_t idx = 0; idx < num_registers; ++idx) {
+        registers_[idx] = std::max(registers_[idx], other.registers_[idx]);
+    }
+}
+
+uint64_t HyperLogLog::estimate() const {
+    constexpr auto m = static_cast<double>(num_registers);
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double sum = 0.0;
+    size_t zero_registers = 0;
+    for (auto rank : registers_) {
+        sum += std::ldexp(1.0, -rank);
+        zero_registers += rank == 0 ? 1 : 0;
+    }
+    auto estimate = alpha * m * m / sum;
+    // The raw estimate is biased upwards for small cardinalities, where counting the empty registers is more accurate.
+    // 64-bit hashes make the correction for large cardinalities unnecessary.
+    if (estimate <= 2.5 * m && zero_registers != 0)
+        estimate = m * std::log(m / static_cast<double>(zero_registers));
+
+    return static_cast<uint64_t>(std::llround(estimate));
+}
+
+std::string HyperLogLog::serialize() const {
+    std::string res(num_registers, zero_rank_char);
+    for (size_t idx = 0; idx < num_registers; ++idx) {
+        res[idx] = static_cast<char>(zero_rank_char + registers_[idx]);
+    }
+    return res;
+}
+
+HyperLogLog HyperLogLog::deserialize(std::string_view serialized) {
+    internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+            serialized.size() == num_registers,
+            "Expected a HyperLogLog sketch of {} registers, but got {}",
+            num_registers, serialized.size());
+    HyperLogLog res;
+    for (size_t idx = 0; idx < num_registers; ++idx) {
+        const auto rank = serialized[idx] - zero_rank_char;
+        internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+                rank >= 0 && rank <= max_rank,
+                "Unexpected HyperLogLog register value {} at position {}",
+                serialized[idx], idx);
+        res.registers_[idx] = static_cast<uint8_t>(rank);
+    }
+    return res;
+}
+
+uint64_t HyperLogLog::hash_bytes(const void* data, size_t size) {
+    return XXH64(data, size, 0);
+}
+
+} // namespace arcticdb
@@ -0,0 +1,81 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace arcticdb {
+
+/*
+ * A HyperLogLog sketch of the distinct values seen in a column, used where counting them precisely would need a hash
+ * set of all of them. Sketches built over different row-slices can be merged, and the merged sketch estimates the
+ * number of values that are distinct across all of those row-slices, with a standard error of about 1.6%.
+ *
+ * Values that compare equal hash the same regardless of their type, so that sketches of a column whose type has been
+ * widened between row-slices can still be merged. NaN is never added.
+ */
+class HyperLogLog {
+public:
+    static constexpr uint8_t precision = 12;
+    static constexpr size_t num_registers = size_t{1} << precision;
+
+    template<typename T>
+    requires std::is_arithmetic_v<T>
+    void add(T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(value))
+                return;
+
+            // Integral values are hashed as integers, which also makes 0.0 and -0.0 the same
+            const auto as_double = static_cast<double>(value);
+            if (std::trunc(as_double) == as_double &&
+                as_double >= static_cast<double>(std::numeric_limits<int64_t>::min()) &&
+                as_double < static_cast<double>(std::numeric_limits<int64_t>::max())) {
+                add_int(static_cast<int64_t>(as_double));
+            } else {
+                add_hash(hash_bytes(&as_double, sizeof(as_double)));
+            }
+        } else {
+            add_int(static_cast<int64_t>(value));
+        }
+    }
+
+    void add(std::string_view value) {
+        add_hash(hash_bytes(value.data(), value.size()));
+    }
+
+    void add_hash(uint64_t hash);
+
+    void merge(const HyperLogLog& other);
+
+    [[nodiscard]] uint64_t estimate() const;
+
+    // One printable character per register, so that sketches can be stored in string columns
+    [[nodiscard]] std::string serialize() const;
+
+    static HyperLogLog deserialize(std::string_view serialized);
+
+    bool operator==(const HyperLogLog& other) const = default;
+
+private:
+    void add_int(int64_t value) {
+        add_hash(hash_bytes(&value, sizeof(value)));
+    }
+
+    static uint64_t hash_bytes(const void* data, size_t size);
+
+    std::array<uint8_t, num_registers> registers_{};
+};
+
+} // namespace arcticdb
@@ -12,6 +12,7 @@
 #include <arcticdb/storage/store.hpp>
 #include <arcticdb/stream/stream_reader.hpp>
 #include <arcticdb/stream/stream_utils.hpp>
+#include <arcticdb/pipeline/index_pages.hpp>
 
 namespace arcticdb {
 
@@ -85,6 +86,8 @@ inline void delete_all(const std::shared_ptr<Store>& store, bool continue_on_err
     });
 }
 
+/* Given a container of index keys, returns the data keys they reference. The rows of a paged index refer to its pages,
+ * which are read in turn, but are not themselves returned. */
 template<typename KeyContainer, typename = std::enable_if<std::is_base_of_v<AtomKey, typename KeyContainer::value_type>>>
 inline std::vector<AtomKey> get_data_keys(
     const std::shared_ptr<stream::StreamSource>& store,
@@ -94,7 +97,9 @@ inline std::vector<AtomKey> get_data_keys(
     using StreamReader = arcticdb::stream::StreamReader<AtomKey, KeySupplier, SegmentInMemory::Row>;
     auto gen = [&keys]() { return keys; };
     StreamReader stream_reader(std::move(gen), store, opts);
-    return stream_reader.generate_data_keys() | folly::gen::as<std::vector>();
+    return stream_reader.generate_data_keys()
+        | folly::gen::filter([](const AtomKey& key) { return key.type() == KeyType::TABLE_DATA; })
+        | folly::gen::as<std::vector>();
 }
 
 inline std::vector<AtomKey> get_data_keys(
@@ -182,7 +187,16 @@ inline ankerl::unordered_dense::set<AtomKey> recurse_index_keys(
                     res.emplace(std::move(key));
                 }
             } else if (index_key.type() == KeyType::TABLE_INDEX) {
-                KeySegment key_segment(store->read_sync(index_key, opts).second, SymbolStructure::SAME);
+                auto segment = store->read_sync(index_key, opts).second;
+                if (pipelines::index::is_paged_index(segment)) {
+                    // The rows of a top-level index segment are its pages, which recurse_segment includes alongside
+                    // the data keys that they reference
+                    for (auto&& key : recurse_segment(store, std::move(segment), std::nullopt))
+                        res.emplace(std::move(key));
+
+                    continue;
+                }
+                KeySegment key_segment(std::move(segment), SymbolStructure::SAME);
                 auto data_keys = key_segment.materialise();
                 util::variant_match(
                     data_keys,
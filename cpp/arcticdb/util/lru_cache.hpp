@@ -4,6 +4,11 @@
  *
  * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
  */
+
+#pragma once
+
+#include <list>
+#include <optional>
 #include <shared_mutex>
 #include <memory>
 
@@ -0,0 +1,55 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/util/simd_dispatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace arcticdb::util {
+
+namespace {
+
+SimdLevel supported_simd_level() {
+#ifdef ARCTICDB_SIMD_DISPATCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq"))
+        return SimdLevel::AVX512;
+
+    if (__builtin_cpu_supports("avx2"))
+        return SimdLevel::AVX2;
+#endif
+    return SimdLevel::BASELINE;
+}
+
+std::atomic<SimdLevel> max_simd_level{SimdLevel::AVX512};
+
+} // namespace
+
+SimdLevel simd_level() {
+    static const auto supported = supported_simd_level();
+    return std::min(supported, max_simd_level.load(std::memory_order_relaxed));
+}
+
+std::string_view simd_level_name(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::AVX512:
+        return "avx512";
+    case SimdLevel::AVX2:
+        return "avx2";
+    case SimdLevel::BASELINE:
+        return "baseline";
+    }
+    return "unknown";
+}
+
+void _test_set_max_simd_level(std::optional<SimdLevel> level) {
+    max_simd_level.store(level.value_or(SimdLevel::AVX512), std::memory_order_relaxed);
+}
+
+} // namespace arcticdb::util
@@ -0,0 +1,76 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ARCTICDB_SIMD_DISPATCH_X86
+#endif
+
+namespace arcticdb::util {
+
+enum class SimdLevel : uint8_t {
+    // Whatever the build targets, which is SSE2 for x86-64 wheels
+    BASELINE,
+    AVX2,
+    AVX512
+};
+
+/// @brief The widest instruction set supported by the running CPU that dispatch_simd compiles kernels for
+SimdLevel simd_level();
+
+std::string_view simd_level_name(SimdLevel level);
+
+/// @brief Caps the level used by dispatch_simd, so that tests and benchmarks can compare the kernels for each level.
+/// Levels above what the CPU supports are ignored.
+void _test_set_max_simd_level(std::optional<SimdLevel> level);
+
+namespace detail {
+
+#ifdef ARCTICDB_SIMD_DISPATCH_X86
+// flatten inlines the kernel and everything it calls, so that its loops are vectorised for the target of these
+// functions rather than for the build's baseline
+template<typename Kernel>
+__attribute__((target("avx2"), flatten))
+void run_avx2(Kernel& kernel) {
+    kernel();
+}
+
+template<typename Kernel>
+__attribute__((target("avx512f,avx512bw,avx512vl,avx512dq"), flatten))
+void run_avx512(Kernel& kernel) {
+    kernel();
+}
+#endif
+
+} // namespace detail
+
+/// @brief Runs kernel, a loop over contiguous data, compiled for the widest of AVX-512 and AVX2 that the running CPU
+/// supports, or for the build's baseline otherwise. The loops are vectorised by the compiler for each target, so the
+/// kernel must not depend on any particular instruction set itself.
+template<typename Kernel>
+void dispatch_simd(Kernel&& kernel) {
+#ifdef ARCTICDB_SIMD_DISPATCH_X86
+    switch (simd_level()) {
+    case SimdLevel::AVX512:
+        detail::run_avx512(kernel);
+        return;
+    case SimdLevel::AVX2:
+        detail::run_avx2(kernel);
+        return;
+    case SimdLevel::BASELINE:
+        break;
+    }
+#endif
+    kernel();
+}
+
+} // namespace arcticdb::util
@@ -0,0 +1,142 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/util/arena.hpp>
+#include <arcticdb/util/allocator.hpp>
+#include <arcticdb/column_store/chunked_buffer.hpp>
+
+#include <folly/container/Enumerate.h>
+
+#include <cstring>
+#include <numeric>
+#include <thread>
+
+using namespace arcticdb;
+
+TEST(Arena, AllocationsInScope) {
+    auto arena = std::make_shared<Arena>(4096, 1024);
+    auto outside = Allocator::alloc(100);
+    std::vector<std::pair<uint8_t*, entity::timestamp>> blocks;
+    {
+        ArenaScope scope{arena};
+        ASSERT_EQ(Arena::current(), arena.get());
+        for (size_t idx = 0; idx < 10; ++idx)
+            blocks.emplace_back(Allocator::aligned_alloc(1000));
+        blocks.emplace_back(Allocator::alloc(2000));
+        {
+            // Nested scopes without an arena go to malloc
+            ArenaScope no_arena{nullptr};
+            blocks.emplace_back(Allocator::alloc(100));
+        }
+        ASSERT_EQ(Arena::current(), arena.get());
+    }
+    ASSERT_EQ(Arena::current(), nullptr);
+
+    for (auto [idx, block] : folly::enumerate(blocks)) {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block.first) % alignof(std::max_align_t), 0);
+        std::memset(block.first, static_cast<int>(idx), idx < 10 ? 1000 : 100);
+    }
+    auto stats = arena->stats();
+    ASSERT_EQ(stats.allocations_, 10);
+    ASSERT_EQ(stats.allocated_bytes_, 10'000);
+    // Three 1000 byte allocations and their headers fit in each chunk
+    ASSERT_EQ(stats.chunks_, 4);
+    ASSERT_EQ(stats.chunk_bytes_, 4 * 4096);
+    ASSERT_EQ(stats.fallback_allocations_, 1);
+    ASSERT_EQ(stats.fallback_bytes_, 2000);
+
+    for (auto block : blocks)
+        Allocator::free(block);
+    Allocator::free(outside);
+}
+
+TEST(Arena, AllocationsOutliveArena) {
+    auto arena = std::make_shared<Arena>(4096, 1024);
+    std::pair<uint8_t*, entity::timestamp> block;
+    {
+        ArenaScope scope{arena};
+        block = Allocator::alloc(16);
+    }
+    arena.reset();
+    std::iota(block.first, block.first + 16, uint8_t{0});
+    ASSERT_EQ(block.first[15], 15);
+    Allocator::free(block);
+}
+
+TEST(Arena, Realloc) {
+    auto arena = std::make_shared<Arena>(4096, 1024);
+    ArenaScope scope{arena};
+    auto block = Allocator::alloc(64);
+    std::iota(block.first, block.first + 64, uint8_t{0});
+    // Grows within the arena, then out of it
+    block = Allocator::realloc(block, 512);
+    ASSERT_EQ(block.first[63], 63);
+    block = Allocator::realloc(block, 2048);
+    ASSERT_EQ(block.first[63], 63);
+    block = Allocator::realloc(block, 4096);
+    ASSERT_EQ(block.first[63], 63);
+    Allocator::free(block);
+    ASSERT_EQ(arena->stats().allocations_, 2);
+    ASSERT_EQ(arena->stats().fallback_allocations_, 1);
+}
+
+TEST(Arena, ChunkedBuffer) {
+    auto arena = std::make_shared<Arena>();
+    ChunkedBuffer buffer;
+    {
+        ArenaScope scope{arena};
+        for (uint64_t value = 0; value < 100'000; ++value)
+            *reinterpret_cast<uint64_t*>(buffer.ensure((value + 1) * sizeof(uint64_t))) = value;
+    }
+    ASSERT_GT(arena->stats().allocations_, 0);
+    arena.reset();
+    for (uint64_t value = 0; value < 100'000; value += 999)
+        ASSERT_EQ(*buffer.ptr_cast<uint64_t>(value * sizeof(uint64_t), sizeof(uint64_t)), value);
+}
+
+TEST(Arena, ChunkTooSmall) {
+    ASSERT_THROW(Arena(1024, 1024), ArcticException);
+}
+
+TEST(Arena, ThreadsAllocateFromOwnChunks) {
+    auto arena = std::make_shared<Arena>(4096, 1024);
+    constexpr size_t num_threads = 4;
+    constexpr size_t allocations_per_thread = 3;
+    std::vector<std::vector<std::pair<uint8_t*, entity::timestamp>>> blocks(num_threads);
+    std::vector<std::thread> threads;
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        threads.emplace_back([&arena, &thread_blocks = blocks[thread_idx], thread_idx] {
+            ArenaScope scope{arena};
+            for (size_t idx = 0; idx < allocations_per_thread; ++idx) {
+                thread_blocks.emplace_back(Allocator::alloc(1000));
+                std::memset(thread_blocks.back().first, static_cast<int>(thread_idx), 1000);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Three 1000 byte allocations and their headers fit in each thread's chunk
+    auto stats = arena->stats();
+    ASSERT_EQ(stats.allocations_, num_threads * allocations_per_thread);
+    ASSERT_EQ(stats.allocated_bytes_, num_threads * allocations_per_thread * 1000);
+    ASSERT_EQ(stats.chunks_, num_threads);
+    for (auto [thread_idx, thread_blocks] : folly::enumerate(blocks)) {
+        for (auto block : thread_blocks) {
+            ASSERT_EQ(block.first[0], thread_idx);
+            ASSERT_EQ(block.first[999], thread_idx);
+            ASSERT_LT(std::abs(block.first - thread_blocks.front().first), 4096);
+        }
+    }
+    arena.reset();
+    for (auto& thread_blocks : blocks) {
+        for (auto block : thread_blocks)
+            Allocator::free(block);
+    }
+}
@@ -7,10 +7,13 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include <bitmagic/bm.h>
 #include <bitmagic/bmserial.h>
 #include <arcticdb/util/buffer.hpp>
 #include <arcticdb/util/bitset.hpp>
+#include <arcticdb/util/bitset_packing.hpp>
 
 #include <arcticdb/util/test/generators.hpp>
 
@@ -67,3 +70,69 @@ TEST(BitMagic, DensifyAndExpand) {
         ++sparse_array;
     }
 }
+
+TEST(BitMagic, PackByteMask) {
+    using namespace arcticdb;
+    std::mt19937 gen(42);
+    for (size_t count: {0UL, 1UL, 63UL, 64UL, 65UL, 200UL, 1024UL, 3001UL}) {
+        std::vector<uint8_t> mask(count);
+        for (auto& byte: mask) {
+            byte = gen() & 1;
+        }
+        // One spare word to check nothing is written past the end
+        std::vector<uint64_t> words((count + 63) / 64 + 1, 0xFF);
+        util::pack_byte_mask(mask.data(), count, words.data());
+        for (size_t idx = 0; idx < count; ++idx) {
+            ASSERT_EQ((words[idx / 64] >> (idx % 64)) & 1, mask[idx]) << util::pack_byte_mask_implementation();
+        }
+        if (count % 64 != 0) {
+            ASSERT_EQ(words[count / 64] >> (count % 64), 0);
+        }
+        ASSERT_EQ(words.back(), 0xFF);
+
+        util::BitSet bitset;
+        util::ByteMaskBitSetBuilder builder(bitset);
+        // Uneven chunks to exercise the chunk buffering
+        for (size_t pos = 0; pos < count;) {
+            auto chunk = builder.next_chunk(std::min<size_t>(count - pos, 100));
+            std::copy_n(mask.begin() + pos, chunk.size(), chunk.begin());
+            pos += chunk.size();
+        }
+        builder.flush();
+        ASSERT_EQ(bitset.count(), std::count(mask.begin(), mask.end(), 1));
+        for (size_t idx = 0; idx < count; ++idx) {
+            ASSERT_EQ(bitset.test(idx), mask[idx] == 1);
+        }
+    }
+}
+
+TEST(BitMagic, ByteMaskBitSetBuilderBlocks) {
+    using namespace arcticdb;
+    // Spans whole blocks that are empty, full and mixed, and ends part way through a block that already has bits set
+    constexpr size_t block_size = util::ByteMaskBitSetBuilder::block_size;
+    const size_t count = 3 * block_size + 100;
+    std::mt19937 gen(42);
+    std::vector<uint8_t> mask(count, 0);
+    std::fill_n(mask.begin() + block_size, block_size, 1);
+    for (size_t idx = 2 * block_size; idx < count; ++idx) {
+        mask[idx] = gen() & 1;
+    }
+
+    util::BitSet bitset;
+    bitset.resize(count + 10);
+    bitset.set_range(count, count + 9);
+    util::ByteMaskBitSetBuilder builder(bitset);
+    for (size_t pos = 0; pos < count;) {
+        auto chunk = builder.next_chunk(count - pos);
+        std::copy_n(mask.begin() + pos, chunk.size(), chunk.begin());
+        pos += chunk.size();
+    }
+    builder.flush();
+    ASSERT_EQ(bitset.count(), std::count(mask.begin(), mask.end(), 1) + 10);
+    for (size_t idx = 0; idx < count; ++idx) {
+        ASSERT_EQ(bitset.test(idx), mask[idx] == 1) << idx;
+    }
+    for (size_t idx = count; idx < count + 10; ++idx) {
+        ASSERT_TRUE(bitset.test(idx));
+    }
+}
@@ -0,0 +1,93 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+#include <arcticdb/util/hyperloglog.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <fmt/format.h>
+
+using namespace arcticdb;
+
+namespace {
+
+void expect_close(uint64_t estimate, uint64_t actual) {
+    // Around five times the standard error of the sketch
+    EXPECT_NEAR(static_cast<double>(estimate), static_cast<double>(actual), 0.08 * static_cast<double>(actual));
+}
+
+} // namespace
+
+TEST(HyperLogLog, Empty) {
+    HyperLogLog sketch;
+    EXPECT_EQ(sketch.estimate(), 0);
+}
+
+TEST(HyperLogLog, SmallCardinalities) {
+    HyperLogLog sketch;
+    for (auto repeat = 0; repeat < 3; ++repeat) {
+        for (int64_t value = 0; value < 100; ++value)
+            sketch.add(value);
+    }
+    expect_close(sketch.estimate(), 100);
+}
+
+TEST(HyperLogLog, LargeCardinalities) {
+    HyperLogLog sketch;
+    for (uint64_t value = 0; value < 1'000'000; ++value)
+        sketch.add(value);
+    expect_close(sketch.estimate(), 1'000'000);
+}
+
+TEST(HyperLogLog, Strings) {
+    HyperLogLog sketch;
+    for (auto value = 0; value < 10'000; ++value)
+        sketch.add(std::string_view{fmt::format("value_{}", value % 5'000)});
+    expect_close(sketch.estimate(), 5'000);
+}
+
+TEST(HyperLogLog, EqualValuesOfDifferentTypes) {
+    HyperLogLog ints;
+    HyperLogLog doubles;
+    for (int32_t value = -500; value < 500; ++value) {
+        ints.add(value);
+        doubles.add(static_cast<double>(value));
+    }
+    doubles.add(-0.0);
+    doubles.add(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_EQ(ints, doubles);
+
+    doubles.add(0.5);
+    EXPECT_NE(ints, doubles);
+}
+
+TEST(HyperLogLog, Merge) {
+    HyperLogLog first;
+    HyperLogLog second;
+    HyperLogLog both;
+    for (int64_t value = 0; value < 100'000; ++value) {
+        first.add(value);
+        both.add(value);
+    }
+    for (int64_t value = 50'000; value < 200'000; ++value) {
+        second.add(value);
+        both.add(value);
+    }
+    first.merge(second);
+    EXPECT_EQ(first, both);
+    expect_close(first.estimate(), 200'000);
+}
+
+TEST(HyperLogLog, SerializeRoundtrip) {
+    HyperLogLog sketch;
+    for (int64_t value = 0; value < 10'000; ++value)
+        sketch.add(value * 7);
+    const auto serialized = sketch.serialize();
+    EXPECT_EQ(serialized.size(), HyperLogLog::num_registers);
+    EXPECT_EQ(HyperLogLog::deserialize(serialized), sketch);
+    EXPECT_THROW(HyperLogLog::deserialize(serialized.substr(1)), InternalException);
+}
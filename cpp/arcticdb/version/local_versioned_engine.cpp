@@ -7,6 +7,7 @@
 
 #include <arcticdb/version/local_versioned_engine.hpp>
 #include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/codec/zstd_dictionary.hpp>
 #include <arcticdb/version/version_core.hpp>
 #include <arcticdb/storage/storage.hpp>
 #include <arcticdb/storage/storage_options.hpp>
@@ -21,6 +22,7 @@
 #include <arcticdb/version/version_map_batch_methods.hpp>
 #include <arcticdb/util/container_filter_wrapper.hpp>
 #include <arcticdb/util/allocation_tracing.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 
 namespace arcticdb::version_store {
 
@@ -45,6 +47,9 @@ LocalVersionedEngine::LocalVersionedEngine(
 
 void LocalVersionedEngine::initialize(const std::shared_ptr<storage::Library>& library) {
     configure(library->config());
+    if(cfg_.zstd_dictionary())
+        load_zstd_dictionary();
+
     ARCTICDB_RUNTIME_DEBUG(log::version(), "Created versioned engine at {} for library path {}  with config {}", uintptr_t(this),
                            library->library_path(), [&cfg=cfg_]{  return util::format(cfg); });
 #ifdef USE_REMOTERY
@@ -132,9 +137,7 @@ folly::Future<folly::Unit> LocalVersionedEngine::delete_unreferenced_pruned_inde
 ) {
     try {
         if (!pruned_indexes.empty() && !cfg().write_options().delayed_deletes()) {
-            // TODO: the following function will load all snapshots, which will be horrifyingly inefficient when called
-            // multiple times from batch_*
-            auto [not_in_snaps, in_snaps] = get_index_keys_partitioned_by_inclusion_in_snapshots(
+            auto [not_in_snaps, in_snaps] = snapshot_index_->index_keys_partitioned_by_inclusion_in_snapshots(
                     store(),
                     pruned_indexes.begin()->id(),
                     std::move(pruned_indexes));
@@ -238,6 +241,28 @@ ColumnStats LocalVersionedEngine::get_column_stats_info_version_internal(
     return get_column_stats_info_internal(versioned_item.value());
 }
 
+uint64_t LocalVersionedEngine::approx_nunique_internal(
+    const VersionedItem& versioned_item,
+    const std::string& column,
+    const IndexRange& date_range) {
+    ARCTICDB_RUNTIME_DEBUG(log::version(), "Command: approx_nunique");
+    return approx_nunique_impl(store(), versioned_item, column, date_range);
+}
+
+uint64_t LocalVersionedEngine::approx_nunique_version_internal(
+    const StreamId& stream_id,
+    const std::string& column,
+    const IndexRange& date_range,
+    const VersionQuery& version_query) {
+    auto versioned_item = get_version_to_read(stream_id, version_query);
+    missing_data::check<ErrorCode::E_NO_SUCH_VERSION>(
+            versioned_item.has_value(),
+            "approx_nunique_version_internal: version not found for stream '{}'",
+            stream_id
+            );
+    return approx_nunique_internal(versioned_item.value(), column, date_range);
+}
+
 std::set<StreamId> LocalVersionedEngine::list_streams_internal(
     std::optional<SnapshotId> snap_name,
     const std::optional<std::string>& regex,
@@ -311,7 +336,7 @@ std::optional<VersionedItem> LocalVersionedEngine::get_specific_version(
         }
         ARCTICDB_DEBUG(log::version(), "Version {} for symbol {} is missing, checking snapshots:", version_id,
                        stream_id);
-        auto index_keys = get_index_keys_in_snapshots(store(), stream_id);
+        auto index_keys = snapshot_index_->index_keys_in_snapshots(store(), stream_id, SnapshotLookup::READ);
         auto index_key = std::find_if(index_keys.begin(), index_keys.end(), [version_id](const AtomKey &k) {
             return k.version_id() == version_id;
         });
@@ -336,7 +361,7 @@ std::optional<VersionedItem> LocalVersionedEngine::get_version_at_time(
 
     auto index_key = load_index_key_from_time(store(), version_map(), stream_id, as_of);
     if (!index_key && std::get<TimestampVersionQuery>(version_query.content_).iterate_snapshots_if_tombstoned) {
-        auto index_keys = get_index_keys_in_snapshots(store(), stream_id);
+        auto index_keys = snapshot_index_->index_keys_in_snapshots(store(), stream_id, SnapshotLookup::READ);
         auto vector_index_keys = std::vector<AtomKey>(index_keys.begin(), index_keys.end());
         std::sort(std::begin(vector_index_keys), std::end(vector_index_keys),
                   [](auto& k1, auto& k2) {return k1.creation_ts() > k2.creation_ts();});
@@ -435,6 +460,26 @@ ReadVersionOutput LocalVersionedEngine::read_dataframe_version_internal(
     return read_frame_for_version(store(), identifier, read_query, read_options, handler_data).get();
 }
 
+std::unique_ptr<ReadBatchIterator> LocalVersionedEngine::read_dataframe_batches_internal(
+    const StreamId& stream_id,
+    const VersionQuery& version_query,
+    const std::shared_ptr<ReadQuery>& read_query,
+    const ReadOptions& read_options,
+    std::any&& handler_data,
+    size_t row_slices_per_batch,
+    size_t prefetch) {
+    py::gil_scoped_release release_gil;
+    auto version = get_version_to_read(stream_id, version_query);
+    if (!version) {
+        missing_data::raise<ErrorCode::E_NO_SUCH_VERSION>(
+            "read_dataframe_batches: version matching query '{}' not found for symbol '{}'",
+            version_query,
+            stream_id
+        );
+    }
+    return read_batches_for_version(store(), *version, read_query, read_options, std::move(handler_data), row_slices_per_batch, prefetch);
+}
+
 folly::Future<DescriptorItem> LocalVersionedEngine::get_descriptor(
     AtomKey&& k){
     const auto key = std::move(k);
@@ -531,8 +576,9 @@ std::shared_ptr<DeDupMap> LocalVersionedEngine::get_de_dup_map(
                 de_dup_map->insert_key(data_key);
             }
         } else if(maybe_prev && write_options.snapshot_dedup) {
-            // This means we don't have any live versions(all tombstoned), so will try to dedup from snapshot versions
-            auto snap_versions = get_index_keys_in_snapshots(store(), stream_id);
+            // This means we don't have any live versions(all tombstoned), so will try to dedup from snapshot versions.
+            // The new version will reference their data keys, so a snapshot deleting them must not be missed.
+            auto snap_versions = snapshot_index_->index_keys_in_snapshots(store(), stream_id, SnapshotLookup::WRITE);
             auto latest_snapshot_it = ranges::max_element(snap_versions,
                                                      [](const auto &k1, const auto &k2){return k1.version_id() < k2.version_id();});
             if (latest_snapshot_it != snap_versions.end()) {
@@ -1238,9 +1284,11 @@ MultiSymbolReadOutput LocalVersionedEngine::batch_read_and_join_internal(
     .thenValueInline([this, &handler_data, clauses_ptr, component_manager](std::vector<SymbolProcessingResult>&& symbol_processing_results) mutable {
         auto [input_schemas, entity_ids, res_versioned_items, res_metadatas] = unpack_symbol_processing_results(std::move(symbol_processing_results));
         auto pipeline_context = setup_join_pipeline_context(std::move(input_schemas), *clauses_ptr);
-        return schedule_remaining_iterations(std::move(entity_ids), clauses_ptr)
+        return schedule_remaining_iterations(component_manager, std::move(entity_ids), clauses_ptr)
         .thenValueInline([component_manager](std::vector<EntityId>&& processed_entity_ids) {
             auto proc = gather_entities<std::shared_ptr<SegmentInMemory>, std::shared_ptr<RowRange>, std::shared_ptr<ColRange>>(*component_manager, std::move(processed_entity_ids));
+            if (component_manager->arena())
+                query_stats::add_arena_stats(component_manager->arena()->stats());
             return collect_segments(std::move(proc));
         })
         .thenValueInline([store=store(), &handler_data, pipeline_context](std::vector<SliceAndKey>&& slice_and_keys) mutable {
@@ -1835,6 +1883,71 @@ void LocalVersionedEngine::configure(const storage::LibraryDescriptor::VariantSt
     );
 }
 
+void LocalVersionedEngine::load_zstd_dictionary() {
+    // Holds the store weakly, as the loader may be called while the engine is being destroyed
+    zstd_dictionary_loader_ = std::make_shared<const ZstdDictionaryLoader>([weak_store=std::weak_ptr<Store>(store_)] (uint32_t id) -> std::shared_ptr<ZstdDictionary> {
+        auto store = weak_store.lock();
+        if (!store)
+            return nullptr;
+
+        try {
+            auto [key, segment] = store->read_sync(RefKey{StreamId{zstd_dictionary_stream_id(id)}, KeyType::ZSTD_DICTIONARY});
+            ARCTICDB_DEBUG(log::version(), "Loaded ZSTD dictionary {} on demand", id);
+            return zstd_dictionary_from_segment(segment);
+        } catch (const storage::KeyNotFoundException&) {
+            return nullptr;
+        }
+    });
+    ZstdDictionaries::instance()->add_loader(zstd_dictionary_loader_);
+
+    try {
+        auto [key, segment] = store()->read_sync(RefKey{StreamId{std::string{ZstdDictionaryId}}, KeyType::ZSTD_DICTIONARY});
+        const auto id = current_zstd_dictionary_from_segment(segment);
+        store()->set_zstd_dictionary(ZstdDictionaries::instance()->get(id));
+    } catch (const storage::KeyNotFoundException&) {
+        ARCTICDB_DEBUG(log::version(), "Library has no ZSTD dictionary yet");
+    }
+}
+
+uint32_t LocalVersionedEngine::train_zstd_dictionary(size_t max_dictionary_bytes, size_t max_keys_per_type) {
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+        cfg_.zstd_dictionary(),
+        "Training a ZSTD dictionary requires the zstd_dictionary library option, otherwise clients would not load it");
+    // Samples every type of key that may be compressed with the dictionary, so that it also suits the small data
+    // segments. Only the data segments that will use the dictionary are sampled, which is known once they are read.
+    std::vector<std::string> samples;
+    for (auto key_type : {KeyType::VERSION, KeyType::SYMBOL_LIST, KeyType::TABLE_DATA, KeyType::APPEND_DATA}) {
+        std::vector<folly::Future<std::pair<VariantKey, SegmentInMemory>>> segment_futs;
+        size_t count = 0;
+        store()->iterate_type(key_type, [this, &segment_futs, &count, max_keys_per_type](VariantKey&& key) {
+            if (count++ < max_keys_per_type)
+                segment_futs.emplace_back(store()->read(key));
+        });
+        for (const auto& [key, segment] : folly::collect(segment_futs).get()) {
+            if (uses_zstd_dictionary(key_type, segment))
+                append_zstd_dictionary_samples(segment, samples);
+        }
+    }
+
+    auto dictionary = ::arcticdb::train_zstd_dictionary(samples, max_dictionary_bytes);
+    // The dictionary is stored before it becomes current, so that every segment compressed with it can find it. A
+    // stored dictionary is never replaced, as segments compressed with it would no longer decode.
+    const RefKey dictionary_key{StreamId{zstd_dictionary_stream_id(dictionary->id())}, KeyType::ZSTD_DICTIONARY};
+    if (store()->key_exists_sync(dictionary_key)) {
+        const auto existing = zstd_dictionary_from_segment(store()->read_sync(dictionary_key).second);
+        internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+            existing->content() == dictionary->content(),
+            "Trained a ZSTD dictionary with the same id {} as a different stored dictionary, train again to get another id",
+            dictionary->id());
+    } else {
+        store()->write_sync(KeyType::ZSTD_DICTIONARY, StreamId{zstd_dictionary_stream_id(dictionary->id())}, zstd_dictionary_to_segment(*dictionary));
+    }
+    store()->write_sync(KeyType::ZSTD_DICTIONARY, StreamId{std::string{ZstdDictionaryId}}, current_zstd_dictionary_to_segment(dictionary->id()));
+    store()->set_zstd_dictionary(dictionary);
+    log::version().info("Trained ZSTD dictionary {} of {} bytes from {} samples", dictionary->id(), dictionary->content().size(), samples.size());
+    return dictionary->id();
+}
+
 timestamp LocalVersionedEngine::latest_timestamp(const std::string& symbol) {
     if(auto latest_incomplete = latest_incomplete_timestamp(store(), symbol); latest_incomplete)
         return *latest_incomplete;
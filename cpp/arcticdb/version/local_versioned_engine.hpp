@@ -11,6 +11,7 @@
 #include <arcticdb/async/async_store.hpp>
 #include <arcticdb/version/symbol_list.hpp>
 #include <arcticdb/version/snapshot.hpp>
+#include <arcticdb/version/snapshot_index.hpp>
 #include <arcticdb/entity/protobufs.hpp>
 #include <arcticdb/pipeline/column_stats.hpp>
 #include <arcticdb/pipeline/write_options.hpp>
@@ -149,6 +150,15 @@ public:
         const ReadOptions& read_options,
         std::any& handler_data) override;
 
+    std::unique_ptr<ReadBatchIterator> read_dataframe_batches_internal(
+        const StreamId& stream_id,
+        const VersionQuery& version_query,
+        const std::shared_ptr<ReadQuery>& read_query,
+        const ReadOptions& read_options,
+        std::any&& handler_data,
+        size_t row_slices_per_batch,
+        size_t prefetch);
+
     DescriptorItem read_descriptor_internal(
             const StreamId& stream_id,
             const VersionQuery& version_query);
@@ -164,7 +174,7 @@ public:
         const std::vector<IndexTypeKey>& idx_to_be_deleted,
         const PreDeleteChecks& checks = default_pre_delete_checks
     ) override {
-        auto snapshot_map = get_master_snapshots_map(store());
+        auto snapshot_map = snapshot_index_->master_snapshots_map(store());
         delete_trees_responsibly(store(), version_map(), idx_to_be_deleted, snapshot_map, std::nullopt, checks).get();
     };
 
@@ -242,6 +252,17 @@ public:
         const StreamId& stream_id,
         const VersionQuery& version_query);
 
+    uint64_t approx_nunique_internal(
+        const VersionedItem& versioned_item,
+        const std::string& column,
+        const IndexRange& date_range);
+
+    uint64_t approx_nunique_version_internal(
+        const StreamId& stream_id,
+        const std::string& column,
+        const IndexRange& date_range,
+        const VersionQuery& version_query);
+
     VersionedItem write_individual_segment(
         const StreamId& stream_id,
         SegmentInMemory&& segment,
@@ -401,6 +422,16 @@ public:
 
     std::unordered_map<StreamId, std::unordered_map<KeyType, KeySizesInfo>> scan_object_sizes_by_stream();
 
+    /// Trains a ZSTD dictionary on up to max_keys_per_type of each of the library's VERSION, SYMBOL_LIST, TABLE_DATA
+    /// and APPEND_DATA keys, of which only the data segments small enough to use the dictionary are sampled. Stores it
+    /// under a ZSTD_DICTIONARY key of its own, keeping the dictionaries trained before it for the segments compressed
+    /// with them, and compresses the small segments written from then on with it.
+    /// Requires the zstd_dictionary library option, so that every client opening the library can load the
+    /// dictionary. Clients that already have the library open load it when they first read a segment compressed with
+    /// it, but keep compressing with the dictionary they opened the library with until they reopen it.
+    /// @return The id of the dictionary
+    uint32_t train_zstd_dictionary(size_t max_dictionary_bytes, size_t max_keys_per_type);
+
     std::shared_ptr<Store>& _test_get_store() { return store_; }
     void _test_set_validate_version_map() {
         version_map()->set_validate(true);
@@ -448,9 +479,11 @@ protected:
     std::shared_ptr<VersionMap>& version_map() override { return version_map_; }
     SymbolList& symbol_list() override { return *symbol_list_; }
     std::shared_ptr<SymbolList> symbol_list_ptr() { return symbol_list_; }
+    SnapshotIndex& snapshot_index() { return *snapshot_index_; }
 
     void set_store(std::shared_ptr<Store> store) override {
         store_ = std::move(store) ;
+        snapshot_index_->invalidate();
     }
 
     /**
@@ -467,12 +500,16 @@ protected:
 
 private:
     void initialize(const std::shared_ptr<storage::Library>& library);
+    void load_zstd_dictionary();
     void add_to_symbol_list_on_compaction(const StreamId& stream_id, const CompactIncompleteOptions& options, const UpdateInfo& update_info);
 
     std::shared_ptr<Store> store_;
     arcticdb::proto::storage::VersionStoreConfig cfg_;
+    // Registered with ZstdDictionaries for as long as the engine is open, when the library has the zstd_dictionary option
+    std::shared_ptr<const ZstdDictionaryLoader> zstd_dictionary_loader_;
     std::shared_ptr<VersionMap> version_map_ = std::make_shared<VersionMap>();
     std::shared_ptr<SymbolList> symbol_list_;
+    std::shared_ptr<SnapshotIndex> snapshot_index_ = std::make_shared<SnapshotIndex>();
     std::optional<std::string> license_key_;
 };
 
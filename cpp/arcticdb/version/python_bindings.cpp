@@ -271,6 +271,20 @@ void register_bindings(py::module &version, py::exception<arcticdb::ArcticExcept
             .def("schema", &RecordBatchData::schema)
         ;
 
+        py::class_<ReadBatchIterator, std::shared_ptr<ReadBatchIterator>>(version, "ReadBatchIterator")
+            .def("next", [](ReadBatchIterator& self) -> py::object {
+                auto output = [&self]() {
+                    py::gil_scoped_release release_gil;
+                    return self.next();
+                }();
+                if (!output.has_value()) {
+                    return py::none();
+                }
+                return adapt_read_df(create_python_read_result(output->versioned_item_, OutputFormat::ARROW, std::move(output->frame_and_descriptor_)), nullptr);
+            })
+            .def("num_batches", &ReadBatchIterator::num_batches)
+        ;
+
     py::enum_<VersionRequestType>(version, "VersionRequestType", R"pbdoc(
         Enum of possible version request types passed to as_of.
     )pbdoc")
@@ -478,6 +492,9 @@ void register_bindings(py::module &version, py::exception<arcticdb::ArcticExcept
             .value("NOTNULL", OperationType::NOTNULL)
             .value("IDENTITY", OperationType::IDENTITY)
             .value("NOT", OperationType::NOT)
+            .value("LEN", OperationType::LEN)
+            .value("LOWER", OperationType::LOWER)
+            .value("UPPER", OperationType::UPPER)
             .value("ADD", OperationType::ADD)
             .value("SUB", OperationType::SUB)
             .value("MUL", OperationType::MUL)
@@ -491,10 +508,14 @@ void register_bindings(py::module &version, py::exception<arcticdb::ArcticExcept
             .value("ISIN", OperationType::ISIN)
             .value("ISNOTIN", OperationType::ISNOTIN)
             .value("REGEX_MATCH", OperationType::REGEX_MATCH)
+            .value("STARTSWITH", OperationType::STARTSWITH)
+            .value("CONTAINS", OperationType::CONTAINS)
             .value("AND", OperationType::AND)
             .value("OR", OperationType::OR)
             .value("XOR", OperationType::XOR)
-            .value("TERNARY", OperationType::TERNARY);
+            .value("CONCAT", OperationType::CONCAT)
+            .value("TERNARY", OperationType::TERNARY)
+            .value("SUBSTRING", OperationType::SUBSTRING);
 
     py::enum_<SortedValue>(version, "SortedValue")
             .value("UNKNOWN", SortedValue::UNKNOWN)
@@ -633,6 +654,9 @@ void register_bindings(py::module &version, py::exception<arcticdb::ArcticExcept
         .def("get_column_stats_info_version",
              &PythonVersionStore::get_column_stats_info_version,
              py::call_guard<SingleThreadMutexHolder>(), "Get info about column stats")
+        .def("approx_nunique_version",
+             &PythonVersionStore::approx_nunique_version,
+             py::call_guard<SingleThreadMutexHolder>(), "Estimate the number of unique values in a column from its column stats")
          .def("remove_incomplete",
              &PythonVersionStore::remove_incomplete,
              py::call_guard<SingleThreadMutexHolder>(), "Delete incomplete segments")
@@ -743,6 +767,13 @@ void register_bindings(py::module &version, py::exception<arcticdb::ArcticExcept
              },
              py::call_guard<SingleThreadMutexHolder>(),
              "Read the specified version of the dataframe from the store")
+        .def("read_dataframe_batches",
+             [&](PythonVersionStore& v, StreamId sid, const VersionQuery& version_query, const std::shared_ptr<ReadQuery>& read_query, const ReadOptions& read_options, size_t row_slices_per_batch, size_t prefetch) -> std::shared_ptr<ReadBatchIterator> {
+                auto handler_data = TypeHandlerRegistry::instance()->get_handler_data(read_options.output_format());
+                return v.read_dataframe_batches_internal(sid, version_query, read_query, read_options, std::move(handler_data), row_slices_per_batch, prefetch);
+             },
+             py::call_guard<SingleThreadMutexHolder>(),
+             "Read the specified version of the dataframe from the store as a sequence of Arrow frames, each covering a group of row-slices")
         .def("read_index",
              [&](PythonVersionStore& v, StreamId sid, const VersionQuery& version_query){
                  constexpr OutputFormat output_format = OutputFormat::PANDAS;
@@ -768,6 +799,12 @@ void register_bindings(py::module &version, py::exception<arcticdb::ArcticExcept
              &PythonVersionStore::scan_object_sizes_for_stream,
              py::call_guard<SingleThreadMutexHolder>(),
              "Scan the compressed sizes of the given symbol.")
+        .def("train_zstd_dictionary",
+             &PythonVersionStore::train_zstd_dictionary,
+             py::arg("max_dictionary_bytes") = 112640,
+             py::arg("max_keys_per_type") = 10000,
+             py::call_guard<SingleThreadMutexHolder>(),
+             "Train a ZSTD dictionary for the small segments of the library, returning its id.")
         .def("find_version",
              &PythonVersionStore::get_version_to_read,
              py::call_guard<SingleThreadMutexHolder>(), "Check if a specific stream has been written to previously")
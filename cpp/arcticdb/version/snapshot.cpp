@@ -57,11 +57,32 @@ void write_snapshot_entry(
     }
 
     snapshot_agg.finalize();
+    write_snapshot_generation(store);
     if (log_changes) {
         log_create_snapshot(store, snapshot_id);
     }
 }
 
+void write_snapshot_generation(const std::shared_ptr<StreamSink>& store) {
+    auto column = std::make_shared<Column>(make_scalar_type(DataType::NANOSECONDS_UTC64), Sparsity::NOT_PERMITTED);
+    column->push_back<timestamp>(util::SysClock::nanos_since_epoch());
+    SegmentInMemory segment;
+    segment.add_column(scalar_field(DataType::NANOSECONDS_UTC64, "generation"), column);
+    segment.set_row_id(0);
+    store->write_sync(KeyType::SNAPSHOT_GENERATION, StreamId{std::string{SnapshotGenerationId}}, std::move(segment));
+}
+
+std::optional<timestamp> read_snapshot_generation(const std::shared_ptr<Store>& store) {
+    try {
+        auto [key, segment] = store->read_sync(RefKey{StreamId{std::string{SnapshotGenerationId}}, KeyType::SNAPSHOT_GENERATION});
+        util::check(segment.num_columns() == 1 && segment.row_count() == 1,
+                    "Expected the snapshot generation segment to have a single value");
+        return segment.scalar_at<timestamp>(0, 0).value();
+    } catch (const storage::KeyNotFoundException&) {
+        return std::nullopt;
+    }
+}
+
 void tombstone_snapshot(
     const std::shared_ptr<StreamSink>& store,
     const RefKey& key,
@@ -91,9 +112,7 @@ void tombstone_snapshot(
     store->write_compressed(std::move(key_segment_pair)).get();
 }
 
-void iterate_snapshots(const std::shared_ptr<Store>& store, folly::Function<void(entity::VariantKey & )> visitor) {
-    ARCTICDB_SAMPLE(IterateSnapshots, 0)
-
+std::vector<VariantKey> get_snapshot_keys(const std::shared_ptr<Store>& store) {
     std::vector<VariantKey> snap_variant_keys;
     std::unordered_set<SnapshotId> seen;
 
@@ -110,7 +129,13 @@ void iterate_snapshots(const std::shared_ptr<Store>& store, folly::Function<void
             snap_variant_keys.emplace_back(key);
         }
     });
+    return snap_variant_keys;
+}
 
+void iterate_snapshots(const std::shared_ptr<Store>& store, folly::Function<void(entity::VariantKey & )> visitor) {
+    ARCTICDB_SAMPLE(IterateSnapshots, 0)
+
+    auto snap_variant_keys = get_snapshot_keys(store);
     for (auto& vk: snap_variant_keys) {
         try {
             visitor(vk);
@@ -185,22 +210,6 @@ std::unordered_set<entity::AtomKey> get_index_keys_in_snapshots(
     return index_keys_in_snapshots;
 }
 
-/**
- * Returned pair has first: keys not in snapshots, second: keys in snapshots.
- */
-std::pair<std::vector<AtomKey>, std::unordered_set<AtomKey>> get_index_keys_partitioned_by_inclusion_in_snapshots(
-        const std::shared_ptr<Store>& store,
-        const StreamId& stream_id,
-        std::vector<entity::AtomKey>&& all_index_keys
-) {
-    ARCTICDB_SAMPLE(GetIndexKeysPartitionedByInclusionInSnapshots, 0)
-    auto index_keys_in_snapshot = get_index_keys_in_snapshots(store, stream_id);
-    std::erase_if(all_index_keys, [&index_keys_in_snapshot](const auto& index_key) {
-        return index_keys_in_snapshot.count(index_key) == 1;
-    });
-    return {std::move(all_index_keys), std::move(index_keys_in_snapshot)};
-}
-
 VariantKey get_ref_key(const SnapshotId& snap_name) {
     return RefKey{snap_name, KeyType::SNAPSHOT_REF};
 }
@@ -44,6 +44,18 @@ void tombstone_snapshot(
         bool log_changes
         );
 
+// The id of the library's SNAPSHOT_GENERATION key
+constexpr std::string_view SnapshotGenerationId = "__snapshot_generation__";
+
+// Records a new generation, which write_snapshot_entry does after writing each snapshot
+void write_snapshot_generation(const std::shared_ptr<stream::StreamSink>& store);
+
+// The generation last written to the library, if any snapshot has been written by a client that records them
+std::optional<timestamp> read_snapshot_generation(const std::shared_ptr<Store>& store);
+
+// The key of every snapshot, preferring the ref key where a snapshot has both a ref key and an old style atom key
+std::vector<VariantKey> get_snapshot_keys(const std::shared_ptr<Store>& store);
+
 void iterate_snapshots(const std::shared_ptr<Store>& store, folly::Function<void(entity::VariantKey & )> visitor);
 
 std::optional<size_t> row_id_for_stream_in_snapshot_segment(
@@ -56,12 +68,6 @@ std::unordered_set<entity::AtomKey> get_index_keys_in_snapshots(
     const std::shared_ptr<Store>& store,
     const StreamId &stream_id);
 
-std::pair<std::vector<AtomKey>, std::unordered_set<AtomKey>> get_index_keys_partitioned_by_inclusion_in_snapshots(
-    const std::shared_ptr<Store>& store,
-    const StreamId& stream_id,
-    std::vector<entity::AtomKey>&& all_index_keys
-);
-
 std::vector<AtomKey> get_versions_from_segment(
     const SegmentInMemory& snapshot_segment
 );
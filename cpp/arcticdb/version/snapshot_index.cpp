@@ -0,0 +1,176 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/version/snapshot_index.hpp>
+#include <arcticdb/storage/storage.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+#include <folly/futures/Future.h>
+#include <folly/container/Enumerate.h>
+
+namespace arcticdb {
+
+std::unordered_set<AtomKey> SnapshotIndex::index_keys_in_snapshots(
+        const std::shared_ptr<Store>& store,
+        const StreamId& stream_id,
+        SnapshotLookup lookup) {
+    ARCTICDB_SAMPLE(SnapshotIndexKeysInSnapshots, 0)
+    refresh(store, lookup);
+    std::lock_guard lock{mutex_};
+    std::unordered_set<AtomKey> output;
+    if (auto it = snapshots_for_index_keys_.find(stream_id); it != snapshots_for_index_keys_.end()) {
+        for (const auto& [index_key, snapshot_ids] : it->second)
+            output.emplace(index_key);
+    }
+    return output;
+}
+
+std::pair<std::vector<AtomKey>, std::unordered_set<AtomKey>> SnapshotIndex::index_keys_partitioned_by_inclusion_in_snapshots(
+        const std::shared_ptr<Store>& store,
+        const StreamId& stream_id,
+        std::vector<AtomKey>&& all_index_keys) {
+    ARCTICDB_SAMPLE(GetIndexKeysPartitionedByInclusionInSnapshots, 0)
+    auto index_keys_in_snapshot = index_keys_in_snapshots(store, stream_id, SnapshotLookup::WRITE);
+    std::erase_if(all_index_keys, [&index_keys_in_snapshot](const auto& index_key) {
+        return index_keys_in_snapshot.contains(index_key);
+    });
+    return {std::move(all_index_keys), std::move(index_keys_in_snapshot)};
+}
+
+MasterSnapshotMap SnapshotIndex::master_snapshots_map(const std::shared_ptr<Store>& store) {
+    refresh(store, SnapshotLookup::WRITE);
+    std::lock_guard lock{mutex_};
+    return snapshots_for_index_keys_;
+}
+
+void SnapshotIndex::add_snapshot(const SnapshotId& snapshot_id, const std::vector<AtomKey>& index_keys) {
+    std::lock_guard lock{mutex_};
+    erase(snapshot_id);
+    insert(snapshot_id, RefKey{snapshot_id, KeyType::SNAPSHOT_REF}, std::vector<AtomKey>{index_keys}, ++change_count_);
+}
+
+void SnapshotIndex::remove_snapshot(const SnapshotId& snapshot_id) {
+    std::lock_guard lock{mutex_};
+    ++change_count_;
+    erase(snapshot_id);
+}
+
+void SnapshotIndex::invalidate() {
+    // Entries are kept until they are replaced, so that lookups racing with the rebuild still see them. Snapshots
+    // under atom keys are immutable, so only those under ref keys need reading again.
+    std::lock_guard lock{mutex_};
+    last_rebuild_time_.reset();
+    generation_.reset();
+}
+
+void SnapshotIndex::refresh(const std::shared_ptr<Store>& store, SnapshotLookup lookup) {
+    const auto now = util::SysClock::coarse_nanos_since_epoch();
+    const timestamp reload_interval = lookup == SnapshotLookup::WRITE ?
+        ConfigsMap::instance()->get_int("SnapshotIndex.WriteReloadInterval", DEFAULT_WRITE_RELOAD_INTERVAL) :
+        ConfigsMap::instance()->get_int("SnapshotIndex.ReloadInterval", DEFAULT_RELOAD_INTERVAL);
+    // Read before listing, so that every snapshot written before this generation is read as it is now
+    std::optional<timestamp> generation;
+    if (lookup == SnapshotLookup::WRITE)
+        generation = read_snapshot_generation(store);
+
+    bool reload_refs;
+    uint64_t start_change_count;
+    {
+        std::lock_guard lock{mutex_};
+        reload_refs = !last_rebuild_time_ || now - *last_rebuild_time_ >= reload_interval ||
+            (lookup == SnapshotLookup::WRITE && generation != generation_);
+        start_change_count = change_count_;
+    }
+
+    auto snapshot_keys = get_snapshot_keys(store);
+    std::vector<VariantKey> to_read;
+    {
+        std::lock_guard lock{mutex_};
+        std::unordered_set<SnapshotId> listed;
+        for (auto& snapshot_key : snapshot_keys) {
+            auto snapshot_id = variant_key_id(snapshot_key);
+            listed.insert(snapshot_id);
+            auto it = snapshots_.find(snapshot_id);
+            if (it == snapshots_.end() || it->second.key_ != snapshot_key || (reload_refs && std::holds_alternative<RefKey>(snapshot_key)))
+                to_read.emplace_back(std::move(snapshot_key));
+        }
+
+        std::vector<SnapshotId> deleted;
+        for (const auto& [snapshot_id, entry] : snapshots_) {
+            if (!listed.contains(snapshot_id) && entry.change_count_ <= start_change_count)
+                deleted.emplace_back(snapshot_id);
+        }
+        for (const auto& snapshot_id : deleted)
+            erase(snapshot_id);
+    }
+
+    std::vector<folly::Try<std::pair<VariantKey, SegmentInMemory>>> results;
+    if (!to_read.empty()) {
+        ARCTICDB_DEBUG(log::snapshot(), "Reading {} snapshots into the snapshot index", to_read.size());
+        std::vector<folly::Future<std::pair<VariantKey, SegmentInMemory>>> reads;
+        reads.reserve(to_read.size());
+        for (const auto& snapshot_key : to_read)
+            reads.emplace_back(store->read(snapshot_key));
+
+        results = folly::collectAll(std::move(reads)).get();
+    }
+
+    std::lock_guard lock{mutex_};
+    for (auto&& [idx, result] : folly::enumerate(results)) {
+        // Snapshots deleted since they were listed are skipped, as in iterate_snapshots
+        if (result.hasException<storage::KeyNotFoundException>()) {
+            ARCTICDB_DEBUG(log::snapshot(), "Snapshot {} deleted while building the snapshot index", to_read[idx]);
+            continue;
+        }
+        auto [snapshot_key, snapshot_segment] = std::move(result).value();
+        auto snapshot_id = variant_key_id(snapshot_key);
+        if (auto it = snapshots_.find(snapshot_id); it != snapshots_.end() && it->second.change_count_ > start_change_count)
+            continue;
+
+        erase(snapshot_id);
+        insert(snapshot_id, std::move(snapshot_key), get_versions_from_segment(snapshot_segment), start_change_count);
+    }
+    if (reload_refs)
+        last_rebuild_time_ = now;
+    if (lookup == SnapshotLookup::WRITE)
+        generation_ = generation;
+}
+
+void SnapshotIndex::insert(
+        const SnapshotId& snapshot_id,
+        VariantKey&& snapshot_key,
+        std::vector<AtomKey>&& index_keys,
+        uint64_t change_count) {
+    for (const auto& index_key : index_keys)
+        snapshots_for_index_keys_[index_key.id()][index_key].insert(snapshot_id);
+
+    snapshots_.insert_or_assign(snapshot_id, SnapshotEntry{std::move(snapshot_key), std::move(index_keys), change_count});
+}
+
+void SnapshotIndex::erase(const SnapshotId& snapshot_id) {
+    auto it = snapshots_.find(snapshot_id);
+    if (it == snapshots_.end())
+        return;
+
+    for (const auto& index_key : it->second.index_keys_) {
+        auto symbol_it = snapshots_for_index_keys_.find(index_key.id());
+        if (symbol_it == snapshots_for_index_keys_.end())
+            continue;
+
+        auto& index_keys = symbol_it->second;
+        if (auto key_it = index_keys.find(index_key); key_it != index_keys.end()) {
+            key_it->second.erase(snapshot_id);
+            if (key_it->second.empty())
+                index_keys.erase(key_it);
+        }
+        if (index_keys.empty())
+            snapshots_for_index_keys_.erase(symbol_it);
+    }
+    snapshots_.erase(it);
+}
+
+} // namespace arcticdb
@@ -0,0 +1,96 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/version/snapshot.hpp>
+
+#include <mutex>
+
+namespace arcticdb {
+
+// What a snapshot index lookup is for, which decides how stale the index it uses may be
+enum class SnapshotLookup {
+    // Finding versions to read that are only in snapshots, where a recently modified snapshot may be missed
+    READ,
+    // Deciding which keys can be deleted, or which existing data keys a new version can reference
+    WRITE
+};
+
+/**
+ * Reverse index from the index keys in any snapshot of a library to the snapshots containing them, so that deleting
+ * and pruning versions can check which index keys are protected by snapshots without reading every snapshot segment.
+ *
+ * Each lookup lists the snapshot keys, reads only the snapshots it has not seen before, and forgets the snapshots that
+ * no longer exist. Snapshots written or deleted through the owning version store are applied directly.
+ *
+ * Snapshots that another client rewrites under the same SNAPSHOT_REF key (add_to_snapshot, remove_from_snapshot, or a
+ * delete followed by a create) cannot be detected by listing. Writing a snapshot therefore also records a new
+ * generation under the library's SNAPSHOT_GENERATION key, and WRITE lookups read the snapshots stored under ref keys
+ * again when the generation has changed. READ lookups skip that check, and may miss a rewritten snapshot until the
+ * index is older than SnapshotIndex.ReloadInterval nanoseconds. Clients from before generations were recorded rewrite
+ * snapshots without changing it, which WRITE lookups only see once the index is older than
+ * SnapshotIndex.WriteReloadInterval nanoseconds. Snapshots stored under atom keys are immutable, as rewriting one
+ * writes a new key.
+ *
+ * Storage is listed and read without holding the lock, so lookups do not wait on each other's IO.
+ */
+class SnapshotIndex {
+public:
+    static constexpr timestamp DEFAULT_RELOAD_INTERVAL = 60 * 1'000'000'000LL;
+    static constexpr timestamp DEFAULT_WRITE_RELOAD_INTERVAL = DEFAULT_RELOAD_INTERVAL;
+
+    // The index keys of the symbol that are in any snapshot
+    std::unordered_set<AtomKey> index_keys_in_snapshots(
+        const std::shared_ptr<Store>& store,
+        const StreamId& stream_id,
+        SnapshotLookup lookup);
+
+    /**
+     * Returned pair has first: keys not in snapshots, second: keys of the symbol in snapshots. This is a WRITE lookup.
+     */
+    std::pair<std::vector<AtomKey>, std::unordered_set<AtomKey>> index_keys_partitioned_by_inclusion_in_snapshots(
+        const std::shared_ptr<Store>& store,
+        const StreamId& stream_id,
+        std::vector<AtomKey>&& all_index_keys);
+
+    // For deleting versions, so this is a WRITE lookup
+    MasterSnapshotMap master_snapshots_map(const std::shared_ptr<Store>& store);
+
+    // Records a snapshot written through the owning version store, replacing any previous contents under that name
+    void add_snapshot(const SnapshotId& snapshot_id, const std::vector<AtomKey>& index_keys);
+
+    void remove_snapshot(const SnapshotId& snapshot_id);
+
+    // Forces the next lookup to read every snapshot stored under a ref key again
+    void invalidate();
+
+private:
+    void refresh(const std::shared_ptr<Store>& store, SnapshotLookup lookup);
+
+    void insert(const SnapshotId& snapshot_id, VariantKey&& snapshot_key, std::vector<AtomKey>&& index_keys, uint64_t change_count);
+
+    void erase(const SnapshotId& snapshot_id);
+
+    struct SnapshotEntry {
+        VariantKey key_;
+        std::vector<AtomKey> index_keys_;
+        // The change_count_ when the entry was inserted, so that a refresh does not replace entries changed since it
+        // started with what it read from storage before the change
+        uint64_t change_count_;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<SnapshotId, SnapshotEntry> snapshots_;
+    MasterSnapshotMap snapshots_for_index_keys_;
+    uint64_t change_count_ = 0;
+    std::optional<timestamp> last_rebuild_time_;
+    std::optional<timestamp> generation_;
+};
+};
+
+} // namespace arcticdb
@@ -386,17 +386,23 @@ ProblematicResult is_problematic(
     return ProblematicResult{latest};
 }
 
+timestamp min_allowed_interval() {
+    return ConfigsMap::instance()->get_int("SymbolList.MinIntervalNs", 100'000'000LL);
+}
+
+// If resolved_from_versions is provided, the symbols whose state had to be checked against the version map are added to it
 CollectionType merge_existing_with_journal_keys(
         const std::shared_ptr<VersionMap>& version_map,
         const std::shared_ptr<Store>& store,
         const std::vector<AtomKey>& keys,
-        std::vector<SymbolListEntry>&& existing) {
+        std::vector<SymbolListEntry>&& existing,
+        std::unordered_set<StreamId>* resolved_from_versions = nullptr) {
     auto existing_keys = std::move(existing);
     auto update_map = load_journal_keys(keys);
 
     CollectionType symbols;
     std::map<StreamId, std::pair<VersionId, timestamp>> problematic_symbols;
-    const auto min_allowed_interval = ConfigsMap::instance()->get_int("SymbolList.MinIntervalNs", 100'000'000LL);
+    const auto min_interval = min_allowed_interval();
 
     for(auto& previous_entry : existing_keys) {
         const auto& stream_id = previous_entry.stream_id_;
@@ -408,7 +414,7 @@ CollectionType merge_existing_with_journal_keys(
                 util::check(previous_entry.action_ == ActionType::DELETE, "Unknown action type {} in symbol list", static_cast<uint8_t>(previous_entry.action_));
         } else {
             util::check(!updated->second.empty(), "Unexpected empty entry for symbol {}", updated->first);
-            if(auto problematic_entry = is_problematic(previous_entry, updated->second, min_allowed_interval); problematic_entry) {
+            if(auto problematic_entry = is_problematic(previous_entry, updated->second, min_interval); problematic_entry) {
                 problematic_symbols.try_emplace(stream_id, std::make_pair(problematic_entry.reference_id(), problematic_entry.time()));
             } else {
                 const auto& last_entry = updated->second.rbegin();
@@ -420,7 +426,7 @@ CollectionType merge_existing_with_journal_keys(
 
     for(const auto& [symbol, entries] : update_map) {
         ARCTICDB_DEBUG(log::symbol(), "{} {}", symbol, entries);
-        if(auto problematic_entry = is_problematic(entries, min_allowed_interval); problematic_entry) {
+        if(auto problematic_entry = is_problematic(entries, min_interval); problematic_entry) {
             problematic_symbols.try_emplace(symbol, problematic_entry.reference_id(), problematic_entry.time());
         } else {
             const auto& last_entry = entries.rbegin();
@@ -430,8 +436,11 @@ CollectionType merge_existing_with_journal_keys(
 
     if(!problematic_symbols.empty()) {
         auto symbol_versions = std::make_shared<std::vector<StreamId>>();
-        for(const auto& [symbol, reference_pair] : problematic_symbols)
+        for(const auto& [symbol, reference_pair] : problematic_symbols) {
             symbol_versions->emplace_back(symbol);
+            if(resolved_from_versions)
+                resolved_from_versions->insert(symbol);
+        }
 
         auto versions = batch_check_latest_id_and_status(store, version_map, symbol_versions);
 
@@ -473,6 +482,120 @@ CollectionType load_from_symbol_list_keys(
     return merge_existing_with_journal_keys(version_map, store, keys, std::move(previous_compaction));
 }
 
+bool is_cache_valid(
+        const std::unique_ptr<SymbolListCache>& cache,
+        const std::vector<AtomKey>& keys,
+        const AtomKey& compaction_key,
+        timestamp min_interval) {
+    if(!cache || cache->compaction_key_ != compaction_key || cache->min_allowed_interval_ != min_interval)
+        return false;
+
+    // Journal keys are only removed by compaction, which also writes a new compaction key, so any applied key missing
+    // from storage means that the symbol list has been changed by something other than the normal write path
+    const auto applied_keys_found = std::count_if(std::begin(keys), std::end(keys), [&cache] (const AtomKey& key) {
+        return cache->applied_journal_keys_.contains(key);
+    });
+    return static_cast<size_t>(applied_keys_found) == cache->applied_journal_keys_.size();
+}
+
+void add_merged_symbols(std::unordered_map<StreamId, std::vector<SymbolListEntry>>& symbols, CollectionType&& merged) {
+    for(auto& entry : merged) {
+        auto stream_id = entry.stream_id_;
+        symbols[stream_id].emplace_back(std::move(entry));
+    }
+}
+
+std::unique_ptr<SymbolListCache> create_cache(
+        const std::shared_ptr<VersionMap>& version_map,
+        const std::shared_ptr<Store>& store,
+        const std::vector<AtomKey>& keys,
+        const Compaction& compaction,
+        timestamp min_interval) {
+    ARCTICDB_RUNTIME_DEBUG(log::symbol(), "Loading symbols from symbol list keys, no usable cached state for {}", *compaction);
+    auto cache = std::make_unique<SymbolListCache>(*compaction, min_interval);
+    auto previous_compaction = read_from_storage(store, *compaction);
+    for(const auto& entry : previous_compaction)
+        cache->compacted_[entry.stream_id_].emplace_back(entry);
+
+    add_merged_symbols(cache->symbols_, merge_existing_with_journal_keys(version_map, store, keys, std::move(previous_compaction), &cache->resolved_from_versions_));
+    for(const auto& key : keys) {
+        if(key.id() != compaction_id)
+            cache->applied_journal_keys_.insert(key);
+    }
+    return cache;
+}
+
+void apply_new_journal_keys(
+        const std::shared_ptr<VersionMap>& version_map,
+        const std::shared_ptr<Store>& store,
+        const std::vector<AtomKey>& keys,
+        SymbolListCache& cache) {
+    std::vector<AtomKey> new_keys;
+    std::unordered_set<StreamId> affected{std::begin(cache.resolved_from_versions_), std::end(cache.resolved_from_versions_)};
+    for(const auto& key : keys) {
+        if(key.id() != compaction_id && !cache.applied_journal_keys_.contains(key)) {
+            new_keys.emplace_back(key);
+            affected.insert(key.start_index());
+        }
+    }
+
+    ARCTICDB_RUNTIME_DEBUG(log::symbol(), "Merging {} new symbol list journal keys affecting {} symbols into cached state",
+                           new_keys.size(), affected.size());
+    if(affected.empty())
+        return;
+
+    // Merge all of the journal keys for the affected symbols, preserving the sort order
+    std::vector<AtomKey> affected_keys;
+    for(const auto& key : keys) {
+        if(key.id() != compaction_id && affected.contains(key.start_index()))
+            affected_keys.emplace_back(key);
+    }
+
+    std::vector<SymbolListEntry> existing;
+    for(const auto& stream_id : affected) {
+        if(auto it = cache.compacted_.find(stream_id); it != cache.compacted_.end())
+            existing.insert(std::end(existing), std::begin(it->second), std::end(it->second));
+    }
+
+    std::unordered_set<StreamId> resolved_from_versions;
+    auto merged = merge_existing_with_journal_keys(version_map, store, affected_keys, std::move(existing), &resolved_from_versions);
+
+    for(const auto& stream_id : affected) {
+        cache.symbols_.erase(stream_id);
+        cache.resolved_from_versions_.erase(stream_id);
+    }
+    add_merged_symbols(cache.symbols_, std::move(merged));
+    cache.resolved_from_versions_.insert(std::begin(resolved_from_versions), std::end(resolved_from_versions));
+    cache.applied_journal_keys_.insert(std::begin(new_keys), std::end(new_keys));
+}
+
+CollectionType load_from_symbol_list_keys_with_cache(
+        const std::shared_ptr<VersionMap>& version_map,
+        const std::shared_ptr<Store>& store,
+        const std::vector<AtomKey>& keys,
+        const Compaction& compaction,
+        SymbolListData& data) {
+    const auto min_interval = min_allowed_interval();
+    std::lock_guard lock(data.cache_mutex_);
+    if(is_cache_valid(data.cache_, keys, *compaction, min_interval)) {
+        apply_new_journal_keys(version_map, store, keys, *data.cache_);
+    } else {
+        data.cache_.reset();
+        data.cache_ = create_cache(version_map, store, keys, compaction, min_interval);
+    }
+
+    CollectionType symbols;
+    symbols.reserve(data.cache_->symbols_.size());
+    for(const auto& [_, entries] : data.cache_->symbols_)
+        symbols.insert(std::end(symbols), std::begin(entries), std::end(entries));
+
+    return symbols;
+}
+
+bool symbol_list_cache_enabled() {
+    return ConfigsMap::instance()->get_int("SymbolList.CacheLoadedState", 1) != 0;
+}
+
 CollectionType load_from_version_keys(
         const std::shared_ptr<VersionMap>& version_map,
         const std::shared_ptr<Store>& store,
@@ -492,9 +615,12 @@ LoadResult attempt_load(
     load_result.symbol_list_keys_ = get_all_symbol_list_keys(store, data);
     load_result.maybe_previous_compaction = last_compaction(load_result.symbol_list_keys_);
 
-    if (load_result.maybe_previous_compaction)
-        load_result.symbols_ = load_from_symbol_list_keys(version_map, store, load_result.symbol_list_keys_, *load_result.maybe_previous_compaction);
-    else {
+    if (load_result.maybe_previous_compaction) {
+        if (symbol_list_cache_enabled())
+            load_result.symbols_ = load_from_symbol_list_keys_with_cache(version_map, store, load_result.symbol_list_keys_, *load_result.maybe_previous_compaction, data);
+        else
+            load_result.symbols_ = load_from_symbol_list_keys(version_map, store, load_result.symbol_list_keys_, *load_result.maybe_previous_compaction);
+    } else {
         load_result.symbols_ = load_from_version_keys(version_map, store, load_result.symbol_list_keys_, data);
         std::unordered_set<StreamId> keys_in_versions;
         for (const auto &entry : load_result.symbols_)
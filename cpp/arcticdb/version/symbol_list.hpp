@@ -15,11 +15,15 @@
 
 #include <folly/futures/Future.h>
 
+#include <mutex>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace arcticdb {
 
 struct LoadResult;
+struct SymbolListCache;
 class Store;
 
 struct SymbolListData {
@@ -27,6 +31,8 @@ struct SymbolListData {
     uint32_t seed_;
     std::shared_ptr<VersionMap> version_map_;
     std::atomic<bool> warned_expected_slowdown_ = false;
+    std::mutex cache_mutex_;
+    std::unique_ptr<SymbolListCache> cache_;
 
     explicit SymbolListData(std::shared_ptr<VersionMap> version_map, StreamId type_indicator = StringId(),
                             uint32_t seed = 0);
@@ -94,6 +100,29 @@ struct SymbolListEntry : public SymbolEntryData {
     }
 };
 
+/*
+ * The state of the symbol list as of the last load, kept in-process so that subsequent loads against the same
+ * compaction key do not need to read it again, and only need to merge the journal keys written since then.
+ *
+ * Each symbol's state only depends on its entries in the compacted list and its own journal keys, so when new journal
+ * keys appear only the symbols they refer to are merged again. Symbols whose journal entries were problematic were
+ * resolved against their version state rather than the symbol list, which can change without new journal keys, so they
+ * are merged again on every load.
+ */
+struct SymbolListCache {
+    AtomKey compaction_key_;
+    timestamp min_allowed_interval_;
+    std::unordered_map<StreamId, std::vector<SymbolListEntry>> compacted_;
+    std::unordered_set<AtomKey> applied_journal_keys_;
+    std::unordered_map<StreamId, std::vector<SymbolListEntry>> symbols_;
+    std::unordered_set<StreamId> resolved_from_versions_;
+
+    SymbolListCache(AtomKey compaction_key, timestamp min_allowed_interval) :
+        compaction_key_(std::move(compaction_key)),
+        min_allowed_interval_(min_allowed_interval) {
+    }
+};
+
 struct ProblematicResult {
     std::optional<SymbolEntryData> problem_;
     bool contains_unknown_reference_ids_ = false;
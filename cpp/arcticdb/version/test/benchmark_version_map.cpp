@@ -0,0 +1,66 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <arcticdb/storage/test/in_memory_store.hpp>
+#include <arcticdb/version/version_functions.hpp>
+#include <arcticdb/version/version_map.hpp>
+
+using namespace arcticdb;
+
+// run like: --benchmark_time_unit=us --benchmark_filter=.* --benchmark_min_time=5x
+
+namespace {
+
+// A version map with the latest version of every symbol cached, and a reload interval long enough that lookups never
+// go back to the store
+struct CachedVersionMap {
+    std::shared_ptr<InMemoryStore> store_ = std::make_shared<InMemoryStore>();
+    std::shared_ptr<VersionMap> version_map_ = std::make_shared<VersionMap>();
+    std::vector<StreamId> symbols_;
+
+    explicit CachedVersionMap(size_t num_symbols) {
+        version_map_->set_reload_interval(std::numeric_limits<timestamp>::max());
+        for (size_t idx = 0; idx < num_symbols; ++idx) {
+            const StreamId symbol{fmt::format("symbol_{}", idx)};
+            auto key = atom_key_builder().version_id(0).creation_ts(idx).content_hash(idx).start_index(0).end_index(1)
+                    .build(symbol, KeyType::TABLE_INDEX);
+            version_map_->write_version(store_, key, std::nullopt);
+            get_latest_version(store_, version_map_, symbol);
+            symbols_.emplace_back(symbol);
+        }
+    }
+};
+
+const CachedVersionMap& cached_version_map() {
+    static const CachedVersionMap instance(10'000);
+    return instance;
+}
+
+} // namespace
+
+static void BM_concurrent_get_latest_version(benchmark::State& state) {
+    const auto& cached = cached_version_map();
+    const auto num_symbols = cached.symbols_.size();
+    // Each thread walks the symbols from a different starting point with a stride coprime to the symbol count
+    auto idx = static_cast<size_t>(state.thread_index()) * num_symbols / static_cast<size_t>(state.threads());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(get_latest_version(cached.store_, cached.version_map_, cached.symbols_[idx]));
+        idx = (idx + 7919) % num_symbols;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_concurrent_get_latest_version)
+        ->Threads(1)
+        ->Threads(2)
+        ->Threads(4)
+        ->Threads(8)
+        ->Threads(16)
+        ->Threads(32)
+        ->UseRealTime();
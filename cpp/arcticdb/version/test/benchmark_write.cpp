@@ -1,4 +1,6 @@
 #include <random>
+#include <span>
+#include <thread>
 
 #include <benchmark/benchmark.h>
 
@@ -80,3 +82,69 @@ struct LMDBStore {
 // BENCHMARK_CAPTURE(BM_write_lmdb, mock_no_clone, false, true)->Arg(100'000)->Arg(1'000'000);
 // BENCHMARK_CAPTURE(BM_write_lmdb, real_with_clone, true, false)->Arg(100'000)->Arg(1'000'000);
 // BENCHMARK_CAPTURE(BM_write_lmdb, real_no_clone, false, false)->Arg(100'000)->Arg(1'000'000);
+
+enum class MultiKeyWrite {
+    PER_KEY,
+    BATCH,
+    CONCURRENT
+};
+
+// Writes state.range(0) small data keys per iteration, either one transaction per key from a single thread, as a single
+// write_batch transaction, or from several threads at once so that concurrent writes are group committed
+[[maybe_unused]] static void BM_write_lmdb_keys(benchmark::State& state, MultiKeyWrite mode, bool use_mock) {
+    const auto num_keys = state.range(0);
+    constexpr auto num_threads = 8;
+
+    auto segment_in_memory = get_test_timeseries_frame("symbol", 100, 0).segment_;
+    auto codec_opts = proto::encoding::VariantCodec();
+    auto segment = encode_dispatch(std::move(segment_in_memory), codec_opts, arcticdb::EncodingVersion::V2);
+
+    auto lmdb = LMDBStore(use_mock);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<storage::KeySegmentPair> kvs;
+        kvs.reserve(num_keys);
+        for (auto i = 0; i < num_keys; ++i) {
+            auto key = atom_key_builder().gen_id(i).build<KeyType::TABLE_DATA>(StreamId{"symbol"});
+            kvs.emplace_back(std::move(key), segment.clone());
+        }
+        state.ResumeTiming();
+        switch (mode) {
+        case MultiKeyWrite::PER_KEY:
+            for (auto& kv : kvs)
+                lmdb.storage->write(kv);
+            break;
+        case MultiKeyWrite::BATCH:
+            lmdb.storage->write_batch(std::span(kvs));
+            break;
+        case MultiKeyWrite::CONCURRENT: {
+            std::vector<std::thread> threads;
+            for (auto t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t]() {
+                    for (auto i = t; i < num_keys; i += num_threads)
+                        lmdb.storage->write(kvs[i]);
+                });
+            }
+            for (auto& thread : threads)
+                thread.join();
+            break;
+        }
+        }
+        state.PauseTiming();
+        for (auto& kv : kvs)
+            lmdb.storage->remove(VariantKey{kv.variant_key()}, storage::RemoveOpts{});
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * num_keys);
+}
+
+BENCHMARK_CAPTURE(BM_write_lmdb_keys, mock_per_key, MultiKeyWrite::PER_KEY, true)->Arg(1'000);
+BENCHMARK_CAPTURE(BM_write_lmdb_keys, mock_batch, MultiKeyWrite::BATCH, true)->Arg(1'000);
+BENCHMARK_CAPTURE(BM_write_lmdb_keys, mock_concurrent, MultiKeyWrite::CONCURRENT, true)->Arg(1'000);
+// The mock storage has no per-transaction cost, so only the real one shows what batching the writes saves
+// TODO: Re-enable real lmdb benchmarks on Windows once running on Windows CI is fixed
+#ifndef _WIN32
+BENCHMARK_CAPTURE(BM_write_lmdb_keys, real_per_key, MultiKeyWrite::PER_KEY, false)->Arg(1'000);
+BENCHMARK_CAPTURE(BM_write_lmdb_keys, real_batch, MultiKeyWrite::BATCH, false)->Arg(1'000);
+BENCHMARK_CAPTURE(BM_write_lmdb_keys, real_concurrent, MultiKeyWrite::CONCURRENT, false)->Arg(1'000);
+#endif
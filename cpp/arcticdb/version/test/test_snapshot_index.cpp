@@ -0,0 +1,138 @@
+/* Copyright 2025 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/version/snapshot_index.hpp>
+#include <arcticdb/storage/test/in_memory_store.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+AtomKey index_key(const StreamId& id, VersionId version_id) {
+    return atom_key_builder().version_id(version_id).creation_ts(version_id).content_hash(version_id)
+        .start_index(0).end_index(1).build(id, KeyType::TABLE_INDEX);
+}
+
+void write_snapshot(const std::shared_ptr<InMemoryStore>& store, const SnapshotId& snapshot_id, std::vector<AtomKey> keys) {
+    write_snapshot_entry(store, keys, snapshot_id, py::none(), false);
+}
+
+// As a client from before snapshot generations were recorded does
+void write_snapshot_keeping_generation(const std::shared_ptr<InMemoryStore>& store, const SnapshotId& snapshot_id, std::vector<AtomKey> keys) {
+    const RefKey generation_key{StreamId{std::string{SnapshotGenerationId}}, KeyType::SNAPSHOT_GENERATION};
+    auto generation_segment = store->read_sync(generation_key).second;
+    write_snapshot(store, snapshot_id, std::move(keys));
+    store->write_sync(KeyType::SNAPSHOT_GENERATION, generation_key.id(), std::move(generation_segment));
+}
+
+} // namespace
+
+TEST(SnapshotIndex, TracksSnapshotsInStorage) {
+    auto store = std::make_shared<InMemoryStore>();
+    write_snapshot(store, "snap_1", {index_key("sym", 0), index_key("other", 0)});
+    write_snapshot(store, "snap_2", {index_key("sym", 1)});
+
+    SnapshotIndex snapshot_index;
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ),
+              std::unordered_set<AtomKey>({index_key("sym", 0), index_key("sym", 1)}));
+
+    // Snapshots written and deleted by another client are found by listing
+    write_snapshot(store, "snap_3", {index_key("sym", 2)});
+    store->remove_key_sync(RefKey{"snap_1", KeyType::SNAPSHOT_REF}, storage::RemoveOpts{});
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ),
+              std::unordered_set<AtomKey>({index_key("sym", 1), index_key("sym", 2)}));
+    ASSERT_TRUE(snapshot_index.index_keys_in_snapshots(store, "other", SnapshotLookup::READ).empty());
+
+    auto [not_in_snaps, in_snaps] = snapshot_index.index_keys_partitioned_by_inclusion_in_snapshots(
+        store, "sym", {index_key("sym", 0), index_key("sym", 1), index_key("sym", 3)});
+    ASSERT_EQ(not_in_snaps, std::vector<AtomKey>({index_key("sym", 0), index_key("sym", 3)}));
+    ASSERT_EQ(in_snaps, std::unordered_set<AtomKey>({index_key("sym", 1), index_key("sym", 2)}));
+
+    const auto master_map = snapshot_index.master_snapshots_map(store);
+    ASSERT_EQ(master_map.at("sym").at(index_key("sym", 1)), std::unordered_set<SnapshotId>({"snap_2"}));
+}
+
+TEST(SnapshotIndex, RewrittenSnapshots) {
+    auto store = std::make_shared<InMemoryStore>();
+    write_snapshot(store, "snap", {index_key("sym", 0)});
+    SnapshotIndex snapshot_index;
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ),
+              std::unordered_set<AtomKey>({index_key("sym", 0)}));
+
+    // Another client rewriting the snapshot under the same name cannot be seen by listing, so reads may miss it until
+    // the index is reloaded, and only deletes check the snapshot generation
+    write_snapshot(store, "snap", {index_key("sym", 1)});
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ),
+              std::unordered_set<AtomKey>({index_key("sym", 0)}));
+
+    // Whereas deletes see the snapshot as it is in storage
+    auto [not_in_snaps, in_snaps] = snapshot_index.index_keys_partitioned_by_inclusion_in_snapshots(
+        store, "sym", {index_key("sym", 0), index_key("sym", 1)});
+    ASSERT_EQ(not_in_snaps, std::vector<AtomKey>({index_key("sym", 0)}));
+    ASSERT_EQ(in_snaps, std::unordered_set<AtomKey>({index_key("sym", 1)}));
+
+    write_snapshot(store, "snap", {index_key("sym", 2)});
+    const auto master_map = snapshot_index.master_snapshots_map(store);
+    ASSERT_EQ(master_map.at("sym").size(), 1u);
+    ASSERT_EQ(master_map.at("sym").at(index_key("sym", 2)), std::unordered_set<SnapshotId>({"snap"}));
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ),
+              std::unordered_set<AtomKey>({index_key("sym", 2)}));
+}
+
+TEST(SnapshotIndex, LocalChanges) {
+    // Snapshots rewritten without changing the generation are only seen without reloading the index when they are
+    // modified through the owning version store, which also shows unchanged snapshots are not read again
+    auto store = std::make_shared<InMemoryStore>();
+    write_snapshot(store, "snap", {index_key("sym", 0)});
+    SnapshotIndex snapshot_index;
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::WRITE),
+              std::unordered_set<AtomKey>({index_key("sym", 0)}));
+
+    write_snapshot_keeping_generation(store, "snap", {index_key("sym", 1)});
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::WRITE),
+              std::unordered_set<AtomKey>({index_key("sym", 0)}));
+    snapshot_index.add_snapshot("snap", {index_key("sym", 1)});
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::WRITE),
+              std::unordered_set<AtomKey>({index_key("sym", 1)}));
+
+    snapshot_index.remove_snapshot("snap");
+    store->remove_key_sync(RefKey{"snap", KeyType::SNAPSHOT_REF}, storage::RemoveOpts{});
+    ASSERT_TRUE(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::WRITE).empty());
+    ASSERT_TRUE(snapshot_index.master_snapshots_map(store).empty());
+}
+
+TEST(SnapshotIndex, Rebuild) {
+    auto store = std::make_shared<InMemoryStore>();
+    write_snapshot(store, "snap", {index_key("sym", 0)});
+    SnapshotIndex snapshot_index;
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ), std::unordered_set<AtomKey>({index_key("sym", 0)}));
+
+    write_snapshot(store, "snap", {index_key("sym", 1)});
+    snapshot_index.invalidate();
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ), std::unordered_set<AtomKey>({index_key("sym", 1)}));
+
+    ScopedConfig reload_interval("SnapshotIndex.ReloadInterval", 0);
+    write_snapshot(store, "snap", {index_key("sym", 2)});
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::READ), std::unordered_set<AtomKey>({index_key("sym", 2)}));
+}
+
+TEST(SnapshotIndex, WriteReloadInterval) {
+    auto store = std::make_shared<InMemoryStore>();
+    write_snapshot(store, "snap", {index_key("sym", 0)});
+    SnapshotIndex snapshot_index;
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::WRITE),
+              std::unordered_set<AtomKey>({index_key("sym", 0)}));
+
+    // Libraries shared with clients that do not record generations can have deletes read every snapshot instead
+    ScopedConfig write_reload_interval("SnapshotIndex.WriteReloadInterval", 0);
+    write_snapshot_keeping_generation(store, "snap", {index_key("sym", 1)});
+    ASSERT_EQ(snapshot_index.index_keys_in_snapshots(store, "sym", SnapshotLookup::WRITE),
+              std::unordered_set<AtomKey>({index_key("sym", 1)}));
+}
@@ -183,6 +183,50 @@ TEST_F(SymbolListSuite, MultipleWrites) {
     ASSERT_THAT(symbols, UnorderedElementsAre(symbol_1, symbol_2, symbol_3));
 }
 
+TEST_F(SymbolListSuite, CachedLoadOnlyMergesNewJournalKeys) {
+    // Otherwise the quick add and remove of symbol_1 would be resolved against the version keys
+    ScopedConfig min_interval("SymbolList.MinIntervalNs", 0);
+    write_initial_compaction_key();
+    SymbolList::add_symbol(store_, symbol_1, 0);
+    SymbolList::add_symbol(store_, symbol_2, 0);
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), ElementsAre(symbol_1, symbol_2));
+
+    // Every read now fails, so subsequent loads can only succeed from the cached compacted state
+    StorageFailureSimulator::instance()->configure({{FailureType::READ, {fault()}}});
+    SymbolList::add_symbol(store_, symbol_3, 0);
+    SymbolList::remove_symbol(store_, symbol_1, 1);
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), ElementsAre(symbol_2, symbol_3));
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), ElementsAre(symbol_2, symbol_3));
+    StorageFailureSimulator::reset();
+
+    // A different instance, or one with the cache disabled, sees the same symbols
+    SymbolList another_instance{version_map_};
+    ASSERT_THAT(another_instance.get_symbols(store_, true), ElementsAre(symbol_2, symbol_3));
+    ScopedConfig disable_cache("SymbolList.CacheLoadedState", 0);
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), ElementsAre(symbol_2, symbol_3));
+}
+
+TEST_F(SymbolListSuite, CachedLoadInvalidatedByChangedKeys) {
+    write_initial_compaction_key();
+    SymbolList::add_symbol(store_, symbol_1, 0);
+    SymbolList::add_symbol(store_, symbol_2, 0);
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), ElementsAre(symbol_1, symbol_2));
+
+    // Journal keys removed without a new compaction
+    auto keys = get_symbol_list_keys(std::get<StringId>(action_id(ActionType::ADD)));
+    ASSERT_THAT(keys, SizeIs(2));
+    store_->remove_key_sync(keys[0], {});
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), SizeIs(1));
+
+    // A new compaction from another instance
+    SymbolList::add_symbol(store_, symbol_3, 0);
+    SymbolList another_instance{version_map_};
+    another_instance.compact(store_);
+    ASSERT_THAT(get_symbol_list_keys(), SizeIs(1));
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), SizeIs(2));
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), Contains(symbol_3));
+}
+
 enum class CompactOutcome : uint8_t {
     NOT_WRITTEN = 0, WRITTEN, NOT_CLEANED_UP, UNKNOWN
 };
@@ -8,6 +8,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <thread>
+
 #include <arcticdb/version/version_map.hpp>
 #include <arcticdb/version/version_functions.hpp>
 #include <arcticdb/util/configs_map.hpp>
@@ -1144,6 +1146,46 @@ TEST(VersionMap, TombstoneAllFromEntry) {
     ASSERT_EQ(version_id, 2);
 }
 
+TEST(VersionMap, ConcurrentLookupsAcrossShards) {
+    using namespace arcticdb;
+    auto store = std::make_shared<InMemoryStore>();
+    auto version_map = std::make_shared<VersionMap>();
+    version_map->set_reload_interval(std::numeric_limits<timestamp>::max());
+    constexpr auto num_symbols = 200;
+    constexpr auto num_threads = 8;
+    for (auto idx = 0; idx < num_symbols; ++idx) {
+        const StreamId id{fmt::format("symbol_{}", idx)};
+        version_map->write_version(store, atom_key_with_version(id, idx, idx), std::nullopt);
+    }
+
+    // Readers of the existing symbols run alongside writers adding entries for new symbols to the same shards
+    std::vector<std::thread> threads;
+    std::atomic<size_t> failures{0};
+    for (auto thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        threads.emplace_back([&, thread_idx]() {
+            for (auto idx = 0; idx < num_symbols; ++idx) {
+                const StreamId id{fmt::format("symbol_{}", (idx + thread_idx * 17) % num_symbols)};
+                auto [latest, deleted] = get_latest_version(store, version_map, id);
+                if (!latest.has_value() || latest->id() != id || deleted)
+                    ++failures;
+
+                const StreamId new_id{fmt::format("new_symbol_{}_{}", thread_idx, idx)};
+                version_map->write_version(store, atom_key_with_version(new_id, 0, 0), std::nullopt);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(failures, 0);
+    const LoadStrategy load_strategy{LoadType::LATEST, LoadObjective::INCLUDE_DELETED};
+    for (auto thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        ASSERT_TRUE(version_map->has_cached_entry(StreamId{fmt::format("new_symbol_{}_0", thread_idx)}, load_strategy));
+    }
+    version_map->flush();
+    ASSERT_FALSE(version_map->has_cached_entry(StreamId{"symbol_0"}, load_strategy));
+}
+
 #define GTEST_COUT std::cerr << "[          ] [ INFO ]"
 
 TEST_F(VersionMapStore, StressTestWrite) {
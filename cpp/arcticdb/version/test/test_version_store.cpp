@@ -15,7 +15,9 @@
 #include <arcticdb/util/allocator.hpp>
 #include <arcticdb/version/version_functions.hpp>
 #include <arcticdb/version/local_versioned_engine.hpp>
+#include <arcticdb/pipeline/index_pages.hpp>
 #include <arcticdb/util/native_handler.hpp>
+#include <arcticdb/arrow/arrow_handlers.hpp>
 
 #include <chrono>
 #include <thread>
@@ -997,4 +999,293 @@ TEST(VersionStore, TestWriteAppendMapHead) {
     auto [next_key, total_rows] = read_head(version_store._test_get_store(), symbol);
     ASSERT_EQ(next_key, key);
     ASSERT_EQ(total_rows, num_rows);
-}
\ No newline at end of file
+}
+TEST(VersionStore, ReadWithParallelColumnDecode) {
+    using namespace arcticdb;
+    using namespace arcticdb::storage;
+    using namespace arcticdb::stream;
+    using namespace arcticdb::pipelines;
+
+    // Decode every column of the segment in its own group, up to the number of CPU threads
+    ScopedConfig group_bytes("Decode.ColumnGroupBytes", 1);
+
+    const StreamId symbol("wide");
+    auto version_store = get_test_engine();
+    constexpr size_t num_rows{100};
+    constexpr size_t num_columns{50};
+    constexpr size_t start_val{3};
+
+    std::vector<std::string> names;
+    for (size_t i = 0; i < num_columns; ++i)
+        names.emplace_back(fmt::format("col_{}", i));
+
+    std::vector<FieldRef> fields;
+    for (size_t i = 0; i < num_columns; ++i)
+        fields.emplace_back(scalar_field(i % 2 == 0 ? DataType::UINT32 : DataType::UINT16, names[i]));
+
+    auto test_frame = get_test_frame<TimeseriesIndex>(symbol, fields, num_rows, start_val);
+    version_store.write_versioned_dataframe_internal(symbol, std::move(test_frame.frame_), false, false, false);
+
+    register_native_handler_data_factory();
+    for (const bool dynamic_schema : {false, true}) {
+        auto read_query = std::make_shared<ReadQuery>();
+        ReadOptions read_options;
+        read_options.set_dynamic_schema(dynamic_schema);
+        auto handler_data = TypeHandlerRegistry::instance()->get_handler_data(OutputFormat::NATIVE);
+        auto read_result = version_store.read_dataframe_version_internal(symbol, VersionQuery{}, read_query, read_options, handler_data);
+        const auto& seg = read_result.frame_and_descriptor_.frame_;
+        ASSERT_EQ(seg.row_count(), num_rows);
+        ASSERT_EQ(seg.descriptor().field_count(), num_columns + 1);
+
+        for (size_t col = 0; col < num_columns; ++col) {
+            const auto pos = static_cast<position_t>(col + 1);
+            for (size_t row = 0; row < num_rows; ++row) {
+                if (col % 2 == 0)
+                    ASSERT_EQ(seg.scalar_at<uint32_t>(row, pos).value(), get_integral_value_for_offset<uint32_t>(start_val, row));
+                else
+                    ASSERT_EQ(seg.scalar_at<uint16_t>(row, pos).value(), get_integral_value_for_offset<uint16_t>(start_val, row));
+            }
+        }
+    }
+}
+
+TEST(VersionStore, ReadBatchesPrefetch) {
+    using namespace arcticdb;
+    using namespace arcticdb::storage;
+    using namespace arcticdb::stream;
+    using namespace arcticdb::pipelines;
+
+    const StreamId symbol("batches");
+    arcticdb::proto::storage::VersionStoreConfig cfg;
+    cfg.mutable_write_options()->set_segment_row_size(10);
+    auto version_store = get_test_engine(cfg);
+    constexpr size_t num_rows{100};
+    constexpr size_t num_batches{num_rows / 10};
+
+    const std::array fields{scalar_field(DataType::UINT32, "thing1")};
+    auto test_frame = get_test_frame<TimeseriesIndex>(symbol, fields, num_rows, 0);
+    version_store.write_versioned_dataframe_internal(symbol, std::move(test_frame.frame_), false, false, false);
+
+    register_arrow_handler_data_factory();
+    ReadOptions read_options;
+    read_options.set_output_format(OutputFormat::ARROW);
+    for (const size_t prefetch : {0, 1, 3}) {
+        auto batches = version_store.read_dataframe_batches_internal(
+            symbol,
+            VersionQuery{},
+            std::make_shared<ReadQuery>(),
+            read_options,
+            TypeHandlerRegistry::instance()->get_handler_data(OutputFormat::ARROW),
+            1,
+            prefetch);
+        ASSERT_EQ(batches->num_batches(), num_batches);
+        ASSERT_EQ(batches->num_reads_in_flight(), 0u);
+
+        size_t rows{0};
+        for (size_t batch = 0; batch < num_batches; ++batch) {
+            auto output = batches->next();
+            ASSERT_TRUE(output.has_value());
+            rows += output->frame_and_descriptor_.frame_.row_count();
+            ASSERT_EQ(batches->num_reads_in_flight(), std::min(prefetch, num_batches - batch - 1));
+        }
+        ASSERT_FALSE(batches->next().has_value());
+        ASSERT_EQ(rows, num_rows);
+    }
+}
+
+TEST(VersionStore, PagedIndex) {
+    using namespace arcticdb;
+    using namespace arcticdb::storage;
+    using namespace arcticdb::stream;
+    using namespace arcticdb::pipelines;
+
+    ScopedConfig reload_interval("VersionMap.ReloadInterval", 0);
+    ScopedConfig page_rows("VersionStore.IndexPageRows", 3);
+
+    const StreamId symbol("paged");
+    arcticdb::proto::storage::VersionStoreConfig cfg;
+    cfg.mutable_write_options()->set_segment_row_size(10);
+    auto version_store = get_test_engine<version_store::PythonVersionStore>(cfg);
+    auto store = version_store._test_get_store();
+    constexpr size_t num_rows{100};
+
+    const std::array fields{scalar_field(DataType::UINT32, "thing1")};
+    auto write_version = [&](size_t start_val, bool prune_previous) {
+        auto test_frame = get_test_frame<TimeseriesIndex>(symbol, fields, num_rows, start_val);
+        return version_store.write_versioned_dataframe_internal(symbol, std::move(test_frame.frame_), prune_previous, false, false);
+    };
+    // The data keys read from the index of a version, which would be its pages if they were not expanded
+    auto data_keys = [&](const VersionedItem& version) {
+        const auto index = read_index_impl(store, version).frame_;
+        std::vector<AtomKey> keys;
+        for (size_t row = 0; row < index.row_count(); ++row)
+            keys.emplace_back(read_key_row(index, static_cast<ssize_t>(row)));
+        return keys;
+    };
+    auto page_keys = [&](const VersionedItem& version) {
+        const auto top_level = store->read_sync(version.key_).second;
+        std::vector<AtomKey> keys;
+        for (size_t row = 0; row < top_level.row_count(); ++row)
+            keys.emplace_back(read_key_row(top_level, static_cast<ssize_t>(row)));
+        return keys;
+    };
+    auto all_exist = [&](const std::vector<AtomKey>& keys) {
+        return std::ranges::all_of(keys, [&](const AtomKey& key) { return store->key_exists_sync(key); });
+    };
+    auto none_exist = [&](const std::vector<AtomKey>& keys) {
+        return std::ranges::none_of(keys, [&](const AtomKey& key) { return store->key_exists_sync(key); });
+    };
+
+    const auto v0 = write_version(0, false);
+    const auto v1 = write_version(num_rows, false);
+    const auto v0_data_keys = data_keys(v0);
+    const auto v0_page_keys = page_keys(v0);
+    const auto v1_data_keys = data_keys(v1);
+    const auto v1_page_keys = page_keys(v1);
+    ASSERT_EQ(v0_data_keys.size(), num_rows / 10);
+    ASSERT_EQ(v0_page_keys.size(), 4u);
+    ASSERT_TRUE(std::ranges::all_of(v0_data_keys, [](const AtomKey& key) { return key.type() == KeyType::TABLE_DATA; }));
+    ASSERT_TRUE(std::ranges::all_of(v0_page_keys, [](const AtomKey& key) { return key.type() == KeyType::TABLE_INDEX; }));
+    ASSERT_EQ(version_store.list_versions(symbol, std::nullopt, std::nullopt, std::nullopt).size(), 2u);
+
+    // The snapshot keeps the data and pages of v0 after it is deleted, until the snapshot is deleted too
+    std::map<StreamId, VersionId> versions{{symbol, v0.version()}};
+    version_store.snapshot("snap", py::none(), {}, versions, false);
+    version_store.delete_version(symbol, v0.version());
+    ASSERT_EQ(version_store.list_versions(symbol, std::nullopt, std::nullopt, std::nullopt).size(), 2u);
+    ASSERT_TRUE(all_exist(v0_data_keys));
+    ASSERT_TRUE(all_exist(v0_page_keys));
+
+    version_store.delete_snapshot("snap");
+    ASSERT_EQ(version_store.list_versions(symbol, std::nullopt, std::nullopt, std::nullopt).size(), 1u);
+    ASSERT_TRUE(none_exist(v0_data_keys));
+    ASSERT_TRUE(none_exist(v0_page_keys));
+    ASSERT_TRUE(all_exist(v1_data_keys));
+    ASSERT_TRUE(all_exist(v1_page_keys));
+
+    // Pruning removes the data and pages of the previous version
+    const auto v2 = write_version(2 * num_rows, true);
+    ASSERT_EQ(data_keys(v2).size(), num_rows / 10);
+    ASSERT_TRUE(none_exist(v1_data_keys));
+    ASSERT_TRUE(none_exist(v1_page_keys));
+}
+
+TEST(VersionStore, PagedIndexUpdateMetadata) {
+    using namespace arcticdb;
+    using namespace arcticdb::storage;
+    using namespace arcticdb::stream;
+    using namespace arcticdb::pipelines;
+
+    ScopedConfig reload_interval("VersionMap.ReloadInterval", 0);
+    ScopedConfig page_rows("VersionStore.IndexPageRows", 3);
+
+    const StreamId symbol("paged");
+    arcticdb::proto::storage::VersionStoreConfig cfg;
+    cfg.mutable_write_options()->set_segment_row_size(10);
+    auto version_store = get_test_engine<version_store::PythonVersionStore>(cfg);
+    auto store = version_store._test_get_store();
+    constexpr size_t num_rows{100};
+
+    const std::array fields{scalar_field(DataType::UINT32, "thing1")};
+    auto test_frame = get_test_frame<TimeseriesIndex>(symbol, fields, num_rows, 0);
+    const auto v0 = version_store.write_versioned_dataframe_internal(symbol, std::move(test_frame.frame_), false, false, false);
+    const auto v0_index = read_index_impl(store, v0).frame_;
+    const auto v0_top_level = store->read_sync(v0.key_).second;
+    ASSERT_TRUE(index::is_paged_index(v0_top_level));
+
+    // Only the top-level segment is rewritten, referring to the pages of v0 alongside the new metadata
+    arcticdb::proto::descriptors::UserDefinedMetadata user_meta;
+    user_meta.set_inline_payload("updated");
+    const auto v1 = version_store.write_versioned_metadata_internal(symbol, true, std::move(user_meta));
+    const auto v1_top_level = store->read_sync(v1.key_).second;
+    ASSERT_TRUE(index::is_paged_index(v1_top_level));
+    ASSERT_EQ(v1_top_level.row_count(), v0_top_level.row_count());
+    for (size_t row = 0; row < v1_top_level.row_count(); ++row)
+        ASSERT_EQ(read_key_row(v1_top_level, static_cast<ssize_t>(row)), read_key_row(v0_top_level, static_cast<ssize_t>(row)));
+
+    const auto descriptor = version_store.read_descriptor_internal(symbol, VersionQuery{});
+    ASSERT_EQ(descriptor.key_.version_id(), v1.version());
+    ASSERT_EQ(descriptor.timeseries_descriptor_->user_metadata().inline_payload(), "updated");
+
+    // Pruning v0 keeps its pages and data keys, as v1 references them
+    const auto v1_index = read_index_impl(store, v1).frame_;
+    ASSERT_EQ(v1_index.row_count(), num_rows / 10);
+    ASSERT_EQ(v1_index.row_count(), v0_index.row_count());
+    ASSERT_FALSE(store->key_exists_sync(v0.key_));
+    for (size_t row = 0; row < v1_index.row_count(); ++row) {
+        ASSERT_EQ(read_key_row(v1_index, static_cast<ssize_t>(row)), read_key_row(v0_index, static_cast<ssize_t>(row)));
+        ASSERT_TRUE(store->key_exists_sync(read_key_row(v1_index, static_cast<ssize_t>(row))));
+    }
+}
+
+TEST(VersionStore, ZstdDictionary) {
+    using namespace arcticdb;
+    using namespace arcticdb::storage;
+    using namespace arcticdb::stream;
+    using namespace arcticdb::pipelines;
+
+    ScopedConfig reload_interval("VersionMap.ReloadInterval", 0);
+    arcticdb::proto::storage::VersionStoreConfig cfg;
+    cfg.set_zstd_dictionary(true);
+    auto [path, storages] = get_test_config_data();
+    auto library = std::make_shared<Library>(path, std::move(storages), LibraryDescriptor::VariantStoreConfig{cfg});
+
+    // Opened before any dictionary is trained, so it only knows of them by loading them when reading
+    version_store::PythonVersionStore open_reader(library);
+
+    const std::array fields{scalar_field(DataType::UINT32, "thing1")};
+    constexpr size_t num_rows{20};
+    const StreamId first_symbol{"after_first_training"};
+    const StreamId second_symbol{"after_second_training"};
+    auto first_frame = get_test_frame<TimeseriesIndex>(first_symbol, fields, num_rows, 1000);
+    auto second_frame = get_test_frame<TimeseriesIndex>(second_symbol, fields, num_rows, 2000);
+    uint32_t first_id;
+    uint32_t second_id;
+    {
+        version_store::PythonVersionStore writer(library);
+        // Many small versions of similarly named symbols, whose version, symbol list and data keys it is trained on
+        auto write_symbols = [&](std::string_view prefix) {
+            for (size_t idx = 0; idx < 500; ++idx) {
+                const StreamId symbol{fmt::format("{}_{}", prefix, idx)};
+                auto test_frame = get_test_frame<TimeseriesIndex>(symbol, fields, num_rows, idx);
+                writer.write_versioned_dataframe_internal(symbol, std::move(test_frame.frame_), false, false, false);
+            }
+        };
+        write_symbols("equities_daily_close");
+        first_id = writer.train_zstd_dictionary(4096, 1000);
+        writer.write_versioned_dataframe_internal(first_symbol, first_frame.frame_, false, false, false);
+
+        // Retraining keeps the first dictionary, which the segments written since still need
+        write_symbols("fx_hourly_rate");
+        second_id = writer.train_zstd_dictionary(4096, 1000);
+        ASSERT_NE(first_id, second_id);
+        writer.write_versioned_dataframe_internal(second_symbol, second_frame.frame_, false, false, false);
+    }
+
+    register_native_handler_data_factory();
+    auto check_symbol = [&](version_store::PythonVersionStore& version_store, const StreamId& symbol, const auto& test_frame) {
+        auto handler_data = TypeHandlerRegistry::instance()->get_handler_data(OutputFormat::NATIVE);
+        auto read_result = version_store.read_dataframe_version(symbol, VersionQuery{}, std::make_shared<ReadQuery>(), ReadOptions{}, handler_data);
+        const auto& seg = std::get<PandasOutputFrame>(read_result.frame_data).frame();
+        ASSERT_EQ(seg.row_count(), num_rows);
+        const auto column = seg.column_index("thing1").value();
+        const auto expected_column = test_frame.segment_.column_index("thing1").value();
+        for (size_t row = 0; row < num_rows; ++row)
+            ASSERT_EQ(seg.scalar_at<uint32_t>(row, column), test_frame.segment_.scalar_at<uint32_t>(row, expected_column));
+    };
+    auto forget_dictionaries = [&]() {
+        ZstdDictionaries::instance()->_test_remove(first_id);
+        ZstdDictionaries::instance()->_test_remove(second_id);
+    };
+
+    // A client that had the library open before either dictionary was trained
+    forget_dictionaries();
+    check_symbol(open_reader, first_symbol, first_frame);
+    check_symbol(open_reader, second_symbol, second_frame);
+
+    // A client opening the library afresh, which only loads the current dictionary when opened
+    forget_dictionaries();
+    version_store::PythonVersionStore reader(library);
+    check_symbol(reader, first_symbol, first_frame);
+    check_symbol(reader, second_symbol, second_frame);
+}
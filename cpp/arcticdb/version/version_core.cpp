@@ -24,10 +24,16 @@
 #include <arcticdb/stream/schema.hpp>
 #include <arcticdb/pipeline/index_writer.hpp>
 #include <arcticdb/pipeline/index_utils.hpp>
+#include <arcticdb/pipeline/index_pages.hpp>
+#include <arcticdb/pipeline/string_pool_utils.hpp>
 #include <arcticdb/version/schema_checks.hpp>
 #include <arcticdb/version/version_utils.hpp>
 #include <arcticdb/entity/merge_descriptors.hpp>
 #include <arcticdb/processing/component_manager.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
+#include <arcticdb/util/hyperloglog.hpp>
+#include <arcticdb/util/clock.hpp>
+#include <arcticdb/storage/storage_exceptions.hpp>
 #include <ranges>
 
 namespace arcticdb::version_store {
@@ -657,20 +663,21 @@ std::shared_ptr<std::vector<folly::Future<std::vector<EntityId>>>> schedule_firs
                             (*slice_added)[pos] = true;
                         }
                     }
-                    return async::MemSegmentProcessingTask(*clauses, std::move(entity_ids))();
+                    return async::MemSegmentProcessingTask(*clauses, std::move(entity_ids), component_manager->arena())();
                 }));
     }
     return futures;
 }
 
 folly::Future<std::vector<EntityId>> schedule_remaining_iterations(
+        std::shared_ptr<ComponentManager> component_manager,
         std::vector<std::vector<EntityId>>&& entity_ids_vec,
         std::shared_ptr<std::vector<std::shared_ptr<Clause>>> clauses
         ) {
     auto scheduling_iterations = num_scheduling_iterations(*clauses);
     folly::Future<std::vector<std::vector<EntityId>>> entity_ids_vec_fut(std::move(entity_ids_vec));
     for (auto i = 0UL; i < scheduling_iterations; ++i) {
-        entity_ids_vec_fut = std::move(entity_ids_vec_fut).thenValue([clauses, scheduling_iterations, i] (std::vector<std::vector<EntityId>>&& entity_id_vectors) {
+        entity_ids_vec_fut = std::move(entity_ids_vec_fut).thenValue([component_manager, clauses, scheduling_iterations, i] (std::vector<std::vector<EntityId>>&& entity_id_vectors) {
             ARCTICDB_RUNTIME_DEBUG(log::memory(), "Scheduling iteration {} of {}", i, scheduling_iterations);
 
             util::check(!clauses->empty(), "Scheduling iteration {} has no clauses to process", scheduling_iterations);
@@ -682,7 +689,7 @@ folly::Future<std::vector<EntityId>> schedule_remaining_iterations(
             std::vector<folly::Future<std::vector<EntityId>>> work_futures;
             for(auto& unit_of_work : next_units_of_work) {
                 ARCTICDB_RUNTIME_DEBUG(log::memory(), "Scheduling work for entity ids: {}", unit_of_work);
-                work_futures.emplace_back(async::submit_cpu_task(async::MemSegmentProcessingTask{*clauses, std::move(unit_of_work)}));
+                work_futures.emplace_back(async::submit_cpu_task(async::MemSegmentProcessingTask{*clauses, std::move(unit_of_work), component_manager->arena()}));
             }
 
             return folly::collect(work_futures).via(&async::io_executor());
@@ -722,9 +729,9 @@ folly::Future<std::vector<EntityId>> schedule_clause_processing(
         std::move(entity_id_to_segment_pos),
         clauses);
 
-    return folly::collect(*futures).via(&async::io_executor()).thenValueInline([clauses](auto&& entity_ids_vec) {
+    return folly::collect(*futures).via(&async::io_executor()).thenValueInline([component_manager, clauses](auto&& entity_ids_vec) {
         remove_processed_clauses(*clauses);
-        return schedule_remaining_iterations(std::move(entity_ids_vec), clauses);
+        return schedule_remaining_iterations(component_manager, std::move(entity_ids_vec), clauses);
     });
 }
 
@@ -904,6 +911,246 @@ std::vector<folly::Future<pipelines::SegmentAndSlice>> generate_segment_and_slic
     return add_schema_check(pipeline_context, std::move(segment_and_slice_futures), std::move(incomplete_bitset), processing_config);
 }
 
+// Removes row-slices that cannot contain any rows passing the FilterClauses at the start of the query, based on the
+// MINMAX column stats for this version if they have been created with create_column_stats. Only leading FilterClauses
+// are considered, as any other clause may change the values or meaning of the columns being filtered on.
+void prune_ranges_and_keys_with_column_stats(
+        const std::shared_ptr<Store>& store,
+        const PipelineContext& pipeline_context,
+        const std::vector<std::shared_ptr<Clause>>& clauses,
+        std::vector<RangesAndKey>& ranges_and_keys) {
+    if (!pipeline_context.index_key_.has_value() || ConfigsMap::instance()->get_int("ColumnStats.UseForFiltering", 1) == 0) {
+        return;
+    }
+    std::vector<std::shared_ptr<ExpressionContext>> filters;
+    for (const auto& clause: clauses) {
+        if (folly::poly_type(*clause) != typeid(FilterClause)) {
+            break;
+        }
+        filters.emplace_back(folly::poly_cast<FilterClause>(*clause).expression_context_);
+    }
+    if (std::ranges::none_of(filters, [](const auto& filter) { return filter_can_use_minmax_stats(*filter); })) {
+        return;
+    }
+
+    // Remembering that a version has no column stats saves filtered reads of symbols that never had stats created from
+    // looking for them every time. Stats created by this process are used straight away, as creating them removes the
+    // entry, while stats created by other clients are used once it expires
+    const auto column_stats_key = index_key_to_column_stats_key(*pipeline_context.index_key_);
+    const auto expiry_nanos = ConfigsMap::instance()->get_int("ColumnStats.MissingStatsCacheSeconds", 60) * 1'000'000'000;
+    if (store->missing_keys().contains(column_stats_key, expiry_nanos)) {
+        return;
+    }
+
+    SegmentInMemory column_stats_segment;
+    try {
+        storage::ReadKeyOpts opts;
+        opts.dont_warn_about_missing_key = true;
+        column_stats_segment = store->read_sync(column_stats_key, opts).second;
+    } catch (const storage::KeyNotFoundException& e) {
+        ARCTICDB_DEBUG(log::version(), "No column stats available to filter {}: {}", pipeline_context.stream_id_, e.what());
+        store->missing_keys().insert(column_stats_key);
+        return;
+    } catch (const std::exception& e) {
+        ARCTICDB_DEBUG(log::version(), "Could not read column stats to filter {}: {}", pipeline_context.stream_id_, e.what());
+        return;
+    }
+    auto start_index_column = column_stats_segment.column_index(start_index_column_name);
+    auto end_index_column = column_stats_segment.column_index(end_index_column_name);
+    if (!start_index_column.has_value() || !end_index_column.has_value()) {
+        return;
+    }
+
+    util::BitSet rows_to_keep = column_stats_rows_matching_filter(column_stats_segment, *filters.front());
+    for (auto filter = std::next(filters.begin()); filter != filters.end(); ++filter) {
+        rows_to_keep &= column_stats_rows_matching_filter(column_stats_segment, **filter);
+    }
+
+    // Map from the index range of each row-slice to the row in the column stats segment describing it. If two
+    // row-slices share an index range we cannot tell which stats belong to which, so neither is pruned.
+    std::map<std::pair<timestamp, timestamp>, std::optional<size_t>> index_range_to_stats_row;
+    for (size_t row = 0; row < column_stats_segment.row_count(); ++row) {
+        auto start = column_stats_segment.column(*start_index_column).scalar_at<timestamp>(static_cast<position_t>(row));
+        auto end = column_stats_segment.column(*end_index_column).scalar_at<timestamp>(static_cast<position_t>(row));
+        if (start.has_value() && end.has_value()) {
+            auto [it, inserted] = index_range_to_stats_row.try_emplace(std::make_pair(*start, *end), row);
+            if (!inserted) {
+                it->second = std::nullopt;
+            }
+        }
+    }
+
+    const auto segments_before = ranges_and_keys.size();
+    std::erase_if(ranges_and_keys, [&](const RangesAndKey& ranges_and_key) {
+        const auto& key = ranges_and_key.key_;
+        if (ranges_and_key.is_incomplete() ||
+            !std::holds_alternative<NumericIndex>(key.start_index()) ||
+            !std::holds_alternative<NumericIndex>(key.end_index())) {
+            return false;
+        }
+        auto it = index_range_to_stats_row.find(std::make_pair(std::get<NumericIndex>(key.start_index()), std::get<NumericIndex>(key.end_index())));
+        return it != index_range_to_stats_row.end() && it->second.has_value() && !rows_to_keep[bv_size(*it->second)];
+    });
+    ARCTICDB_DEBUG(log::version(), "Column stats excluded {} of {} segments from read of {}",
+                   segments_before - ranges_and_keys.size(), segments_before, pipeline_context.stream_id_);
+}
+
+// When a query starts with a FilterClause on column-sliced data, returns the column-slices that hold the columns the
+// filter reads, as positions in ranges_and_keys. These are read and the filter evaluated on them before the other
+// column-slices in the same row-slice are fetched, so that row-slices with no matching rows are never read in full.
+// Returns nullopt if every column-slice would be needed to evaluate the filter anyway, or if the column-slices cannot
+// be relied upon to hold the same columns in every row-slice (dynamic schema and incompletes).
+std::optional<util::BitSet> late_materialisation_filter_slices(
+        const PipelineContext& pipeline_context,
+        const std::vector<std::shared_ptr<Clause>>& clauses,
+        const ProcessingConfig& processing_config,
+        const std::vector<RangesAndKey>& ranges_and_keys,
+        const std::vector<std::vector<size_t>>& processing_unit_indexes) {
+    if (clauses.empty() ||
+        folly::poly_type(*clauses.front()) != typeid(FilterClause) ||
+        processing_config.dynamic_schema_ ||
+        ConfigsMap::instance()->get_int("Filter.LateMaterialisation", 1) == 0 ||
+        std::ranges::any_of(ranges_and_keys, [](const RangesAndKey& ranges_and_key) { return ranges_and_key.is_incomplete(); })) {
+        return std::nullopt;
+    }
+    const auto& filter_clause = folly::poly_cast<FilterClause>(*clauses.front());
+    const auto& desc = pipeline_context.descriptor();
+    util::BitSet filter_columns(static_cast<util::BitSetSizeType>(desc.field_count()));
+    for (const auto& column: filter_clause.clause_info_.input_columns_.value_or(std::unordered_set<std::string>{})) {
+        auto pos = desc.find_field(column);
+        if (!pos.has_value()) {
+            // Leave the normal read path to report the missing column
+            return std::nullopt;
+        }
+        // Index columns are present in every column-slice
+        if (*pos >= desc.index().field_count()) {
+            filter_columns.set(*pos);
+        }
+    }
+    if (filter_columns.count() == 0) {
+        return std::nullopt;
+    }
+
+    util::BitSet filter_slices(static_cast<util::BitSetSizeType>(ranges_and_keys.size()));
+    bool any_slice_deferred{false};
+    for (const auto& indexes: processing_unit_indexes) {
+        bool any_filter_slice{false};
+        for (auto idx: indexes) {
+            const auto& col_range = ranges_and_keys[idx].col_range();
+            if (col_range.second > col_range.first && filter_columns.any_range(col_range.first, col_range.second - 1)) {
+                filter_slices.set(idx);
+                any_filter_slice = true;
+            } else {
+                any_slice_deferred = true;
+            }
+        }
+        if (!any_filter_slice) {
+            return std::nullopt;
+        }
+    }
+    return any_slice_deferred ? std::make_optional(std::move(filter_slices)) : std::nullopt;
+}
+
+VariantData evaluate_filter(const FilterClause& filter_clause, const std::vector<pipelines::SegmentAndSlice>& segment_and_slices) {
+    ProcessingUnit proc;
+    std::vector<std::shared_ptr<SegmentInMemory>> segments;
+    segments.reserve(segment_and_slices.size());
+    for (const auto& segment_and_slice: segment_and_slices) {
+        segments.emplace_back(std::make_shared<SegmentInMemory>(segment_and_slice.segment_in_memory_));
+    }
+    proc.set_segments(std::move(segments));
+    proc.set_expression_context(filter_clause.expression_context_);
+    return proc.get(filter_clause.root_node_name_);
+}
+
+bool filter_matches_any_row(const VariantData& filter_result) {
+    return util::variant_match(filter_result,
+                               [](const util::BitSet& bitset) { return bitset.count() > 0; },
+                               [](EmptyResult) { return false; },
+                               [](FullResult) { return true; },
+                               [](const auto&) -> bool { util::raise_rte("Expected bitset from filter clause"); });
+}
+
+using SegmentFuturesAndProcessingUnits = std::pair<std::vector<folly::Future<pipelines::SegmentAndSlice>>, std::vector<std::vector<size_t>>>;
+
+// Late materialisation for reads starting with a FilterClause. The column-slices given by filter_slices are read first
+// and the filter evaluated on each row-slice as soon as its own column-slices arrive. The other column-slices of a
+// row-slice are only read if some of its rows match, and otherwise are replaced by empty segments. The result of each
+// evaluation is handed to the FilterClause through its precomputed results, so that it drops the row-slices with no
+// matching rows and filters the rest without evaluating the filter again. Returns the segment futures and processing
+// unit structure to schedule.
+SegmentFuturesAndProcessingUnits read_filter_slices_first(
+        const std::shared_ptr<Store>& store,
+        const std::shared_ptr<PipelineContext>& pipeline_context,
+        const ProcessingConfig& processing_config,
+        std::vector<RangesAndKey>&& ranges_and_keys,
+        std::vector<std::vector<size_t>>&& processing_unit_indexes,
+        util::BitSet&& filter_slices,
+        std::shared_ptr<Clause> filter_clause) {
+    std::vector<RangesAndKey> filter_ranges;
+    filter_ranges.reserve(filter_slices.count());
+    for (auto en = filter_slices.first(); en < filter_slices.end(); ++en) {
+        filter_ranges.emplace_back(ranges_and_keys[*en]);
+    }
+    auto filter_segment_futures = generate_segment_and_slice_futures(store, pipeline_context, processing_config, std::move(filter_ranges));
+
+    // Processing units from structure_by_row_slice cover ranges_and_keys in order, so the filter slices are met in the
+    // same order as they were read
+    auto filter_segment_future = filter_segment_futures.begin();
+    std::vector<folly::Future<pipelines::SegmentAndSlice>> segment_and_slice_futures;
+    segment_and_slice_futures.reserve(ranges_and_keys.size());
+    std::vector<std::vector<size_t>> output_indexes;
+    output_indexes.reserve(processing_unit_indexes.size());
+    for (const auto& indexes: processing_unit_indexes) {
+        std::vector<folly::Future<pipelines::SegmentAndSlice>> unit_filter_futures;
+        std::vector<RangesAndKey> deferred_ranges;
+        for (auto idx: indexes) {
+            if (filter_slices[idx]) {
+                unit_filter_futures.emplace_back(std::move(*filter_segment_future++));
+            } else {
+                deferred_ranges.emplace_back(std::move(ranges_and_keys[idx]));
+            }
+        }
+        // The segments of the row-slice, those the filter reads followed by the others
+        using RowSliceSegments = std::shared_ptr<std::vector<pipelines::SegmentAndSlice>>;
+        auto row_slice_segments = folly::collect(unit_filter_futures)
+            .via(&async::cpu_executor())
+            .thenValue([store, pipeline_context, processing_config, filter_clause, deferred_ranges = std::move(deferred_ranges)]
+            (std::vector<pipelines::SegmentAndSlice>&& segment_and_slices) mutable -> folly::Future<RowSliceSegments> {
+                const auto& filter = folly::poly_cast<FilterClause>(*filter_clause);
+                auto filter_result = evaluate_filter(filter, segment_and_slices);
+                const bool matches = filter_matches_any_row(filter_result);
+                filter.precomputed_results_->insert(segment_and_slices.front().ranges_and_key_.row_range().first, std::move(filter_result));
+                if (!matches) {
+                    for (auto& ranges_and_key: deferred_ranges) {
+                        segment_and_slices.emplace_back(std::move(ranges_and_key), SegmentInMemory{});
+                    }
+                    return folly::makeFuture(std::make_shared<std::vector<pipelines::SegmentAndSlice>>(std::move(segment_and_slices)));
+                }
+                auto deferred_futures = generate_segment_and_slice_futures(store, pipeline_context, processing_config, std::move(deferred_ranges));
+                return folly::collect(deferred_futures).thenValueInline(
+                    [segment_and_slices = std::move(segment_and_slices)](std::vector<pipelines::SegmentAndSlice>&& deferred) mutable {
+                        std::move(deferred.begin(), deferred.end(), std::back_inserter(segment_and_slices));
+                        return std::make_shared<std::vector<pipelines::SegmentAndSlice>>(std::move(segment_and_slices));
+                    });
+            });
+        folly::FutureSplitter<RowSliceSegments> splitter{std::move(row_slice_segments)};
+
+        size_t filter_pos{0};
+        auto deferred_pos = static_cast<size_t>(std::ranges::count_if(indexes, [&filter_slices](size_t idx) { return filter_slices[idx]; }));
+        output_indexes.emplace_back();
+        for (auto idx: indexes) {
+            output_indexes.back().emplace_back(segment_and_slice_futures.size());
+            const auto pos = filter_slices[idx] ? filter_pos++ : deferred_pos++;
+            // Each position is taken by one future only, so can be moved from the shared segments
+            segment_and_slice_futures.emplace_back(splitter.getFuture().thenValueInline([pos](RowSliceSegments&& segments) {
+                return std::move((*segments)[pos]);
+            }));
+        }
+    }
+    return {std::move(segment_and_slice_futures), std::move(output_indexes)};
+}
+
 folly::Future<std::vector<EntityId>> read_and_schedule_processing(
     const std::shared_ptr<Store>& store,
     const std::shared_ptr<PipelineContext>& pipeline_context,
@@ -922,6 +1169,7 @@ folly::Future<std::vector<EntityId>> read_and_schedule_processing(
     }
 
     auto ranges_and_keys = generate_ranges_and_keys(*pipeline_context);
+    prune_ranges_and_keys_with_column_stats(store, *pipeline_context, read_query->clauses_, ranges_and_keys);
 
     // Each element of the vector corresponds to one processing unit containing the list of indexes in ranges_and_keys required for that processing unit
     // i.e. if the first processing unit needs ranges_and_keys[0] and ranges_and_keys[1], and the second needs ranges_and_keys[2] and ranges_and_keys[3]
@@ -933,6 +1181,28 @@ folly::Future<std::vector<EntityId>> read_and_schedule_processing(
         processing_unit_indexes = read_query->clauses_[0]->structure_for_processing(ranges_and_keys);
     }
 
+    auto clauses = std::make_shared<std::vector<std::shared_ptr<Clause>>>(read_query->clauses_);
+    if (auto filter_slices = late_materialisation_filter_slices(*pipeline_context, read_query->clauses_, processing_config, ranges_and_keys, processing_unit_indexes)) {
+        // A copy of the FilterClause for this read only, to hold the results evaluated while reading
+        auto filter_clause = folly::poly_cast<FilterClause>(*clauses->front());
+        filter_clause.precomputed_results_ = std::make_shared<PrecomputedFilterResults>();
+        clauses->front() = std::make_shared<Clause>(std::move(filter_clause));
+        auto [segment_and_slice_futures, output_indexes] = read_filter_slices_first(
+            store,
+            pipeline_context,
+            processing_config,
+            std::move(ranges_and_keys),
+            std::move(processing_unit_indexes),
+            std::move(*filter_slices),
+            clauses->front());
+        return schedule_clause_processing(
+            component_manager,
+            std::move(segment_and_slice_futures),
+            std::move(output_indexes),
+            clauses)
+        .via(&async::cpu_executor());
+    }
+
     // Start reading as early as possible
     auto segment_and_slice_futures = generate_segment_and_slice_futures(store, pipeline_context, processing_config, std::move(ranges_and_keys));
 
@@ -940,7 +1210,7 @@ folly::Future<std::vector<EntityId>> read_and_schedule_processing(
         component_manager,
         std::move(segment_and_slice_futures),
         std::move(processing_unit_indexes),
-        std::make_shared<std::vector<std::shared_ptr<Clause>>>(read_query->clauses_))
+        clauses)
     .via(&async::cpu_executor());
 }
 
@@ -966,6 +1236,8 @@ folly::Future<std::vector<SliceAndKey>> read_process_and_collect(
                 auto proc = gather_entities<std::shared_ptr<SegmentInMemory>,
                         std::shared_ptr<RowRange>,
                         std::shared_ptr<ColRange>>(*component_manager, processed_entity_ids);
+                if (component_manager->arena())
+                    query_stats::add_arena_stats(component_manager->arena()->stats());
 
                 if (std::ranges::any_of(read_query->clauses_,
                                         [](const std::shared_ptr<Clause>& clause) {
@@ -999,19 +1271,43 @@ FrameAndDescriptor read_segment_impl(
     return frame_and_descriptor_from_segment(decode_segment(*seg, AllocationType::DETACHABLE));
 }
 
+// Frames returned to Python take ownership of the buffer of each column, so need a single detachable block per column
+static SegmentInMemory detachable_copy(const SegmentInMemory& segment) {
+    SegmentInMemory output{segment.descriptor(), segment.row_count(), AllocationType::DETACHABLE};
+    for (size_t col = 0; col < segment.num_columns(); ++col) {
+        auto* dest = output.column(static_cast<position_t>(col)).ptr();
+        for (const auto* block : segment.column(static_cast<position_t>(col)).data().buffer().blocks()) {
+            block->copy_to(dest);
+            dest += block->bytes();
+        }
+    }
+    output.set_row_data(static_cast<ssize_t>(segment.row_count()) - 1);
+    output.set_string_pool(segment.string_pool_ptr());
+    output.set_timeseries_descriptor(segment.index_descriptor());
+    return output;
+}
+
 FrameAndDescriptor read_index_impl(
     const std::shared_ptr<Store>& store,
     const VersionedItem& version) {
-    return read_segment_impl(store, version.key_);
+    auto seg = store->read_compressed_sync(version.key_).segment_ptr();
+    auto index_segment = decode_segment(*seg, AllocationType::DETACHABLE);
+    if (!index::is_paged_index(index_segment))
+        return frame_and_descriptor_from_segment(std::move(index_segment));
+
+    // The rows of a top-level index segment refer to its pages, whereas callers expect the data keys of the version
+    auto pages = index::read_index_pages(store, std::move(index_segment)).get();
+    return frame_and_descriptor_from_segment(detachable_copy(pages));
 }
 
 std::optional<index::IndexSegmentReader> get_index_segment_reader(
-    Store& store,
+    const std::shared_ptr<Store>& store,
     const std::shared_ptr<PipelineContext>& pipeline_context,
-    const VersionedItem& version_info) {
+    const VersionedItem& version_info,
+    const ReadQuery& read_query) {
     std::pair<VariantKey, SegmentInMemory> index_key_seg = [&]() {
         try {
-            return store.read_sync(version_info.key_);
+            return store->read_sync(version_info.key_);
         } catch (const std::exception &ex) {
             ARCTICDB_DEBUG(log::version(), "Key not found from versioned item {}: {}", version_info.key_, ex.what());
             throw storage::NoDataFoundException(fmt::format(
@@ -1027,6 +1323,15 @@ std::optional<index::IndexSegmentReader> get_index_segment_reader(
         pipeline_context->multi_key_ = std::move(index_key_seg.second);
         return std::nullopt;
     }
+    if (index::is_paged_index(index_key_seg.second)) {
+        // Only the pages that overlap a date range can contain keys that the read will need
+        std::optional<IndexRange> index_range;
+        if (const auto* range = std::get_if<IndexRange>(&read_query.row_filter))
+            index_range = *range;
+
+        return std::make_optional<index::IndexSegmentReader>(
+            index::read_index_pages(store, std::move(index_key_seg.second), index_range).get());
+    }
     return std::make_optional<index::IndexSegmentReader>(std::move(index_key_seg.second));
 }
 
@@ -1059,7 +1364,7 @@ static void read_indexed_keys_to_pipeline(
         const VersionedItem& version_info,
         ReadQuery& read_query,
         const ReadOptions& read_options) {
-    auto maybe_reader = get_index_segment_reader(*store, pipeline_context, version_info);
+    auto maybe_reader = get_index_segment_reader(store, pipeline_context, version_info, read_query);
     if(!maybe_reader)
         return;
 
@@ -1069,6 +1374,7 @@ static void read_indexed_keys_to_pipeline(
     check_column_and_date_range_filterable(index_segment_reader, read_query);
     add_index_columns_to_query(read_query, index_segment_reader.tsd());
 
+    pipeline_context->index_key_ = version_info.key_;
     const auto& tsd = index_segment_reader.tsd();
     read_query.convert_to_positive_row_filter(static_cast<int64_t>(tsd.total_rows()));
     const bool bucketize_dynamic = index_segment_reader.bucketize_dynamic();
@@ -1471,6 +1777,7 @@ void create_column_stats_impl(
     auto read_query = std::make_shared<ReadQuery>(std::vector<std::shared_ptr<Clause>>{std::make_shared<Clause>(std::move(*clause))});
 
     auto column_stats_key = index_key_to_column_stats_key(versioned_item.key_);
+    store->missing_keys().erase(column_stats_key);
     std::optional<SegmentInMemory> old_segment;
     try {
         old_segment = store->read(column_stats_key).get().second;
@@ -1520,6 +1827,8 @@ void create_column_stats_impl(
         internal::check<ErrorCode::E_ASSERTION_FAILURE>(
                 new_segment.column(0) == old_segment->column(0) && new_segment.column(1) == old_segment->column(1),
                 "Cannot create column stats, existing column stats row-groups do not match");
+        if (new_segment.has_string_pool())
+            remap_strings(new_segment, old_segment->string_pool());
         old_segment->concatenate(std::move(new_segment));
         store->update(column_stats_key, std::move(*old_segment), update_opts).get();
     }
@@ -1595,6 +1904,44 @@ ColumnStats get_column_stats_info_impl(
     }
 }
 
+uint64_t approx_nunique_impl(
+    const std::shared_ptr<Store>& store,
+    const VersionedItem& versioned_item,
+    const std::string& column,
+    const IndexRange& date_range) {
+    auto column_stats_key = index_key_to_column_stats_key(versioned_item.key_);
+    SegmentInMemory segment;
+    // Remove try-catch once AsyncStore methods raise the new error codes themselves
+    try {
+        segment = store->read(column_stats_key).get().second;
+    } catch (const std::exception& e) {
+        storage::raise<ErrorCode::E_KEY_NOT_FOUND>("Failed to read column stats key: {}", e.what());
+    }
+    auto sketch_column_name = ColumnStats(segment.fields()).hyperloglog_column_name(column);
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+            sketch_column_name.has_value(),
+            "Cannot estimate the number of unique values in column '{}' of symbol '{}' without HYPERLOGLOG column stats for it",
+            column, versioned_item.symbol());
+    const auto sketch_column = static_cast<position_t>(segment.column_index(*sketch_column_name).value());
+    const auto start_index_column = static_cast<position_t>(segment.column_index(start_index_column_name).value());
+    const auto end_index_column = static_cast<position_t>(segment.column_index(end_index_column_name).value());
+
+    // Row-slices that only partly overlap date_range contribute all of their values, so the estimate can be high
+    HyperLogLog sketch;
+    for (size_t row = 0; row < segment.row_count(); ++row) {
+        const auto index_row = static_cast<position_t>(row);
+        const auto start_index = segment.scalar_at<timestamp>(index_row, start_index_column).value();
+        // The end index of a data key is one past its last index value
+        const auto last_index = segment.scalar_at<timestamp>(index_row, end_index_column).value() - 1;
+        if (!intersects(date_range, IndexValue{start_index}, IndexValue{last_index}))
+            continue;
+
+        if (auto serialized = segment.string_at(index_row, sketch_column); serialized.has_value())
+            sketch.merge(HyperLogLog::deserialize(*serialized));
+    }
+    return sketch.estimate();
+}
+
 folly::Future<SegmentInMemory> do_direct_read_or_process(
         const std::shared_ptr<Store>& store,
         const std::shared_ptr<ReadQuery>& read_query,
@@ -2181,6 +2528,111 @@ folly::Future<ReadVersionOutput> read_frame_for_version(
     });
 }
 
+ReadBatchIterator::ReadBatchIterator(
+        std::shared_ptr<Store> store,
+        std::shared_ptr<PipelineContext> pipeline_context,
+        std::shared_ptr<ReadQuery> read_query,
+        ReadOptions read_options,
+        VersionedItem versioned_item,
+        std::any&& handler_data,
+        size_t row_slices_per_batch,
+        size_t prefetch) :
+    store_(std::move(store)),
+    pipeline_context_(std::move(pipeline_context)),
+    read_query_(std::move(read_query)),
+    read_options_(std::move(read_options)),
+    versioned_item_(std::move(versioned_item)),
+    handler_data_(std::move(handler_data)),
+    prefetch_(prefetch) {
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(row_slices_per_batch > 0, "row_slices_per_batch must be positive");
+    const auto& slice_and_keys = pipeline_context_->slice_and_keys_;
+    size_t row_slices_in_batch{0};
+    for (size_t idx = 0; idx < slice_and_keys.size(); ++idx) {
+        if (idx == 0 || slice_and_keys[idx].slice_.row_range != slice_and_keys[idx - 1].slice_.row_range) {
+            if (row_slices_in_batch++ % row_slices_per_batch == 0) {
+                batch_starts_.emplace_back(idx);
+            }
+        }
+    }
+    batch_starts_.emplace_back(slice_and_keys.size());
+}
+
+ReadBatchIterator::~ReadBatchIterator() {
+    for (auto& fut: in_flight_) {
+        fut.wait();
+    }
+}
+
+void ReadBatchIterator::schedule_reads(size_t max_in_flight) {
+    while (next_batch_to_schedule_ < num_batches() && in_flight_.size() < max_in_flight) {
+        in_flight_.emplace_back(read_batch(next_batch_to_schedule_++));
+    }
+}
+
+folly::Future<ReadVersionOutput> ReadBatchIterator::read_batch(size_t batch) {
+    auto batch_context = pipeline_context_->slice_range_context(batch_starts_[batch], batch_starts_[batch + 1]);
+    DecodePathData shared_data;
+    return do_direct_read_or_process(store_, read_query_, read_options_, batch_context, shared_data, handler_data_)
+    .thenValue([this, batch_context](SegmentInMemory&& frame) mutable {
+        return reduce_and_fix_columns(batch_context, frame, read_options_, handler_data_)
+        .via(&async::cpu_executor())
+        .thenValue([versioned_item = versioned_item_, batch_context, frame](auto&&) mutable {
+            return ReadVersionOutput{std::move(versioned_item),
+                                     {frame,
+                                      timeseries_descriptor_from_pipeline_context(batch_context, {}, batch_context->bucketize_dynamic_),
+                                      {}}};
+        });
+    });
+}
+
+std::optional<ReadVersionOutput> ReadBatchIterator::next() {
+    // The batch returned now, if it was not prefetched by the previous call
+    schedule_reads(1);
+    if (in_flight_.empty()) {
+        return std::nullopt;
+    }
+    auto fut = std::move(in_flight_.front());
+    in_flight_.pop_front();
+    // Keep prefetch_ batches reading while the caller consumes this one
+    schedule_reads(prefetch_);
+    return std::move(fut).get();
+}
+
+std::unique_ptr<ReadBatchIterator> read_batches_for_version(
+        const std::shared_ptr<Store>& store,
+        const VersionedItem& version_info,
+        const std::shared_ptr<ReadQuery>& read_query,
+        const ReadOptions& read_options,
+        std::any&& handler_data,
+        size_t row_slices_per_batch,
+        size_t prefetch) {
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+        read_options.output_format() == OutputFormat::ARROW,
+        "Reading record batches is only supported with Arrow output");
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+        read_query->clauses_.empty(),
+        "Reading record batches does not support QueryBuilder clauses, use date_range, row_range and columns instead");
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+        !opt_false(read_options.incompletes()),
+        "Reading record batches does not support reading staged data");
+    auto pipeline_context = setup_pipeline_context(store, version_info, *read_query, read_options);
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+        !pipeline_context->multi_key_,
+        "Reading record batches is not supported for recursively normalized data");
+    schema::check<ErrorCode::E_OPERATION_NOT_SUPPORTED_WITH_PICKLED_DATA>(
+        !pipeline_context->is_pickled(),
+        "Reading record batches is not supported for pickled data");
+    return std::make_unique<ReadBatchIterator>(
+        store,
+        std::move(pipeline_context),
+        read_query,
+        read_options,
+        version_info,
+        std::move(handler_data),
+        row_slices_per_batch,
+        prefetch);
+}
+
 folly::Future<SymbolProcessingResult> read_and_process(
         const std::shared_ptr<Store>& store,
         const std::variant<VersionedItem, StreamId>& version_info,
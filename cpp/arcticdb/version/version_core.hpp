@@ -23,6 +23,7 @@
 #include <arcticdb/version/version_store_objects.hpp>
 #include <arcticdb/version/schema_checks.hpp>
 
+#include <deque>
 #include <string>
 
 namespace arcticdb::version_store {
@@ -159,12 +160,21 @@ ColumnStats get_column_stats_info_impl(
     const std::shared_ptr<Store>& store,
     const VersionedItem& versioned_item);
 
+// Estimates the number of unique values in column over the row-slices intersecting date_range by merging their
+// HYPERLOGLOG column stats, without reading any data segments
+uint64_t approx_nunique_impl(
+    const std::shared_ptr<Store>& store,
+    const VersionedItem& versioned_item,
+    const std::string& column,
+    const IndexRange& date_range);
+
 folly::Future<ReadVersionOutput> read_multi_key(
     const std::shared_ptr<Store>& store,
     const SegmentInMemory& index_key_seg,
     std::any& handler_data);
 
 folly::Future<std::vector<EntityId>> schedule_remaining_iterations(
+    std::shared_ptr<ComponentManager> component_manager,
     std::vector<std::vector<EntityId>>&& entity_ids_vec_fut,
     std::shared_ptr<std::vector<std::shared_ptr<Clause>>> clauses);
 
@@ -232,6 +242,71 @@ folly::Future<ReadVersionOutput> read_frame_for_version(
     std::any& handler_data
 );
 
+/*
+ * Reads a version of a symbol as a sequence of frames, each holding the rows of a group of consecutive row-slices,
+ * rather than into a single frame allocated up front for the whole result. Up to prefetch groups are read ahead of
+ * the one returned by next(), so memory use is bounded by the group size rather than the size of the symbol, and the
+ * first rows can be consumed before the last segments have been read.
+ *
+ * Only direct reads with Arrow output are supported, i.e. columns, date_range and row_range but no QueryBuilder
+ * clauses, as the Arrow read path applies date and row range truncation to each frame itself.
+ */
+class ReadBatchIterator {
+public:
+    ReadBatchIterator(
+        std::shared_ptr<Store> store,
+        std::shared_ptr<PipelineContext> pipeline_context,
+        std::shared_ptr<ReadQuery> read_query,
+        ReadOptions read_options,
+        VersionedItem versioned_item,
+        std::any&& handler_data,
+        size_t row_slices_per_batch,
+        size_t prefetch);
+
+    ARCTICDB_NO_MOVE_OR_COPY(ReadBatchIterator)
+
+    // Outstanding reads refer to the handler data held here, so must complete before it is destroyed
+    ~ReadBatchIterator();
+
+    // The next group of rows, or std::nullopt once the whole version has been returned
+    std::optional<ReadVersionOutput> next();
+
+    [[nodiscard]] size_t num_batches() const {
+        return batch_starts_.size() - 1;
+    }
+
+    // The batches being read ahead of the one last returned by next(), at most prefetch
+    [[nodiscard]] size_t num_reads_in_flight() const {
+        return in_flight_.size();
+    }
+
+private:
+    void schedule_reads(size_t max_in_flight);
+
+    folly::Future<ReadVersionOutput> read_batch(size_t batch);
+
+    std::shared_ptr<Store> store_;
+    std::shared_ptr<PipelineContext> pipeline_context_;
+    std::shared_ptr<ReadQuery> read_query_;
+    ReadOptions read_options_;
+    VersionedItem versioned_item_;
+    std::any handler_data_;
+    size_t prefetch_;
+    // Positions in pipeline_context_->slice_and_keys_ at which each batch starts, followed by the end position
+    std::vector<size_t> batch_starts_;
+    size_t next_batch_to_schedule_ = 0;
+    std::deque<folly::Future<ReadVersionOutput>> in_flight_;
+};
+
+std::unique_ptr<ReadBatchIterator> read_batches_for_version(
+    const std::shared_ptr<Store>& store,
+    const VersionedItem& version_info,
+    const std::shared_ptr<ReadQuery>& read_query,
+    const ReadOptions& read_options,
+    std::any&& handler_data,
+    size_t row_slices_per_batch,
+    size_t prefetch);
+
 folly::Future<SymbolProcessingResult> read_and_process(
         const std::shared_ptr<Store>& store,
         const std::variant<VersionedItem, StreamId>& version_info,
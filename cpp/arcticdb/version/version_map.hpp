@@ -12,7 +12,9 @@
  */
 #pragma once
 
+#include <array>
 #include <shared_mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <map>
 #include <deque>
@@ -99,6 +101,10 @@ class VersionMapImpl {
      * when someone requests the latest version, we do have a grace period of DEFAULT_RELOAD_INTERVAL where we will
      * just use the data in the in memory map if it exists rather than reading the ref key from the storage.
      *
+     * The in memory map is split into NUM_MAP_SHARDS shards by the hash of the symbol, each guarded by its own
+     * shared mutex, so that concurrent cache lookups (e.g. from batch reads over many symbols) only take a shared lock
+     * on one shard and do not contend with each other. An exclusive lock is only needed to add a new symbol's entry.
+     *
      */
 
     /**
@@ -106,15 +112,22 @@ class VersionMapImpl {
      *
      * Methods already declared with const& were not touched during this change.
      */
-    using MapType =  std::map<StreamId, std::shared_ptr<VersionMapEntry>>;
+    // Values are never erased individually and unordered_map does not move its nodes when rehashing, so references to
+    // them remain valid until the next flush()
+    using MapType =  std::unordered_map<StreamId, std::shared_ptr<VersionMapEntry>>;
+
+    struct MapShard {
+        MapType map_;
+        mutable std::shared_mutex mutex_;
+    };
 
     static constexpr uint64_t DEFAULT_CLOCK_UNSYNC_TOLERANCE = ONE_MILLISECOND * 200;
     static constexpr uint64_t DEFAULT_RELOAD_INTERVAL = ONE_SECOND * 2;
-    MapType map_;
+    static constexpr size_t NUM_MAP_SHARDS = 64;
+    std::array<MapShard, NUM_MAP_SHARDS> shards_;
     bool validate_ = false;
     bool log_changes_ = false;
     std::optional<timestamp> reload_interval_;
-    mutable std::mutex map_mutex_;
     std::shared_ptr<LockTable> lock_table_ = std::make_shared<LockTable>();
 
 public:
@@ -214,8 +227,10 @@ public:
     }
 
     void flush() {
-        std::lock_guard lock(map_mutex_);
-        map_.clear();
+        for (auto& shard : shards_) {
+            std::unique_lock lock(shard.mutex_);
+            shard.map_.clear();
+        }
     }
 
     void load_via_iteration(
@@ -663,15 +678,14 @@ public:
         util::check(requested_load_type < LoadType::UNKNOWN, "Unexpected load type requested {}", requested_load_type);
 
         requested_load_strategy.validate();
-        MapType::const_iterator entry_it;
-        if(!find_entry(entry_it, stream_id)) {
+        const auto entry = find_entry(stream_id);
+        if(!entry) {
             return false;
         }
 
-        const timestamp reload_interval = reload_interval_.value_or(
-                ConfigsMap::instance()->get_int("VersionMap.ReloadInterval", DEFAULT_RELOAD_INTERVAL));
+        const timestamp reload_interval = reload_interval_.has_value() ? *reload_interval_ :
+                ConfigsMap::instance()->get_int("VersionMap.ReloadInterval", DEFAULT_RELOAD_INTERVAL);
 
-        const auto& entry = entry_it->second;
         if (const timestamp cache_timing = now() - entry->last_reload_time_; cache_timing > reload_interval) {
             ARCTICDB_DEBUG(log::version(),
                            "Latest read time {} too long ago for last acceptable cached timing {} (cache period {}) for symbol {}",
@@ -766,14 +780,22 @@ private:
             entry->validate();
     }
 
-    bool find_entry(MapType::const_iterator& entry, const StreamId& stream_id) const {
-        std::lock_guard lock(map_mutex_);
-        entry = map_.find(stream_id);
-        if (entry == map_.cend()) {
-            ARCTICDB_DEBUG(log::version(), "Did not find cached entry for stream id {}", stream_id);
-            return false;
-        }
-        return true;
+    MapShard& shard_for(const StreamId& stream_id) {
+        return shards_[std::hash<StreamId>{}(stream_id) % NUM_MAP_SHARDS];
+    }
+
+    const MapShard& shard_for(const StreamId& stream_id) const {
+        return shards_[std::hash<StreamId>{}(stream_id) % NUM_MAP_SHARDS];
+    }
+
+    std::shared_ptr<VersionMapEntry> find_entry(const StreamId& stream_id) const {
+        const auto& shard = shard_for(stream_id);
+        std::shared_lock lock(shard.mutex_);
+        if (auto result = shard.map_.find(stream_id); result != shard.map_.cend())
+            return result->second;
+
+        ARCTICDB_DEBUG(log::version(), "Did not find cached entry for stream id {}", stream_id);
+        return nullptr;
     }
 
     /**
@@ -807,11 +829,14 @@ private:
     }
 
     std::shared_ptr<VersionMapEntry>& get_entry(const StreamId& stream_id) {
-        std::lock_guard lock(map_mutex_);
-        if(auto result = map_.find(stream_id); result != std::end(map_))
-            return result->second;
-
-        return map_.try_emplace(stream_id, std::make_shared<VersionMapEntry>()).first->second;
+        auto& shard = shard_for(stream_id);
+        {
+            std::shared_lock lock(shard.mutex_);
+            if(auto result = shard.map_.find(stream_id); result != std::end(shard.map_))
+                return result->second;
+        }
+        std::unique_lock lock(shard.mutex_);
+        return shard.map_.try_emplace(stream_id, std::make_shared<VersionMapEntry>()).first->second;
     }
 
     AtomKey write_entry_to_storage(
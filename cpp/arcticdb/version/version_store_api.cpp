@@ -374,12 +374,13 @@ void PythonVersionStore::add_to_snapshot(
 
     std::sort(std::begin(retained_keys), std::end(retained_keys));
     if(is_delete_keys_immediately) {
-        delete_trees_responsibly(store(), version_map(), deleted_keys, get_master_snapshots_map(store()), snap_name).get();
+        delete_trees_responsibly(store(), version_map(), deleted_keys, snapshot_index().master_snapshots_map(store()), snap_name).get();
         if (version_map()->log_changes()) {
             log_delete_snapshot(store(), snap_name);
         }
     }
     write_snapshot_entry(store(), retained_keys, snap_name, user_meta, version_map()->log_changes());
+    snapshot_index().add_snapshot(snap_name, retained_keys);
 }
 
 void PythonVersionStore::remove_from_snapshot(
@@ -416,12 +417,13 @@ void PythonVersionStore::remove_from_snapshot(
     }
 
     if(is_delete_keys_immediately) {
-        delete_trees_responsibly(store(), version_map(), deleted_keys, get_master_snapshots_map(store()), snap_name).get();
+        delete_trees_responsibly(store(), version_map(), deleted_keys, snapshot_index().master_snapshots_map(store()), snap_name).get();
         if (version_map()->log_changes()) {
             log_delete_snapshot(store(), snap_name);
         }
     }
     write_snapshot_entry(store(), retained_keys, snap_name, user_meta, version_map()->log_changes());
+    snapshot_index().add_snapshot(snap_name, retained_keys);
 }
 
 void PythonVersionStore::verify_snapshot(const SnapshotId& snap_name) {
@@ -496,6 +498,7 @@ void PythonVersionStore::snapshot(
 
     ARCTICDB_DEBUG(log::version(), "Total Index keys in snapshot={}", index_keys.size());
     write_snapshot_entry(store(), index_keys, snap_name, user_meta, version_map()->log_changes());
+    snapshot_index().add_snapshot(snap_name, index_keys);
 }
 
 std::set<StreamId> PythonVersionStore::list_streams(
@@ -715,6 +718,15 @@ ColumnStats PythonVersionStore::get_column_stats_info_version(
     return get_column_stats_info_version_internal(stream_id, version_query);
 }
 
+uint64_t PythonVersionStore::approx_nunique_version(
+    const StreamId& stream_id,
+    const std::string& column,
+    const std::optional<IndexRange>& date_range,
+    const VersionQuery& version_query) {
+    ARCTICDB_SAMPLE(ApproxNunique, 0)
+    return approx_nunique_version_internal(stream_id, column, date_range.value_or(IndexRange{}), version_query);
+}
+
 VersionedItem PythonVersionStore::compact_incomplete(
         const StreamId& stream_id,
         bool append,
@@ -853,6 +865,7 @@ void PythonVersionStore::delete_snapshot(const SnapshotId& snap_name) {
             log_delete_snapshot(store(), snap_name);
         }
     }
+    snapshot_index().remove_snapshot(snap_name);
 }
 
 void PythonVersionStore::delete_snapshot_sync(const SnapshotId& snap_name, const VariantKey& snap_key) {
@@ -153,6 +153,12 @@ class PythonVersionStore : public LocalVersionedEngine {
         const StreamId& stream_id,
         const VersionQuery& version_query);
 
+    uint64_t approx_nunique_version(
+        const StreamId& stream_id,
+        const std::string& column,
+        const std::optional<IndexRange>& date_range,
+        const VersionQuery& version_query);
+
     ReadResult read_dataframe_version(
         const StreamId &stream_id,
         const VersionQuery& version_query,
@@ -34,6 +34,9 @@ struct UpdateMetadataTask : async::BaseTask {
         ARCTICDB_RUNTIME_DEBUG(log::version(), "Command: update metadata");
         util::check(update_info_.previous_index_key_.has_value(), "Cannot update metadata as there is no previous index key to update");
         auto index_key = *(update_info_.previous_index_key_);
+        // For a paged index this is the top-level segment, which carries the descriptor of the whole version. The
+        // new version refers to the same pages, which are kept when the previous version is pruned as they are kept
+        // for its data keys.
         auto segment = store_->read_sync(index_key).second;
 
         segment.mutable_index_descriptor().mutable_proto().mutable_user_meta()->CopyFrom(user_meta_);
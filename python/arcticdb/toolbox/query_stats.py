@@ -55,19 +55,34 @@ def get_query_stats() -> Dict[str, Any]:
     Returns
     -------
     Dict[str, Any]:
-        A dictionary containing statistics organized by key type,
-        operation group, and task type. Each task contains timing and count information. 
+        A dictionary containing statistics organized by operation group, task type and either key type (for
+        storage operations) or a stage specific name such as the codec or clause (for processing operations).
+        Each task contains timing and count information.
         Example output:
         {
             "storage_operations": {
                 "S3_ListObjectsV2": {
-                    "total_time_ms": 83,
-                    "count": 3
+                    "SYMBOL_LIST": {
+                        "total_time_ms": 83,
+                        "count": 3,
+                        "size_bytes": 0
+                    }
                 },
-                "S3_GetObject": {
-                    "total_time_ms": 50,
-                    "count": 3,
-                    "size_bytes": 10
+                "LMDB_Read": {
+                    "TABLE_DATA": {
+                        "total_time_ms": 50,
+                        "count": 3,
+                        "size_bytes": 10
+                    }
+                }
+            },
+            "processing_operations": {
+                "ClauseProcess": {
+                    "FilterClause": {
+                        "total_time_ms": 2,
+                        "count": 3,
+                        "size_bytes": 0
+                    }
                 }
             }
         }
@@ -24,7 +24,7 @@ import difflib
 from datetime import datetime
 from numpy import datetime64
 from pandas import Timestamp, to_datetime, Timedelta
-from typing import Any, Optional, Union, List, Sequence, Tuple, Dict, Set
+from typing import Any, Optional, Union, List, Sequence, Tuple, Dict, Set, Iterator
 from contextlib import contextmanager
 
 from arcticc.pb2.descriptors_pb2 import IndexDescriptor, TypeDescriptor
@@ -974,6 +974,8 @@ class NativeVersionStore:
             Keys are column names.
             Values are sets of statistic types to build for that column. Options are:
                 "MINMAX" : store the minimum and maximum value for the column in each row-slice
+                "HYPERLOGLOG" : store a sketch of the distinct values of the column in each row-slice, used by
+                    `approx_nunique`
         as_of : `Optional[VersionQueryInput]`, default=None
             See documentation of `read` method for more details.
 
@@ -1051,6 +1053,39 @@ class NativeVersionStore:
         version_query = self._get_version_query(as_of, **kwargs)
         return self.version_store.get_column_stats_info_version(symbol, version_query).to_map()
 
+    def approx_nunique(
+        self,
+        symbol: str,
+        column: str,
+        date_range: Optional[DateRangeInput] = None,
+        as_of: Optional[VersionQueryInput] = None,
+        **kwargs,
+    ) -> int:
+        """
+        Estimate the number of unique values in a column, using the "HYPERLOGLOG" column stats created for it with
+        `create_column_stats`. No data segments are read. The estimate has a standard error of around 1.6%.
+
+        Parameters
+        ----------
+        symbol: `str`
+            Symbol name.
+        column: `str`
+            The column to estimate the number of unique values of.
+        date_range: `Optional[DateRangeInput]`, default=None
+            If provided, only the row-slices intersecting this range contribute to the estimate. All of the values in
+            a row-slice that is only partly inside the range are counted.
+        as_of : `Optional[VersionQueryInput]`, default=None
+            See documentation of `read` method for more details.
+
+        Returns
+        -------
+        `int`
+            The estimated number of unique values. NaN, NaT and None are not counted.
+        """
+        version_query = self._get_version_query(as_of, **kwargs)
+        index_range = None if date_range is None else _normalize_dt_range(date_range)
+        return self.version_store.approx_nunique_version(symbol, column, index_range, version_query)
+
     def _batch_read_keys(self, atom_keys):
         for result in self.version_store.batch_read_keys(atom_keys):
             read_result = ReadResult(*result)
@@ -1987,6 +2022,72 @@ class NativeVersionStore:
         read_result = self._read_dataframe(symbol, version_query, read_query, read_options)
         return self._post_process_dataframe(read_result, read_query, implement_read_index)
 
+    def read_record_batches(
+        self,
+        symbol: str,
+        as_of: Optional[VersionQueryInput] = None,
+        date_range: Optional[DateRangeInput] = None,
+        row_range: Optional[Tuple[int, int]] = None,
+        columns: Optional[List[str]] = None,
+        row_slices_per_batch: int = 1,
+        prefetch: int = 2,
+        **kwargs,
+    ) -> Iterator["pyarrow.RecordBatch"]:
+        """
+        Read data for the named symbol as a stream of Arrow record batches rather than a single table.
+
+        Data is read one group of row-slices at a time, with up to `prefetch` groups read ahead of the one being
+        consumed, so symbols larger than memory can be processed and the first rows are available before the rest of
+        the symbol has been read. Concatenating the batches gives the same table as `read` with Arrow output.
+
+        Parameters
+        ----------
+        symbol : `str`
+            Symbol name.
+        as_of : `Optional[VersionQueryInput]`, default=None
+            See documentation of `read` method for more details.
+        date_range: `Optional[DateRangeInput]`, default=None
+            See documentation of `read` method for more details.
+        row_range: `Optional[Tuple[int, int]]`, default=None
+            See documentation of `read` method for more details.
+        columns: `Optional[List[str]]`, default=None
+            See documentation of `read` method for more details.
+        row_slices_per_batch: `int`, default=1
+            Number of row-slices (as set by the `segment_row_size` library option) read into each group. Each group
+            yields one record batch per row-slice.
+        prefetch: `int`, default=2
+            Number of groups to read ahead of the group being consumed.
+
+        Returns
+        -------
+        Iterator[pyarrow.RecordBatch]
+
+        Notes
+        ----------
+        !!! warning
+            This API is unstable and not governed by semantic versioning.
+        """
+        import pyarrow as pa
+
+        kwargs["_output_format"] = OutputFormat.ARROW
+        version_query, read_options, read_query = self._get_queries(
+            as_of=as_of,
+            date_range=date_range,
+            row_range=row_range,
+            columns=columns,
+            query_builder=None,
+            **kwargs,
+        )
+        batches = self.version_store.read_dataframe_batches(
+            symbol, version_query, read_query, read_options, row_slices_per_batch, prefetch
+        )
+        while True:
+            read_result = batches.next()
+            if read_result is None:
+                return
+            for record_batch in ReadResult(*read_result).frame_data.extract_record_batches():
+                yield pa.RecordBatch._import_from_c(record_batch.array(), record_batch.schema())
+
     def head(
         self,
         symbol: str,
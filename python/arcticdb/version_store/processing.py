@@ -90,6 +90,7 @@ class ExpressionNode:
 
     def _apply(self, right, operator):
         left = ExpressionNode.compose(self.left, self.operator, self.right)
+        left.condition = self.condition
         self = ExpressionNode()
         self.left = left
         self.operator = operator
@@ -98,6 +99,7 @@ class ExpressionNode:
 
     def _rapply(self, left, operator):
         right = ExpressionNode.compose(self.left, self.operator, self.right)
+        right.condition = self.condition
         self = ExpressionNode()
         self.right = right
         self.operator = operator
@@ -244,6 +246,48 @@ class ExpressionNode:
                 f"'regex_match' filtering only accepts str as pattern, {type(pattern)} is given"
             )
 
+    def startswith(self, prefix: str):
+        if isinstance(prefix, str):
+            return self._apply(prefix, _OperationType.STARTSWITH)
+        else:
+            raise UserInputException(f"'startswith' only accepts str as prefix, {type(prefix)} is given")
+
+    def contains(self, substring: str):
+        if isinstance(substring, str):
+            return self._apply(substring, _OperationType.CONTAINS)
+        else:
+            raise UserInputException(f"'contains' only accepts str as substring, {type(substring)} is given")
+
+    def len(self):
+        return ExpressionNode.compose(self, _OperationType.LEN, None)
+
+    def lower(self):
+        return ExpressionNode.compose(self, _OperationType.LOWER, None)
+
+    def upper(self):
+        return ExpressionNode.compose(self, _OperationType.UPPER, None)
+
+    def substring(self, start: int, length: Optional[int] = None):
+        if not isinstance(start, (int, np.integer)) or not isinstance(length, (int, np.integer, type(None))):
+            raise UserInputException(
+                f"'substring' only accepts integer start and length, {type(start)} and {type(length)} are given"
+            )
+        if length is not None and length < 0:
+            raise UserInputException(f"'substring' length must be non-negative, {length} is given")
+        expression_node = ExpressionNode()
+        # The string column is held in the condition slot, as for the ternary operator
+        expression_node.condition = self
+        expression_node.left = int(start)
+        expression_node.operator = _OperationType.SUBSTRING
+        expression_node.right = np.iinfo(np.int64).max if length is None else int(length)
+        return expression_node
+
+    def concat(self, other):
+        if isinstance(other, (str, ExpressionNode)):
+            return self._apply(other, _OperationType.CONCAT)
+        else:
+            raise UserInputException(f"'concat' only accepts str or a string column, {type(other)} is given")
+
     def __str__(self):
         return self.get_name()
 
@@ -251,10 +295,19 @@ class ExpressionNode:
         if not self.name:
             if self.operator == COLUMN:
                 self.name = 'Column["{}"]'.format(self.left)
-            elif self.operator in [_OperationType.ABS, _OperationType.NEG, _OperationType.NOT]:
+            elif self.operator in [
+                _OperationType.ABS,
+                _OperationType.NEG,
+                _OperationType.NOT,
+                _OperationType.LEN,
+                _OperationType.LOWER,
+                _OperationType.UPPER,
+            ]:
                 self.name = "{}({})".format(self.operator.name, self.left)
             elif self.operator == _OperationType.TERNARY:
                 self.name = f"{self.left} if {self.condition} else {self.right}"
+            elif self.operator == _OperationType.SUBSTRING:
+                self.name = f"{self.operator.name}({self.condition}, {self.left}, {self.right})"
             else:
                 if isinstance(self.left, ExpressionNode):
                     left = str(self.left)
@@ -452,6 +505,7 @@ class QueryBuilder:
     * Binary combinators: &, |, ^
     * List membership: isin, isnotin (also accessible with == and !=)
     * Regex match: regex_match
+    * String predicates: startswith, contains
 
     isin/isnotin accept lists, sets, frozensets, 1D ndarrays, or *args unpacking. For example:
 
@@ -464,6 +518,20 @@ class QueryBuilder:
 
     regex_match, similar to pandas' contains, accepts string as pattern and can only filter string columns
 
+    String functions can be used when filtering or projecting on dynamic string columns:
+
+    * startswith(prefix), contains(substring) - literal (non-regex) matching, producing a filter
+    * len() - the number of characters in each string, as a float column with NaN for missing strings
+    * lower(), upper() - change the case of ASCII characters
+    * substring(start, length=None) - characters from start (negative counts from the end) up to length characters
+    * concat(other) - append a str or another string column
+
+    These are evaluated once per distinct string in each row-slice rather than once per row, so they are much cheaper
+    than the equivalent row-wise operation on low-cardinality columns. For example:
+
+        q = q[q["exchange"].lower().startswith("x")]
+        q = q.apply("ticker_prefix", q["ticker"].substring(0, 3))
+
     Boolean columns can be filtered on directly:
 
         q = adb.QueryBuilder()
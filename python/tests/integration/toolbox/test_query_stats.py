@@ -3,6 +3,8 @@ from arcticdb.util.test import config_context
 
 import pandas as pd
 
+from arcticdb.version_store.processing import QueryBuilder
+
 
 def verify_list_symbol_stats(list_symbol_call_counts):
     stats = qs.get_query_stats()
@@ -654,3 +656,30 @@ def test_query_stats_staged_data(s3_version_store_v1, clear_query_stats, sym):
         stats_entry = put_object_ops[key]
         assert stats_entry["size_bytes"] > 0
         assert stats_entry["total_time_ms"] < 8000
+
+
+def test_query_stats_lmdb_and_processing(lmdb_version_store_v1, clear_query_stats):
+    lib = lmdb_version_store_v1
+    df = pd.DataFrame({"col": [1, 2, 3], "str_col": ["a", "b", "c"]})
+    qs.enable()
+    lib.write("a", df)
+    q = QueryBuilder()
+    q = q[q["col"] > 1]
+    lib.read("a", query_builder=q)
+    stats = qs.get_query_stats()
+
+    storage_operations = stats["storage_operations"]
+    assert {"LMDB_Write", "LMDB_Read"}.issubset(storage_operations.keys()), storage_operations
+    assert storage_operations["LMDB_Write"]["TABLE_DATA"]["count"] == 1
+    assert storage_operations["LMDB_Write"]["TABLE_DATA"]["size_bytes"] > 0
+    assert storage_operations["LMDB_Read"]["TABLE_DATA"]["count"] == 1
+    assert storage_operations["LMDB_Read"]["TABLE_DATA"]["size_bytes"] > 0
+
+    processing_operations = stats["processing_operations"]
+    assert sum(codec_stats["size_bytes"] for codec_stats in processing_operations["DecodeBlock"].values()) > 0
+    assert processing_operations["DecodeSlice"]["TABLE_DATA"]["count"] == 1
+    assert processing_operations["ClauseProcess"]["FilterClause"]["count"] == 1
+    assert processing_operations["PythonStringReduction"]["UTF_DYNAMIC64"]["count"] == 1
+    for stage in processing_operations.values():
+        for stats_entry in stage.values():
+            assert stats_entry["total_time_ms"] < 8000
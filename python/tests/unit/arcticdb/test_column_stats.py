@@ -10,6 +10,7 @@ import numpy as np
 import pandas as pd
 import pytest
 
+from arcticdb.version_store.processing import QueryBuilder
 from arcticdb_ext.exceptions import SchemaException, StorageException, UserInputException, InternalException
 from arcticdb_ext.storage import KeyType, NoDataFoundException
 from arcticdb_ext.version_store import NoSuchVersionException
@@ -688,3 +689,65 @@ def test_column_stats_object_deleted_with_index_key_batch_methods(lmdb_version_s
     for test in [test_prune_previous_kwarg_batch_methods]:
         test()
         clear()
+
+
+@pytest.mark.parametrize(
+    "expr",
+    [
+        lambda q: q["col_1"] == 3,
+        lambda q: q["col_1"] < 2,
+        lambda q: q["col_1"] >= 4,
+        lambda q: 4 < q["col_1"],
+        lambda q: q["col_1"].isin([1, 6]),
+        lambda q: q["col_1"].isin([100]),
+        lambda q: (q["col_1"] < 2) | (q["col_2"] > 9),
+        lambda q: (q["col_1"] > 1) & (q["col_2"] < 7),
+        lambda q: q["col_1"] != 3,
+    ],
+)
+def test_column_stats_used_to_filter_segments(lmdb_version_store_tiny_segment, expr):
+    lib = lmdb_version_store_tiny_segment
+    sym = "test_column_stats_used_to_filter_segments"
+    lib.write(sym, df0)
+    lib.append(sym, df1)
+    lib.append(sym, df2)
+    expected_df = pd.concat((df0, df1, df2))
+    q = QueryBuilder()
+    q = q[expr(q)]
+    expected = expected_df[expr(expected_df)]
+
+    received_without_stats = lib.read(sym, query_builder=q).data
+    lib.create_column_stats(sym, {"col_1": {"MINMAX"}, "col_2": {"MINMAX"}})
+    received_with_stats = lib.read(sym, query_builder=q).data
+
+    pd.testing.assert_frame_equal(expected, received_without_stats)
+    pd.testing.assert_frame_equal(expected, received_with_stats)
+
+
+def test_column_stats_approx_nunique(lmdb_version_store_tiny_segment):
+    lib = lmdb_version_store_tiny_segment
+    sym = "test_column_stats_approx_nunique"
+    lib.write(sym, df0)
+    lib.append(sym, df1)
+    lib.append(sym, df2.assign(col_0=["a", None]))
+
+    with pytest.raises(UserInputException):
+        lib.approx_nunique(sym, "col_1")
+
+    lib.create_column_stats(sym, {"col_0": {"HYPERLOGLOG"}, "col_1": {"HYPERLOGLOG", "MINMAX"}})
+    assert lib.get_column_stats_info(sym) == {"col_0": {"HYPERLOGLOG"}, "col_1": {"HYPERLOGLOG", "MINMAX"}}
+    # Counts at this scale are exact
+    assert lib.approx_nunique(sym, "col_0") == 4
+    assert lib.approx_nunique(sym, "col_1") == 6
+    assert lib.approx_nunique(sym, "col_1", date_range=(pd.Timestamp("2000-01-02"), pd.Timestamp("2000-01-03"))) == 4
+    assert lib.approx_nunique(sym, "col_1", date_range=(pd.Timestamp("2000-01-07"), None)) == 0
+
+    # Creating more stats keeps the existing sketches readable
+    lib.create_column_stats(sym, {"col_2": {"HYPERLOGLOG"}})
+    assert lib.approx_nunique(sym, "col_0") == 4
+    assert lib.approx_nunique(sym, "col_2") == 6
+
+    lib.drop_column_stats(sym, {"col_1": {"HYPERLOGLOG"}})
+    assert lib.get_column_stats_info(sym) == {"col_0": {"HYPERLOGLOG"}, "col_1": {"MINMAX"}, "col_2": {"HYPERLOGLOG"}}
+    with pytest.raises(UserInputException):
+        lib.approx_nunique(sym, "col_1")
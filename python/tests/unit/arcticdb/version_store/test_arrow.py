@@ -6,7 +6,7 @@ import pytest
 from pandas.testing import assert_frame_equal
 from arcticdb.version_store.processing import QueryBuilder
 import pyarrow as pa
-from arcticdb.util.test import get_sample_dataframe
+from arcticdb.util.test import get_sample_dataframe, config_context
 from arcticdb_ext.storage import KeyType
 from tests.util.mark import WINDOWS
 
@@ -121,6 +121,21 @@ def test_strings_multiple_segments_and_columns(lmdb_version_store_tiny_segment,
     assert_frame_equal(result, df)
 
 
+def test_strings_dictionary_encoded(lmdb_version_store_v2):
+    lib = lmdb_version_store_v2
+    num_rows = 1000
+    df = pd.DataFrame({
+        "side": [["buy", "sell", "cross"][i % 3] for i in range(num_rows)],
+        "order_id": [f"order_{i}" for i in range(num_rows)],
+    })
+    with config_context("Codec.DictionaryEncodeStrings", 1):
+        lib.write("arrow", df)
+    vit = lib.read("arrow", _output_format=OutputFormat.ARROW)
+    result = convert_pandas_categorical_to_str(vit.data.to_pandas())
+    assert_frame_equal(result, df)
+    assert_frame_equal(lib.read("arrow").data, df)
+
+
 # TODO: Fix unicode strings on windows
 @pytest.mark.skipif(WINDOWS, reason="Unicode arrow strings fail on windows")
 def test_all_types(lmdb_version_store_v1):
@@ -356,4 +371,40 @@ def test_arrow_layout(lmdb_version_store_tiny_segment):
         index_arr, int_arr, str_arr = record_batch.columns
         assert index_arr.type == pa.int64()
         assert int_arr.type == pa.int64()
-        assert str_arr.type == pa.dictionary(pa.int32(), pa.large_string())
\ No newline at end of file
+        assert str_arr.type == pa.dictionary(pa.int32(), pa.large_string())
+
+
+@pytest.mark.parametrize("row_slices_per_batch", [1, 2, 10])
+@pytest.mark.parametrize("prefetch", [0, 3])
+def test_read_record_batches(lmdb_version_store_tiny_segment, row_slices_per_batch, prefetch):
+    lib = lmdb_version_store_tiny_segment
+    df = pd.DataFrame(
+        {"x": np.arange(9), "y": np.arange(9, dtype=np.float64), "z": [f"s{i}" for i in range(9)]},
+        index=pd.date_range(pd.Timestamp(0), periods=9),
+    )
+    lib.write("arrow", df)
+    batches = list(lib.read_record_batches("arrow", row_slices_per_batch=row_slices_per_batch, prefetch=prefetch))
+    # One record batch per row-slice of 2 rows
+    assert len(batches) == 5
+    expected = lib.read("arrow", _output_format=OutputFormat.ARROW).data
+    assert pa.Table.from_batches(batches).equals(expected)
+
+    date_range = (pd.Timestamp(3), pd.Timestamp(6))
+    batches = lib.read_record_batches("arrow", date_range=date_range, columns=["y"], row_slices_per_batch=row_slices_per_batch, prefetch=prefetch)
+    expected = lib.read("arrow", date_range=date_range, columns=["y"], _output_format=OutputFormat.ARROW).data
+    assert pa.Table.from_batches(list(batches)).equals(expected)
+
+    batches = lib.read_record_batches("arrow", row_range=(1, 8), row_slices_per_batch=row_slices_per_batch, prefetch=prefetch)
+    expected = lib.read("arrow", row_range=(1, 8), _output_format=OutputFormat.ARROW).data
+    assert pa.Table.from_batches(list(batches)).equals(expected)
+
+
+def test_read_record_batches_stops_early(lmdb_version_store_tiny_segment):
+    lib = lmdb_version_store_tiny_segment
+    df = pd.DataFrame({"x": np.arange(100)})
+    lib.write("arrow", df)
+    batches = lib.read_record_batches("arrow", prefetch=4)
+    first = next(batches)
+    assert first.to_pandas()["x"].tolist() == [0, 1]
+    # Abandoning the iterator with reads in flight must be safe
+    del batches
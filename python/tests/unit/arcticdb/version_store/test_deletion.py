@@ -22,7 +22,7 @@ from arcticdb_ext.exceptions import InternalException
 from arcticdb_ext.storage import KeyType, NoDataFoundException
 from arcticdb_ext.version_store import ManualClockVersionStore
 from arcticdb.version_store._normalization import NPDDataFrame
-from arcticdb.util.test import sample_dataframe
+from arcticdb.util.test import sample_dataframe, config_context
 from arcticdb.version_store._store import resolve_defaults
 
 
@@ -507,3 +507,42 @@ def test_delete_date_range_pickled_symbol(lmdb_version_store):
     assert lmdb_version_store.is_symbol_pickled(symbol)
     with pytest.raises(InternalException) as e_info:
         lmdb_version_store.delete(symbol, (idx[1], idx[2]))
+
+
+def test_delete_paged_index(version_store_factory, sym):
+    lib = version_store_factory(segment_row_size=10)
+    lt = lib.library_tool()
+    df0 = pd.DataFrame({"col": np.arange(100)}, index=pd.date_range("2024-01-01", periods=100))
+    df1 = pd.DataFrame({"col": np.arange(100, 200)}, index=pd.date_range("2025-01-01", periods=100))
+    # Each version's index of ten data keys is written as four pages under a top-level index key
+    with config_context("VersionStore.IndexPageRows", 3):
+        lib.write(sym, df0)
+        lib.write(sym, df1)
+    assert len(lt.find_keys_for_id(KeyType.TABLE_INDEX, sym)) == 10
+
+    def data_key_hashes(version_id):
+        return {k.content_hash for k in lt.find_keys_for_id(KeyType.TABLE_DATA, sym) if k.version_id == version_id}
+
+    for version_id in (0, 1):
+        index = lib.read_index(sym, as_of=version_id)
+        assert len(index) == 10
+        assert (index["key_type"] == KeyType.TABLE_DATA.value).all()
+        assert set(index["content_hash"]) == data_key_hashes(version_id)
+    assert {v["version"] for v in lib.list_versions(sym)} == {0, 1}
+
+    lib.snapshot("snap", versions={sym: 0})
+    lib.delete_version(sym, 0)
+    assert {v["version"] for v in lib.list_versions(sym)} == {0, 1}
+    assert len(data_key_hashes(0)) == 10
+    assert_frame_equal(lib.read(sym, as_of="snap").data, df0)
+
+    lib.delete_snapshot("snap")
+    assert {v["version"] for v in lib.list_versions(sym)} == {1}
+    assert len(data_key_hashes(0)) == 0
+    assert len(lt.find_keys_for_id(KeyType.TABLE_INDEX, sym)) == 5
+
+    with config_context("VersionStore.IndexPageRows", 3):
+        lib.write(sym, df0, prune_previous_version=True)
+    assert len(data_key_hashes(1)) == 0
+    assert len(lt.find_keys_for_id(KeyType.TABLE_INDEX, sym)) == 5
+    assert_frame_equal(lib.read(sym).data, df0)
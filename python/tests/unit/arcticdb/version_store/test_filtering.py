@@ -18,6 +18,7 @@ import string
 import sys
 
 from arcticdb.exceptions import ArcticNativeException
+import arcticdb.toolbox.query_stats as qs
 from arcticdb.version_store.processing import QueryBuilder
 from arcticdb_ext.exceptions import InternalException, UserInputException
 from arcticdb.util.test import (
@@ -1372,6 +1373,40 @@ def test_filter_regex_match_basic(lmdb_version_store_v1, sym, dynamic_strings):
     assert_frame_equal(lib.read(sym, query_builder=q2_alt).data, expected2)
 
 
+def test_filter_string_functions(lmdb_version_store_tiny_segment, sym):
+    lib = lmdb_version_store_tiny_segment
+    df = pd.DataFrame(
+        {"a": ["Apple", "banana", None, "apricot", "Apple", "grape"], "b": np.arange(6)},
+        index=pd.date_range(pd.Timestamp(0), periods=6),
+    )
+    lib.write(sym, df, dynamic_strings=True)
+
+    q = QueryBuilder()
+    q = q[q["a"].startswith("Ap")]
+    assert_frame_equal(lib.read(sym, query_builder=q).data, df[df["a"].str.startswith("Ap", na=False)])
+
+    q = QueryBuilder()
+    q = q[q["a"].lower().startswith("ap")]
+    assert_frame_equal(lib.read(sym, query_builder=q).data, df[df["a"].str.lower().str.startswith("ap", na=False)])
+
+    # Unlike regex_match, contains matches literally
+    q = QueryBuilder()
+    q = q[q["a"].contains("an.") | q["a"].contains("ap")]
+    assert_frame_equal(lib.read(sym, query_builder=q).data, df[df["a"].str.contains("ap", regex=False, na=False)])
+
+    q = QueryBuilder()
+    q = q[q["a"].len() > 5]
+    assert_frame_equal(lib.read(sym, query_builder=q).data, df[df["a"].str.len() > 5])
+
+    q = QueryBuilder()
+    q = q[q["a"].substring(1, 2) == "pp"]
+    assert_frame_equal(lib.read(sym, query_builder=q).data, df[df["a"].str.slice(1, 3) == "pp"])
+
+    with pytest.raises(UserInputException):
+        q = QueryBuilder()
+        q = q[q["a"].startswith(1)]
+
+
 @pytest.mark.parametrize("dynamic_strings", [True, False])
 def test_filter_regex_match_empty_match(lmdb_version_store_v1, sym, dynamic_strings):
     lib = lmdb_version_store_v1
@@ -1476,3 +1511,31 @@ def test_filter_regex_comma_separated_strings(lmdb_version_store_v1, sym, dynami
     assert_frame_equal(expected, received)
     assert not expected.empty
 
+
+@pytest.mark.parametrize("late_materialisation", [0, 1])
+def test_filter_late_materialisation_column_sliced(lmdb_version_store_tiny_segment, sym, clear_query_stats, late_materialisation):
+    # 5 row-slices of 3 column-slices each, with the filter column in the first column-slice
+    lib = lmdb_version_store_tiny_segment
+    df = pd.DataFrame(
+        {col: np.arange(10, dtype=np.int64) + offset for offset, col in enumerate("abcdef")},
+        index=pd.date_range("2025-01-01", periods=10),
+    )
+    lib.write(sym, df)
+
+    q = QueryBuilder()
+    q = q[(q["a"] == 3) | (q["c"] > 100)]
+    with config_context("Filter.LateMaterialisation", late_materialisation):
+        qs.enable()
+        received = lib.read(sym, query_builder=q).data
+        qs.disable()
+    assert_frame_equal(df[(df["a"] == 3) | (df["c"] > 100)], received)
+
+    # With late materialisation only the two column-slices holding a and c are read for the row-slices with no
+    # matching rows
+    table_data_reads = qs.get_query_stats()["storage_operations"]["LMDB_Read"]["TABLE_DATA"]["count"]
+    assert table_data_reads == (11 if late_materialisation else 15)
+
+    q = QueryBuilder()
+    q = q[q["a"] < 0]
+    with config_context("Filter.LateMaterialisation", late_materialisation):
+        assert lib.read(sym, query_builder=q).data.empty
@@ -187,3 +187,34 @@ def test_project_fixed_value_dynamic(lmdb_version_store_dynamic_schema_v1, index
     q = QueryBuilder().apply("new_col", value)
     received = lib.read(sym, query_builder=q).data
     assert_frame_equal(expected, received, check_dtype=False)
+
+
+def test_project_string_functions(lmdb_version_store_tiny_segment):
+    lib = lmdb_version_store_tiny_segment
+    sym = "test_project_string_functions"
+    df = pd.DataFrame(
+        {"a": ["Apple", "caf\u00e9", None, "Apple", "kiwi"], "b": ["x", "y", "z", None, "x"]},
+        index=pd.date_range("2025-01-01", periods=5),
+    )
+    lib.write(sym, df, dynamic_strings=True)
+
+    def check_projection(expr_fn, expected_values):
+        q = QueryBuilder()
+        q = q.apply("new_col", expr_fn(q))
+        expected = df.copy()
+        expected["new_col"] = expected_values
+        assert_frame_equal(expected, lib.read(sym, query_builder=q).data)
+
+    check_projection(lambda q: q["a"].len(), [5.0, 4.0, np.nan, 5.0, 4.0])
+    # Only ASCII characters change case
+    check_projection(lambda q: q["a"].upper(), ["APPLE", "CAF\u00e9", None, "APPLE", "KIWI"])
+    check_projection(lambda q: q["a"].lower(), ["apple", "caf\u00e9", None, "apple", "kiwi"])
+    check_projection(lambda q: q["a"].substring(-3), ["ple", "af\u00e9", None, "ple", "iwi"])
+    check_projection(lambda q: q["a"].substring(1, 2), ["pp", "af", None, "pp", "iw"])
+    check_projection(lambda q: q["a"].concat("_1"), ["Apple_1", "caf\u00e9_1", None, "Apple_1", "kiwi_1"])
+    check_projection(lambda q: q["a"].concat(q["b"]), ["Applex", "caf\u00e9y", None, None, "kiwix"])
+    check_projection(lambda q: q["a"].lower().concat(q["b"].upper()), ["appleX", "caf\u00e9Y", None, None, "kiwiX"])
+
+    q = QueryBuilder()
+    with pytest.raises(UserInputException):
+        q.apply("new_col", q["a"].substring("1"))